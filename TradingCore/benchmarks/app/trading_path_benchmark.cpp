@@ -0,0 +1,185 @@
+/**============================================================================
+Name        : trading_path_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Interface-wired vs compile-time wired trading path.
+============================================================================**/
+
+/*
+    Cost per MarketEvent of the path from a BookUpdate to the order gateway:
+
+        virtual  - IBookUpdateHandler (BookBuilder) -> IMarketEventHandler
+                   (MarketEventHandler) -> IStrategy -> StrategyExecutor
+                   -> OrderManager -> IRiskManager -> IExecutionGateway;
+        inline   - InlineTradingPath with the same components as template
+                   parameters.
+
+    Every update changes the best bid quantity. One update in 64 makes the
+    book imbalanced enough for the strategy to send an order, the next one
+    restores the balance. Parsing is left out: it costs the same on both
+    paths and would hide the difference.
+*/
+
+#include "book_builder.hpp"
+#include "imbalance_strategy.hpp"
+#include "inline_trading_path.hpp"
+#include "market_data_parser.hpp"
+#include "market_event_handler.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <cstdint>
+#include <print>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::OrderId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::Timestamp;
+    using trading::app::InlineTradingPath;
+    using trading::execution::ExecutionReport;
+    using trading::execution::IExecutionGateway;
+    using trading::execution::Order;
+    using trading::execution::OrderManager;
+    using trading::execution::OrderStoreConfig;
+    using trading::execution::OrderStoreOverflow;
+    using trading::market_data::BasicBookBuilder;
+    using trading::market_data::BookStorage;
+    using trading::market_data::BookUpdate;
+    using trading::market_data::BookUpdates;
+    using trading::market_data::IBookUpdateHandler;
+    using trading::market_data::IMarketDataParser;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::MarketEventHandler;
+    using trading::market_data::OrderBook;
+    using trading::market_data::ParseResult;
+    using trading::market_data::TickOrderBook;
+    using trading::position::Position;
+    using trading::recording::IRecorder;
+    using trading::risk::RiskLimits;
+    using trading::risk::RiskManager;
+    using trading::strategy::ImbalanceStrategy;
+    using trading::strategy::StrategyExecutor;
+
+    constexpr std::size_t Iterations { 5'000'000 };
+    constexpr std::size_t SignalEvery { 64 };
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+    constexpr Price BestBid { 1'000'000'000'000 };
+    constexpr Price BestAsk { 1'000'001'000'000 };
+    constexpr Quantity Balanced { 500'000'000 };
+    constexpr Quantity Imbalanced { 5'000'000'000 };
+    constexpr Quantity OrderQuantity { 1'000 };
+
+    // No fills arrive: the oldest orders make room so every signal still creates an order.
+    constexpr OrderStoreConfig StoreConfig { .overflow = OrderStoreOverflow::RetireOldest };
+
+    struct CountingGateway final : IExecutionGateway
+    {
+        void send(const Order&) override {
+            ++sent;
+        }
+
+        void cancel(OrderId) override {
+        }
+
+        uint64_t sent { 0 };
+    };
+
+    struct NullRecorder final : IRecorder
+    {
+        void record(const MarketEvent&) override {}
+        void record(const ExecutionReport&) override {}
+    };
+
+    // Parsing is not measured, the inline path only needs the type.
+    struct NullParser final : IMarketDataParser
+    {
+        [[nodiscard]]
+        ParseResult parse(std::string_view, BookUpdates&) const override {
+            return ParseResult::Success;
+        }
+    };
+
+    [[nodiscard]]
+    std::vector<BookUpdate> bookUpdates()
+    {
+        std::vector<BookUpdate> updates;
+        updates.reserve(Iterations);
+
+        for (std::size_t index { 0 }; index < Iterations; ++index)
+        {
+            updates.push_back(BookUpdate {
+                .instrument = btcUsdt.id(),
+                .sequence = 101 + index,
+                .side = Side::Buy,
+                .price = BestBid,
+                .quantity = index % SignalEvery == 0 ? Imbalanced : Balanced
+            });
+        }
+        return updates;
+    }
+
+    template<BookStorage Book>
+    void compare(const std::string_view bookName, Book& virtualBook, Book& inlineBook)
+    {
+        const std::vector<BookUpdate> updates = bookUpdates();
+        const typename Book::Levels bids { { BestBid, Balanced } };
+        const typename Book::Levels asks { { BestAsk, Balanced } };
+        const RiskLimits limits { .maxOrderQuantity = Quantity { 100'000'000 } };
+
+        ImbalanceStrategy strategy {};
+        NullRecorder recorder;
+        NullParser parser;
+
+        CountingGateway virtualGateway;
+        RiskManager virtualRisk { limits };
+        Position virtualPosition { btcUsdt.id() };
+        OrderManager virtualOrders { virtualGateway, virtualRisk, virtualPosition, StoreConfig };
+        StrategyExecutor executor { virtualOrders, OrderQuantity };
+        MarketEventHandler eventHandler { strategy, executor, recorder };
+        BasicBookBuilder<Book> builder { btcUsdt.id(), virtualBook, eventHandler };
+        IBookUpdateHandler& updateHandler = builder;
+
+        CountingGateway inlineGateway;
+        RiskManager inlineRisk { limits };
+        Position inlinePosition { btcUsdt.id() };
+        OrderManager inlineOrders { inlineGateway, inlineRisk, inlinePosition, StoreConfig };
+        InlineTradingPath<NullParser, Book, ImbalanceStrategy, RiskManager, CountingGateway> path {
+            btcUsdt.id(), parser, inlineBook, strategy, inlineRisk, inlineGateway,
+            inlineOrders, inlinePosition, OrderQuantity
+        };
+
+        [[maybe_unused]] const bool builderReady = builder.applySnapshot(100, bids, asks, Timestamp {});
+        [[maybe_unused]] const bool pathReady = path.applySnapshot(100, bids, asks, Timestamp {});
+
+        std::println("Trading path per MarketEvent ({}):", bookName);
+        benchmark::run("virtual", Iterations, [&](const std::size_t index) {
+            updateHandler.onBookUpdates({ &updates[index], 1 });
+        });
+        benchmark::run("inline", Iterations, [&](const std::size_t index) {
+            path.onBookUpdates({ &updates[index], 1 });
+        });
+        std::println("    {:<16} {:>8} / {}", "orders sent", inlineGateway.sent, virtualGateway.sent);
+    }
+}
+
+void trading_path_benchmark()
+{
+    {
+        OrderBook virtualBook;
+        OrderBook inlineBook;
+        compare("OrderBook", virtualBook, inlineBook);
+    }
+    {
+        TickOrderBook virtualBook { btcUsdt };
+        TickOrderBook inlineBook { btcUsdt };
+        compare("TickOrderBook", virtualBook, inlineBook);
+    }
+}
@@ -0,0 +1,81 @@
+/**============================================================================
+Name        : replay_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Backtest replay throughput.
+============================================================================**/
+
+/*
+    ReplayEngine over one million synthetic MarketEvents: the book imbalance
+    swings every few events, so the strategy trades and the simulated
+    gateway fills on a regular part of them. Reports the time of one run
+    and the event rate of the last one.
+*/
+
+#include "replay_engine.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <print>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::backtest::ReplayEngine;
+    using trading::backtest::ReplayResult;
+    using trading::market_data::MarketEvent;
+
+    constexpr std::size_t EventCount { 1'000'000 };
+    constexpr std::size_t Runs { 5 };
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+    [[nodiscard]]
+    std::vector<MarketEvent> makeEvents()
+    {
+        std::vector<MarketEvent> events;
+        events.reserve(EventCount);
+
+        uint64_t state { 0x9E3779B97F4A7C15 };
+        Price::Value bid { 6'500'000'000'000 };
+        for (std::size_t index = 0; index < EventCount; ++index)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            bid += static_cast<Price::Value>((state >> 33) % 5) * 1'000'000 - 2'000'000;
+
+            events.push_back(MarketEvent {
+                .instrument = btcUsdt.id(),
+                .sequence = index + 1,
+                .bestBid = Price { bid },
+                .bestBidQuantity = Quantity { static_cast<Quantity::Value>(((state >> 40) % 10 + 1) * 100'000'000) },
+                .bestAsk = Price { bid + 1'000'000 },
+                .bestAskQuantity = Quantity { static_cast<Quantity::Value>(((state >> 50) % 10 + 1) * 100'000'000) }
+            });
+        }
+        return events;
+    }
+}
+
+void replay_benchmark()
+{
+    const std::vector<MarketEvent> events = makeEvents();
+    const ReplayEngine engine { btcUsdt };
+
+    ReplayResult result {};
+    std::println("Backtest replay ({} events per run):", EventCount);
+    benchmark::run("ReplayEngine run", Runs, [&](std::size_t) {
+        result = engine.run(events);
+        benchmark::doNotOptimize(result);
+    });
+
+    std::println("    {:.0f} events/s, {:.1f} ns/event, {} orders, {} fills, PnL {}",
+                 result.eventsPerSecond(),
+                 static_cast<double>(result.elapsedNanoseconds) / static_cast<double>(result.marketEvents),
+                 result.orders, result.fills,
+                 static_cast<double>(result.totalPnl().raw()) / 1e8);
+}
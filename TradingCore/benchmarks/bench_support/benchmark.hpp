@@ -0,0 +1,213 @@
+/**============================================================================
+Name        : benchmark.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : benchmark.hpp
+============================================================================**/
+
+/*
+    Two harnesses:
+
+        run()        mean ns/op of a tight loop, read from steady_clock once;
+        measure()    ns/op percentiles: every sample (one call, or a batch of
+                     calls for operations shorter than the timer) is timed
+                     with a fenced rdtsc and counted in a LatencyHistogram.
+
+    measure() and Sampler subtract the cost of an empty timed region, so a
+    sample shows the time of the operation only; samples shorter than the
+    timer resolution come out as zero. Percentiles are bucket upper bounds
+    (about 3% precision, see LatencyHistogram), mean and max are exact.
+
+    Every Sampler::report() appends a Result to results(), which main()
+    writes as CSV or JSON (see report.hpp).
+
+    Without an invariant TSC samples are read from steady_clock.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BENCHMARK_HPP
+#define FINANCETECHNOLOGYPROJECTS_BENCHMARK_HPP
+
+#include "latency_histogram.hpp"
+#include "tsc_clock.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace benchmark
+{
+    template<typename T>
+    inline void doNotOptimize(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /*
+        Calls operation(iteration) 'iterations' times and prints the mean
+        time per call.
+    */
+    template<typename Operation>
+    void run(const std::string_view name,
+             const std::size_t iterations,
+             Operation&& operation)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t iteration { 0 }; iteration < iterations; ++iteration)
+            operation(iteration);
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+        std::println("    {:<16} {:>8.2f} ns/op", name, elapsed / static_cast<double>(iterations));
+    }
+
+    // Nanoseconds per operation.
+    struct Result
+    {
+        std::string name;
+        std::size_t samples { 0 };
+        std::size_t operationsPerSample { 1 };
+        double mean { 0 };
+        double p50 { 0 };
+        double p99 { 0 };
+        double p999 { 0 };
+        double max { 0 };
+    };
+
+    [[nodiscard]]
+    inline std::vector<Result>& results()
+    {
+        static std::vector<Result> all;
+        return all;
+    }
+
+    class Sampler
+    {
+    public:
+        explicit Sampler(const std::string_view name, const std::size_t operationsPerSample = 1):
+            name { name },
+            operationsPerSample { std::max<std::size_t>(operationsPerSample, 1) }
+        {
+        }
+
+        template<typename Operation>
+        void time(Operation&& operation)
+        {
+            const uint64_t start = ticks();
+            operation();
+            const uint64_t elapsed = ticks() - start;
+
+            const uint64_t net = elapsed > overhead ? elapsed - overhead : 0;
+            histogram.record(net);
+            totalTicks += net;
+        }
+
+        // Prints the percentiles and appends them to results().
+        Result report() const
+        {
+            const trading::trace::LatencySummary summary = histogram.summary();
+            const double scale = nanosecondsPerTick() / static_cast<double>(operationsPerSample);
+            const auto perOperation = [scale](const uint64_t ticks) { return static_cast<double>(ticks) * scale; };
+
+            const Result result {
+                .name = name,
+                .samples = summary.count,
+                .operationsPerSample = operationsPerSample,
+                .mean = summary.count == 0 ? 0.0 : perOperation(totalTicks) / static_cast<double>(summary.count),
+                .p50 = perOperation(summary.p50),
+                .p99 = perOperation(summary.p99),
+                .p999 = perOperation(summary.p999),
+                .max = perOperation(summary.max)
+            };
+
+            std::println("    {:<28} {:>8.2f} ns/op   p50 {:>8.2f}   p99 {:>8.2f}   p99.9 {:>8.2f}   max {:>10.2f}",
+                         result.name, result.mean, result.p50, result.p99, result.p999, result.max);
+            results().push_back(result);
+            return result;
+        }
+
+        // Fenced counter read; steady_clock nanoseconds without an invariant TSC.
+        [[nodiscard]]
+        static uint64_t ticks() noexcept
+        {
+#if TRADING_CORE_HAS_TSC
+            if (useTsc()) [[likely]]
+            {
+                _mm_lfence();
+                const uint64_t value = __rdtsc();
+                _mm_lfence();
+                return value;
+            }
+#endif
+            return trading::TscClock::steadyNanoseconds();
+        }
+
+        [[nodiscard]]
+        static double nanosecondsPerTick() noexcept
+        {
+            static const double value = useTsc() ? 1.0 / trading::TscClock::instance().ticksPerNanosecond() : 1.0;
+            return value;
+        }
+
+    private:
+        [[nodiscard]]
+        static bool useTsc() noexcept
+        {
+            static const bool value = trading::TscClock::instance().isTscBased() &&
+                                      trading::TscClock::instance().ticksPerNanosecond() > 0.0;
+            return value;
+        }
+
+        // Cheapest of many empty timed regions.
+        [[nodiscard]]
+        static uint64_t timerOverhead() noexcept
+        {
+            static const uint64_t value = [] {
+                uint64_t cheapest { ~uint64_t { 0 } };
+                for (int attempt { 0 }; attempt < 10'000; ++attempt)
+                {
+                    const uint64_t start = ticks();
+                    cheapest = std::min(cheapest, ticks() - start);
+                }
+                return cheapest;
+            }();
+            return value;
+        }
+
+        std::string name;
+        std::size_t operationsPerSample;
+        uint64_t overhead { timerOverhead() };
+        uint64_t totalTicks { 0 };
+        trading::trace::LatencyHistogram histogram {};
+    };
+
+    /*
+        Times 'samples' samples of 'batch' calls of operation(iteration),
+        iteration = 0, 1, 2, ..., and reports ns per call. Nothing is run
+        untimed: warm up stateful operations before.
+    */
+    template<typename Operation>
+    Result measure(const std::string_view name,
+                   const std::size_t samples,
+                   Operation&& operation,
+                   const std::size_t batch = 1)
+    {
+        Sampler sampler { name, batch };
+        for (std::size_t sample { 0 }; sample < samples; ++sample)
+        {
+            sampler.time([&] {
+                for (std::size_t index { 0 }; index < batch; ++index)
+                    operation(sample * batch + index);
+            });
+        }
+        return sampler.report();
+    }
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BENCHMARK_HPP
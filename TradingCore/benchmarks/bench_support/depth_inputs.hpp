@@ -0,0 +1,135 @@
+/**============================================================================
+Name        : depth_inputs.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Benchmark inputs derived from a recorded Binance depth stream.
+============================================================================**/
+
+/*
+    Component benchmarks run on market data recorded from Binance rather
+    than on synthetic values, so that book depth, price levels and
+    top-of-book changes look like production:
+
+        resources/data/binance/depth.json
+               |
+               | BinanceMarketDataParser, one message per line
+               v
+        updates        - every BookUpdate of the recording, in order
+               |
+               | BookBuilder on an empty snapshot at snapshotSequence
+               v
+        events         - the MarketEvent of every applied message
+
+    replayed(index) repeats the updates endlessly: pass k shifts the
+    sequence numbers by k * sequenceSpan, so every pass continues the
+    sequence of the previous one and is applied to the same book.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_DEPTH_INPUTS_HPP
+#define FINANCETECHNOLOGYPROJECTS_DEPTH_INPUTS_HPP
+
+#include "binance_market_data_parser.hpp"
+#include "book_builder.hpp"
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+    inline constexpr std::array DepthInstruments {
+        trading::Instrument { trading::InstrumentId { 1 }, "BTCUSDT", trading::Price { 1'000'000 }, trading::Quantity { 1'000 } }
+    };
+
+    struct DepthInputs
+    {
+        trading::InstrumentId instrument { DepthInstruments.front().id() };
+        trading::SequenceNumber snapshotSequence { 0 };
+        trading::SequenceNumber sequenceSpan { 0 };
+
+        std::vector<trading::market_data::BookUpdate> updates;
+        std::vector<trading::market_data::MarketEvent> events;
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return updates.empty() || events.empty();
+        }
+
+        [[nodiscard]]
+        trading::market_data::BookUpdate replayed(const std::size_t index) const noexcept
+        {
+            trading::market_data::BookUpdate update = updates[index % updates.size()];
+            const trading::SequenceNumber shift = static_cast<trading::SequenceNumber>(index / updates.size()) * sequenceSpan;
+            if (update.firstSequence != 0)
+                update.firstSequence += shift;
+            update.sequence += shift;
+            return update;
+        }
+    };
+
+    [[nodiscard]]
+    inline DepthInputs loadDepthInputs()
+    {
+        using namespace trading::market_data;
+
+        struct Collector final : IMarketEventHandler
+        {
+            void onMarketEvent(const MarketEvent& event) override {
+                events.push_back(event);
+            }
+
+            std::vector<MarketEvent> events;
+        };
+
+        DepthInputs inputs;
+        const trading::exchanges::binance::BinanceMarketDataParser parser { DepthInstruments };
+
+        std::ifstream file { std::filesystem::path(TEST_DATA_PATH) / "binance" / "depth.json" };
+        std::string message;
+        BookUpdates parsed;
+        while (std::getline(file, message))
+        {
+            if (parser.parse(message, parsed) != ParseResult::Success)
+                continue;
+            inputs.updates.insert(inputs.updates.end(), parsed.begin(), parsed.end());
+        }
+        if (inputs.updates.empty())
+            return inputs;
+
+        const BookUpdate& first = inputs.updates.front();
+        inputs.snapshotSequence = (first.firstSequence != 0 ? first.firstSequence : first.sequence) - 1;
+        inputs.sequenceSpan = inputs.updates.back().sequence - inputs.snapshotSequence;
+
+        // One MarketEvent per message, as BookBuilder publishes them.
+        OrderBook book;
+        Collector collector;
+        BookBuilder builder { inputs.instrument, book, collector };
+        const bool _ = builder.applySnapshot(inputs.snapshotSequence, {}, {}, trading::Timestamp {});
+        collector.events.clear();
+
+        std::size_t begin { 0 };
+        for (std::size_t index { 1 }; index <= inputs.updates.size(); ++index)
+        {
+            if (index == inputs.updates.size() || inputs.updates[index].sequence != inputs.updates[begin].sequence)
+            {
+                builder.onBookUpdates(std::span { inputs.updates }.subspan(begin, index - begin));
+                begin = index;
+            }
+        }
+
+        // Only two-sided books are useful inputs for strategies and risk.
+        for (const MarketEvent& event : collector.events)
+        {
+            if (event.bestBid.isPositive() && event.bestAsk.isPositive())
+                inputs.events.push_back(event);
+        }
+        return inputs;
+    }
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_DEPTH_INPUTS_HPP
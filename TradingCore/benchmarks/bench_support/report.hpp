@@ -0,0 +1,123 @@
+/**============================================================================
+Name        : report.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : CSV / JSON output of benchmark results.
+============================================================================**/
+
+/*
+    Writes benchmark::results() for regression tracking. All times are
+    nanoseconds per operation.
+
+    CSV:
+
+        name,samples,operations_per_sample,mean_ns,p50_ns,p99_ns,p999_ns,max_ns
+        "OrderBook::applyUpdate",200000,1,41.20,38.91,95.33,180.02,5021.77
+
+        Names are always quoted; a quote inside a name is doubled ("").
+
+    JSON:
+
+        { "unit": "ns/op", "benchmarks": [ { "name": ..., "samples": ..., ... } ] }
+
+        Names are JSON strings with backslash escapes.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BENCHMARK_REPORT_HPP
+#define FINANCETECHNOLOGYPROJECTS_BENCHMARK_REPORT_HPP
+
+#include "benchmark.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace benchmark
+{
+    // RFC 4180 field: always quoted, an embedded quote is doubled.
+    [[nodiscard]]
+    inline std::string csvQuoted(const std::string_view text)
+    {
+        std::string result { '"' };
+        for (const char symbol : text)
+        {
+            if (symbol == '"')
+                result.push_back('"');
+            result.push_back(symbol);
+        }
+        result.push_back('"');
+        return result;
+    }
+
+    // JSON string: quote and backslash are escaped, control characters become \u00XX.
+    [[nodiscard]]
+    inline std::string jsonQuoted(const std::string_view text)
+    {
+        std::string result { '"' };
+        for (const char symbol : text)
+        {
+            if (symbol == '"' || symbol == '\\')
+            {
+                result.push_back('\\');
+                result.push_back(symbol);
+            }
+            else if (static_cast<unsigned char>(symbol) < 0x20)
+            {
+                constexpr std::string_view Digits { "0123456789abcdef" };
+                result += "\\u00";
+                result.push_back(Digits[static_cast<unsigned char>(symbol) >> 4]);
+                result.push_back(Digits[static_cast<unsigned char>(symbol) & 0x0F]);
+            }
+            else
+                result.push_back(symbol);
+        }
+        result.push_back('"');
+        return result;
+    }
+
+    [[nodiscard]]
+    inline bool writeCsv(const std::filesystem::path& path, const std::span<const Result> results)
+    {
+        std::ofstream file { path };
+        if (!file)
+            return false;
+
+        std::println(file, "name,samples,operations_per_sample,mean_ns,p50_ns,p99_ns,p999_ns,max_ns");
+        for (const Result& result : results)
+        {
+            std::println(file, "{},{},{},{:.2f},{:.2f},{:.2f},{:.2f},{:.2f}",
+                         csvQuoted(result.name), result.samples, result.operationsPerSample,
+                         result.mean, result.p50, result.p99, result.p999, result.max);
+        }
+        return static_cast<bool>(file);
+    }
+
+    [[nodiscard]]
+    inline bool writeJson(const std::filesystem::path& path, const std::span<const Result> results)
+    {
+        std::ofstream file { path };
+        if (!file)
+            return false;
+
+        std::println(file, "{{\n  \"unit\": \"ns/op\",\n  \"benchmarks\": [");
+        for (std::size_t index { 0 }; index < results.size(); ++index)
+        {
+            const Result& result = results[index];
+            std::println(file,
+                         "    {{ \"name\": {}, \"samples\": {}, \"operations_per_sample\": {}, "
+                         "\"mean\": {:.2f}, \"p50\": {:.2f}, \"p99\": {:.2f}, \"p999\": {:.2f}, \"max\": {:.2f} }}{}",
+                         jsonQuoted(result.name), result.samples, result.operationsPerSample,
+                         result.mean, result.p50, result.p99, result.p999, result.max,
+                         index + 1 < results.size() ? "," : "");
+        }
+        std::println(file, "  ]\n}}");
+        return static_cast<bool>(file);
+    }
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BENCHMARK_REPORT_HPP
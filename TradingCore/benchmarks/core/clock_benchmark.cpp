@@ -0,0 +1,49 @@
+/**============================================================================
+Name        : clock_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Timestamp source micro-benchmark.
+============================================================================**/
+
+/*
+    Compares the cost of taking a Timestamp:
+
+        now          - std::chrono::steady_clock (vDSO clock_gettime);
+        nowFast      - calibrated TSC (TscClock);
+        rdtsc        - the raw counter, lower bound for nowFast.
+*/
+
+#include "timestamp.hpp"
+#include "tsc_clock.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <cstdint>
+#include <print>
+
+namespace
+{
+    using trading::Timestamp;
+    using trading::TscClock;
+
+    constexpr std::size_t Iterations { 10'000'000 };
+}
+
+void clock_benchmark()
+{
+    const TscClock& clock = TscClock::instance();
+    std::println("Timestamp (TSC based: {}, {:.3f} ticks/ns):", clock.isTscBased(), clock.ticksPerNanosecond());
+
+    benchmark::run("now", Iterations, [](std::size_t) {
+        benchmark::doNotOptimize(Timestamp::now());
+    });
+    benchmark::run("nowFast", Iterations, [](std::size_t) {
+        benchmark::doNotOptimize(Timestamp::nowFast());
+    });
+#if TRADING_CORE_HAS_TSC
+    benchmark::run("rdtsc", Iterations, [](std::size_t) {
+        benchmark::doNotOptimize(__rdtsc());
+    });
+#endif
+}
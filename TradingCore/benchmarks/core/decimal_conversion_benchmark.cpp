@@ -0,0 +1,89 @@
+/**============================================================================
+Name        : decimal_conversion_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Decimal string conversion micro-benchmark.
+============================================================================**/
+
+/*
+    Compares the conversion of exchange decimal strings into a fixed-point
+    value:
+
+        stod          - std::stod, then scaling of the double (current parsers);
+        from_chars    - std::from_chars(double), then scaling of the double;
+        scalar        - parseDecimalScalar<8>;
+        fromDecimal   - Price::fromDecimalString (SIMD path when available).
+
+    The inputs are price / quantity strings taken from
+    resources/data/binance/depth.json.
+*/
+
+#include "price.hpp"
+#include "decimal_conversion.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using trading::Price;
+    using trading::details::DecimalRounding;
+    using trading::details::parseDecimalScalar;
+
+    constexpr std::size_t Iterations { 2'000'000 };
+
+    constexpr std::array<std::string_view, 16> Inputs {
+        "89218.34000000", "0.03110000", "80325.00000000", "0.00266000",
+        "71400.63000000", "0.14033000", "89309.47000000", "0.00000000",
+        "89277.57000000", "0.16817000", "89252.08000000", "0.00931000",
+        "89250.78000000", "0.34938000", "89241.48000000", "0.03009000"
+    };
+
+    template<typename Convert>
+    void run(const std::string_view name, Convert&& convert)
+    {
+        benchmark::run(name, Iterations, [&](const std::size_t iteration) {
+            const std::string_view text = Inputs[iteration % Inputs.size()];
+            benchmark::doNotOptimize(text);
+            benchmark::doNotOptimize(convert(text));
+        });
+    }
+
+    [[nodiscard]]
+    int64_t scaleDouble(const double value) noexcept
+    {
+        return std::llround(value * Price::Scale);
+    }
+}
+
+void decimal_conversion_benchmark()
+{
+    std::println("Decimal conversion ({} conversions):", Iterations);
+
+    run("stod", [](const std::string_view text) {
+        // std::stod needs a null-terminated string
+        return scaleDouble(std::stod(std::string { text }));
+    });
+
+    run("from_chars", [](const std::string_view text) {
+        double value { 0 };
+        std::from_chars(text.data(), text.data() + text.size(), value);
+        return scaleDouble(value);
+    });
+
+    run("scalar", [](const std::string_view text) {
+        return parseDecimalScalar<Price::DecimalPlaces>(text, DecimalRounding::Exact).value_or(0);
+    });
+
+    run("fromDecimal", [](const std::string_view text) {
+        return Price::fromDecimalString(text).value_or(Price {}).raw();
+    });
+}
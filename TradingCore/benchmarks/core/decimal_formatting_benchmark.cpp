@@ -0,0 +1,87 @@
+/**============================================================================
+Name        : decimal_formatting_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Decimal formatting micro-benchmark.
+============================================================================**/
+
+/*
+    Compares writing a fixed-point value as decimal text:
+
+        to_chars(double)    - conversion to double, then std::to_chars with
+                              fixed precision (current approach);
+        toChars             - ScaledValue::toChars, full precision;
+        toChars tick        - ScaledValue::toChars with the instrument price
+                              precision;
+        toChars trimmed     - ScaledValue::toChars without trailing zeros.
+
+    The values are prices / quantities taken from
+    resources/data/binance/depth.json.
+*/
+
+#include "instrument.hpp"
+#include "price.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <print>
+#include <string_view>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::details::DecimalFormat;
+
+    constexpr std::size_t Iterations { 2'000'000 };
+
+    constexpr Instrument instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+    constexpr std::array<Price, 8> Inputs {
+        Price { 8'921'834'000'000 }, Price { 8'032'500'000'000 }, Price { 7'140'063'000'000 }, Price { 8'930'947'000'000 },
+        Price { 8'927'757'000'000 }, Price { 8'925'208'000'000 }, Price { 8'925'078'000'000 }, Price { 8'924'148'000'000 }
+    };
+
+    template<typename Format>
+    void run(const std::string_view name, Format&& format)
+    {
+        std::array<char, Price::MaxChars + 8> buffer {};
+
+        benchmark::run(name, Iterations, [&](const std::size_t iteration) {
+            Price price = Inputs[iteration % Inputs.size()];
+            benchmark::doNotOptimize(price);
+            const auto result = format(price, buffer.data(), buffer.data() + buffer.size());
+            benchmark::doNotOptimize(result.ptr);
+            benchmark::doNotOptimize(buffer);
+        });
+    }
+}
+
+void decimal_formatting_benchmark()
+{
+    std::println("Decimal formatting ({} conversions):", Iterations);
+
+    run("to_chars(double)", [](const Price price, char* first, char* last) {
+        const double value = static_cast<double>(price.raw()) / Price::Scale;
+        return std::to_chars(first, last, value, std::chars_format::fixed, Price::DecimalPlaces);
+    });
+
+    run("toChars", [](const Price price, char* first, char* last) {
+        return price.toChars(first, last);
+    });
+
+    const DecimalFormat tick { .fractionDigits = instrument.priceDecimalPlaces() };
+    run("toChars tick", [&](const Price price, char* first, char* last) {
+        return price.toChars(first, last, tick);
+    });
+
+    run("toChars trimmed", [](const Price price, char* first, char* last) {
+        return price.toChars(first, last, { .trimTrailingZeros = true });
+    });
+}
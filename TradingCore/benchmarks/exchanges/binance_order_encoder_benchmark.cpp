@@ -0,0 +1,122 @@
+/**============================================================================
+Name        : binance_order_encoder_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Order to Binance request bytes latency percentiles.
+============================================================================**/
+
+/*
+    Cost of turning an Order into the parameters of a Binance new order
+    request, for limit orders at the top of book of the recorded depth
+    stream (depth_inputs.hpp):
+
+        string baseline                   - the request concatenated into a new
+                                            std::string, as a send handler had
+                                            to do before;
+        BinanceOrderEncoder::encode       - patch of the pre-rendered template;
+        BinanceExecutionGateway::send     - encode plus the wall clock read
+                                            and the call of the send handler.
+*/
+
+#include "binance_execution_gateway.hpp"
+#include "binance_order_encoder.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <array>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::OrderType;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::exchanges::binance::BinanceExecutionGateway;
+    using trading::exchanges::binance::BinanceOrderEncoder;
+    using trading::execution::Order;
+    using trading::market_data::MarketEvent;
+
+    constexpr std::size_t Samples { 200'000 };
+    constexpr uint64_t Now { 1'765'107'346'014 };
+
+    [[nodiscard]]
+    std::string formatRequest(const Instrument& instrument, const Order& order, const uint64_t timestamp)
+    {
+        std::array<char, 32> quantity {};
+        std::array<char, 32> price {};
+        const auto quantityEnd = order.quantity.toChars(quantity.data(), quantity.data() + quantity.size(),
+                                                        { .fractionDigits = instrument.quantityDecimalPlaces() });
+        const auto priceEnd = order.price.toChars(price.data(), price.data() + price.size(),
+                                                  { .fractionDigits = instrument.priceDecimalPlaces() });
+
+        std::string request { "symbol=" };
+        request += instrument.symbol();
+        request += order.side == Side::Buy ? "&side=BUY" : "&side=SELL";
+        request += "&type=LIMIT&timeInForce=GTC&newClientOrderId=";
+        request += std::to_string(order.clientOrderId);
+        request += "&timestamp=";
+        request += std::to_string(timestamp);
+        request += "&quantity=";
+        request.append(quantity.data(), quantityEnd.ptr);
+        request += "&price=";
+        request.append(price.data(), priceEnd.ptr);
+        return request;
+    }
+}
+
+void binance_order_encoder_benchmark()
+{
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+    {
+        std::println("Binance order encoding: cannot load depth.json");
+        return;
+    }
+
+    std::println("Binance order encoding ({} events of depth.json):", inputs.events.size());
+
+    const std::array instruments { benchmark::DepthInstruments[0] };
+
+    std::vector<Order> orders;
+    orders.reserve(inputs.events.size());
+    for (const MarketEvent& event : inputs.events)
+    {
+        const bool buy = orders.size() % 2 == 0;
+        orders.push_back(Order {
+            .clientOrderId = 1'000'000 + orders.size(),
+            .instrument = event.instrument,
+            .side = buy ? Side::Buy : Side::Sell,
+            .type = OrderType::Limit,
+            .price = buy ? event.bestAsk : event.bestBid,
+            .quantity = Quantity { 100'000 }
+        });
+    }
+
+    const std::size_t count = orders.size();
+    benchmark::measure("string baseline", Samples, [&](const std::size_t index) {
+        benchmark::doNotOptimize(formatRequest(instruments.front(), orders[index % count], Now + index));
+    });
+
+    BinanceOrderEncoder encoder { instruments };
+    uint64_t failed { 0 };
+    benchmark::measure("BinanceOrderEncoder::encode", Samples, [&](const std::size_t index) {
+        failed += encoder.encode(orders[index % count], Now + index).empty();
+    });
+
+    std::size_t bytes { 0 };
+    BinanceExecutionGateway gateway {
+        instruments,
+        [&bytes](const Order&, const std::span<const std::byte> request) { bytes += request.size(); },
+        {}
+    };
+    benchmark::measure("BinanceExecutionGateway::send", Samples, [&](const std::size_t index) {
+        gateway.send(orders[index % count]);
+    });
+
+    std::println("    {} failed, {} bytes sent", failed, bytes);
+}
@@ -0,0 +1,144 @@
+/**============================================================================
+Name        : binance_request_signer_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Binance request signing latency percentiles.
+============================================================================**/
+
+/*
+    Cost of signing Binance new order requests of the recorded depth stream
+    (depth_inputs.hpp, limit orders at the top of book, ~140 bytes):
+
+        HMAC from the key                 - key pads hashed on every call and
+                                            the hex string allocated, as a
+                                            signature computed from scratch;
+        HmacSha256::sign                  - HMAC from the precomputed midstates;
+        appendSignature                   - the same plus the SIMD hex digits
+                                            appended in place (timed with the
+                                            copy of the request into the buffer);
+        BinanceOrderEncoder::encode       - Order to signed request bytes.
+*/
+
+#include "binance_order_encoder.hpp"
+#include "binance_request_signer.hpp"
+#include "hmac_sha256.hpp"
+#include "sha256.hpp"
+#include "HexConverter.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using trading::OrderType;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::crypto::HmacSha256;
+    using trading::crypto::Sha256;
+    using trading::exchanges::binance::BinanceOrderEncoder;
+    using trading::exchanges::binance::BinanceRequestSigner;
+    using trading::execution::Order;
+    using trading::market_data::MarketEvent;
+
+    constexpr std::size_t Samples { 200'000 };
+    constexpr uint64_t Now { 1'765'107'346'014 };
+    constexpr std::string_view SecretKey { "NhqPtmdSJYdKjVHjA7PZj4Mge3R5YNiP1e3UZjInClVN65XAbvqqM6A7H5fATj0j" };
+
+    [[nodiscard]]
+    std::string signFromKey(const std::string_view key, const std::string_view payload)
+    {
+        std::array<std::byte, Sha256::BlockSize> innerPad {};
+        std::array<std::byte, Sha256::BlockSize> outerPad {};
+        for (std::size_t index { 0 }; index < key.size(); ++index)
+        {
+            innerPad[index] = static_cast<std::byte>(key[index]);
+            outerPad[index] = static_cast<std::byte>(key[index]);
+        }
+        for (std::size_t index { 0 }; index < Sha256::BlockSize; ++index)
+        {
+            innerPad[index] ^= std::byte { 0x36 };
+            outerPad[index] ^= std::byte { 0x5c };
+        }
+
+        Sha256 inner;
+        inner.update(innerPad);
+        inner.update(std::as_bytes(std::span { payload }));
+        const Sha256::Digest innerDigest = inner.finish();
+
+        Sha256 outer;
+        outer.update(outerPad);
+        outer.update(innerDigest);
+        const Sha256::Digest digest = outer.finish();
+
+        return HexConverter::bytesToHexStr(reinterpret_cast<const char*>(digest.data()), digest.size());
+    }
+}
+
+void binance_request_signer_benchmark()
+{
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+    {
+        std::println("Binance request signing: cannot load depth.json");
+        return;
+    }
+
+    const std::array instruments { benchmark::DepthInstruments[0] };
+    BinanceOrderEncoder encoder { instruments };
+
+    std::vector<Order> orders;
+    std::vector<std::string> payloads;
+    orders.reserve(inputs.events.size());
+    payloads.reserve(inputs.events.size());
+    for (const MarketEvent& event : inputs.events)
+    {
+        const bool buy = orders.size() % 2 == 0;
+        const Order& order = orders.emplace_back(Order {
+            .clientOrderId = 1'000'000 + orders.size(),
+            .instrument = event.instrument,
+            .side = buy ? Side::Buy : Side::Sell,
+            .type = OrderType::Limit,
+            .price = buy ? event.bestAsk : event.bestBid,
+            .quantity = Quantity { 100'000 }
+        });
+
+        const std::span<const std::byte> request = encoder.encode(order, Now);
+        payloads.emplace_back(reinterpret_cast<const char*>(request.data()), request.size());
+    }
+
+    std::println("Binance request signing ({} requests of depth.json, {} bytes):",
+                 payloads.size(), payloads.front().size());
+
+    const std::size_t count = payloads.size();
+    benchmark::measure("HMAC from the key", Samples, [&](const std::size_t index) {
+        benchmark::doNotOptimize(signFromKey(SecretKey, payloads[index % count]));
+    });
+
+    const HmacSha256 hmac { std::as_bytes(std::span { SecretKey }) };
+    benchmark::measure("HmacSha256::sign", Samples, [&](const std::size_t index) {
+        benchmark::doNotOptimize(hmac.sign(std::as_bytes(std::span { payloads[index % count] })));
+    });
+
+    const BinanceRequestSigner signer { SecretKey };
+    std::array<char, BinanceOrderEncoder::BufferSize> buffer {};
+    std::size_t failed { 0 };
+    benchmark::measure("BinanceRequestSigner::appendSignature", Samples, [&](const std::size_t index) {
+        const std::string& payload = payloads[index % count];
+        std::ranges::copy(payload, buffer.begin());
+        failed += signer.appendSignature(buffer, payload.size()) == 0;
+    });
+
+    benchmark::measure("BinanceOrderEncoder::encode signed", Samples, [&](const std::size_t index) {
+        failed += encoder.encode(orders[index % count], Now + index, &signer).empty();
+    });
+
+    std::println("    {} failed", failed);
+}
@@ -0,0 +1,131 @@
+/**============================================================================
+Name        : order_manager_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : OrderManager::createOrder / applyExecution latency percentiles.
+============================================================================**/
+
+/*
+    Order lifecycle cost on the recorded depth stream (depth_inputs.hpp):
+
+        OrderManager::createOrder     - risk check, OrderStore insert, risk
+                                        reservation, send to a null gateway;
+        OrderManager::applyExecution  - a full fill of that order: store
+                                        lookup, Position update, release of
+                                        the reservation, retirement.
+
+    Orders alternate between a buy at the best ask and a sell at the best
+    bid of consecutive events, so the position stays within the limits.
+    Every order is filled before the next one is created: the store holds
+    one live order and its history ring is full after the first pass.
+*/
+
+#include "order_manager.hpp"
+#include "risk_manager.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <cstdint>
+#include <print>
+
+namespace
+{
+    using trading::ExecType;
+    using trading::OrderId;
+    using trading::OrderStatus;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::execution::ExecutionReport;
+    using trading::execution::IExecutionGateway;
+    using trading::execution::Order;
+    using trading::execution::OrderCreationResult;
+    using trading::execution::OrderManager;
+    using trading::execution::OrderRequest;
+    using trading::market_data::MarketEvent;
+    using trading::position::Position;
+    using trading::risk::RiskLimits;
+    using trading::risk::RiskManager;
+
+    constexpr std::size_t Samples { 200'000 };
+
+    constexpr RiskLimits Limits {
+        .maxOrderQuantity = Quantity { 100'000'000 },
+        .maxPositionQuantity = Quantity { 500'000'000 },
+        .maxNotional = Price { 100'000'000'000'000 }
+    };
+
+    struct NullGateway final : IExecutionGateway
+    {
+        void send(const Order& order) override {
+            benchmark::doNotOptimize(order);
+        }
+
+        void cancel(OrderId) override {}
+    };
+}
+
+void order_manager_benchmark()
+{
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+    {
+        std::println("OrderManager: cannot load depth.json");
+        return;
+    }
+
+    std::println("OrderManager ({} events of depth.json):", inputs.events.size());
+
+    NullGateway gateway;
+    RiskManager riskManager { Limits };
+    Position position { inputs.instrument };
+    OrderManager orderManager { gateway, riskManager, position };
+
+    benchmark::Sampler create { "OrderManager::createOrder" };
+    benchmark::Sampler execute { "OrderManager::applyExecution" };
+    uint64_t failed { 0 };
+
+    for (std::size_t index { 0 }; index < Samples; ++index)
+    {
+        const MarketEvent& event = inputs.events[index % inputs.events.size()];
+        const bool buy = index % 2 == 0;
+        const OrderRequest request {
+            .instrument = event.instrument,
+            .side = buy ? Side::Buy : Side::Sell,
+            .type = OrderType::Limit,
+            .price = buy ? event.bestAsk : event.bestBid,
+            .quantity = Quantity { 1'000'000 }
+        };
+
+        OrderCreationResult result;
+        create.time([&] { result = orderManager.createOrder(request); });
+        if (!result)
+        {
+            ++failed;
+            continue;
+        }
+
+        const ExecutionReport report {
+            .clientOrderId = *result,
+            .exchangeOrderId = *result,
+            .instrument = request.instrument,
+            .side = request.side,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::Filled,
+            .price = request.price,
+            .quantity = request.quantity,
+            .filledQuantity = request.quantity
+        };
+        bool applied { false };
+        execute.time([&] { applied = orderManager.applyExecution(report); });
+        if (!applied)
+            ++failed;
+    }
+
+    create.report();
+    execute.report();
+    std::println("    {} failed, final position {}", failed, position.quantity());
+}
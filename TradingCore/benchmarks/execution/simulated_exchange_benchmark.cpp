@@ -0,0 +1,171 @@
+/**============================================================================
+Name        : simulated_exchange_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Order flow soak against SimulatedExecutionGateway.
+============================================================================**/
+
+/*
+    OrderManager and PositionManager under a steady order flow, with the
+    exchange played by SimulatedExecutionGateway in front of a live
+    OrderBook:
+
+        4096 buys of 0.01 rest on 64 bid levels, each behind 1 unit of
+        market quantity. Every book change moves the quantity of one level
+        between 1 and 0.5 units; the decreases walk through the queues and
+        fill the orders, every fill is applied through
+        ExecutionReportHandler and replaced by a new order at the same
+        level, so the number of resting orders stays at 4096.
+
+        no fill      - quantity changes of an ask level without resting
+                       orders: the cost of a book change seen by the gateway;
+        soak         - the flow above, per book change, reports included.
+*/
+
+#include "execution_report_handler.hpp"
+#include "order_manager.hpp"
+#include "position_manager.hpp"
+#include "risk_manager.hpp"
+#include "simulated_execution_gateway.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <print>
+#include <vector>
+
+namespace
+{
+    using trading::InstrumentId;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Side;
+    using trading::ExecType;
+    using trading::execution::ExecutionReport;
+    using trading::execution::ExecutionReportHandler;
+    using trading::execution::OrderManager;
+    using trading::execution::OrderRequest;
+    using trading::execution::OrderStoreConfig;
+    using trading::execution::SimulatedExecutionGateway;
+    using trading::market_data::BookUpdate;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::OrderBook;
+    using trading::position::Position;
+    using trading::position::PositionManager;
+    using trading::recording::IRecorder;
+    using trading::risk::RiskManager;
+
+    constexpr std::size_t Iterations { 1'000'000 };
+    constexpr std::size_t Levels { 64 };
+    constexpr std::size_t OrdersPerLevel { 64 };
+
+    constexpr InstrumentId Instrument { 1 };
+    constexpr Quantity OrderQuantity { 1'000'000 };
+
+    struct NullRecorder final : IRecorder
+    {
+        void record(const MarketEvent&) override {}
+        void record(const ExecutionReport&) override {}
+    };
+
+    [[nodiscard]]
+    Price levelPrice(const std::size_t level)
+    {
+        return Price { static_cast<Price::Value>(9'000'000'000 + level * 1'000'000) };
+    }
+
+    class Exchange
+    {
+    public:
+        Exchange():
+            orderManager { gateway, riskManager, position, OrderStoreConfig { .capacity = 8192, .historyCapacity = 8192 } },
+            reportHandler { orderManager, positionManager, recorder }
+        {
+            book.replace(sequence, {}, {});
+            gateway.setOrderBook(Instrument, book);
+
+            update(Side::Sell, Price { 10'000'000'000 }, Quantity { 100'000'000 });
+            for (std::size_t level = 0; level < Levels; ++level)
+                update(Side::Buy, levelPrice(level), Quantity { 100'000'000 });
+
+            for (std::size_t index = 0; index < OrdersPerLevel; ++index)
+                for (std::size_t level = 0; level < Levels; ++level)
+                    place(levelPrice(level));
+            deliver();
+        }
+
+        void update(const Side side, const Price price, const Quantity quantity)
+        {
+            const BookUpdate bookUpdate {
+                .instrument = Instrument,
+                .sequence = ++sequence,
+                .side = side,
+                .price = price,
+                .quantity = quantity
+            };
+            const bool _ = book.applyUpdate(bookUpdate);
+            gateway.onBookUpdate(bookUpdate);
+        }
+
+        // Applies the reports and replaces every filled order.
+        void deliver()
+        {
+            fills += gateway.deliverReports([this](const ExecutionReport& report) {
+                const bool _ = reportHandler.onExecutionReport(report);
+                if (report.execType == ExecType::Trade && report.status == trading::OrderStatus::Filled)
+                    place(report.price);
+            });
+        }
+
+        [[nodiscard]]
+        const SimulatedExecutionGateway& simulator() const noexcept
+        {
+            return gateway;
+        }
+
+        std::size_t fills { 0 };
+
+    private:
+        void place(const Price price)
+        {
+            const auto _ = orderManager.createOrder(OrderRequest {
+                .instrument = Instrument,
+                .side = Side::Buy,
+                .type = OrderType::Limit,
+                .price = price,
+                .quantity = OrderQuantity
+            });
+        }
+
+        NullRecorder recorder;
+        OrderBook book;
+        SimulatedExecutionGateway gateway;
+        RiskManager riskManager;
+        Position position { Instrument };
+        PositionManager positionManager;
+        OrderManager orderManager;
+        ExecutionReportHandler reportHandler;
+        SequenceNumber sequence { 1 };
+    };
+}
+
+void simulated_exchange_benchmark()
+{
+    Exchange exchange;
+
+    std::println("Simulated exchange ({} resting orders):", exchange.simulator().restingOrderCount());
+    benchmark::run("no fill", Iterations, [&](const std::size_t iteration) {
+        exchange.update(Side::Sell, Price { 10'000'000'000 }, Quantity { static_cast<Quantity::Value>(100'000'000 + (iteration & 1) * 50'000'000) });
+        exchange.deliver();
+    });
+
+    benchmark::run("soak", Iterations, [&](const std::size_t iteration) {
+        const std::size_t level = (iteration >> 1) % Levels;
+        exchange.update(Side::Buy, levelPrice(level), Quantity { static_cast<Quantity::Value>(100'000'000 - (iteration & 1) * 50'000'000) });
+        exchange.deliver();
+    });
+
+    std::println("    {} fills, {} resting orders", exchange.fills, exchange.simulator().restingOrderCount());
+}
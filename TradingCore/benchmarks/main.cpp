@@ -0,0 +1,121 @@
+/**============================================================================
+Name        : main.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : TradingCore benchmarks
+============================================================================**/
+
+/*
+    Usage:
+
+        TradingCoreBench [--csv <file>] [--json <file>] [benchmark ...]
+
+    Runs the named benchmarks (all without names) and writes the percentile
+    results (benchmark::measure / Sampler) to the given files, e.g.
+
+        TradingCoreBench order_book order_manager --csv before.csv
+*/
+
+#include "bench_support/benchmark.hpp"
+#include "bench_support/report.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <print>
+#include <string_view>
+#include <vector>
+
+
+void decimal_conversion_benchmark();
+void decimal_formatting_benchmark();
+void clock_benchmark();
+void market_data_replay_benchmark();
+void order_book_benchmark();
+void imbalance_strategy_benchmark();
+void trading_path_benchmark();
+void risk_check_benchmark();
+void order_manager_benchmark();
+void pnl_calculator_benchmark();
+void mark_to_market_benchmark();
+void journal_benchmark();
+void replay_benchmark();
+void simulated_exchange_benchmark();
+void binance_order_encoder_benchmark();
+void binance_request_signer_benchmark();
+
+namespace
+{
+    struct Benchmark
+    {
+        std::string_view name;
+        void (*run)();
+    };
+
+    constexpr std::array benchmarks {
+        Benchmark { "decimal_conversion", decimal_conversion_benchmark },
+        Benchmark { "decimal_formatting", decimal_formatting_benchmark },
+        Benchmark { "clock", clock_benchmark },
+        Benchmark { "market_data_replay", market_data_replay_benchmark },
+        Benchmark { "order_book", order_book_benchmark },
+        Benchmark { "imbalance_strategy", imbalance_strategy_benchmark },
+        Benchmark { "trading_path", trading_path_benchmark },
+        Benchmark { "risk_check", risk_check_benchmark },
+        Benchmark { "order_manager", order_manager_benchmark },
+        Benchmark { "pnl_calculator", pnl_calculator_benchmark },
+        Benchmark { "mark_to_market", mark_to_market_benchmark },
+        Benchmark { "journal", journal_benchmark },
+        Benchmark { "replay", replay_benchmark },
+        Benchmark { "simulated_exchange", simulated_exchange_benchmark },
+        Benchmark { "binance_order_encoder", binance_order_encoder_benchmark },
+        Benchmark { "binance_request_signer", binance_request_signer_benchmark }
+    };
+}
+
+int main(const int argc, char** argv)
+{
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+
+    std::string_view csvPath;
+    std::string_view jsonPath;
+    std::vector<std::string_view> selected;
+    for (std::size_t index = 0; index < args.size(); ++index)
+    {
+        if (args[index] == "--csv" && index + 1 < args.size())
+            csvPath = args[++index];
+        else if (args[index] == "--json" && index + 1 < args.size())
+            jsonPath = args[++index];
+        else
+            selected.push_back(args[index]);
+    }
+
+    for (const std::string_view name : selected)
+    {
+        if (std::ranges::none_of(benchmarks, [name](const Benchmark& entry) { return entry.name == name; }))
+        {
+            std::println("Unknown benchmark '{}'", name);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (const Benchmark& entry : benchmarks)
+    {
+        if (selected.empty() || std::ranges::find(selected, entry.name) != selected.end())
+            entry.run();
+    }
+
+    if (!csvPath.empty() && !benchmark::writeCsv(csvPath, benchmark::results()))
+    {
+        std::println("Cannot write {}", csvPath);
+        return EXIT_FAILURE;
+    }
+    if (!jsonPath.empty() && !benchmark::writeJson(jsonPath, benchmark::results()))
+    {
+        std::println("Cannot write {}", jsonPath);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
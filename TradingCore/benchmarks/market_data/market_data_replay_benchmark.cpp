@@ -0,0 +1,124 @@
+/**============================================================================
+Name        : market_data_replay_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Market-data path throughput test.
+============================================================================**/
+
+/*
+    Replays resources/data/binance/depth.json as fast as possible through
+    the market-data path and reports msgs/s and ns/msg:
+
+        FileReplayMarketDataSource
+               |
+               v
+        MarketDataMessageHandler ---> BinanceMarketDataParser
+               |
+               v
+        BookRegistry ---> BookBuilder ---> OrderBook
+               |
+               v
+        counting IMarketEventHandler
+
+    Before every pass the book is reset with an empty snapshot that ends
+    right before the first update of the recording, so that all depth
+    updates pass the sequence checks and are applied.
+*/
+
+#include "binance_market_data_parser.hpp"
+#include "book_registry.hpp"
+#include "file_replay_market_data_source.hpp"
+#include "market_data_message_handler.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <print>
+#include <string>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Timestamp;
+    using trading::exchanges::binance::BinanceMarketDataParser;
+    using trading::market_data::BookRegistry;
+    using trading::market_data::BookUpdates;
+    using trading::market_data::FileReplayMarketDataSource;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketDataMessageHandler;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::ParseResult;
+    using trading::market_data::ReplayStatistics;
+
+    constexpr uint32_t Passes { 50 };
+
+    constexpr std::array instruments {
+        Instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } }
+    };
+
+    [[nodiscard]]
+    SequenceNumber firstSequence(const std::filesystem::path& path, const BinanceMarketDataParser& parser)
+    {
+        std::ifstream file { path };
+        std::string message;
+        std::getline(file, message);
+
+        BookUpdates updates;
+        if (parser.parse(message, updates) != ParseResult::Success || updates.empty())
+            return 0;
+        return updates.front().firstSequence;
+    }
+
+    struct CountingEventHandler final : IMarketEventHandler
+    {
+        void onMarketEvent(const MarketEvent&) override {
+            ++events;
+        }
+
+        uint64_t events { 0 };
+    };
+}
+
+void market_data_replay_benchmark()
+{
+    const std::filesystem::path path = std::filesystem::path(TEST_DATA_PATH) / "binance" / "depth.json";
+
+    CountingEventHandler eventHandler;
+    BookRegistry bookRegistry { instruments, eventHandler };
+    BinanceMarketDataParser parser { instruments };
+    MarketDataMessageHandler messageHandler { parser, bookRegistry };
+
+    FileReplayMarketDataSource source { path.string() };
+    if (!source.isOpen())
+    {
+        std::println("Market-data replay: cannot open {}", path.string());
+        return;
+    }
+
+    const SequenceNumber snapshotSequence = firstSequence(path, parser) - 1;
+    source.setMessageHandler(messageHandler);
+
+    ReplayStatistics statistics {};
+    for (uint32_t pass { 0 }; pass < Passes; ++pass)
+    {
+        const bool _ = bookRegistry.builder(instruments.front().id())->applySnapshot(
+            snapshotSequence, {}, {}, Timestamp {});
+
+        source.start();
+        statistics.messages += source.statistics().messages;
+        statistics.elapsedNanoseconds += source.statistics().elapsedNanoseconds;
+    }
+
+    std::println("Market-data replay ({} x {} KB):", Passes, source.fileSize() / 1024);
+    std::println("    {:<16} {:>12}", "messages", statistics.messages);
+    std::println("    {:<16} {:>12}", "market events", eventHandler.events);
+    std::println("    {:<16} {:>12.0f}", "msgs/s", statistics.messagesPerSecond());
+    std::println("    {:<16} {:>12.2f}", "ns/msg", statistics.nanosecondsPerMessage());
+}
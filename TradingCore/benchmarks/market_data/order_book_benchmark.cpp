@@ -0,0 +1,78 @@
+/**============================================================================
+Name        : order_book_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : OrderBook / BookBuilder update latency percentiles.
+============================================================================**/
+
+/*
+    Latency of one BookUpdate of the recorded depth stream (depth_inputs.hpp):
+
+        OrderBook::applyUpdate     - sequence check + level update;
+        BookBuilder::onBookUpdate  - the same plus top of book and the
+                                     MarketEvent handed to a counting handler.
+
+    Every sample is one update; the updates are replayed Passes times on one
+    book. The timed region includes the copy of the update that shifts its
+    sequence numbers (a few ns).
+*/
+
+#include "book_builder.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <cstdint>
+#include <print>
+
+namespace
+{
+    using trading::Timestamp;
+    using trading::market_data::BookBuilder;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::OrderBook;
+
+    constexpr std::size_t Passes { 4 };
+
+    struct CountingEventHandler final : IMarketEventHandler
+    {
+        void onMarketEvent(const MarketEvent&) override {
+            ++events;
+        }
+
+        uint64_t events { 0 };
+    };
+}
+
+void order_book_benchmark()
+{
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+    {
+        std::println("Order book: cannot load depth.json");
+        return;
+    }
+
+    const std::size_t samples = Passes * inputs.updates.size();
+    std::println("Order book ({} updates of depth.json x {}):", inputs.updates.size(), Passes);
+
+    OrderBook book;
+    book.replace(inputs.snapshotSequence, {}, {});
+    uint64_t rejected { 0 };
+    benchmark::measure("OrderBook::applyUpdate", samples, [&](const std::size_t index) {
+        if (!book.applyUpdate(inputs.replayed(index)))
+            ++rejected;
+    });
+
+    OrderBook builderBook;
+    CountingEventHandler handler;
+    BookBuilder builder { inputs.instrument, builderBook, handler };
+    const bool _ = builder.applySnapshot(inputs.snapshotSequence, {}, {}, Timestamp {});
+    benchmark::measure("BookBuilder::onBookUpdate", samples, [&](const std::size_t index) {
+        builder.onBookUpdate(inputs.replayed(index));
+    });
+
+    std::println("    {} rejected updates, {} market events", rejected, handler.events);
+}
@@ -0,0 +1,97 @@
+/**============================================================================
+Name        : mark_to_market_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Portfolio unrealized PnL micro-benchmark.
+============================================================================**/
+
+/*
+    Unrealized PnL of a 64-instrument portfolio on every tick:
+
+        per position  - PositionManager::find() + calculateUnrealized() for
+                        every instrument (__int128 arithmetic);
+        markToMarket  - one pass over the PositionManager columns.
+*/
+
+#include "pnl_calculator.hpp"
+#include "position_manager.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <optional>
+#include <print>
+#include <vector>
+
+namespace
+{
+    using trading::ExchangeOrderId;
+    using trading::ExecType;
+    using trading::InstrumentId;
+    using trading::OrderId;
+    using trading::OrderStatus;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::execution::ExecutionReport;
+    using trading::market_data::MarketEvent;
+    using trading::pnl::PnLCalculator;
+    using trading::position::Position;
+    using trading::position::PositionManager;
+
+    constexpr std::size_t Iterations { 1'000'000 };
+    constexpr std::size_t InstrumentCount { 64 };
+}
+
+void mark_to_market_benchmark()
+{
+    PositionManager positions {};
+    std::vector<Price> bids(InstrumentCount);
+    std::vector<Price> asks(InstrumentCount);
+    std::vector<Price> unrealized(InstrumentCount);
+
+    for (std::size_t index = 0; index < InstrumentCount; ++index)
+    {
+        const auto instrument = static_cast<InstrumentId>(index + 1);
+        const Price entry { static_cast<Price::Value>(1'000'000'000'000 + index * 100'000'000) };
+
+        const Quantity quantity { static_cast<Quantity::Value>(10'000'000 + index * 1'000) };
+
+        const bool _ = positions.applyExecution(ExecutionReport {
+            .clientOrderId = OrderId { index + 1 },
+            .exchangeOrderId = ExchangeOrderId { index + 1 },
+            .instrument = instrument,
+            .side = index % 2 == 0 ? Side::Buy : Side::Sell,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::Filled,
+            .price = entry,
+            .quantity = quantity,
+            .filledQuantity = quantity
+        });
+
+        bids[index] = entry + Price { 50'000'000 };
+        asks[index] = bids[index] + Price { 1'000'000 };
+    }
+
+    std::println("Portfolio unrealized PnL ({} instruments):", InstrumentCount);
+    benchmark::run("per position", Iterations, [&](const std::size_t iteration) {
+        Price total {};
+        for (std::size_t slot = 0; slot < InstrumentCount; ++slot)
+        {
+            const std::optional<Position> position = positions.find(positions.instruments()[slot]);
+            const MarketEvent event {
+                .instrument = position->instrumentId(),
+                .bestBid = bids[slot] + Price { static_cast<Price::Value>(iteration & 0xFF) },
+                .bestBidQuantity = Quantity { 100'000'000 },
+                .bestAsk = asks[slot],
+                .bestAskQuantity = Quantity { 100'000'000 }
+            };
+            total += PnLCalculator::calculateUnrealized(*position, event);
+        }
+        benchmark::doNotOptimize(total);
+    });
+    benchmark::run("markToMarket", Iterations, [&](const std::size_t iteration) {
+        bids[iteration % InstrumentCount] += Price { 1 };
+        benchmark::doNotOptimize(PnLCalculator::markToMarket(positions, bids, asks, unrealized));
+    });
+}
@@ -0,0 +1,83 @@
+/**============================================================================
+Name        : pnl_calculator_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : PnLCalculator latency percentiles.
+============================================================================**/
+
+/*
+    PnLCalculator on the recorded depth stream (depth_inputs.hpp), for a
+    long position opened at the first event:
+
+        calculateRealized    - a sell fill at the best bid of the event;
+        calculateUnrealized  - the position marked at the event;
+        calculate            - both.
+
+    A call takes a few ns, so every sample is a batch of Batch calls.
+*/
+
+#include "pnl_calculator.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <print>
+#include <vector>
+
+namespace
+{
+    using trading::ExecType;
+    using trading::OrderStatus;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::execution::ExecutionReport;
+    using trading::market_data::MarketEvent;
+    using trading::pnl::PnLCalculator;
+    using trading::position::Position;
+
+    constexpr std::size_t Samples { 200'000 };
+    constexpr std::size_t Batch { 16 };
+}
+
+void pnl_calculator_benchmark()
+{
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+    {
+        std::println("PnLCalculator: cannot load depth.json");
+        return;
+    }
+
+    std::println("PnLCalculator ({} events of depth.json):", inputs.events.size());
+
+    Position position { inputs.instrument };
+    position.applyTrade(Side::Buy, inputs.events.front().bestAsk, Quantity { 50'000'000 });
+
+    std::vector<ExecutionReport> fills;
+    fills.reserve(inputs.events.size());
+    for (const MarketEvent& event : inputs.events)
+    {
+        fills.push_back(ExecutionReport {
+            .instrument = event.instrument,
+            .side = Side::Sell,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::PartiallyFilled,
+            .price = event.bestBid,
+            .quantity = Quantity { 1'000'000 },
+            .filledQuantity = Quantity { 1'000'000 }
+        });
+    }
+
+    const std::size_t count = inputs.events.size();
+    benchmark::measure("PnLCalculator::realized", Samples, [&](const std::size_t index) {
+        benchmark::doNotOptimize(PnLCalculator::calculateRealized(position, fills[index % count]));
+    }, Batch);
+    benchmark::measure("PnLCalculator::unrealized", Samples, [&](const std::size_t index) {
+        benchmark::doNotOptimize(PnLCalculator::calculateUnrealized(position, inputs.events[index % count]));
+    }, Batch);
+    benchmark::measure("PnLCalculator::calculate", Samples, [&](const std::size_t index) {
+        benchmark::doNotOptimize(PnLCalculator::calculate(position, fills[index % count], inputs.events[index % count]));
+    }, Batch);
+}
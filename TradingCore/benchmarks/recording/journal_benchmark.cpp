@@ -0,0 +1,94 @@
+/**============================================================================
+Name        : journal_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Recording hot path micro-benchmark.
+============================================================================**/
+
+/*
+    Cost of recording one MarketEvent on the calling thread:
+
+        TradeRecorder    - push_back into a growing std::vector;
+        JournalRecorder  - copy into the ring, the writer thread appends the
+                           records to a journal file in the temp directory.
+                           The first round writes every ring slot for the
+                           first time, the second one reuses the warm ring.
+
+    The recorder statistics show how many records the writer kept up with.
+*/
+
+#include "journal_recorder.hpp"
+#include "trade_recorder.hpp"
+#include "bench_support/benchmark.hpp"
+
+#include <filesystem>
+#include <print>
+#include <thread>
+
+namespace
+{
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Timestamp;
+    using trading::market_data::MarketEvent;
+    using trading::recording::JournalConfig;
+    using trading::recording::JournalRecorder;
+    using trading::recording::JournalStatistics;
+    using trading::recording::TradeRecorder;
+
+    // One ring worth of records: measures the copy, not the drop path when the writer falls behind.
+    constexpr std::size_t Iterations { JournalRecorder::RingCapacity };
+
+    [[nodiscard]]
+    MarketEvent marketEvent(const std::size_t iteration)
+    {
+        return MarketEvent {
+            .instrument = InstrumentId { 1 },
+            .sequence = iteration,
+            .receiveTimestamp = Timestamp { iteration },
+            .bestBid = Price { 6'500'000'000'000 },
+            .bestBidQuantity = Quantity { 100'000'000 },
+            .bestAsk = Price { 6'500'001'000'000 },
+            .bestAskQuantity = Quantity { 200'000'000 }
+        };
+    }
+}
+
+void journal_benchmark()
+{
+    std::println("Recording a MarketEvent:");
+
+    TradeRecorder tradeRecorder;
+    benchmark::run("TradeRecorder", Iterations, [&](const std::size_t iteration) {
+        tradeRecorder.record(marketEvent(iteration));
+    });
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "journal_benchmark";
+    JournalRecorder journal { JournalConfig { .directory = directory } };
+    if (!journal.start())
+    {
+        std::println("    JournalRecorder: cannot create {}", directory.string());
+        return;
+    }
+
+    for (const char* const name : { "Journal (cold)", "JournalRecorder" })
+    {
+        benchmark::run(name, Iterations, [&](const std::size_t iteration) {
+            journal.record(marketEvent(iteration));
+        });
+
+        // The next round starts with an empty ring.
+        while (journal.statistics().written < journal.statistics().recorded)
+            std::this_thread::yield();
+    }
+    journal.stop();
+
+    const JournalStatistics statistics = journal.statistics();
+    std::println("    journal: {} recorded, {} dropped, {} written, {} files",
+                 statistics.recorded, statistics.dropped, statistics.written, statistics.files);
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,154 @@
+/**============================================================================
+Name        : risk_check_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Pre-trade risk check micro-benchmark.
+============================================================================**/
+
+/*
+    Cost of RiskManager::checkOrder():
+
+        limits       - quantity, position and notional limits;
+        price band   - the same plus the band against ReferencePrices
+                       (one seqlock read of the instrument slot);
+        contended    - price band while another thread keeps updating the
+                       reference price of the instrument;
+        depth.json   - price band percentiles on the recorded depth stream
+                       (depth_inputs.hpp): before every sample the reference
+                       price follows the event, then an order at the
+                       opposite best price is checked.
+*/
+
+#include "reference_prices.hpp"
+#include "risk_manager.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <array>
+#include <atomic>
+#include <print>
+#include <thread>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::execution::OrderRequest;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::position::Position;
+    using trading::risk::PriceBandUnit;
+    using trading::risk::ReferencePrices;
+    using trading::risk::RiskLimits;
+    using trading::risk::RiskManager;
+
+    constexpr std::size_t Iterations { 10'000'000 };
+    constexpr std::size_t DepthSamples { 200'000 };
+
+    constexpr std::array instruments {
+        Instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } }
+    };
+
+    constexpr OrderRequest Request {
+        .instrument = InstrumentId { 1 },
+        .side = Side::Buy,
+        .type = OrderType::Limit,
+        .price = Price { 1'000'001'000'000 },
+        .quantity = Quantity { 1'000'000 }
+    };
+
+    constexpr RiskLimits Limits {
+        .maxOrderQuantity = Quantity { 100'000'000 },
+        .maxPositionQuantity = Quantity { 500'000'000 },
+        .maxNotional = Price { 100'000'000'000'000 }
+    };
+
+    struct NullHandler final : IMarketEventHandler
+    {
+        void onMarketEvent(const MarketEvent&) override {}
+    };
+
+    [[nodiscard]]
+    MarketEvent topOfBook(const std::size_t tick)
+    {
+        return MarketEvent {
+            .instrument = InstrumentId { 1 },
+            .bestBid = Price { static_cast<Price::Value>(1'000'000'000'000 + tick % 100) },
+            .bestBidQuantity = Quantity { 100'000'000 },
+            .bestAsk = Price { static_cast<Price::Value>(1'000'001'000'000 + tick % 100) },
+            .bestAskQuantity = Quantity { 100'000'000 }
+        };
+    }
+}
+
+void risk_check_benchmark()
+{
+    NullHandler next;
+    ReferencePrices prices { instruments, next };
+    prices.onMarketEvent(topOfBook(0));
+
+    const Position position { InstrumentId { 1 } };
+
+    RiskManager limitsOnly { Limits };
+    RiskLimits bandLimits = Limits;
+    bandLimits.priceBand = 50;
+    bandLimits.priceBandUnit = PriceBandUnit::BasisPoints;
+    RiskManager band { bandLimits };
+    band.setReferencePrices(prices);
+
+    std::println("RiskManager::checkOrder:");
+    benchmark::run("limits", Iterations, [&](std::size_t) {
+        benchmark::doNotOptimize(limitsOnly.checkOrder(Request, position));
+    });
+    benchmark::run("price band", Iterations, [&](std::size_t) {
+        benchmark::doNotOptimize(band.checkOrder(Request, position));
+    });
+
+    std::atomic<bool> running { true };
+    std::thread marketData { [&prices, &running] {
+        for (std::size_t tick { 0 }; running.load(std::memory_order_relaxed); ++tick)
+            prices.onMarketEvent(topOfBook(tick));
+    } };
+    benchmark::run("contended", Iterations, [&](std::size_t) {
+        benchmark::doNotOptimize(band.checkOrder(Request, position));
+    });
+    running.store(false, std::memory_order_relaxed);
+    marketData.join();
+
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+        return;
+
+    ReferencePrices depthPrices { benchmark::DepthInstruments, next };
+    RiskManager depthBand { bandLimits };
+    depthBand.setReferencePrices(depthPrices);
+
+    benchmark::Sampler sampler { "RiskManager::checkOrder" };
+    uint64_t rejected { 0 };
+    for (std::size_t index { 0 }; index < DepthSamples; ++index)
+    {
+        const MarketEvent& event = inputs.events[index % inputs.events.size()];
+        depthPrices.onMarketEvent(event);
+
+        const bool buy = index % 2 == 0;
+        const OrderRequest request {
+            .instrument = event.instrument,
+            .side = buy ? Side::Buy : Side::Sell,
+            .type = OrderType::Limit,
+            .price = buy ? event.bestAsk : event.bestBid,
+            .quantity = Quantity { 1'000'000 }
+        };
+        sampler.time([&] {
+            if (depthBand.checkOrder(request, position) != trading::risk::RiskResult::Accepted)
+                ++rejected;
+        });
+    }
+    sampler.report();
+    std::println("    {} of {} rejected", rejected, DepthSamples);
+}
@@ -0,0 +1,52 @@
+/**============================================================================
+Name        : imbalance_strategy_benchmark.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : ImbalanceStrategy::evaluate latency percentiles.
+============================================================================**/
+
+/*
+    Latency of ImbalanceStrategy::evaluate() on the top of book of the
+    recorded depth stream (depth_inputs.hpp). A call takes a few ns, less
+    than the timer, so every sample is a batch of Batch calls.
+*/
+
+#include "imbalance_strategy.hpp"
+#include "bench_support/benchmark.hpp"
+#include "bench_support/depth_inputs.hpp"
+
+#include <array>
+#include <cstdint>
+#include <print>
+
+namespace
+{
+    using trading::strategy::ImbalanceStrategy;
+    using trading::strategy::Signal;
+
+    constexpr std::size_t Samples { 200'000 };
+    constexpr std::size_t Batch { 16 };
+}
+
+void imbalance_strategy_benchmark()
+{
+    const benchmark::DepthInputs inputs = benchmark::loadDepthInputs();
+    if (inputs.empty())
+    {
+        std::println("ImbalanceStrategy: cannot load depth.json");
+        return;
+    }
+
+    std::println("ImbalanceStrategy ({} events of depth.json):", inputs.events.size());
+
+    const ImbalanceStrategy strategy {};
+    std::array<uint64_t, 3> signals {};
+    benchmark::measure("ImbalanceStrategy::evaluate", Samples, [&](const std::size_t index) {
+        const Signal signal = strategy.evaluate(inputs.events[index % inputs.events.size()]);
+        ++signals[static_cast<std::size_t>(signal)];
+    }, Batch);
+
+    std::println("    signals: {} / {} / {}", signals[0], signals[1], signals[2]);
+}
@@ -12,18 +12,45 @@ Description : Tests C++ project
 #include <string_view>
 
 
+void scaled_value_test();
+void instrument_resolver_test();
+void instrument_slots_test();
+void tsc_clock_test();
+void spsc_queue_test();
+void rcu_cell_test();
+void seqlock_test();
 void order_book_test();
+void tick_order_book_test();
 void order_manager_test();
+void order_store_test();
 void market_event_handler_test();
 void execution_report_handler_test();
+void simulated_execution_gateway_test();
 void book_builder_test();
+void book_synchronizer_test();
+void book_registry_test();
+void file_replay_market_data_source_test();
 void pnl_calculator_test();
 void risk_manager_test();
+void reference_prices_test();
 void trade_recorder_test();
+void journal_recorder_test();
+void journal_reader_test();
 void position_test();
 void position_manager_test();
 void imbalance_strategy_test();
 void strategy_executor_test();
+void binance_market_data_parser_test();
+void binance_order_encoder_test();
+void binance_request_signer_test();
+void json_config_loader_test();
+void pipeline_test();
+void inline_trading_path_test();
+void config_reloader_test();
+void replay_engine_test();
+void latency_histogram_test();
+void trace_collector_test();
+void hmac_sha256_test();
 
 // TODO:
 //   Config
@@ -50,18 +77,45 @@ int main([[maybe_unused]] const int argc,
     const std::vector<std::string_view> args(argv + 1, argv + argc);
 
 
+    scaled_value_test();
+    instrument_resolver_test();
+    instrument_slots_test();
+    tsc_clock_test();
+    spsc_queue_test();
+    rcu_cell_test();
+    seqlock_test();
     order_book_test();
+    tick_order_book_test();
     order_manager_test();
+    order_store_test();
     market_event_handler_test();
     execution_report_handler_test();
+    simulated_execution_gateway_test();
     book_builder_test();
+    book_synchronizer_test();
+    book_registry_test();
+    file_replay_market_data_source_test();
     pnl_calculator_test();
     risk_manager_test();
+    reference_prices_test();
     trade_recorder_test();
+    journal_recorder_test();
+    journal_reader_test();
     position_test();
     position_manager_test();
     imbalance_strategy_test();
     strategy_executor_test();
+    binance_market_data_parser_test();
+    binance_order_encoder_test();
+    binance_request_signer_test();
+    json_config_loader_test();
+    pipeline_test();
+    inline_trading_path_test();
+    config_reloader_test();
+    replay_engine_test();
+    latency_histogram_test();
+    trace_collector_test();
+    hmac_sha256_test();
 
     return EXIT_SUCCESS;
 }
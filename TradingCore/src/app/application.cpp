@@ -24,6 +24,12 @@ Description : application.cpp
                  |
                  | BookUpdate
                  v
+            BookRegistry
+                 |
+                 v
+          BookSynchronizer
+                 |
+                 v
              BookBuilder
                  |
                  v
@@ -31,6 +37,9 @@ Description : application.cpp
                  |
                  | MarketEvent
                  v
+            BookRegistry
+                 |
+                 v
         MarketEventDispatcher
                  |
                  +------------------+
@@ -38,30 +47,70 @@ Description : application.cpp
                  v                  v
               Strategy           Recorder
 
+    In pipelined mode the same components are connected through Pipeline,
+    which runs each stage on its own core.
+
     Application does not process market-data events itself. It only creates
     the components and establishes their relationships.
 */
 
 #include "application.hpp"
+#include "trace_collector.hpp"
+
+#include <array>
+#include <chrono>
+#include <utility>
 
 namespace trading::app
 {
-    Application::Application():
-        orderBook {},
-        recorder {},
-        position { InstrumentId { 1 } },
-        riskManager {},
+    namespace
+    {
+        // Compiled in: Instrument refers to its symbol and the books, parsers and
+        // the order encoder are sized from this table at construction.
+        constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+        constexpr std::array instruments { btcUsdt };
+
+        constexpr std::chrono::milliseconds HousekeepingSleep { 50 };
+    }
+
+    Application::Application(SnapshotRequestHandler requestSnapshot,
+                             const config::StartupConfig& config,
+                             const ApplicationMode mode,
+                             const PipelineConfig& pipelineConfig):
+        pipeline { mode == ApplicationMode::Pipelined ? std::make_unique<Pipeline>(pipelineConfig) : nullptr },
+        recorder { recording::JournalConfig { .directory = config.journalDirectory } },
+        position { btcUsdt.id() },
+        positionManager {},
+        riskManager { risk::RiskLimits {}, instruments },
         strategy {},
-        binanceExecutionGateway {},
-        orderManager { binanceExecutionGateway, riskManager, position },
+        binanceExecutionGateway { instruments },
+        orderManager { executionGateway(), riskManager, position, execution::OrderStoreConfig { .instruments = instruments } },
+        executionReportHandler { orderManager, positionManager, eventRecorder() },
         strategyExecutor { orderManager, Quantity { 100'000'000 } },
-        marketEventHandler { strategy, strategyExecutor, recorder },
-        bookBuilder { InstrumentId { 1 }, orderBook, marketEventHandler },
-        marketDataParser {},
-        marketDataMessageHandler { marketDataParser, bookBuilder },
+        marketEventHandler { strategy, strategyExecutor, eventRecorder() },
+        configChannel {},
+        configReloader { configChannel, riskManager, strategy, marketEventHandler },
+        referencePrices { instruments, marketEventSink() },
+        bookRegistry { instruments, referencePrices },
+        requestSnapshot { std::move(requestSnapshot) },
+        bookSynchronizers {},
+        marketDataParser { instruments },
+        snapshotParser { instruments },
+        snapshot {},
+        marketDataMessageHandler { marketDataParser, bookRegistry },
         marketDataSource {}
     {
+        // Calibrates the TSC before the first Timestamp::nowFast() on the hot path.
+        [[maybe_unused]] const TscClock& clock = TscClock::instance();
+
+        // Allocates the trace buffers before a hot thread commits its first trace.
+        if constexpr (trace::TracingEnabled)
+            [[maybe_unused]] const trace::TraceCollector& traces = trace::collector();
+
+        createBookSynchronizers();
         configureRisk();
+        configureExecution();
         configureMarketData();
     }
 
@@ -70,29 +119,108 @@ namespace trading::app
         stop();
     }
 
+    void Application::createBookSynchronizers()
+    {
+        bookSynchronizers.reserve(instruments.size());
+        for (const Instrument& instrument: instruments)
+        {
+            bookSynchronizers.push_back(std::make_unique<market_data::BookSynchronizer>(
+                *bookRegistry.builder(instrument.id()),
+                *bookRegistry.book(instrument.id()),
+                [this, &instrument] {
+                    if (requestSnapshot)
+                        requestSnapshot(instrument);
+                }));
+        }
+    }
+
     void Application::configureRisk()
     {
         constexpr risk::RiskLimits limits {
             .maxOrderQuantity = Quantity { 100'000'000 },
             .maxPositionQuantity = Quantity { 500'000'000 },
-            .maxNotional = Price { 100'000'000'000'000 }
+            .maxNotional = Price { 100'000'000'000'000 },
+            .priceBand = 50,
+            .priceBandUnit = risk::PriceBandUnit::BasisPoints
         };
 
         riskManager.setLimits(limits);
+        riskManager.setReferencePrices(referencePrices);
+    }
+
+    void Application::configureExecution()
+    {
+        // Orders the gateway cannot encode come back as Rejected reports.
+        binanceExecutionGateway.setReportHandler([this](const execution::ExecutionReport& report) {
+            submitExecutionReport(report);
+        });
     }
 
     void Application::configureMarketData()
     {
-        marketDataSource.setMessageHandler(marketDataMessageHandler);
+        for (std::size_t index { 0 }; index < instruments.size(); ++index)
+        {
+            const bool _ = bookRegistry.setUpdateHandler(instruments[index].id(), *bookSynchronizers[index]);
+        }
+
+        if (!pipeline)
+        {
+            marketDataSource.setMessageHandler(marketDataMessageHandler);
+            return;
+        }
+
+        marketDataSource.setMessageHandler(*pipeline);
+        pipeline->connect(PipelineTargets {
+            .source = &marketDataSource,
+            .messageHandler = &marketDataMessageHandler,
+            .marketEventHandler = &configReloader,
+            .executionReportHandler = &executionReportHandler,
+            .gateway = &binanceExecutionGateway,
+            .recorder = &recorder
+        });
+    }
+
+    recording::IRecorder& Application::eventRecorder() noexcept
+    {
+        if (pipeline)
+            return *pipeline;
+        return recorder;
+    }
+
+    execution::IExecutionGateway& Application::executionGateway() noexcept
+    {
+        if (pipeline)
+            return *pipeline;
+        return binanceExecutionGateway;
     }
 
-    void Application::start()
+    market_data::IMarketEventHandler& Application::marketEventSink() noexcept
+    {
+        if (pipeline)
+            return *pipeline;
+        return configReloader;
+    }
+
+    std::expected<void, recording::JournalError> Application::start()
     {
         if (running)
-            return;
+            return {};
+
+        if (const std::expected<void, recording::JournalError> started = recorder.start(); !started)
+            return started;
 
         running = true;
+
+        if (pipeline)
+        {
+            pipeline->start();
+            return {};
+        }
+
+        housekeepingActive.store(true, std::memory_order_release);
+        housekeepingThread = std::thread { &Application::runHousekeeping, this };
         marketDataSource.start();
+        return {};
     }
 
     void Application::stop()
@@ -100,7 +228,88 @@ namespace trading::app
         if (!running)
             return;
 
-        marketDataSource.stop();
+        if (pipeline)
+        {
+            pipeline->stop();
+        }
+        else
+        {
+            marketDataSource.stop();
+            housekeepingActive.store(false, std::memory_order_release);
+            housekeepingThread.join();
+        }
+        recorder.stop();
         running = false;
     }
+
+    void Application::runHousekeeping()
+    {
+        Timestamp nextCalibration = Timestamp::now() + TscClock::RecalibrationPeriodNanoseconds;
+        while (housekeepingActive.load(std::memory_order_acquire))
+        {
+            if (const Timestamp now = Timestamp::now(); now >= nextCalibration)
+            {
+                TscClock::instance().recalibrate();
+                nextCalibration = now + TscClock::RecalibrationPeriodNanoseconds;
+            }
+            if constexpr (trace::TracingEnabled)
+                trace::collector().collect();
+            std::this_thread::sleep_for(HousekeepingSleep);
+        }
+    }
+
+    void Application::submitExecutionReport(const execution::ExecutionReport& report)
+    {
+        if (pipeline)
+        {
+            pipeline->submitExecutionReport(report);
+            return;
+        }
+
+        const bool _ = executionReportHandler.onExecutionReport(report);
+    }
+
+    ApplicationMode Application::mode() const noexcept
+    {
+        return pipeline ? ApplicationMode::Pipelined : ApplicationMode::Synchronous;
+    }
+
+    std::optional<PipelineStatistics> Application::pipelineStatistics() const noexcept
+    {
+        if (!pipeline)
+            return std::nullopt;
+        return pipeline->statistics();
+    }
+
+    std::expected<void, SnapshotError> Application::offerSnapshot(const InstrumentId instrument,
+                                                                  const std::string_view response)
+    {
+        for (std::size_t index { 0 }; index < instruments.size(); ++index)
+        {
+            if (instruments[index].id() != instrument)
+                continue;
+
+            if (snapshotParser.parseSnapshot(response, snapshot) != market_data::ParseResult::Success)
+                return std::unexpected(SnapshotError::InvalidSnapshot);
+
+            if (!bookSynchronizers[index]->offerSnapshot(std::move(snapshot)))
+                return std::unexpected(SnapshotError::SnapshotPending);
+
+            return {};
+        }
+
+        return std::unexpected(SnapshotError::UnknownInstrument);
+    }
+
+    std::expected<void, config::Error> Application::reloadConfig(const std::filesystem::path& configPath)
+    {
+        const std::expected<config::Config, config::Error> loaded = config::JsonConfigLoader::load(configPath);
+        if (!loaded)
+            return std::unexpected(loaded.error());
+
+        if (!configChannel.publish(*loaded))
+            return std::unexpected(config::Error::InvalidConfiguration);
+
+        return {};
+    }
 }
\ No newline at end of file
@@ -27,7 +27,14 @@ Description : application.hpp
            v
         BinanceMarketDataParser
            |
-           | BookUpdate
+           | BookUpdate (symbol resolved to InstrumentId)
+           v
+        BookRegistry
+           |
+           | per instrument
+           v
+        BookSynchronizer
+           |
            v
         BookBuilder
            |
@@ -36,6 +43,12 @@ Description : application.hpp
            |
            | MarketEvent
            v
+        BookRegistry (top of book of every instrument)
+           |
+           v
+        ReferencePrices (best bid / ask for the RiskManager price band)
+           |
+           v
         MarketEventDispatcher
            |
            +----------------------+
@@ -43,6 +56,72 @@ Description : application.hpp
            v                      v
         Strategy              Recorder
 
+    Modes:
+
+        Synchronous
+            every stage runs on the thread of the market-data source, as
+            shown above.
+
+        Pipelined
+            the same components run on core-pinned stage threads connected
+            by SPSC queues (see Pipeline):
+
+                network RX -> parser + OrderBook -> strategy + risk -> execution
+                                                           |
+                                                           +-> recorder (background)
+
+            The pipeline replaces the next stage in the wiring: BookRegistry
+            publishes into it, OrderManager sends through it and
+            MarketEventHandler records through it.
+
+    Execution reports:
+
+        The transport of the execution gateway hands every report to
+        submitExecutionReport(). ExecutionReportHandler then records it and
+        applies it to OrderManager and PositionManager, on the trading thread
+        in both modes: directly in synchronous mode, through Q4 of the
+        pipeline in pipelined mode. The gateway itself submits a Rejected
+        report for an order it cannot encode.
+
+    Order book snapshots:
+
+        Every instrument has a BookSynchronizer that buffers the depth stream
+        until its book has been bootstrapped from a REST depth snapshot. The
+        SnapshotRequestHandler passed to the constructor schedules
+        GET /api/v3/depth for the instrument on a thread of the caller, which
+        hands the response body back through offerSnapshot(). The parser
+        thread applies it at its next message.
+
+    Configuration reload:
+
+        reloadConfig() loads a JSON configuration on the calling (control)
+        thread and publishes it through ConfigChannel. ConfigReloader, in
+        front of MarketEventHandler, applies the risk limits and the strategy
+        threshold on the trading thread before the next market event. Risk
+        limits and a strategy threshold missing from the file keep their
+        active values.
+
+    Clock recalibration and traces:
+
+        Pipeline recalibrates TscClock on its background thread. In
+        synchronous mode start() runs a housekeeping thread that does the
+        same once every TscClock::RecalibrationPeriodNanoseconds; it sleeps
+        in between and never touches the market-data path. With
+        TRADING_CORE_TRACING it also collects the tick-to-trade traces into
+        trace::collector() every time it wakes up, so the trace buffers do
+        not fill up and drop.
+
+    Recording:
+
+        Market events and execution reports go to a JournalRecorder: the
+        recording thread copies them into a ring and a writer thread appends
+        them to binary journal files in StartupConfig::journalDirectory.
+        start() starts the writer before anything else and fails with its
+        JournalError, starting nothing, when the first file cannot be
+        created; stop() flushes it after the market-data path has stopped.
+        A later file that cannot be created makes the recorder drop the
+        records and count them.
+
     Responsibilities:
 
         - construct application components;
@@ -60,19 +139,60 @@ Description : application.hpp
 #include "binance_market_data_parser.hpp"
 #include "binance_market_data_source.hpp"
 #include "binance_execution_gateway.hpp"
-#include "book_builder.hpp"
+#include "book_registry.hpp"
+#include "book_synchronizer.hpp"
+#include "execution_report_handler.hpp"
+#include "config_channel.hpp"
+#include "config_reloader.hpp"
 #include "imbalance_strategy.hpp"
+#include "json_config_loader.hpp"
 #include "market_data_message_handler.hpp"
 #include "market_event_handler.hpp"
-#include "order_book.hpp"
-#include "trade_recorder.hpp"
+#include "pipeline.hpp"
+#include "position_manager.hpp"
+#include "reference_prices.hpp"
+#include "journal_recorder.hpp"
+
+#include <atomic>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace trading::app
 {
+    enum class ApplicationMode : uint8_t
+    {
+        Synchronous,
+        Pipelined
+    };
+
+    /*
+        Called on the parser thread when the book of 'instrument' needs a
+        snapshot. Must only schedule GET /api/v3/depth?symbol=<symbol>, not
+        perform it, and deliver the response through Application::offerSnapshot().
+    */
+    using SnapshotRequestHandler = std::function<void(const Instrument& instrument)>;
+
+    enum class SnapshotError : uint8_t
+    {
+        UnknownInstrument,
+        InvalidSnapshot,
+        SnapshotPending
+    };
+
     class Application final
     {
     public:
-        Application();
+        // Trading settings come through reloadConfig().
+        explicit Application(SnapshotRequestHandler requestSnapshot,
+                             const config::StartupConfig& config = {},
+                             ApplicationMode mode = ApplicationMode::Synchronous,
+                             const PipelineConfig& pipelineConfig = {});
         ~Application();
 
         Application(const Application&) = delete;
@@ -81,27 +201,86 @@ namespace trading::app
         Application(Application&&) = delete;
         Application& operator=(Application&&) = delete;
 
-        void start();
+        [[nodiscard]]
+        std::expected<void, recording::JournalError> start();
         void stop();
 
+        [[nodiscard]]
+        ApplicationMode mode() const noexcept;
+
+        // Queue depths and stage latencies, std::nullopt in synchronous mode.
+        [[nodiscard]]
+        std::optional<PipelineStatistics> pipelineStatistics() const noexcept;
+
+        /*
+            Called by the execution transport: on the thread that runs
+            IExecutionGateway::send() (the market-data thread in synchronous
+            mode, the execution stage in pipelined mode).
+        */
+        void submitExecutionReport(const execution::ExecutionReport& report);
+
+        // Control thread. Applied by the trading thread at the next market event.
+        [[nodiscard]]
+        std::expected<void, config::Error> reloadConfig(const std::filesystem::path& configPath);
+
+        /*
+            Snapshot thread. Parses a GET /api/v3/depth response for
+            'instrument' and hands it over to its BookSynchronizer. Fails with
+            SnapshotPending while the previous snapshot has not been applied.
+            Not reentrant: one snapshot thread at a time.
+        */
+        [[nodiscard]]
+        std::expected<void, SnapshotError> offerSnapshot(InstrumentId instrument, std::string_view response);
+
     private:
+        void createBookSynchronizers();
         void configureRisk();
+        void configureExecution();
         void configureMarketData();
 
-        market_data::OrderBook orderBook;
-        recording::TradeRecorder recorder;
+        // Synchronous mode only: what the Pipeline background thread does otherwise.
+        void runHousekeeping();
+
+        // The next stage of each boundary: the pipeline in pipelined mode.
+        [[nodiscard]]
+        recording::IRecorder& eventRecorder() noexcept;
+
+        [[nodiscard]]
+        execution::IExecutionGateway& executionGateway() noexcept;
+
+        [[nodiscard]]
+        market_data::IMarketEventHandler& marketEventSink() noexcept;
+
+        // Heap allocated: the queues hold several megabytes.
+        std::unique_ptr<Pipeline> pipeline;
+
+        recording::JournalRecorder recorder;
         position::Position position;
+        position::PositionManager positionManager;
         risk::RiskManager riskManager;
         strategy::ImbalanceStrategy strategy;
         exchanges::binance::BinanceExecutionGateway binanceExecutionGateway;
         execution::OrderManager orderManager;
+        execution::ExecutionReportHandler executionReportHandler;
         strategy::StrategyExecutor strategyExecutor;
         market_data::MarketEventHandler marketEventHandler;
-        market_data::BookBuilder bookBuilder;
+        config::ConfigChannel configChannel;
+        ConfigReloader configReloader;
+        risk::ReferencePrices referencePrices;
+        market_data::BookRegistry bookRegistry;
+        SnapshotRequestHandler requestSnapshot;
+        // Parallel to 'instruments'; heap allocated, BookSynchronizer is not movable.
+        std::vector<std::unique_ptr<market_data::BookSynchronizer>> bookSynchronizers;
         exchanges::binance::BinanceMarketDataParser marketDataParser;
+        // Used on the snapshot thread only.
+        exchanges::binance::BinanceMarketDataParser snapshotParser;
+        market_data::BookSnapshot snapshot;
         market_data::MarketDataMessageHandler marketDataMessageHandler;
         exchanges::binance::BinanceMarketDataSource marketDataSource;
 
+        std::atomic<bool> housekeepingActive { false };
+        std::thread housekeepingThread;
+
         bool running { false };
     };
 }
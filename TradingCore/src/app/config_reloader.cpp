@@ -0,0 +1,51 @@
+/**============================================================================
+Name        : config_reloader.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Applies reloaded configuration on the trading thread.
+============================================================================**/
+
+#include "config_reloader.hpp"
+
+namespace trading::app
+{
+    ConfigReloader::ConfigReloader(config::ConfigChannel& channel,
+                                   risk::RiskManager& riskManager,
+                                   strategy::ImbalanceStrategy& strategy,
+                                   market_data::IMarketEventHandler& next) noexcept:
+        channel { channel },
+        riskManager { riskManager },
+        strategy { strategy },
+        next { next }
+    {
+    }
+
+    void ConfigReloader::onMarketEvent(const market_data::MarketEvent& event)
+    {
+        if (const config::Config* config = channel.poll(); config != nullptr) [[unlikely]]
+            apply(*config);
+
+        next.onMarketEvent(event);
+    }
+
+    uint64_t ConfigReloader::appliedCount() const noexcept
+    {
+        return applied;
+    }
+
+    void ConfigReloader::apply(const config::Config& config) noexcept
+    {
+        riskManager.setLimits(config::applyRiskLimits(riskManager.activeLimits(), config.riskLimits));
+
+        // A threshold field the config does not set keeps its active value.
+        if (config.strategyThresholdNumerator.has_value() || config.strategyThresholdDenominator.has_value())
+        {
+            const bool _ = strategy.setThreshold(
+                config.strategyThresholdNumerator.value_or(strategy.activeThresholdNumerator()),
+                config.strategyThresholdDenominator.value_or(strategy.activeThresholdDenominator()));
+        }
+        ++applied;
+    }
+}
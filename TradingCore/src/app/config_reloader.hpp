@@ -0,0 +1,79 @@
+/**============================================================================
+Name        : config_reloader.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Applies reloaded configuration on the trading thread.
+============================================================================**/
+
+/*
+    ConfigReloader sits in front of the MarketEventHandler and applies a
+    Config published through ConfigChannel before the next market event
+    reaches the strategy. Applying on the trading thread keeps RiskManager
+    and ImbalanceStrategy single-threaded: they are never changed while they
+    evaluate an event.
+
+    Data Flow:
+
+        BookRegistry / Pipeline (trading stage)
+           |
+           | MarketEvent
+           v
+        ConfigReloader ---- ConfigChannel::poll() ----> new Config?
+           |                                               |
+           |                        RiskManager::setLimits()
+           |                        ImbalanceStrategy::setThreshold()
+           v
+        MarketEventHandler (next)
+
+    Reloadable values: risk limits and the strategy threshold. The
+    instrument and the order quantity are fixed when the application is
+    wired. A risk limit, threshold numerator or threshold denominator the
+    Config does not set keeps its active value: a numerator alone is applied
+    over the active denominator and vice versa.
+
+    ConfigReloader does not:
+
+        - load or validate configuration files;
+        - block or allocate on the market event path.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_CONFIG_RELOADER_HPP
+#define FINANCETECHNOLOGYPROJECTS_CONFIG_RELOADER_HPP
+
+#include "config_channel.hpp"
+#include "imbalance_strategy.hpp"
+#include "interfaces/market_event_handler.hpp"
+#include "risk_manager.hpp"
+
+#include <cstdint>
+
+namespace trading::app
+{
+    class ConfigReloader final : public market_data::IMarketEventHandler
+    {
+    public:
+        ConfigReloader(config::ConfigChannel& channel,
+                       risk::RiskManager& riskManager,
+                       strategy::ImbalanceStrategy& strategy,
+                       market_data::IMarketEventHandler& next) noexcept;
+
+        void onMarketEvent(const market_data::MarketEvent& event) override;
+
+        // Number of configs applied, read on the trading thread.
+        [[nodiscard]]
+        uint64_t appliedCount() const noexcept;
+
+    private:
+        void apply(const config::Config& config) noexcept;
+
+        config::ConfigChannel& channel;
+        risk::RiskManager& riskManager;
+        strategy::ImbalanceStrategy& strategy;
+        market_data::IMarketEventHandler& next;
+        uint64_t applied { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_CONFIG_RELOADER_HPP
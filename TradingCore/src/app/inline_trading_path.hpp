@@ -0,0 +1,187 @@
+/**============================================================================
+Name        : inline_trading_path.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Compile-time wired market-data-to-order path.
+============================================================================**/
+
+/*
+    InlineTradingPath composes the components of the trading path through
+    template parameters instead of interfaces. Every call on the per-message
+    path is a direct call to a known type, so the compiler can inline the
+    whole path into onMessage().
+
+    Data Flow:
+
+        raw message
+           |
+           v
+        Parser::parse()                       (MarketDataParser)
+           |
+           | BookUpdates
+           v
+        applyUpdates(Book&)                   (BookStorage)
+           |
+           | makeMarketEvent()
+           v
+        Strategy::evaluate()                  (SignalGenerator)
+           |
+           | makeOrderRequest()
+           v
+        OrderManager::createOrder(request, riskManager, position, gateway)
+           |
+           +-> Risk::checkOrder()             (PreTradeRisk)
+           +-> OrderManager::acceptOrder()    (assigns OrderId, tracks order)
+           +-> Gateway::send()                (OrderGateway)
+
+    Compared with the interface-based wiring:
+
+        MarketDataMessageHandler -> IMarketDataParser
+                                 -> IBookUpdateHandler   (BookBuilder)
+                                 -> IMarketEventHandler  (MarketEventHandler)
+                                 -> IStrategy
+                                 -> StrategyExecutor -> OrderManager
+                                 -> IRiskManager
+                                 -> IExecutionGateway
+
+    both paths share the same building blocks (applyUpdates, makeMarketEvent,
+    makeOrderRequest and the OrderManager::createOrder() sequence) and produce
+    the same orders for the same input. The interfaces remain the wiring for
+    tests and for components chosen at run time.
+
+    orderManager must be constructed with the same risk manager, gateway and
+    position: InlineTradingPath passes them to createOrder() by their
+    concrete types, while cancels and execution reports still go through
+    OrderManager and its interfaces.
+
+    InlineTradingPath does not:
+
+        - record market events (wire a recorder into the Gateway or run the
+          path inside the Pipeline instead);
+        - synchronize the book with a snapshot (see BookSynchronizer);
+        - route several instruments (one path per instrument).
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_INLINE_TRADING_PATH_HPP
+#define FINANCETECHNOLOGYPROJECTS_INLINE_TRADING_PATH_HPP
+
+#include "book_builder.hpp"
+#include "execution_gateway.hpp"
+#include "market_data_parser.hpp"
+#include "order_manager.hpp"
+#include "position.hpp"
+#include "risk_manager.hpp"
+#include "strategy.hpp"
+#include "strategy_executor.hpp"
+
+#include <span>
+#include <string_view>
+
+namespace trading::app
+{
+    template<market_data::MarketDataParser Parser,
+             market_data::BookStorage Book,
+             strategy::SignalGenerator Strategy,
+             risk::PreTradeRisk Risk,
+             execution::OrderGateway Gateway>
+    class InlineTradingPath final
+    {
+    public:
+        using Levels = typename Book::Levels;
+
+        InlineTradingPath(const InstrumentId instrument,
+                          const Parser& parser,
+                          Book& book,
+                          const Strategy& strategy,
+                          Risk& riskManager,
+                          Gateway& gateway,
+                          execution::OrderManager& orderManager,
+                          const position::Position& position,
+                          const Quantity orderQuantity) noexcept:
+            instrument { instrument },
+            parser { parser },
+            book { book },
+            strategy { strategy },
+            riskManager { riskManager },
+            gateway { gateway },
+            orderManager { orderManager },
+            position { position },
+            orderQuantity { orderQuantity }
+        {
+        }
+
+        InlineTradingPath(const InlineTradingPath&) = delete;
+        InlineTradingPath& operator=(const InlineTradingPath&) = delete;
+
+        void onMessage(const std::string_view message)
+        {
+            trace::TraceContext context {};
+            context.stamp(trace::Stage::SocketRead);
+
+            if (parser.parse(message, bookUpdates) != market_data::ParseResult::Success)
+                return;
+
+            context.stamp(trace::Stage::Parsed);
+            if constexpr (trace::TracingEnabled)
+            {
+                for (market_data::BookUpdate& update : bookUpdates)
+                    update.trace = context;
+            }
+
+            onBookUpdates(bookUpdates);
+        }
+
+        void onBookUpdates(const std::span<const market_data::BookUpdate> updates)
+        {
+            const market_data::BookUpdate* lastApplied = market_data::applyUpdates(book, instrument, updates);
+            if (lastApplied == nullptr)
+                return;
+
+            const strategy::StrategyExecutionResult _ = onMarketEvent(market_data::makeMarketEvent(
+                book, instrument, lastApplied->sequence, lastApplied->exchangeTimestamp, lastApplied->trace));
+        }
+
+        [[nodiscard]]
+        bool applySnapshot(const SequenceNumber sequence,
+                           const Levels& bids,
+                           const Levels& asks,
+                           const Timestamp exchangeTimestamp)
+        {
+            book.replace(sequence, bids, asks);
+
+            const strategy::StrategyExecutionResult _ = onMarketEvent(
+                market_data::makeMarketEvent(book, instrument, sequence, exchangeTimestamp));
+            return true;
+        }
+
+        // Same result as MarketEventHandler + StrategyExecutor for one event.
+        [[nodiscard]]
+        strategy::StrategyExecutionResult onMarketEvent(const market_data::MarketEvent& event)
+        {
+            const strategy::Signal signal = strategy.evaluate(event);
+
+            const std::optional<execution::OrderRequest> request =
+                strategy::makeOrderRequest(signal, event, orderQuantity);
+            if (!request)
+                return std::optional<OrderId> {};
+
+            return orderManager.createOrder(*request, riskManager, position, gateway);
+        }
+
+    private:
+        InstrumentId instrument;
+        market_data::BookUpdates bookUpdates;
+        const Parser& parser;
+        Book& book;
+        const Strategy& strategy;
+        Risk& riskManager;
+        Gateway& gateway;
+        execution::OrderManager& orderManager;
+        const position::Position& position;
+        Quantity orderQuantity;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_INLINE_TRADING_PATH_HPP
@@ -0,0 +1,605 @@
+/**============================================================================
+Name        : pipeline.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Core-pinned multi-stage trading pipeline.
+============================================================================**/
+
+/*
+    Pipeline implementation.
+
+    Stage loop:
+
+        pin to core
+           |
+           v
+        while active:  poll input queue -> process -> account latency
+           |           (cpu pause when the queue is empty)
+           v
+        drain input queue
+           |
+           v
+        exit
+
+    The counters of a stage or queue have a single writer (the thread that
+    owns them) and are updated with relaxed load + store, statistics() reads
+    them from any thread.
+*/
+
+#include "pipeline.hpp"
+#include "trace_collector.hpp"
+#include "tsc_clock.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace trading::app
+{
+    namespace
+    {
+        void cpuRelax() noexcept
+        {
+#if TRADING_CORE_HAS_TSC
+            _mm_pause();
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        [[nodiscard]]
+        bool pinCurrentThread(const CoreId core) noexcept
+        {
+            if (core < 0 || core >= CPU_SETSIZE)
+                return false;
+
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(core, &cpus);
+            return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpus), &cpus) == 0;
+        }
+
+        template<typename T>
+        void increase(std::atomic<T>& counter, const T value) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        template<typename T>
+        void raise(std::atomic<T>& maximum, const T value) noexcept
+        {
+            if (value > maximum.load(std::memory_order_relaxed))
+                maximum.store(value, std::memory_order_relaxed);
+        }
+
+        // Spins while the queue is full and its consumer is still consuming.
+        template<typename Queue, typename Item>
+        [[nodiscard]]
+        bool push(Queue& queue, const Item& item, const std::atomic<bool>& consuming) noexcept
+        {
+            while (!queue.tryPush(item))
+            {
+                if (!consuming.load(std::memory_order_acquire))
+                    return false;
+                cpuRelax();
+            }
+            return true;
+        }
+
+        template<typename Counters>
+        void account(Counters& stage, const Timestamp enqueued, const Timestamp started) noexcept
+        {
+            const Timestamp finished = Timestamp::nowFast();
+            const uint64_t wait = started > enqueued ? started - enqueued : 0;
+            const uint64_t service = finished > started ? finished - started : 0;
+
+            increase<uint64_t>(stage.processed, 1);
+            increase(stage.waitNanoseconds, wait);
+            increase(stage.serviceNanoseconds, service);
+            raise(stage.maxWaitNanoseconds, wait);
+            raise(stage.maxServiceNanoseconds, service);
+        }
+
+        template<typename Counters>
+        [[nodiscard]]
+        QueueStatistics snapshot(const std::size_t depth, const std::size_t capacity, const Counters& counters) noexcept
+        {
+            return QueueStatistics {
+                .depth = depth,
+                .maxDepth = counters.maxDepth.load(std::memory_order_relaxed),
+                .capacity = capacity,
+                .rejected = counters.rejected.load(std::memory_order_relaxed)
+            };
+        }
+    }
+
+    double StageStatistics::averageWaitNanoseconds() const noexcept
+    {
+        return processed == 0 ? 0.0 : static_cast<double>(waitNanoseconds) / static_cast<double>(processed);
+    }
+
+    double StageStatistics::averageServiceNanoseconds() const noexcept
+    {
+        return processed == 0 ? 0.0 : static_cast<double>(serviceNanoseconds) / static_cast<double>(processed);
+    }
+
+    Pipeline::Pipeline(const PipelineConfig config):
+        configuration { config }
+    {
+    }
+
+    Pipeline::~Pipeline()
+    {
+        stop();
+    }
+
+    void Pipeline::connect(const PipelineTargets& stageTargets) noexcept
+    {
+        if (!running)
+            targets = stageTargets;
+    }
+
+    void Pipeline::start()
+    {
+        if (running)
+            return;
+
+        // Calibrates the TSC before the stages take their first Timestamp::nowFast().
+        [[maybe_unused]] const TscClock& clock = TscClock::instance();
+
+        // Allocates the trace buffers before the stages commit their first trace.
+        if constexpr (trace::TracingEnabled)
+            [[maybe_unused]] const trace::TraceCollector& traces = trace::collector();
+
+        running = true;
+        recorderActive.store(true, std::memory_order_release);
+        executionActive.store(true, std::memory_order_release);
+        tradingActive.store(true, std::memory_order_release);
+        marketDataActive.store(true, std::memory_order_release);
+        executionConsuming.store(true, std::memory_order_release);
+        tradingConsuming.store(true, std::memory_order_release);
+        marketDataConsuming.store(true, std::memory_order_release);
+
+        // Consumers first: every stage is polling before its producer starts.
+        recorderThread = std::thread { &Pipeline::runRecorder, this };
+        executionThread = std::thread { &Pipeline::runExecution, this };
+        tradingThread = std::thread { &Pipeline::runTrading, this };
+        marketDataThread = std::thread { &Pipeline::runMarketData, this };
+        networkThread = std::thread { &Pipeline::runNetwork, this };
+    }
+
+    void Pipeline::stop()
+    {
+        if (!running)
+            return;
+
+        if (targets.source != nullptr)
+            targets.source->stop();
+        shutdown();
+    }
+
+    void Pipeline::join()
+    {
+        if (running)
+            shutdown();
+    }
+
+    void Pipeline::shutdown()
+    {
+        // Every stage is stopped only after its producer has exited, so that
+        // draining the input queue sees every item.
+        if (networkThread.joinable())
+            networkThread.join();
+
+        marketDataActive.store(false, std::memory_order_release);
+        if (marketDataThread.joinable())
+            marketDataThread.join();
+
+        // The trading stage stops the execution stage itself (see runTrading()).
+        tradingActive.store(false, std::memory_order_release);
+        if (tradingThread.joinable())
+            tradingThread.join();
+        if (executionThread.joinable())
+            executionThread.join();
+
+        recorderActive.store(false, std::memory_order_release);
+        if (recorderThread.joinable())
+            recorderThread.join();
+
+        running = false;
+    }
+
+    bool Pipeline::isRunning() const noexcept
+    {
+        return running;
+    }
+
+    void Pipeline::onMessage(const std::string_view message)
+    {
+        if (message.size() > MaxRawMessageSize)
+        {
+            increase<uint64_t>(rawMessageCounters.rejected, 1);
+            return;
+        }
+
+        RawMessage* slot = rawMessages.tryClaim();
+        while (slot == nullptr)
+        {
+            if (!marketDataConsuming.load(std::memory_order_acquire))
+            {
+                increase<uint64_t>(rawMessageCounters.rejected, 1);
+                return;
+            }
+            cpuRelax();
+            slot = rawMessages.tryClaim();
+        }
+
+        std::memcpy(slot->data.data(), message.data(), message.size());
+        slot->size = static_cast<uint32_t>(message.size());
+        slot->enqueued = Timestamp::nowFast();
+        rawMessages.publish();
+    }
+
+    void Pipeline::onMarketEvent(const market_data::MarketEvent& event)
+    {
+        const Stamped<market_data::MarketEvent> item { .enqueued = Timestamp::nowFast(), .value = event };
+        if (!push(marketEvents, item, tradingConsuming))
+            increase<uint64_t>(marketEventCounters.rejected, 1);
+    }
+
+    void Pipeline::send(const execution::Order& order)
+    {
+        pushOrderCommand(OrderCommand { .type = OrderCommandType::Send, .enqueued = Timestamp::nowFast(), .order = order });
+    }
+
+    void Pipeline::cancel(const OrderId orderId)
+    {
+        OrderCommand command { .type = OrderCommandType::Cancel, .enqueued = Timestamp::nowFast() };
+        command.order.clientOrderId = orderId;
+        pushOrderCommand(command);
+    }
+
+    void Pipeline::pushOrderCommand(const OrderCommand& command)
+    {
+        // The execution stage may be waiting for room in Q4: take its reports instead of spinning.
+        bool overflowed { false };
+        while (!orderCommands.tryPush(command))
+        {
+            if (!executionConsuming.load(std::memory_order_acquire))
+            {
+                increase<uint64_t>(orderCommandCounters.rejected, 1);
+                if (command.type == OrderCommandType::Cancel)
+                {
+                    increase<uint64_t>(droppedCancels, 1);
+                    return;
+                }
+
+                const execution::Order& order = command.order;
+                const bool deferred = deferredReports.tryPush(Stamped<execution::ExecutionReport> {
+                    .enqueued = Timestamp::nowFast(),
+                    .value = execution::ExecutionReport {
+                        .clientOrderId = order.clientOrderId,
+                        .exchangeOrderId = order.exchangeOrderId,
+                        .instrument = order.instrument,
+                        .side = order.side,
+                        .execType = ExecType::Reject,
+                        .status = OrderStatus::Rejected,
+                        .price = order.price,
+                        .quantity = order.quantity,
+                        .filledQuantity = order.filledQuantity
+                    }
+                });
+                if (!deferred)
+                    increase<uint64_t>(deferredReportOverflows, 1);
+                return;
+            }
+            if (deferExecutionReport())
+                continue;
+
+            // Full ring: leave the reports in Q4 and wait for the execution stage to drain Q3.
+            if (!overflowed && deferredReports.size() == DeferredReportCapacity)
+            {
+                overflowed = true;
+                increase<uint64_t>(deferredReportOverflows, 1);
+            }
+            cpuRelax();
+        }
+    }
+
+    void Pipeline::record(const market_data::MarketEvent& event)
+    {
+        RecordingItem* const slot = recordingItems.tryClaim();
+        if (slot == nullptr)
+        {
+            increase<uint64_t>(recordingCounters.rejected, 1);
+            return;
+        }
+
+        slot->event = recording::RecordingEvent { recording::EventType::MarketEvent, Timestamp::nowFast() };
+        slot->marketEvent = event;
+        recordingItems.publish();
+    }
+
+    void Pipeline::record(const execution::ExecutionReport& report)
+    {
+        RecordingItem* const slot = recordingItems.tryClaim();
+        if (slot == nullptr)
+        {
+            increase<uint64_t>(recordingCounters.rejected, 1);
+            return;
+        }
+
+        slot->event = recording::RecordingEvent { recording::EventType::ExecutionReport, Timestamp::nowFast() };
+        slot->executionReport = report;
+        recordingItems.publish();
+    }
+
+    void Pipeline::submitExecutionReport(const execution::ExecutionReport& report)
+    {
+        const Stamped<execution::ExecutionReport> item { .enqueued = Timestamp::nowFast(), .value = report };
+        if (!push(executionReports, item, tradingConsuming))
+            increase<uint64_t>(executionReportCounters.rejected, 1);
+    }
+
+    PipelineStatistics Pipeline::statistics() const noexcept
+    {
+        const auto stage = [](const StageCounters& counters) noexcept {
+            return StageStatistics {
+                .processed = counters.processed.load(std::memory_order_relaxed),
+                .waitNanoseconds = counters.waitNanoseconds.load(std::memory_order_relaxed),
+                .maxWaitNanoseconds = counters.maxWaitNanoseconds.load(std::memory_order_relaxed),
+                .serviceNanoseconds = counters.serviceNanoseconds.load(std::memory_order_relaxed),
+                .maxServiceNanoseconds = counters.maxServiceNanoseconds.load(std::memory_order_relaxed),
+                .pinned = counters.pinned.load(std::memory_order_relaxed)
+            };
+        };
+
+        return PipelineStatistics {
+            .rawMessages = snapshot(rawMessages.size(), RawMessageCapacity, rawMessageCounters),
+            .marketEvents = snapshot(marketEvents.size(), MarketEventCapacity, marketEventCounters),
+            .orderCommands = snapshot(orderCommands.size(), OrderCommandCapacity, orderCommandCounters),
+            .executionReports = snapshot(executionReports.size(), ExecutionReportCapacity, executionReportCounters),
+            .recording = snapshot(recordingItems.size(), RecordingCapacity, recordingCounters),
+            .marketData = stage(marketDataStage),
+            .trading = stage(tradingStage),
+            .execution = stage(executionStage),
+            .recorder = stage(recorderStage),
+            .unknownExecutionReports = unknownExecutionReports.load(std::memory_order_relaxed),
+            .droppedCancels = droppedCancels.load(std::memory_order_relaxed),
+            .deferredReportOverflows = deferredReportOverflows.load(std::memory_order_relaxed)
+        };
+    }
+
+    const PipelineConfig& Pipeline::config() const noexcept
+    {
+        return configuration;
+    }
+
+    void Pipeline::runNetwork()
+    {
+        [[maybe_unused]] const bool pinned = pinCurrentThread(configuration.networkCore);
+        if (targets.source != nullptr)
+            targets.source->start();
+    }
+
+    void Pipeline::runMarketData()
+    {
+        marketDataStage.pinned.store(pinCurrentThread(configuration.marketDataCore), std::memory_order_relaxed);
+        while (marketDataActive.load(std::memory_order_acquire))
+        {
+            if (!pollMarketData())
+                cpuRelax();
+        }
+        while (pollMarketData()) {
+        }
+        marketDataConsuming.store(false, std::memory_order_release);
+    }
+
+    void Pipeline::runTrading()
+    {
+        tradingStage.pinned.store(pinCurrentThread(configuration.tradingCore), std::memory_order_relaxed);
+        while (tradingActive.load(std::memory_order_acquire))
+        {
+            if (!pollTrading())
+                cpuRelax();
+        }
+        while (pollTrading()) {
+        }
+
+        // No orders follow the last market event: let the execution stage
+        // drain and keep taking its execution reports until it has exited.
+        executionActive.store(false, std::memory_order_release);
+        while (executionConsuming.load(std::memory_order_acquire))
+        {
+            if (!pollTrading())
+                cpuRelax();
+        }
+        while (pollTrading()) {
+        }
+        tradingConsuming.store(false, std::memory_order_release);
+    }
+
+    void Pipeline::runExecution()
+    {
+        executionStage.pinned.store(pinCurrentThread(configuration.executionCore), std::memory_order_relaxed);
+        while (executionActive.load(std::memory_order_acquire))
+        {
+            if (!pollExecution())
+                cpuRelax();
+        }
+        while (pollExecution()) {
+        }
+        executionConsuming.store(false, std::memory_order_release);
+    }
+
+    void Pipeline::runRecorder()
+    {
+        recorderStage.pinned.store(pinCurrentThread(configuration.backgroundCore), std::memory_order_relaxed);
+
+        Timestamp nextCalibration = Timestamp::now() + TscClock::RecalibrationPeriodNanoseconds;
+        while (recorderActive.load(std::memory_order_acquire))
+        {
+            if (pollRecorder())
+                continue;
+
+            if (const Timestamp now = Timestamp::now(); now >= nextCalibration)
+            {
+                TscClock::instance().recalibrate();
+                if constexpr (trace::TracingEnabled)
+                    trace::collector().collect();
+                nextCalibration = now + TscClock::RecalibrationPeriodNanoseconds;
+            }
+            std::this_thread::yield();
+        }
+        while (pollRecorder()) {
+        }
+    }
+
+    bool Pipeline::pollMarketData()
+    {
+        const RawMessage* const message = rawMessages.front();
+        if (message == nullptr)
+            return false;
+
+        raise(rawMessageCounters.maxDepth, rawMessages.size());
+
+        const Timestamp started = Timestamp::nowFast();
+        const Timestamp enqueued = message->enqueued;
+        if (targets.messageHandler != nullptr)
+            targets.messageHandler->onMessage(std::string_view { message->data.data(), message->size });
+        rawMessages.pop();
+
+        account(marketDataStage, enqueued, started);
+        return true;
+    }
+
+    bool Pipeline::pollTrading()
+    {
+        // Execution reports first: state updates precede new decisions.
+        if (applyDeferredReports() || pollExecutionReport())
+            return true;
+
+        const auto* const event = marketEvents.front();
+        if (event == nullptr)
+            return false;
+
+        raise(marketEventCounters.maxDepth, marketEvents.size());
+
+        const Timestamp started = Timestamp::nowFast();
+        const Stamped<market_data::MarketEvent> item = *event;
+        marketEvents.pop();
+
+        if (targets.marketEventHandler != nullptr)
+            targets.marketEventHandler->onMarketEvent(item.value);
+
+        account(tradingStage, item.enqueued, started);
+        return true;
+    }
+
+    bool Pipeline::pollExecutionReport()
+    {
+        const auto* const report = executionReports.front();
+        if (report == nullptr)
+            return false;
+
+        raise(executionReportCounters.maxDepth, executionReports.size());
+
+        const Stamped<execution::ExecutionReport> item = *report;
+        executionReports.pop();
+
+        applyExecutionReport(item);
+        return true;
+    }
+
+    bool Pipeline::deferExecutionReport() noexcept
+    {
+        const auto* const report = executionReports.front();
+        if (report == nullptr)
+            return false;
+
+        raise(executionReportCounters.maxDepth, executionReports.size());
+
+        if (!deferredReports.tryPush(*report))
+            return false;
+        executionReports.pop();
+        return true;
+    }
+
+    bool Pipeline::applyDeferredReports()
+    {
+        const auto* item = deferredReports.front();
+        if (item == nullptr)
+            return false;
+
+        // The report handler does not send, so the ring does not grow meanwhile.
+        for (; item != nullptr; item = deferredReports.front())
+        {
+            applyExecutionReport(*item);
+            deferredReports.pop();
+        }
+        return true;
+    }
+
+    void Pipeline::applyExecutionReport(const Stamped<execution::ExecutionReport>& item)
+    {
+        const Timestamp started = Timestamp::nowFast();
+        if (targets.executionReportHandler != nullptr &&
+            !targets.executionReportHandler->onExecutionReport(item.value))
+        {
+            increase<uint64_t>(unknownExecutionReports, 1);
+        }
+
+        account(tradingStage, item.enqueued, started);
+    }
+
+    bool Pipeline::pollExecution()
+    {
+        const OrderCommand* const slot = orderCommands.front();
+        if (slot == nullptr)
+            return false;
+
+        raise(orderCommandCounters.maxDepth, orderCommands.size());
+
+        const Timestamp started = Timestamp::nowFast();
+        const OrderCommand command = *slot;
+        orderCommands.pop();
+
+        if (targets.gateway != nullptr)
+        {
+            if (command.type == OrderCommandType::Send)
+                targets.gateway->send(command.order);
+            else
+                targets.gateway->cancel(command.order.clientOrderId);
+        }
+
+        account(executionStage, command.enqueued, started);
+        return true;
+    }
+
+    bool Pipeline::pollRecorder()
+    {
+        const RecordingItem* const slot = recordingItems.front();
+        if (slot == nullptr)
+            return false;
+
+        raise(recordingCounters.maxDepth, recordingItems.size());
+
+        const Timestamp started = Timestamp::nowFast();
+        const Timestamp enqueued = slot->event.timestamp;
+        if (targets.recorder != nullptr)
+        {
+            if (slot->event.type == recording::EventType::MarketEvent)
+                targets.recorder->record(slot->marketEvent);
+            else
+                targets.recorder->record(slot->executionReport);
+        }
+        recordingItems.pop();
+
+        account(recorderStage, enqueued, started);
+        return true;
+    }
+}
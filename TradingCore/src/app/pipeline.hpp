@@ -0,0 +1,400 @@
+/**============================================================================
+Name        : pipeline.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Core-pinned multi-stage trading pipeline.
+============================================================================**/
+
+/*
+    Pipeline runs the trading path on dedicated threads, one per stage, and
+    connects the stages with bounded SPSC queues that carry the domain
+    messages by value (see docs/2_Modules_per_CPU.md).
+
+    Data Flow:
+
+        networkCore        IMarketDataSource::start()
+           |
+           | Q1 RawMessage (copy of the frame)
+           v
+        marketDataCore     MarketDataMessageHandler -> parser -> BookRegistry
+           |
+           | Q2 MarketEvent
+           v
+        tradingCore        MarketEventHandler -> Strategy -> StrategyExecutor
+           ^                                   -> OrderManager (risk check)
+           |                  |
+           |                  | Q3 OrderCommand (approved Order / cancel)
+           |                  v
+           |        executionCore   IExecutionGateway -> exchange
+           |                  |
+           +------------------+ Q4 ExecutionReport
+
+        tradingCore ---- recording queue (try_push, drops when full) ----> backgroundCore
+                                                                             IRecorder
+
+    Wiring:
+
+        Pipeline implements the interfaces the synchronous components already
+        depend on, and the composition root passes the pipeline in place of
+        the next stage:
+
+            IMarketDataMessageHandler   network thread   -> Q1
+            IMarketEventHandler         market-data      -> Q2
+            IExecutionGateway           trading          -> Q3
+            IRecorder                   trading          -> recording queue
+            submitExecutionReport()     execution        -> Q4
+
+        connect() hands over the components that consume the queues. Every
+        interface method must be called only from the thread named above,
+        because each queue has exactly one producer.
+
+    Threads:
+
+        The network, market-data, trading and execution stages are pinned to
+        their configured cores (UnpinnedCore leaves a stage to the scheduler)
+        and busy-poll their input queues. The background thread drains the
+        recording queue, yields when idle and periodically recalibrates
+        TscClock and, with TRADING_CORE_TRACING, collects the tick-to-trade
+        traces of the other stages into trace::collector().
+
+        A stage whose output queue is full spins until the next stage makes
+        room (backpressure). Only the recording queue drops: a slow recorder
+        never stalls market-data ingestion or order flow.
+
+        Trading and execution feed each other through Q3 and Q4, so the
+        execution stage may itself be waiting for room in Q4. While Q3 is
+        full the trading stage therefore moves the reports of Q4 into a
+        deferred list instead of spinning, and hands them to the report
+        handler at its next poll, before anything newer from Q4. The report
+        handler never runs inside send() or cancel(), so OrderManager is not
+        re-entered from createOrder() or cancelAll(). The list is a ring of
+        DeferredReportCapacity reports allocated with the Pipeline, so the
+        trading thread never allocates under backpressure. When it is full
+        the trading stage stops taking reports from Q4 and only waits for
+        Q3, while the execution stage keeps draining Q3 into Q4. The reports
+        not yet applied while one market event runs are bounded by what Q3,
+        Q4 and the ring hold together: an event that sends or cancels more
+        than about OrderCommandCapacity + ExecutionReportCapacity +
+        DeferredReportCapacity orders (one report each) leaves both stages
+        waiting for each other. Every wait on a full ring is counted in
+        deferredReportOverflows, so monitoring sees it first.
+
+    Shutdown:
+
+        stop() stops the source, join() waits for it to return by itself.
+        Both then stop the stages in data-flow order; every stage drains its
+        input queue before it exits. Trading and execution form a loop
+        (orders out, reports back): the trading stage stops the execution
+        stage after its last market event and keeps taking reports until the
+        execution stage has exited. An order sent after that is answered
+        with a Rejected report, so OrderManager releases its reservation; a
+        cancel after that is counted in droppedCancels.
+
+    Statistics:
+
+        Per queue: current depth, the largest depth seen by the consumer and
+        the number of rejected items (oversized frames, recorder drops).
+        Per stage: processed items, time waited in the input queue and
+        processing time, as totals and maxima in nanoseconds.
+
+    Pipeline does not:
+
+        - own the stage components (they are owned by the composition root);
+        - decide trading logic or perform risk checks itself;
+        - reorder messages (every queue is FIFO).
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_PIPELINE_HPP
+#define FINANCETECHNOLOGYPROJECTS_PIPELINE_HPP
+
+#include "market_data_message_handler.hpp"
+#include "interfaces/market_data_source.hpp"
+#include "interfaces/market_event_handler.hpp"
+#include "execution_gateway.hpp"
+#include "execution_report_handler.hpp"
+#include "recorder.hpp"
+#include "recording_event.hpp"
+#include "spsc_queue.hpp"
+#include "timestamp.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+namespace trading::app
+{
+    using CoreId = int;
+
+    inline constexpr CoreId UnpinnedCore { -1 };
+
+    struct PipelineConfig
+    {
+        CoreId networkCore { 0 };
+        CoreId marketDataCore { 1 };
+        CoreId tradingCore { 2 };
+        CoreId executionCore { 3 };
+        CoreId backgroundCore { UnpinnedCore };
+    };
+
+    struct PipelineTargets
+    {
+        market_data::IMarketDataSource* source { nullptr };
+        market_data::IMarketDataMessageHandler* messageHandler { nullptr };
+        market_data::IMarketEventHandler* marketEventHandler { nullptr };
+        execution::ExecutionReportHandler* executionReportHandler { nullptr };
+        execution::IExecutionGateway* gateway { nullptr };
+        recording::IRecorder* recorder { nullptr };
+    };
+
+    enum class OrderCommandType : uint8_t
+    {
+        Send,
+        Cancel
+    };
+
+    // Q3 item: an order approved by risk, or the id of an order to cancel.
+    struct OrderCommand
+    {
+        OrderCommandType type { OrderCommandType::Send };
+        Timestamp enqueued {};
+        execution::Order order {};
+    };
+
+    struct QueueStatistics
+    {
+        std::size_t depth { 0 };
+        std::size_t maxDepth { 0 };
+        std::size_t capacity { 0 };
+        uint64_t rejected { 0 };
+    };
+
+    struct StageStatistics
+    {
+        uint64_t processed { 0 };
+        uint64_t waitNanoseconds { 0 };
+        uint64_t maxWaitNanoseconds { 0 };
+        uint64_t serviceNanoseconds { 0 };
+        uint64_t maxServiceNanoseconds { 0 };
+        bool pinned { false };
+
+        [[nodiscard]]
+        double averageWaitNanoseconds() const noexcept;
+
+        [[nodiscard]]
+        double averageServiceNanoseconds() const noexcept;
+    };
+
+    struct PipelineStatistics
+    {
+        QueueStatistics rawMessages {};
+        QueueStatistics marketEvents {};
+        QueueStatistics orderCommands {};
+        QueueStatistics executionReports {};
+        QueueStatistics recording {};
+
+        StageStatistics marketData {};
+        StageStatistics trading {};
+        StageStatistics execution {};
+        StageStatistics recorder {};
+
+        // Reports the ExecutionReportHandler did not match to a known order.
+        uint64_t unknownExecutionReports { 0 };
+        // Cancels issued after the execution stage had exited.
+        uint64_t droppedCancels { 0 };
+        // Times the deferred report ring was full: the trading stage left reports in Q4
+        // while it waited for Q3, or dropped the Rejected report of an unsent order.
+        uint64_t deferredReportOverflows { 0 };
+    };
+
+    class Pipeline final : public market_data::IMarketDataMessageHandler,
+                           public market_data::IMarketEventHandler,
+                           public execution::IExecutionGateway,
+                           public recording::IRecorder
+    {
+    public:
+        // Largest raw frame carried by Q1, larger frames are rejected.
+        static constexpr std::size_t MaxRawMessageSize { 32 * 1024 };
+
+        static constexpr std::size_t RawMessageCapacity { 128 };
+        static constexpr std::size_t MarketEventCapacity { 4096 };
+        static constexpr std::size_t OrderCommandCapacity { 1024 };
+        static constexpr std::size_t ExecutionReportCapacity { 1024 };
+        static constexpr std::size_t RecordingCapacity { 16 * 1024 };
+        // Reports the trading stage holds back while it waits for room in Q3.
+        static constexpr std::size_t DeferredReportCapacity { 16 * 1024 };
+
+        explicit Pipeline(PipelineConfig config = {});
+        ~Pipeline() override;
+
+        Pipeline(const Pipeline&) = delete;
+        Pipeline& operator=(const Pipeline&) = delete;
+
+        Pipeline(Pipeline&&) = delete;
+        Pipeline& operator=(Pipeline&&) = delete;
+
+        // Must be called before start(). Components left nullptr are skipped.
+        void connect(const PipelineTargets& targets) noexcept;
+
+        void start();
+
+        // Stops the source, then drains and stops the stages.
+        void stop();
+
+        // Waits until the source returns by itself, then drains and stops the stages.
+        void join();
+
+        [[nodiscard]]
+        bool isRunning() const noexcept;
+
+        // Network thread.
+        void onMessage(std::string_view message) override;
+
+        // Market-data thread.
+        void onMarketEvent(const market_data::MarketEvent& event) override;
+
+        // Trading thread.
+        void send(const execution::Order& order) override;
+        void cancel(OrderId orderId) override;
+        void record(const market_data::MarketEvent& event) override;
+        void record(const execution::ExecutionReport& report) override;
+
+        // Execution thread.
+        void submitExecutionReport(const execution::ExecutionReport& report);
+
+        // Safe to call from any thread while the pipeline runs.
+        [[nodiscard]]
+        PipelineStatistics statistics() const noexcept;
+
+        [[nodiscard]]
+        const PipelineConfig& config() const noexcept;
+
+    private:
+        static constexpr std::size_t CacheLineSize { 64 };
+
+        struct RawMessage
+        {
+            Timestamp enqueued {};
+            uint32_t size { 0 };
+            std::array<char, MaxRawMessageSize> data;
+        };
+
+        template<typename T>
+        struct Stamped
+        {
+            Timestamp enqueued {};
+            T value {};
+        };
+
+        struct RecordingItem
+        {
+            recording::RecordingEvent event {};
+            market_data::MarketEvent marketEvent {};
+            execution::ExecutionReport executionReport {};
+        };
+
+        // Written only by the thread that owns the counter.
+        struct alignas(CacheLineSize) QueueCounters
+        {
+            std::atomic<std::size_t> maxDepth { 0 };
+            std::atomic<uint64_t> rejected { 0 };
+        };
+
+        struct alignas(CacheLineSize) StageCounters
+        {
+            std::atomic<uint64_t> processed { 0 };
+            std::atomic<uint64_t> waitNanoseconds { 0 };
+            std::atomic<uint64_t> maxWaitNanoseconds { 0 };
+            std::atomic<uint64_t> serviceNanoseconds { 0 };
+            std::atomic<uint64_t> maxServiceNanoseconds { 0 };
+            std::atomic<bool> pinned { false };
+        };
+
+        void runNetwork();
+        void runMarketData();
+        void runTrading();
+        void runExecution();
+        void runRecorder();
+
+        [[nodiscard]]
+        bool pollMarketData();
+
+        [[nodiscard]]
+        bool pollTrading();
+
+        [[nodiscard]]
+        bool pollExecutionReport();
+
+        // Moves one report of Q4 to deferredReports; false if Q4 is empty or the ring is full.
+        [[nodiscard]]
+        bool deferExecutionReport() noexcept;
+
+        [[nodiscard]]
+        bool applyDeferredReports();
+
+        void applyExecutionReport(const Stamped<execution::ExecutionReport>& item);
+
+        void pushOrderCommand(const OrderCommand& command);
+
+        [[nodiscard]]
+        bool pollExecution();
+
+        [[nodiscard]]
+        bool pollRecorder();
+
+        void shutdown();
+
+        PipelineConfig configuration;
+        PipelineTargets targets {};
+
+        SpscQueue<RawMessage, RawMessageCapacity> rawMessages;
+        SpscQueue<Stamped<market_data::MarketEvent>, MarketEventCapacity> marketEvents;
+        SpscQueue<OrderCommand, OrderCommandCapacity> orderCommands;
+        SpscQueue<Stamped<execution::ExecutionReport>, ExecutionReportCapacity> executionReports;
+        SpscQueue<RecordingItem, RecordingCapacity> recordingItems;
+
+        QueueCounters rawMessageCounters;
+        QueueCounters marketEventCounters;
+        QueueCounters orderCommandCounters;
+        QueueCounters executionReportCounters;
+        QueueCounters recordingCounters;
+
+        StageCounters marketDataStage;
+        StageCounters tradingStage;
+        StageCounters executionStage;
+        StageCounters recorderStage;
+
+        // Written by the trading thread.
+        std::atomic<uint64_t> unknownExecutionReports { 0 };
+        std::atomic<uint64_t> droppedCancels { 0 };
+        std::atomic<uint64_t> deferredReportOverflows { 0 };
+
+        // Trading thread only (both ends): reports taken from Q4 while it waited for room in Q3.
+        SpscQueue<Stamped<execution::ExecutionReport>, DeferredReportCapacity> deferredReports;
+
+        // A stage keeps polling while its active flag is set and drains its input once it is cleared.
+        alignas(CacheLineSize) std::atomic<bool> marketDataActive { false };
+        std::atomic<bool> tradingActive { false };
+        std::atomic<bool> executionActive { false };
+        std::atomic<bool> recorderActive { false };
+
+        // Cleared by a stage thread when it exits: producers stop waiting for room.
+        std::atomic<bool> marketDataConsuming { false };
+        std::atomic<bool> tradingConsuming { false };
+        std::atomic<bool> executionConsuming { false };
+
+        std::thread networkThread;
+        std::thread marketDataThread;
+        std::thread tradingThread;
+        std::thread executionThread;
+        std::thread recorderThread;
+
+        bool running { false };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_PIPELINE_HPP
@@ -0,0 +1,192 @@
+/**============================================================================
+Name        : replay_engine.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Deterministic backtest over recorded journals.
+============================================================================**/
+
+#include "replay_engine.hpp"
+
+#include "execution_report_handler.hpp"
+#include "journal_reader.hpp"
+#include "market_event_handler.hpp"
+#include "order_manager.hpp"
+#include "pnl_calculator.hpp"
+#include "position_manager.hpp"
+#include "recorder.hpp"
+#include "reference_prices.hpp"
+#include "risk_manager.hpp"
+#include "strategy_executor.hpp"
+#include "timestamp.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace trading::backtest
+{
+    namespace
+    {
+        // The replayed events are already recorded.
+        struct NullRecorder final : recording::IRecorder
+        {
+            void record(const market_data::MarketEvent&) override {}
+            void record(const execution::ExecutionReport&) override {}
+        };
+
+        // One run of the strategy stack, wired as in Application.
+        class Session
+        {
+        public:
+            Session(const Instrument& instrument, const ReplayConfig& config):
+                instruments { instrument },
+                position { instrument.id() },
+                riskManager { config.limits, instruments },
+                strategy { config.thresholdNumerator, config.thresholdDenominator },
+                gateway { execution::SimulatedExecutionConfig { .clock = execution::SimulatedClock::Virtual,
+                                                                .orderEntryLatency = config.orderEntryLatency,
+                                                                .ackLatency = config.ackLatency } },
+                orderManager { gateway, riskManager, position, execution::OrderStoreConfig { .instruments = instruments } },
+                executor { orderManager, config.orderQuantity },
+                marketEventHandler { strategy, executor, recorder },
+                referencePrices { instruments, marketEventHandler },
+                reportHandler { orderManager, positionManager, recorder }
+            {
+                riskManager.setReferencePrices(referencePrices);
+            }
+
+            void onMarketEvent(const market_data::MarketEvent& event)
+            {
+                ++result.marketEvents;
+                lastEvent = event;
+
+                gateway.advanceTo(event.receiveTimestamp);
+                gateway.onMarketEvent(event);
+                applyReports();
+
+                referencePrices.onMarketEvent(event);
+                applyReports();
+            }
+
+            [[nodiscard]]
+            ReplayResult& statistics() noexcept
+            {
+                return result;
+            }
+
+            [[nodiscard]]
+            ReplayResult finish(const uint64_t elapsedNanoseconds)
+            {
+                result.orders = gateway.statistics().orders;
+                result.fills = gateway.statistics().fills;
+                result.position = position;
+                if (result.marketEvents != 0)
+                    result.unrealizedPnl = pnl::PnLCalculator::calculateUnrealized(position, lastEvent);
+                result.elapsedNanoseconds = elapsedNanoseconds;
+                return result;
+            }
+
+        private:
+            void applyReports()
+            {
+                const std::size_t _ = gateway.deliverReports([this](const execution::ExecutionReport& report) {
+                    // Before the handler: realized PnL needs the position the fill closes.
+                    if (report.execType == ExecType::Trade)
+                        result.realizedPnl += pnl::PnLCalculator::calculateRealized(position, report);
+
+                    const bool _ = reportHandler.onExecutionReport(report);
+                });
+            }
+
+            std::array<Instrument, 1> instruments;
+            NullRecorder recorder;
+            position::Position position;
+            position::PositionManager positionManager;
+            risk::RiskManager riskManager;
+            strategy::ImbalanceStrategy strategy;
+            execution::SimulatedExecutionGateway gateway;
+            execution::OrderManager orderManager;
+            strategy::StrategyExecutor executor;
+            market_data::MarketEventHandler marketEventHandler;
+            risk::ReferencePrices referencePrices;
+            execution::ExecutionReportHandler reportHandler;
+
+            market_data::MarketEvent lastEvent {};
+            ReplayResult result {};
+        };
+    }
+
+    ReplayEngine::ReplayEngine(const Instrument& instrument, const ReplayConfig& config) noexcept:
+        instrument { instrument },
+        config { config }
+    {
+    }
+
+    std::expected<ReplayResult, ReplayError> ReplayEngine::run(const std::span<const std::filesystem::path> journals) const
+    {
+        // Open and map every file before the clock starts.
+        std::vector<std::unique_ptr<recording::JournalReader>> readers;
+        readers.reserve(journals.size());
+        for (const std::filesystem::path& journal : journals)
+        {
+            auto& reader = readers.emplace_back(std::make_unique<recording::JournalReader>(journal));
+            if (reader->status() == recording::JournalReadStatus::CannotOpenFile)
+                return std::unexpected(ReplayError::CannotOpenJournal);
+            if (!reader->isOpen())
+                return std::unexpected(ReplayError::InvalidJournal);
+        }
+
+        Session session { instrument, config };
+        ReplayResult& statistics = session.statistics();
+        uint64_t nextSequence { 0 };
+
+        const Timestamp start = Timestamp::now();
+        for (const auto& reader : readers)
+        {
+            for (const recording::JournalRecord& record : reader->records())
+            {
+                ++statistics.records;
+                if (nextSequence != 0 && record.sequence != nextSequence)
+                    ++statistics.sequenceGaps;
+                nextSequence = record.sequence + 1;
+
+                if (record.type != recording::EventType::MarketEvent)
+                {
+                    ++statistics.skipped;
+                    continue;
+                }
+
+                const market_data::MarketEvent event = recording::marketEventOf(record);
+                if (event.instrument != instrument.id())
+                {
+                    ++statistics.skipped;
+                    continue;
+                }
+
+                session.onMarketEvent(event);
+            }
+        }
+        return session.finish(Timestamp::now() - start);
+    }
+
+    ReplayResult ReplayEngine::run(const std::span<const market_data::MarketEvent> events) const
+    {
+        Session session { instrument, config };
+        ReplayResult& statistics = session.statistics();
+
+        const Timestamp start = Timestamp::now();
+        for (const market_data::MarketEvent& event : events)
+        {
+            ++statistics.records;
+            if (event.instrument != instrument.id())
+            {
+                ++statistics.skipped;
+                continue;
+            }
+            session.onMarketEvent(event);
+        }
+        return session.finish(Timestamp::now() - start);
+    }
+}
@@ -0,0 +1,174 @@
+/**============================================================================
+Name        : replay_engine.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Deterministic backtest over recorded journals.
+============================================================================**/
+
+/*
+    ReplayEngine runs the strategy stack of the trading system over recorded
+    market data and reports the PnL it would have made.
+
+    Data Flow:
+
+        journal files (JournalReader, mmap)      or      MarketEvent span
+               |                                               |
+               +-------------------+---------------------------+
+                                   |
+                                   | MarketEvent, recording order
+                                   v
+        SimulatedExecutionGateway.onMarketEvent() -- fills resting orders
+                                   |
+                                   v
+        ReferencePrices -> MarketEventHandler -> ImbalanceStrategy
+                                   |
+                                   v
+        StrategyExecutor -> OrderManager -> RiskManager
+                                   |
+                                   | send()
+                                   v
+        SimulatedExecutionGateway
+                                   |
+                                   | deliverReports()
+                                   v
+        ExecutionReportHandler -> OrderManager / Position / PositionManager
+                                   |
+                                   v
+                             ReplayResult
+
+    Determinism:
+
+        A run is single-threaded and builds a fresh set of components, so
+        the gateway, risk and position state start empty. Time is the
+        virtual time of the recorded events: nothing in the path reads a
+        clock, and the same journal gives the same orders, fills and PnL on
+        every run. Only elapsedNanoseconds, the wall time of the run, and
+        the rate derived from it differ.
+
+    Order of one event:
+
+        1. the gateway clock moves to the receive time of the event, the
+           requests that reached the exchange by then are processed, the
+           gateway sees the new top of book and fills the resting orders it
+           reaches; the due reports are applied;
+        2. the strategy sees the event and may send an order; with zero
+           latencies (ReplayConfig::orderEntryLatency and ackLatency) the
+           gateway processes it at once and its reports are applied.
+
+        The strategy therefore always sees the fills caused by an event
+        before deciding on it.
+
+    PnL:
+
+        Realized PnL is accumulated per fill from the position before the
+        fill (PnLCalculator::calculateRealized). Unrealized PnL marks the
+        final position to the last replayed event.
+
+    ReplayEngine does not:
+
+        - rebuild books from raw BookUpdates (journals hold MarketEvents);
+        - replay the recorded ExecutionReports (they are skipped and
+          counted, the gateway produces its own);
+        - trade more than one instrument per run.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_REPLAY_ENGINE_HPP
+#define FINANCETECHNOLOGYPROJECTS_REPLAY_ENGINE_HPP
+
+#include "imbalance_strategy.hpp"
+#include "instrument.hpp"
+#include "market_event.hpp"
+#include "position.hpp"
+#include "risk_limits.hpp"
+#include "simulated_execution_gateway.hpp"
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <span>
+
+namespace trading::backtest
+{
+    enum class ReplayError : uint8_t
+    {
+        CannotOpenJournal,
+        InvalidJournal
+    };
+
+    struct ReplayConfig
+    {
+        Quantity orderQuantity { 100'000'000 };
+
+        risk::RiskLimits limits {
+            .maxOrderQuantity = Quantity { 100'000'000 },
+            .maxPositionQuantity = Quantity { 500'000'000 },
+            .maxNotional = Price { 100'000'000'000'000 },
+            .priceBand = 50,
+            .priceBandUnit = risk::PriceBandUnit::BasisPoints
+        };
+
+        strategy::ImbalanceStrategy::Value thresholdNumerator { strategy::ImbalanceStrategy::DefaultThresholdNumerator };
+        strategy::ImbalanceStrategy::Value thresholdDenominator { strategy::ImbalanceStrategy::DefaultThresholdDenominator };
+
+        /*
+            Latencies of the SimulatedExecutionGateway in nanoseconds. The
+            gateway always runs on the virtual clock (SimulatedClock::Virtual):
+            they are measured against the event receive timestamps.
+        */
+        uint64_t orderEntryLatency { 0 };
+        uint64_t ackLatency { 0 };
+    };
+
+    struct ReplayResult
+    {
+        // Journal records read, of any type and instrument.
+        uint64_t records { 0 };
+        uint64_t marketEvents { 0 };
+
+        // Execution reports and events of other instruments.
+        uint64_t skipped { 0 };
+
+        // Breaks in the journal sequence numbers (dropped records).
+        uint64_t sequenceGaps { 0 };
+
+        uint64_t orders { 0 };
+        uint64_t fills { 0 };
+
+        position::Position position {};
+        Price realizedPnl {};
+        Price unrealizedPnl {};
+
+        uint64_t elapsedNanoseconds { 0 };
+
+        [[nodiscard]]
+        constexpr Price totalPnl() const noexcept {
+            return realizedPnl + unrealizedPnl;
+        }
+
+        [[nodiscard]]
+        constexpr double eventsPerSecond() const noexcept {
+            return elapsedNanoseconds == 0 ? 0.0 : static_cast<double>(marketEvents) * 1e9 / static_cast<double>(elapsedNanoseconds);
+        }
+    };
+
+    class ReplayEngine final
+    {
+    public:
+        explicit ReplayEngine(const Instrument& instrument, const ReplayConfig& config = {}) noexcept;
+
+        // Journal files of one recorder run, in file order.
+        [[nodiscard]]
+        std::expected<ReplayResult, ReplayError> run(std::span<const std::filesystem::path> journals) const;
+
+        [[nodiscard]]
+        ReplayResult run(std::span<const market_data::MarketEvent> events) const;
+
+    private:
+        Instrument instrument;
+        ReplayConfig config;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_REPLAY_ENGINE_HPP
@@ -13,18 +13,84 @@ Description : Application configuration model.
 #include "risk_limits.hpp"
 #include "types.hpp"
 
+#include <filesystem>
+#include <optional>
+
 namespace trading::config
 {
+    /*
+        The risk limits a configuration file sets. A limit missing from the
+        file stays std::nullopt and keeps its active value when the Config is
+        applied (see applyRiskLimits()): a partial file never disables the
+        other limits.
+    */
+    struct RiskLimitsConfig
+    {
+        std::optional<Quantity> maxOrderQuantity {};
+        std::optional<Quantity> maxPositionQuantity {};
+        std::optional<Price> maxNotional {};
+        std::optional<Price> maxOpenNotional {};
+        std::optional<int64_t> priceBand {};
+        // Unit of priceBand, ignored without it.
+        risk::PriceBandUnit priceBandUnit { risk::PriceBandUnit::BasisPoints };
+    };
+
     struct Config
     {
         InstrumentId instrument { 1 };
 
         Quantity strategyOrderQuantity { 100'000'000 };
-        int64_t strategyThresholdNumerator { 7 };
-        int64_t strategyThresholdDenominator { 10 };
+        // A field the file does not set keeps its active value (see ConfigReloader).
+        std::optional<int64_t> strategyThresholdNumerator {};
+        std::optional<int64_t> strategyThresholdDenominator {};
 
-        risk::RiskLimits riskLimits {};
+        RiskLimitsConfig riskLimits {};
+    };
+
+    /*
+        Settings read once when the Application is constructed; a reload does
+        not change them. Kept out of Config, which ConfigChannel copies into
+        its slots and must stay trivially copyable.
+    */
+    struct StartupConfig
+    {
+        std::filesystem::path journalDirectory { "journal" };
     };
+
+    // 'active' with the limits present in 'config' replaced.
+    [[nodiscard]]
+    constexpr risk::RiskLimits applyRiskLimits(risk::RiskLimits active, const RiskLimitsConfig& config) noexcept
+    {
+        active.maxOrderQuantity = config.maxOrderQuantity.value_or(active.maxOrderQuantity);
+        active.maxPositionQuantity = config.maxPositionQuantity.value_or(active.maxPositionQuantity);
+        active.maxNotional = config.maxNotional.value_or(active.maxNotional);
+        active.maxOpenNotional = config.maxOpenNotional.value_or(active.maxOpenNotional);
+
+        if (config.priceBand.has_value())
+        {
+            active.priceBand = *config.priceBand;
+            active.priceBandUnit = config.priceBandUnit;
+        }
+
+        return active;
+    }
+
+    // Checks the values a running application can apply (see ConfigChannel).
+    [[nodiscard]]
+    constexpr bool isValid(const Config& config) noexcept
+    {
+        const RiskLimitsConfig& limits = config.riskLimits;
+
+        return config.instrument != InstrumentId { 0 } &&
+               config.strategyOrderQuantity.isPositive() &&
+               config.strategyThresholdNumerator.value_or(0) >= 0 &&
+               config.strategyThresholdDenominator.value_or(1) > 0 &&
+               limits.maxOrderQuantity.value_or(Quantity {}).raw() >= 0 &&
+               limits.maxPositionQuantity.value_or(Quantity {}).raw() >= 0 &&
+               limits.maxNotional.value_or(Price {}).raw() >= 0 &&
+               limits.maxOpenNotional.value_or(Price {}).raw() >= 0 &&
+               limits.priceBand.value_or(0) >= 0;
+    }
 }
 
 #endif // FINANCETECHNOLOGYPROJECTS_CONFIG_HPP
\ No newline at end of file
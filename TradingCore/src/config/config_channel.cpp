@@ -0,0 +1,34 @@
+/**============================================================================
+Name        : config_channel.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Lock-free hand-over of a new Config to the trading thread.
+============================================================================**/
+
+#include "config_channel.hpp"
+
+namespace trading::config
+{
+    bool ConfigChannel::publish(const Config& config)
+    {
+        if (!isValid(config))
+            return false;
+
+        const std::lock_guard lock { writerMutex };
+        cell.publish(config);
+        published.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    const Config* ConfigChannel::poll() noexcept
+    {
+        return cell.update();
+    }
+
+    uint64_t ConfigChannel::publishedCount() const noexcept
+    {
+        return published.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,85 @@
+/**============================================================================
+Name        : config_channel.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Lock-free hand-over of a new Config to the trading thread.
+============================================================================**/
+
+/*
+    ConfigChannel carries a reloaded Config from a control thread to the
+    trading thread while the application runs, so limits and strategy
+    parameters can be changed without a restart (and without losing the
+    books).
+
+    Data Flow:
+
+        control thread
+           |
+           | JsonConfigLoader::load()
+           v
+        Config ---> publish()      validation, copy into a free slot,
+                       |           one atomic pointer store
+                       v
+                    RcuCell<Config>
+                       |
+                       | poll()    at the next market event
+                       v
+        trading thread (ConfigReloader)
+           |
+           +---> RiskManager::setLimits()
+           +---> ImbalanceStrategy::setThreshold()
+
+    The trading side takes no lock, does not allocate and never observes a
+    partially written Config. Several control threads may publish: they are
+    serialized by a mutex that the trading thread never touches.
+
+    A Config that fails isValid() is not published.
+
+    ConfigChannel does not:
+
+        - read files (JsonConfigLoader does);
+        - apply the Config (ConfigReloader does);
+        - queue intermediate configs: the trading thread sees the latest one.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_CONFIG_CHANNEL_HPP
+#define FINANCETECHNOLOGYPROJECTS_CONFIG_CHANNEL_HPP
+
+#include "config.hpp"
+#include "rcu_cell.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace trading::config
+{
+    class ConfigChannel final
+    {
+    public:
+        ConfigChannel() noexcept = default;
+
+        ConfigChannel(const ConfigChannel&) = delete;
+        ConfigChannel& operator=(const ConfigChannel&) = delete;
+
+        // Control thread. Returns false if the config is not valid.
+        [[nodiscard]]
+        bool publish(const Config& config);
+
+        // Trading thread. The config published since the previous call, or nullptr.
+        [[nodiscard]]
+        const Config* poll() noexcept;
+
+        [[nodiscard]]
+        uint64_t publishedCount() const noexcept;
+
+    private:
+        std::mutex writerMutex;
+        RcuCell<Config> cell;
+        std::atomic<uint64_t> published { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_CONFIG_CHANNEL_HPP
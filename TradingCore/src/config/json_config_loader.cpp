@@ -13,6 +13,7 @@ Description : JSON configuration loader implementation.
 #include <nlohmann/json.hpp>
 
 #include <fstream>
+#include <string>
 #include <stdexcept>
 
 namespace trading::config
@@ -48,11 +49,65 @@ namespace trading::config
             }
             if (json.contains("risk"))
             {
-                [[maybe_unused]]
                 const auto& risk = json.at("risk");
-                // RiskLimits fields will be mapped here.
+                RiskLimitsConfig& limits = config.riskLimits;
+
+                if (risk.contains("maxOrderQuantity")) {
+                    limits.maxOrderQuantity = Quantity {risk.at("maxOrderQuantity").get<Quantity::Value>()};
+                }
+                if (risk.contains("maxPositionQuantity")) {
+                    limits.maxPositionQuantity = Quantity {risk.at("maxPositionQuantity").get<Quantity::Value>()};
+                }
+                if (risk.contains("maxNotional")) {
+                    limits.maxNotional = Price {risk.at("maxNotional").get<Price::Value>()};
+                }
+                if (risk.contains("maxOpenNotional")) {
+                    limits.maxOpenNotional = Price {risk.at("maxOpenNotional").get<Price::Value>()};
+                }
+                if (risk.contains("priceBandTicks")) {
+                    limits.priceBand = risk.at("priceBandTicks").get<int64_t>();
+                    limits.priceBandUnit = risk::PriceBandUnit::Ticks;
+                }
+                else if (risk.contains("priceBandBasisPoints")) {
+                    limits.priceBand = risk.at("priceBandBasisPoints").get<int64_t>();
+                    limits.priceBandUnit = risk::PriceBandUnit::BasisPoints;
+                }
             }
 
+            if (!isValid(config))
+                return std::unexpected(Error::InvalidConfiguration);
+
+            return config;
+        }
+        catch (const nlohmann::json::parse_error&)
+        {
+            return std::unexpected(Error::InvalidJson);
+        }
+        catch (const nlohmann::json::type_error&)
+        {
+            return std::unexpected(Error::InvalidConfiguration);
+        }
+    }
+
+    std::expected<StartupConfig, Error> JsonConfigLoader::loadStartup(const std::filesystem::path& configPath)
+    {
+        std::ifstream file { configPath };
+        if (!file)
+            return std::unexpected(Error::FileOpenFailed);
+
+        try
+        {
+            const nlohmann::json json = nlohmann::json::parse(file);
+
+            StartupConfig config {};
+
+            if (json.contains("journalDirectory")) {
+                config.journalDirectory = json.at("journalDirectory").get<std::string>();
+            }
+
+            if (config.journalDirectory.empty())
+                return std::unexpected(Error::InvalidConfiguration);
+
             return config;
         }
         catch (const nlohmann::json::parse_error&)
@@ -64,4 +119,4 @@ namespace trading::config
             return std::unexpected(Error::InvalidConfiguration);
         }
     }
-}
\ No newline at end of file
+}
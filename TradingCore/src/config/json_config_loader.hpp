@@ -28,8 +28,18 @@ namespace trading::config
     class JsonConfigLoader final
     {
     public:
+        /*
+            Risk limits and threshold fields missing from the file stay unset
+            and keep their active values when the Config is applied. Either
+            strategy.thresholdNumerator or strategy.thresholdDenominator may
+            be set alone.
+        */
         [[nodiscard]]
         static std::expected<Config, Error> load(const std::filesystem::path& configPath);
+
+        // Reads the StartupConfig keys of the same file ("journalDirectory").
+        [[nodiscard]]
+        static std::expected<StartupConfig, Error> loadStartup(const std::filesystem::path& configPath);
     };
 }
 
@@ -0,0 +1,476 @@
+/**============================================================================
+Name        : decimal_conversion.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Conversion between decimal text and fixed-point values.
+============================================================================**/
+
+/*
+    Conversion of exchange decimal strings such as "89218.34000000" into the
+    raw integer representation of ScaledValue, and back.
+
+    Parsing Data Flow:
+
+        "89218.34000000"
+               |
+               v
+        parseDecimal<8>()
+               |
+               +---------------------------+
+               |                           |
+               | up to 8 + 8 digits        | anything else
+               v                           v
+          SIMD path                   scalar path
+               |                           |
+               +-------------+-------------+
+                             |
+                             v
+                 8921834000000  /  DecimalConversionError
+
+
+    Accepted format:
+
+        [-]digits[.digits]
+
+        - at least one digit before the decimal point;
+        - at least one digit after the decimal point, if it is present;
+        - no exponent, no leading '+', no whitespace.
+
+    Precision:
+
+        Digits beyond DecimalPlaces are handled according to DecimalRounding:
+
+            Exact              - must be zeros, otherwise PrecisionLoss;
+            TowardZero         - are discarded;
+            HalfAwayFromZero   - are rounded to the nearest value, ties away
+                                 from zero.
+
+    Errors are returned as values; nothing here throws.
+
+    SIMD path:
+
+        Used when the code is compiled with SSE4.1 (or AVX2) enabled and
+        DecimalPlaces == 8. The string, at most 16 bytes, is loaded into one
+        register, validated, and shuffled into 8 integer digits followed by
+        8 fractional digits. Both halves are then combined with three
+        multiply-add steps. A 16-byte decimal fits one 128-bit lane, so the
+        AVX2 build uses the same (VEX-encoded) instructions.
+
+        Strings the SIMD path does not handle (more than 8 integer or
+        fractional digits, signs, invalid characters) are passed to the scalar
+        path, which also produces the error for invalid input. Both paths
+        return identical results for every input.
+
+    Formatting Data Flow:
+
+        8921834000000, DecimalFormat { .fractionDigits = 2 }
+               |
+               v
+        formatDecimal<8>()
+               |
+               v
+        caller buffer: "89218.34"
+
+    Formatting writes the exact value; it never rounds. The number of
+    fractional digits is either DecimalPlaces or the precision of an
+    instrument (see decimalPlacesOf). If the value has non-zero digits beyond
+    the requested precision, formatting fails with errc::invalid_argument
+    instead of sending a different price to the exchange. The buffer contents
+    are unspecified on failure, as with std::to_chars.
+
+    Digits are written two at a time from a 200-byte table and the digit
+    count is derived from the bit width, so the only data-dependent loop is
+    the optional zero trimming.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_DECIMAL_CONVERSION_HPP
+#define FINANCETECHNOLOGYPROJECTS_DECIMAL_CONVERSION_HPP
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+#if defined(__SSE4_1__)
+#include <cstring>
+#include <immintrin.h>
+#endif
+
+namespace trading::details
+{
+    enum class DecimalConversionError : uint8_t
+    {
+        Empty,
+        InvalidCharacter,
+        Overflow,
+        PrecisionLoss
+    };
+
+    enum class DecimalRounding : uint8_t
+    {
+        Exact,
+        TowardZero,
+        HalfAwayFromZero
+    };
+
+    using DecimalConversionResult = std::expected<int64_t, DecimalConversionError>;
+
+    struct DecimalFormat
+    {
+        static constexpr int FullPrecision { -1 };
+
+        // Number of fractional digits; FullPrecision means all DecimalPlaces digits.
+        int fractionDigits { FullPrecision };
+
+        // "1.50000000" -> "1.5", "2.00000000" -> "2"
+        bool trimTrailingZeros { false };
+    };
+
+    // Sign, 19 digits of int64_t and the decimal point.
+    inline constexpr std::size_t MaxDecimalChars { 21 };
+
+    template<int DecimalPlaces>
+    [[nodiscard]]
+    constexpr DecimalConversionResult parseDecimalScalar(const std::string_view text,
+                                                         const DecimalRounding rounding) noexcept
+    {
+        static_assert(DecimalPlaces >= 0 && DecimalPlaces <= 18);
+
+        constexpr uint64_t Scale = [] {
+            uint64_t scale { 1 };
+            for (int index { 0 }; index < DecimalPlaces; ++index)
+                scale *= 10;
+            return scale;
+        }();
+        constexpr uint64_t MaxMagnitude { std::numeric_limits<int64_t>::max() };
+        constexpr uint64_t MaxInteger { MaxMagnitude / Scale };
+
+        // uint64_t holds any 19-digit number without overflow.
+        constexpr std::size_t MaxAccumulatedDigits { 19 };
+
+        if (text.empty())
+            return std::unexpected { DecimalConversionError::Empty };
+
+        const char* current = text.data();
+        const char* const end = current + text.size();
+
+        const bool negative = *current == '-';
+        if (negative)
+            ++current;
+
+        const auto isDigit = [](const char symbol) noexcept {
+            return symbol >= '0' && symbol <= '9';
+        };
+
+        const char* const integerBegin = current;
+        while (current != end && *current == '0')
+            ++current;
+
+        const char* const significantBegin = current;
+        uint64_t integer { 0 };
+        while (current != end && isDigit(*current))
+            integer = integer * 10 + static_cast<uint64_t>(*current++ - '0');
+
+        if (current == integerBegin)
+            return std::unexpected { DecimalConversionError::InvalidCharacter };
+
+        const bool integerTooLong = static_cast<std::size_t>(current - significantBegin) > MaxAccumulatedDigits;
+
+        uint64_t fraction { 0 };
+        int fractionDigits { 0 };
+        int firstExcessDigit { 0 };
+        bool excessNonZero { false };
+
+        if (current != end && *current == '.')
+        {
+            const char* const fractionBegin = ++current;
+            while (current != end && isDigit(*current))
+            {
+                const int digit = *current++ - '0';
+                if (fractionDigits < DecimalPlaces)
+                {
+                    fraction = fraction * 10 + static_cast<uint64_t>(digit);
+                    ++fractionDigits;
+                    continue;
+                }
+
+                if (current - fractionBegin == DecimalPlaces + 1)
+                    firstExcessDigit = digit;
+                excessNonZero |= digit != 0;
+            }
+
+            if (current == fractionBegin)
+                return std::unexpected { DecimalConversionError::InvalidCharacter };
+        }
+
+        if (current != end)
+            return std::unexpected { DecimalConversionError::InvalidCharacter };
+
+        if (integerTooLong || integer > MaxInteger)
+            return std::unexpected { DecimalConversionError::Overflow };
+
+        for (int index { fractionDigits }; index < DecimalPlaces; ++index)
+            fraction *= 10;
+
+        uint64_t magnitude = integer * Scale + fraction;
+
+        if (excessNonZero)
+        {
+            switch (rounding)
+            {
+                case DecimalRounding::Exact:
+                    return std::unexpected { DecimalConversionError::PrecisionLoss };
+                case DecimalRounding::TowardZero:
+                    break;
+                case DecimalRounding::HalfAwayFromZero:
+                    magnitude += firstExcessDigit >= 5 ? 1 : 0;
+                    break;
+            }
+        }
+
+        if (magnitude > MaxMagnitude)
+            return std::unexpected { DecimalConversionError::Overflow };
+
+        const auto value = static_cast<int64_t>(magnitude);
+        return negative ? -value : value;
+    }
+
+#if defined(__SSE4_1__)
+    /*
+        Converts an unsigned decimal with 1..8 integer digits and 0..8
+        fractional digits into its raw value with DecimalPlaces == 8.
+        Returns false for anything else; the caller then falls back to the
+        scalar path.
+    */
+    [[nodiscard]]
+    inline bool parseDecimalSimd(const std::string_view text, int64_t& raw) noexcept
+    {
+        constexpr std::size_t RegisterSize { 16 };
+
+        const std::size_t size = text.size();
+        if (size == 0 || size > RegisterSize)
+            return false;
+
+        __m128i input;
+        if (size == RegisterSize)
+        {
+            input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data()));
+        }
+        else
+        {
+            alignas(RegisterSize) char copy[RegisterSize] {};
+            std::memcpy(copy, text.data(), size);
+            input = _mm_load_si128(reinterpret_cast<const __m128i*>(copy));
+        }
+
+        const auto length = static_cast<char>(size);
+        const __m128i positions = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+        const __m128i digits = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+        const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        const __m128i isDot = _mm_cmpeq_epi8(input, _mm_set1_epi8('.'));
+
+        const auto lengthMask = static_cast<uint32_t>((1u << size) - 1);
+        const auto validMask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(isDigit, isDot))) & lengthMask;
+        const auto dotMask = static_cast<uint32_t>(_mm_movemask_epi8(isDot)) & lengthMask;
+
+        if (validMask != lengthMask || (dotMask & (dotMask - 1)) != 0)
+            return false;
+
+        const int dot = dotMask != 0 ? std::countr_zero(dotMask) : static_cast<int>(size);
+        const int fractionDigits = dotMask != 0 ? static_cast<int>(size) - dot - 1 : 0;
+
+        if (dot == 0 || dot > 8 || fractionDigits > 8 || (dotMask != 0 && fractionDigits == 0))
+            return false;
+
+        /*
+            Output byte i takes the input byte at:
+
+                i < 8   : dot - 8 + i    (integer digits, right-aligned)
+                i >= 8  : dot - 7 + i    (fractional digits, left-aligned)
+
+            Indices outside [0, size) get the high bit set so that the shuffle
+            writes zero digits there.
+        */
+        const __m128i offsets = _mm_setr_epi8(-8, -8, -8, -8, -8, -8, -8, -8, -7, -7, -7, -7, -7, -7, -7, -7);
+        __m128i source = _mm_add_epi8(_mm_add_epi8(positions, offsets), _mm_set1_epi8(static_cast<char>(dot)));
+        const __m128i outside = _mm_or_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), source),
+                                             _mm_cmpgt_epi8(source, _mm_set1_epi8(static_cast<char>(length - 1))));
+        source = _mm_or_si128(source, outside);
+
+        const __m128i aligned = _mm_shuffle_epi8(digits, source);
+
+        const __m128i pairs = _mm_maddubs_epi16(aligned, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+        const __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+        const __m128i packed = _mm_packus_epi32(quads, quads);
+        const __m128i halves = _mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+        const auto integer = static_cast<int64_t>(_mm_cvtsi128_si32(halves));
+        const auto fraction = static_cast<int64_t>(_mm_extract_epi32(halves, 1));
+
+        raw = integer * 100'000'000 + fraction;
+        return true;
+    }
+#endif
+
+    template<int DecimalPlaces>
+    [[nodiscard]]
+    constexpr DecimalConversionResult parseDecimal(const std::string_view text,
+                                                   const DecimalRounding rounding = DecimalRounding::Exact) noexcept
+    {
+#if defined(__SSE4_1__)
+        if constexpr (DecimalPlaces == 8)
+        {
+            if !consteval
+            {
+                int64_t raw { 0 };
+                if (parseDecimalSimd(text, raw)) [[likely]]
+                    return raw;
+            }
+        }
+#endif
+        return parseDecimalScalar<DecimalPlaces>(text, rounding);
+    }
+
+    inline constexpr std::array<char, 200> DigitPairs = [] {
+        std::array<char, 200> pairs {};
+        for (std::size_t value { 0 }; value < 100; ++value)
+        {
+            pairs[2 * value] = static_cast<char>('0' + value / 10);
+            pairs[2 * value + 1] = static_cast<char>('0' + value % 10);
+        }
+        return pairs;
+    }();
+
+    inline constexpr std::array<uint64_t, 20> PowersOfTen = [] {
+        std::array<uint64_t, 20> powers {};
+        uint64_t power { 1 };
+        for (uint64_t& value : powers)
+        {
+            value = power;
+            power *= 10;
+        }
+        return powers;
+    }();
+
+    [[nodiscard]]
+    constexpr int digitCount(const uint64_t value) noexcept
+    {
+        // floor(log10(value)) estimated from the bit width (1233 / 4096 ~ log10(2)), then corrected.
+        // Zero is written as one digit.
+        const uint64_t nonZero = value | 1;
+        const int estimate = static_cast<int>((std::bit_width(nonZero) * 1233) >> 12);
+        return estimate + 1 - static_cast<int>(nonZero < PowersOfTen[static_cast<std::size_t>(estimate)]);
+    }
+
+    /*
+        Writes the lowest 'count' digits of 'value' into [first, first + count),
+        including leading zeros.
+    */
+    constexpr void writeDigits(char* const first, int count, uint64_t value) noexcept
+    {
+        char* current = first + count;
+        for (; count >= 2; count -= 2)
+        {
+            const auto pair = static_cast<std::size_t>(value % 100) * 2;
+            value /= 100;
+            *--current = DigitPairs[pair + 1];
+            *--current = DigitPairs[pair];
+        }
+
+        if (count == 1)
+            *--current = static_cast<char>('0' + value % 10);
+    }
+
+    /*
+        Number of fractional digits needed to represent every multiple of
+        'step', e.g. 2 for a tick size of 0.01. A non-positive step requires
+        the full precision.
+    */
+    template<int DecimalPlaces>
+    [[nodiscard]]
+    constexpr int decimalPlacesOf(int64_t step) noexcept
+    {
+        if (step <= 0)
+            return DecimalPlaces;
+
+        int places { DecimalPlaces };
+        while (places > 0 && step % 10 == 0)
+        {
+            step /= 10;
+            --places;
+        }
+        return places;
+    }
+
+    template<int DecimalPlaces>
+    [[nodiscard]]
+    constexpr std::to_chars_result formatDecimal(char* const first,
+                                                 char* const last,
+                                                 const int64_t raw,
+                                                 const DecimalFormat format = {}) noexcept
+    {
+        static_assert(DecimalPlaces >= 0 && DecimalPlaces <= 18);
+
+        const int fractionDigits = format.fractionDigits < 0 || format.fractionDigits > DecimalPlaces
+            ? DecimalPlaces
+            : format.fractionDigits;
+
+        const bool negative = raw < 0;
+        const uint64_t magnitude = negative ? uint64_t { 0 } - static_cast<uint64_t>(raw) : static_cast<uint64_t>(raw);
+
+        const uint64_t integer = magnitude / PowersOfTen[DecimalPlaces];
+        const uint64_t scaledFraction = magnitude % PowersOfTen[DecimalPlaces];
+        const uint64_t divisor = PowersOfTen[DecimalPlaces - fractionDigits];
+
+        if (scaledFraction % divisor != 0)
+            return { last, std::errc::invalid_argument };
+
+        uint64_t fraction = scaledFraction / divisor;
+        int writtenFractionDigits = fractionDigits;
+
+        if (format.trimTrailingZeros)
+        {
+            if (fraction == 0)
+                writtenFractionDigits = 0;
+
+            while (writtenFractionDigits > 0 && fraction % 10 == 0)
+            {
+                fraction /= 10;
+                --writtenFractionDigits;
+            }
+        }
+
+        const int integerDigits = digitCount(integer);
+        const std::size_t length = static_cast<std::size_t>(negative)
+            + static_cast<std::size_t>(integerDigits)
+            + (writtenFractionDigits > 0 ? static_cast<std::size_t>(writtenFractionDigits) + 1 : 0);
+
+        if (static_cast<std::size_t>(last - first) < length)
+            return { last, std::errc::value_too_large };
+
+        char* current = first;
+        *current = '-';
+        current += negative;
+
+        writeDigits(current, integerDigits, integer);
+        current += integerDigits;
+
+        if (writtenFractionDigits > 0)
+        {
+            *current++ = '.';
+            writeDigits(current, writtenFractionDigits, fraction);
+            current += writtenFractionDigits;
+        }
+
+        return { current, std::errc {} };
+    }
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_DECIMAL_CONVERSION_HPP
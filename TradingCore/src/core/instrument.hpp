@@ -56,6 +56,18 @@ namespace trading
             return lotSize_;
         }
 
+        // Fractional digits of a price on the tick grid, e.g. 2 for a tick size of 0.01.
+        [[nodiscard]]
+        constexpr int priceDecimalPlaces() const noexcept {
+            return details::decimalPlacesOf<Price::DecimalPlaces>(tickSize_.raw());
+        }
+
+        // Fractional digits of a quantity on the lot grid, e.g. 5 for a lot size of 0.00001.
+        [[nodiscard]]
+        constexpr int quantityDecimalPlaces() const noexcept {
+            return details::decimalPlacesOf<Quantity::DecimalPlaces>(lotSize_.raw());
+        }
+
     private:
         InstrumentId id_ { 0 };
         std::string_view symbol_;
@@ -0,0 +1,318 @@
+/**============================================================================
+Name        : instrument_resolver.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Exchange symbol to InstrumentId resolution.
+============================================================================**/
+
+/*
+    InstrumentResolver maps an exchange symbol such as "BTCUSDT" to the
+    InstrumentId of the configured instrument with a minimal perfect hash.
+
+    Data Flow:
+
+        configured instruments                  "s":"BTCUSDT"
+               |                                      |
+               | constructor (startup or constexpr)   | raw symbol bytes
+               v                                      v
+        +------------------------------------------------------+
+        |  key = symbol bytes packed into two uint64_t         |
+        |  bucket = hash(key, Seed) -> displacement[bucket]    |
+        |  slot   = hash(key, displacement) -> entries[slot]   |
+        |  compare entries[slot].key with key                  |
+        +------------------------------------------------------+
+                                  |
+                                  v
+                          InstrumentId / nullopt
+
+    Key:
+
+        Symbols of 1..16 bytes are packed little-endian into two 64-bit words
+        and zero padded. A lookup therefore compares two words and the
+        length, never a string, and allocates nothing.
+
+    Hash:
+
+        Hash-and-displace. Keys are distributed over as many buckets as there
+        are keys. Buckets are placed largest first: for every bucket the
+        smallest displacement is searched that maps all keys of the bucket to
+        free slots. The table has exactly one slot per instrument (minimal),
+        and every lookup computes two hashes and does one key comparison.
+
+    Construction is constexpr, so a fixed instrument list can be resolved by
+    a table built at compile time:
+
+        constexpr std::array instruments { ... };
+        constexpr InstrumentResolver resolver { instruments };
+
+    isValid() is false when the list has more than Capacity instruments, a
+    symbol that is empty or longer than MaxSymbolLength, or duplicate
+    symbols. An invalid resolver resolves nothing.
+
+    InstrumentResolver does not:
+
+        - own instrument definitions;
+        - normalize symbols (case, separators);
+        - know exchange-specific message formats.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_INSTRUMENT_RESOLVER_HPP
+#define FINANCETECHNOLOGYPROJECTS_INSTRUMENT_RESOLVER_HPP
+
+#include "instrument.hpp"
+#include "types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace trading
+{
+    template<std::size_t Capacity>
+    class BasicInstrumentResolver
+    {
+    public:
+        static constexpr std::size_t MaxSymbolLength { 16 };
+
+        constexpr BasicInstrumentResolver() noexcept = default;
+
+        constexpr explicit BasicInstrumentResolver(const std::span<const Instrument> instruments) noexcept
+        {
+            build(instruments);
+        }
+
+        [[nodiscard]]
+        constexpr std::optional<InstrumentId> resolve(const std::string_view symbol) const noexcept
+        {
+            if (count == 0 || symbol.empty() || symbol.size() > MaxSymbolLength)
+                return std::nullopt;
+
+            const Key key = makeKey(symbol);
+            const Entry& entry = entries[slotOf(key)];
+
+            if (entry.key.low != key.low || entry.key.high != key.high || entry.length != symbol.size())
+                return std::nullopt;
+
+            return entry.instrument;
+        }
+
+        [[nodiscard]]
+        constexpr bool isValid() const noexcept
+        {
+            return valid;
+        }
+
+        [[nodiscard]]
+        constexpr std::size_t size() const noexcept
+        {
+            return count;
+        }
+
+    private:
+        struct Key
+        {
+            uint64_t low { 0 };
+            uint64_t high { 0 };
+        };
+
+        struct Entry
+        {
+            Key key {};
+            InstrumentId instrument { 0 };
+            uint32_t length { 0 };
+        };
+
+        static constexpr uint64_t Seed { 0x9E37'79B9'7F4A'7C15 };
+        static constexpr uint32_t MaxDisplacement { 0xFFFF };
+
+        [[nodiscard]]
+        static constexpr Key makeKey(const std::string_view symbol) noexcept
+        {
+            const std::size_t size = symbol.size();
+
+            if !consteval
+            {
+                /*
+                    Overlapping loads keep the key construction free of
+                    loops: the second load ends at the last byte of the
+                    symbol and the bytes already covered by the first load
+                    are shifted out.
+                */
+                const char* const data = symbol.data();
+
+                if (size >= 8)
+                {
+                    uint64_t low { 0 };
+                    uint64_t tail { 0 };
+                    std::memcpy(&low, data, 8);
+                    std::memcpy(&tail, data + size - 8, 8);
+                    return Key { .low = low, .high = size > 8 ? tail >> (8 * (16 - size)) : 0 };
+                }
+
+                if (size >= 4)
+                {
+                    uint32_t head { 0 };
+                    uint32_t tail { 0 };
+                    std::memcpy(&head, data, 4);
+                    std::memcpy(&tail, data + size - 4, 4);
+                    const uint64_t rest = size > 4 ? uint64_t { tail } >> (8 * (8 - size)) : 0;
+                    return Key { .low = head | rest << 32, .high = 0 };
+                }
+            }
+
+            Key key {};
+            for (std::size_t index { 0 }; index < size; ++index)
+            {
+                const auto byte = static_cast<uint64_t>(static_cast<unsigned char>(symbol[index]));
+                if (index < 8)
+                    key.low |= byte << (8 * index);
+                else
+                    key.high |= byte << (8 * (index - 8));
+            }
+            return key;
+        }
+
+        [[nodiscard]]
+        static constexpr uint64_t hash(const Key& key, const uint64_t seed) noexcept
+        {
+            uint64_t value = (key.low ^ seed) * 0xBF58'476D'1CE4'E5B9;
+            value ^= (key.high + seed) * 0x94D0'49BB'1331'11EB;
+            value ^= value >> 31;
+            value *= 0xFF51'AFD7'ED55'8CCD;
+            value ^= value >> 29;
+            return value;
+        }
+
+        // Maps a hash onto [0, range) without a division.
+        [[nodiscard]]
+        static constexpr uint32_t reduce(const uint64_t value, const uint32_t range) noexcept
+        {
+            return static_cast<uint32_t>(((value >> 32) * range) >> 32);
+        }
+
+        [[nodiscard]]
+        constexpr uint32_t slotOf(const Key& key) const noexcept
+        {
+            const uint32_t bucket = reduce(hash(key, Seed), count);
+            return reduce(hash(key, displacements[bucket]), count);
+        }
+
+        constexpr void build(const std::span<const Instrument> instruments) noexcept
+        {
+            if (instruments.empty() || instruments.size() > Capacity)
+                return;
+
+            const auto keyCount = static_cast<uint32_t>(instruments.size());
+
+            std::array<Key, Capacity> keys {};
+            std::array<uint32_t, Capacity> bucketOf {};
+            std::array<uint32_t, Capacity> bucketSize {};
+
+            for (uint32_t index { 0 }; index < keyCount; ++index)
+            {
+                const std::string_view symbol = instruments[index].symbol();
+                if (symbol.empty() || symbol.size() > MaxSymbolLength)
+                    return;
+
+                keys[index] = makeKey(symbol);
+                for (uint32_t other { 0 }; other < index; ++other)
+                {
+                    if (instruments[other].symbol() == symbol)
+                        return;
+                }
+
+                bucketOf[index] = reduce(hash(keys[index], Seed), keyCount);
+                ++bucketSize[bucketOf[index]];
+            }
+
+            std::array<bool, Capacity> occupied {};
+            std::array<uint32_t, Capacity> members {};
+            std::array<uint32_t, Capacity> slots {};
+
+            // Largest buckets first: they are the hardest to place.
+            for (uint32_t size { keyCount }; size > 0; --size)
+            {
+                for (uint32_t bucket { 0 }; bucket < keyCount; ++bucket)
+                {
+                    if (bucketSize[bucket] != size)
+                        continue;
+
+                    uint32_t memberCount { 0 };
+                    for (uint32_t index { 0 }; index < keyCount; ++index)
+                    {
+                        if (bucketOf[index] == bucket)
+                            members[memberCount++] = index;
+                    }
+
+                    if (!place(keys, members, memberCount, slots, occupied, bucket, keyCount))
+                        return;
+
+                    for (uint32_t member { 0 }; member < memberCount; ++member)
+                    {
+                        const uint32_t index = members[member];
+                        entries[slots[member]] = Entry {
+                            .key = keys[index],
+                            .instrument = instruments[index].id(),
+                            .length = static_cast<uint32_t>(instruments[index].symbol().size())
+                        };
+                    }
+                }
+            }
+
+            count = keyCount;
+            valid = true;
+        }
+
+        /*
+            Searches the smallest displacement that maps every member of the
+            bucket to a distinct free slot and marks those slots as occupied.
+        */
+        constexpr bool place(const std::array<Key, Capacity>& keys,
+                             const std::array<uint32_t, Capacity>& members,
+                             const uint32_t memberCount,
+                             std::array<uint32_t, Capacity>& slots,
+                             std::array<bool, Capacity>& occupied,
+                             const uint32_t bucket,
+                             const uint32_t keyCount) noexcept
+        {
+            for (uint32_t displacement { 0 }; displacement <= MaxDisplacement; ++displacement)
+            {
+                bool fits { true };
+                for (uint32_t member { 0 }; member < memberCount && fits; ++member)
+                {
+                    slots[member] = reduce(hash(keys[members[member]], displacement), keyCount);
+                    fits = !occupied[slots[member]];
+
+                    for (uint32_t previous { 0 }; previous < member && fits; ++previous)
+                        fits = slots[previous] != slots[member];
+                }
+
+                if (!fits)
+                    continue;
+
+                for (uint32_t member { 0 }; member < memberCount; ++member)
+                    occupied[slots[member]] = true;
+
+                displacements[bucket] = static_cast<uint16_t>(displacement);
+                return true;
+            }
+
+            return false;
+        }
+
+        std::array<Entry, Capacity> entries {};
+        std::array<uint16_t, Capacity> displacements {};
+        uint32_t count { 0 };
+        bool valid { false };
+    };
+
+    using InstrumentResolver = BasicInstrumentResolver<256>;
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_INSTRUMENT_RESOLVER_HPP
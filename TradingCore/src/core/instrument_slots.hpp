@@ -0,0 +1,152 @@
+/**============================================================================
+Name        : instrument_slots.hpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Direct table from InstrumentId to a dense slot index.
+============================================================================**/
+
+/*
+    Instrument ids are small integers assigned by the instrument
+    configuration. Components that keep per-instrument state index it either
+    directly by InstrumentId (instrumentTableSize()) or by a dense slot found
+    through InstrumentSlots, so a lookup is one array load and no hashing.
+
+    Data Flow:
+
+        InstrumentId
+               |
+               | slotById[instrument]
+               v
+        Slot ---> per-instrument arrays of the owner
+                  (books, positions, templates, ...)
+
+    Slots are handed out in the order of add(): the first instrument added
+    gets slot 0, the next one slot 1, and so on. The owner appends its
+    per-instrument state in the same order.
+
+    Sizing:
+
+        Constructed from an instrument list, the table is sized once for the
+        largest id of the list; add() of those ids never allocates.
+        Default-constructed, the table grows on add() up to the id added.
+        Ids above MaxInstrumentId never get a slot.
+
+    InstrumentSlots does not:
+
+        - own per-instrument state;
+        - remove or reuse slots;
+        - synchronize: it is written by one thread, and read concurrently
+          only once it no longer changes.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_INSTRUMENT_SLOTS_HPP
+#define FINANCETECHNOLOGYPROJECTS_INSTRUMENT_SLOTS_HPP
+
+#include "instrument.hpp"
+#include "types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace trading
+{
+    inline constexpr InstrumentId MaxInstrumentId { 64 * 1024 - 1 };
+
+    namespace details
+    {
+        // Largest id of 'instruments' not above MaxInstrumentId, 0 for none.
+        [[nodiscard]]
+        inline InstrumentId largestInstrumentId(const std::span<const Instrument> instruments) noexcept
+        {
+            InstrumentId maxId { 0 };
+            for (const Instrument& instrument : instruments)
+            {
+                if (instrument.id() <= MaxInstrumentId)
+                    maxId = std::max(maxId, instrument.id());
+            }
+            return maxId;
+        }
+    }
+
+    /*
+        Entries of a table indexed directly by InstrumentId: one per id up to
+        the largest of 'instruments', or up to MaxInstrumentId when the list
+        is empty.
+    */
+    [[nodiscard]]
+    inline std::size_t instrumentTableSize(const std::span<const Instrument> instruments) noexcept
+    {
+        if (instruments.empty())
+            return static_cast<std::size_t>(MaxInstrumentId) + 1;
+
+        return static_cast<std::size_t>(details::largestInstrumentId(instruments)) + 1;
+    }
+
+    class InstrumentSlots
+    {
+    public:
+        using Slot = uint32_t;
+
+        static constexpr Slot NoSlot { std::numeric_limits<Slot>::max() };
+
+        InstrumentSlots() = default;
+
+        explicit InstrumentSlots(const std::span<const Instrument> instruments) :
+            slotById(static_cast<std::size_t>(details::largestInstrumentId(instruments)) + 1, NoSlot)
+        {
+        }
+
+        /*
+            Gives 'instrument' the next slot. Returns NoSlot, and adds nothing,
+            if the id is above MaxInstrumentId or already has a slot.
+        */
+        Slot add(const InstrumentId instrument)
+        {
+            if (instrument > MaxInstrumentId)
+                return NoSlot;
+
+            if (instrument >= slotById.size())
+                slotById.resize(static_cast<std::size_t>(instrument) + 1, NoSlot);
+
+            Slot& slot = slotById[instrument];
+            if (slot != NoSlot)
+                return NoSlot;
+
+            slot = static_cast<Slot>(count);
+            ++count;
+            return slot;
+        }
+
+        // Slot of the instrument, NoSlot if it has none.
+        [[nodiscard]]
+        Slot slotOf(const InstrumentId instrument) const noexcept
+        {
+            return instrument < slotById.size() ? slotById[instrument] : NoSlot;
+        }
+
+        [[nodiscard]]
+        bool contains(const InstrumentId instrument) const noexcept
+        {
+            return slotOf(instrument) != NoSlot;
+        }
+
+        // Number of slots handed out.
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return count;
+        }
+
+    private:
+        std::vector<Slot> slotById;
+        std::size_t count { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_INSTRUMENT_SLOTS_HPP
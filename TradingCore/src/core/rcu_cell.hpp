@@ -0,0 +1,131 @@
+/**============================================================================
+Name        : rcu_cell.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Read-copy-update cell for one writer and one reader thread.
+============================================================================**/
+
+/*
+    RcuCell publishes a value from a writer thread (control, configuration)
+    to a reader thread (trading) without locks. The writer copies a new value
+    into a free slot and publishes it with one atomic pointer store; the
+    reader keeps using the value it holds until it asks for the next one.
+
+    Data Flow:
+
+        writer thread                              reader thread
+           |                                             ^
+           | publish(value)                              | update()
+           v                                             |
+        [ slot | slot | slot ] -- published pointer -----+
+                                  hazard pointer <-------+ (slot held by the reader)
+
+    Slots:
+
+        Three slots are enough for one reader: the writer never writes the
+        published slot nor the slot the reader holds (its hazard pointer),
+        so there is always a third one to write into, and the reader never
+        sees a value that is being written (no torn reads).
+
+    Reader cost:
+
+        update() is one acquire load and a pointer comparison while nothing
+        new is published. Taking a new value costs a sequentially consistent
+        store of the hazard pointer and a load to confirm the value is still
+        the published one.
+
+    The initial value counts as already read: update() returns nullptr until
+    the first publish().
+
+    RcuCell does not:
+
+        - support more than one writer or more than one reader thread
+          (serialize writers outside, see ConfigChannel);
+        - allocate after construction;
+        - keep a history of published values.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_RCU_CELL_HPP
+#define FINANCETECHNOLOGYPROJECTS_RCU_CELL_HPP
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace trading
+{
+    template<typename T>
+    class RcuCell
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "RcuCell values are copied into slots");
+
+    public:
+        explicit RcuCell(const T& initial = T {}) noexcept:
+            slots { initial, initial, initial }
+        {
+        }
+
+        RcuCell(const RcuCell&) = delete;
+        RcuCell& operator=(const RcuCell&) = delete;
+
+        // Writer side.
+        void publish(const T& value) noexcept
+        {
+            const T* const current = published.load(std::memory_order_relaxed);
+            const T* const inUse = hazard.load(std::memory_order_seq_cst);
+
+            T* slot = &slots[0];
+            while (slot == current || slot == inUse)
+                ++slot;
+
+            *slot = value;
+            published.store(slot, std::memory_order_seq_cst);
+        }
+
+        /*
+            Reader side. Returns the latest value if it was published since
+            the previous call, nullptr otherwise. The returned value stays
+            valid and unchanged until the next call.
+        */
+        [[nodiscard]]
+        const T* update() noexcept
+        {
+            const T* latest = published.load(std::memory_order_acquire);
+            if (latest == held)
+                return nullptr;
+
+            for (;;)
+            {
+                hazard.store(latest, std::memory_order_seq_cst);
+
+                const T* const confirmed = published.load(std::memory_order_seq_cst);
+                if (confirmed == latest)
+                    break;
+
+                latest = confirmed;
+            }
+
+            held = latest;
+            return held;
+        }
+
+        // Reader side. The value returned by the last update(), or the initial value.
+        [[nodiscard]]
+        const T& current() const noexcept
+        {
+            return *held;
+        }
+
+    private:
+        static constexpr std::size_t CacheLineSize { 64 };
+
+        std::array<T, 3> slots;
+        alignas(CacheLineSize) std::atomic<const T*> published { &slots[0] };
+        alignas(CacheLineSize) std::atomic<const T*> hazard { &slots[0] };
+        const T* held { &slots[0] };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_RCU_CELL_HPP
@@ -41,6 +41,8 @@ Description : scaled_value.hpp
         - store a fixed-point numeric value;
         - provide the common fixed-point scale;
         - construct values from integer values;
+        - construct values from decimal strings (see decimal_conversion.hpp);
+        - write the exact decimal representation into a caller buffer;
         - expose the raw representation;
         - provide basic arithmetic;
         - provide zero and sign checks;
@@ -78,8 +80,8 @@ Description : scaled_value.hpp
         - what a Quantity represents;
         - whether a value is valid for a particular instrument;
         - exchange-specific precision rules;
-        - rounding policies;
-        - overflow handling.
+        - rounding policies of arithmetic;
+        - overflow handling of arithmetic.
 
 
     Those responsibilities belong to the corresponding domain types and
@@ -89,8 +91,14 @@ Description : scaled_value.hpp
 #ifndef FINANCETECHNOLOGYPROJECTS_SCALED_VALUE_HPP
 #define FINANCETECHNOLOGYPROJECTS_SCALED_VALUE_HPP
 
+#include "decimal_conversion.hpp"
+
+#include <charconv>
 #include <compare>
+#include <cstddef>
 #include <cstdint>
+#include <expected>
+#include <string_view>
 
 namespace trading::details
 {
@@ -110,6 +118,7 @@ namespace trading::details
 
         static constexpr int DecimalPlaces = DecimalPlacesCount;
         static constexpr Value Scale = pow10(DecimalPlaces);
+        static constexpr std::size_t MaxChars = MaxDecimalChars;
 
         constexpr ScaledValue() noexcept = default;
 
@@ -124,12 +133,40 @@ namespace trading::details
             return Derived { value * Scale };
         }
 
+        /*
+            Parses an exchange decimal such as "89218.34000000".
+            Digits beyond DecimalPlaces are handled according to 'rounding'.
+        */
+        [[nodiscard]]
+        static constexpr std::expected<Derived, DecimalConversionError>
+        fromDecimalString(const std::string_view text,
+                          const DecimalRounding rounding = DecimalRounding::Exact) noexcept
+        {
+            const DecimalConversionResult raw = parseDecimal<DecimalPlaces>(text, rounding);
+            if (!raw)
+                return std::unexpected { raw.error() };
+
+            return Derived { *raw };
+        }
+
         [[nodiscard]]
         constexpr Value raw() const noexcept
         {
             return value;
         }
 
+        /*
+            Writes the decimal representation into [first, last) without a
+            terminating null character, following std::to_chars conventions.
+        */
+        [[nodiscard]]
+        constexpr std::to_chars_result toChars(char* const first,
+                                               char* const last,
+                                               const DecimalFormat format = {}) const noexcept
+        {
+            return formatDecimal<DecimalPlaces>(first, last, value, format);
+        }
+
         [[nodiscard]]
         constexpr bool isZero() const noexcept
         {
@@ -0,0 +1,122 @@
+/**============================================================================
+Name        : seqlock.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Single-writer sequence lock for small values.
+============================================================================**/
+
+/*
+    Seqlock shares a small value written by one thread with readers on other
+    threads. Neither side blocks: the writer never waits for readers, and a
+    reader that overlaps a write retries its copy.
+
+    Data Flow:
+
+        writer thread                           reader threads
+           |                                          ^
+           | store(value)                             | load()
+           v                                          |
+        sequence: odd while writing, even when stable |
+        words:    the value, copied word by word -----+
+
+    Protocol:
+
+        store()  sequence += 1 (odd), write the words, sequence += 1 (even)
+        load()   read sequence (even), read the words, read sequence again;
+                 retry if the sequence changed or was odd
+
+    The words are relaxed atomics, so an overlapping read is not a data race;
+    the fences order them against the sequence. A Seqlock is aligned to a
+    cache line so that two slots never share one.
+
+    Seqlock does not:
+
+        - support more than one writer;
+        - hold values larger than a few words (readers copy the whole value);
+        - block or allocate.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_SEQLOCK_HPP
+#define FINANCETECHNOLOGYPROJECTS_SEQLOCK_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace trading
+{
+    template<typename T>
+    class alignas(64) Seqlock
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Seqlock values are copied word by word");
+        static_assert(sizeof(T) % sizeof(uint64_t) == 0, "Seqlock values must be a whole number of words");
+
+        static constexpr std::size_t WordCount { sizeof(T) / sizeof(uint64_t) };
+
+        using Words = std::array<uint64_t, WordCount>;
+
+    public:
+        Seqlock() noexcept = default;
+
+        explicit Seqlock(const T& initial) noexcept
+        {
+            store(initial);
+        }
+
+        Seqlock(const Seqlock&) = delete;
+        Seqlock& operator=(const Seqlock&) = delete;
+
+        // Writer side.
+        void store(const T& value) noexcept
+        {
+            const Words source = std::bit_cast<Words>(value);
+            const uint64_t start = sequence.load(std::memory_order_relaxed);
+
+            sequence.store(start + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (std::size_t index { 0 }; index < WordCount; ++index)
+                words[index].store(source[index], std::memory_order_relaxed);
+
+            sequence.store(start + 2, std::memory_order_release);
+        }
+
+        // Reader side. Never observes a partially written value.
+        [[nodiscard]]
+        T load() const noexcept
+        {
+            Words copy;
+            uint64_t before;
+            do
+            {
+                before = sequence.load(std::memory_order_acquire);
+
+                for (std::size_t index { 0 }; index < WordCount; ++index)
+                    copy[index] = words[index].load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            while ((before & 1) != 0 || before != sequence.load(std::memory_order_relaxed));
+
+            return std::bit_cast<T>(copy);
+        }
+
+        // Number of completed stores.
+        [[nodiscard]]
+        uint64_t version() const noexcept
+        {
+            return sequence.load(std::memory_order_acquire) / 2;
+        }
+
+    private:
+        std::atomic<uint64_t> sequence { 0 };
+        std::array<std::atomic<uint64_t>, WordCount> words {};
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_SEQLOCK_HPP
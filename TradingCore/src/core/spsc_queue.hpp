@@ -0,0 +1,177 @@
+/**============================================================================
+Name        : spsc_queue.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Bounded single-producer single-consumer queue.
+============================================================================**/
+
+/*
+    SpscQueue is a bounded lock-free ring buffer between exactly one producer
+    thread and exactly one consumer thread. It is the thread boundary of the
+    pipelined application: items are copied into the ring by value and no
+    memory is allocated after construction.
+
+    Data Flow:
+
+        producer thread                       consumer thread
+           |                                        ^
+           | tryPush() / tryClaim() + publish()     | tryPop() / front() + pop()
+           v                                        |
+        [ slot | slot | slot | ... | slot ] --------+
+               ^                 ^
+               head              tail
+
+    Layout:
+
+        head is written only by the consumer, tail only by the producer. Each
+        index lives on its own cache line next to the cached copy of the other
+        index, so that a push or pop touches the shared line only when the
+        cached copy says the ring looks full or empty.
+
+    In-place access:
+
+        tryClaim()/publish() and front()/pop() let large items (raw network
+        frames) be written and read directly in the ring instead of being
+        copied through a temporary.
+
+    SpscQueue does not:
+
+        - support more than one producer or more than one consumer;
+        - block or wait (callers decide whether to spin, yield or drop);
+        - grow beyond Capacity.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_SPSC_QUEUE_HPP
+#define FINANCETECHNOLOGYPROJECTS_SPSC_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace trading
+{
+    template<typename T, std::size_t Capacity>
+    class SpscQueue
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static_assert(std::is_trivially_copyable_v<T>, "SpscQueue items are copied by value");
+
+    public:
+        SpscQueue() = default;
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        // Producer side.
+        [[nodiscard]]
+        bool tryPush(const T& item) noexcept
+        {
+            T* const slot = tryClaim();
+            if (slot == nullptr)
+                return false;
+
+            *slot = item;
+            publish();
+            return true;
+        }
+
+        // Producer side. Returns the next free slot or nullptr if the queue is full.
+        [[nodiscard]]
+        T* tryClaim() noexcept
+        {
+            const std::size_t tail = producer.tail.load(std::memory_order_relaxed);
+            if (tail - producer.cachedHead == Capacity)
+            {
+                producer.cachedHead = consumer.head.load(std::memory_order_acquire);
+                if (tail - producer.cachedHead == Capacity)
+                    return nullptr;
+            }
+            return &slots[tail & Mask];
+        }
+
+        // Producer side. Makes the slot returned by tryClaim() visible to the consumer.
+        void publish() noexcept
+        {
+            producer.tail.store(producer.tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        // Consumer side.
+        [[nodiscard]]
+        bool tryPop(T& item) noexcept
+        {
+            const T* const slot = front();
+            if (slot == nullptr)
+                return false;
+
+            item = *slot;
+            pop();
+            return true;
+        }
+
+        // Consumer side. Returns the oldest item or nullptr if the queue is empty.
+        [[nodiscard]]
+        const T* front() noexcept
+        {
+            const std::size_t head = consumer.head.load(std::memory_order_relaxed);
+            if (head == consumer.cachedTail)
+            {
+                consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+                if (head == consumer.cachedTail)
+                    return nullptr;
+            }
+            return &slots[head & Mask];
+        }
+
+        // Consumer side. Releases the slot returned by front().
+        void pop() noexcept
+        {
+            consumer.head.store(consumer.head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        // Approximate when called concurrently with push or pop.
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            const std::size_t head = consumer.head.load(std::memory_order_acquire);
+            const std::size_t tail = producer.tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        static constexpr std::size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+    private:
+        static constexpr std::size_t CacheLineSize { 64 };
+        static constexpr std::size_t Mask { Capacity - 1 };
+
+        struct alignas(CacheLineSize) ProducerIndex
+        {
+            std::atomic<std::size_t> tail { 0 };
+            std::size_t cachedHead { 0 };
+        };
+
+        struct alignas(CacheLineSize) ConsumerIndex
+        {
+            std::atomic<std::size_t> head { 0 };
+            std::size_t cachedTail { 0 };
+        };
+
+        ProducerIndex producer {};
+        ConsumerIndex consumer {};
+        alignas(CacheLineSize) std::array<T, Capacity> slots {};
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_SPSC_QUEUE_HPP
@@ -14,6 +14,8 @@ Description : timestamp.hpp
 #include <compare>
 #include <cstdint>
 
+#include "tsc_clock.hpp"
+
 namespace trading
 {
 
@@ -34,6 +36,16 @@ namespace trading
             return Timestamp { static_cast<Value>( std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) };
         }
 
+        /*
+            Same clock as now(), read from the calibrated TSC (see TscClock).
+            TscClock::instance() must have been called once at startup.
+        */
+        [[nodiscard]]
+        static Timestamp nowFast() noexcept
+        {
+            return Timestamp { TscClock::instance().nanoseconds() };
+        }
+
         [[nodiscard]]
         constexpr Value nanoseconds() const noexcept {
             return nanoseconds_;
@@ -0,0 +1,314 @@
+/**============================================================================
+Name        : tsc_clock.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Calibrated time stamp counter clock.
+============================================================================**/
+
+/*
+    TscClock converts the CPU time stamp counter into nanoseconds of
+    CLOCK_MONOTONIC, the clock behind Timestamp::now(). Reading it costs an
+    rdtsc and a multiplication instead of a vDSO call.
+
+    Data Flow:
+
+        startup                          hot path
+           |                                |
+           | calibrate()                    | nanoseconds()
+           v                                v
+        (tsc, CLOCK_MONOTONIC) pairs     rdtsc
+           |                                |
+           v                                v
+        base tsc, base ns, multiplier -> base ns + (tsc - base tsc) * multiplier
+
+    Calibration:
+
+        The first call of instance() samples the TSC and CLOCK_MONOTONIC
+        twice, CalibrationNanoseconds apart, and derives the multiplier. Each
+        sample brackets clock_gettime() between two rdtsc reads and keeps the
+        narrowest of several attempts. instance() must therefore be called
+        once during startup, not on the hot path.
+
+    Drift correction:
+
+        A frequency error of a few ppm adds up to microseconds per second.
+        recalibrate() measures a new (tsc, CLOCK_MONOTONIC) pair and derives
+        the multiplier over the whole time since the first calibration, which
+        makes it more precise on every call. It must be called periodically
+        (about once per second) from one thread outside the hot path. The new
+        parameters are published with a sequence lock, readers never block.
+
+        The clock is never moved backwards. A clock that is behind
+        CLOCK_MONOTONIC jumps forward to it; a clock that is ahead keeps its
+        current value as the new base and is slewed instead: the multiplier
+        is scaled so that the clock meets CLOCK_MONOTONIC one
+        RecalibrationPeriodNanoseconds later (see slew()). The scaling is
+        capped at MaxSlewDivisor, so a large offset takes several periods
+        and the clock keeps advancing at least at half its rate.
+
+    Fallback:
+
+        Without an invariant TSC (CPUID 8000_0007H EDX bit 8) the counter
+        rate may change with frequency scaling or stop in deep C-states.
+        nanoseconds() then reads std::chrono::steady_clock instead.
+
+    TscClock does not:
+
+        - synchronize the TSC between sockets (all CPUs of a modern system
+          share one invariant TSC);
+        - provide wall-clock time.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_TSC_CLOCK_HPP
+#define FINANCETECHNOLOGYPROJECTS_TSC_CLOCK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define TRADING_CORE_HAS_TSC 1
+#else
+#define TRADING_CORE_HAS_TSC 0
+#endif
+
+namespace trading
+{
+    class TscClock
+    {
+    public:
+        static constexpr uint64_t CalibrationNanoseconds { 10'000'000 };
+        // How often the owner of the clock is expected to call recalibrate().
+        static constexpr uint64_t RecalibrationPeriodNanoseconds { 1'000'000'000 };
+        // An ahead clock loses at most RecalibrationPeriodNanoseconds / MaxSlewDivisor per period.
+        static constexpr uint64_t MaxSlewDivisor { 2 };
+
+        struct Correction
+        {
+            uint64_t baseNanoseconds { 0 };
+            uint64_t multiplier { 0 };
+        };
+
+        /*
+            Base and multiplier for a clock that reads 'current' when
+            CLOCK_MONOTONIC reads 'monotonic'; 'multiplier' is the measured
+            rate. 'period' nanoseconds later the corrected clock reads
+            monotonic + period, or has closed period / MaxSlewDivisor of a
+            larger offset.
+        */
+        [[nodiscard]]
+        static constexpr Correction slew(const uint64_t current,
+                                         const uint64_t monotonic,
+                                         const uint64_t multiplier,
+                                         const uint64_t period = RecalibrationPeriodNanoseconds) noexcept
+        {
+            if (current <= monotonic)
+                return Correction { .baseNanoseconds = monotonic, .multiplier = multiplier };
+
+            const uint64_t ahead = current - monotonic;
+            const uint64_t remaining = ahead < period - period / MaxSlewDivisor ? period - ahead : period / MaxSlewDivisor;
+            return Correction {
+                .baseNanoseconds = current,
+                .multiplier = static_cast<uint64_t>(static_cast<unsigned __int128>(multiplier) * remaining / period)
+            };
+        }
+
+        TscClock(const TscClock&) = delete;
+        TscClock& operator=(const TscClock&) = delete;
+
+        // Calibrated on the first call.
+        [[nodiscard]]
+        static TscClock& instance() noexcept
+        {
+            static TscClock clock;
+            return clock;
+        }
+
+        [[nodiscard]]
+        static bool hasInvariantTsc() noexcept
+        {
+#if TRADING_CORE_HAS_TSC
+            unsigned eax { 0 }, ebx { 0 }, ecx { 0 }, edx { 0 };
+            if (__get_cpuid_max(0x8000'0000, nullptr) < 0x8000'0007)
+                return false;
+            __cpuid(0x8000'0007, eax, ebx, ecx, edx);
+            return (edx & (1U << 8)) != 0;
+#else
+            return false;
+#endif
+        }
+
+        [[nodiscard]]
+        static uint64_t steadyNanoseconds() noexcept
+        {
+            const auto duration = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
+
+        // Nanoseconds of CLOCK_MONOTONIC.
+        [[nodiscard]]
+        uint64_t nanoseconds() const noexcept
+        {
+#if TRADING_CORE_HAS_TSC
+            if (usesTsc) [[likely]]
+                return toNanoseconds(__rdtsc());
+#endif
+            return steadyNanoseconds();
+        }
+
+        /*
+            Re-anchors the conversion to CLOCK_MONOTONIC. Called periodically
+            from one thread outside the hot path.
+        */
+        void recalibrate() noexcept
+        {
+#if TRADING_CORE_HAS_TSC
+            if (!usesTsc)
+                return;
+
+            const Sample sample = measure();
+            const uint64_t elapsedTicks = sample.tsc - origin.tsc;
+            if (elapsedTicks == 0)
+                return;
+
+            const uint64_t multiplier = multiplierOf(sample.nanoseconds - origin.nanoseconds, elapsedTicks);
+            const Correction correction = slew(toNanoseconds(sample.tsc), sample.nanoseconds, multiplier);
+
+            publish(sample.tsc, correction.baseNanoseconds, correction.multiplier);
+#endif
+        }
+
+        [[nodiscard]]
+        bool isTscBased() const noexcept
+        {
+            return usesTsc;
+        }
+
+        [[nodiscard]]
+        double ticksPerNanosecond() const noexcept
+        {
+            const uint64_t multiplier = parameters.multiplier.load(std::memory_order_relaxed);
+            return multiplier == 0 ? 0.0 : static_cast<double>(uint64_t { 1 } << Shift) / static_cast<double>(multiplier);
+        }
+
+    private:
+        // Nanoseconds per tick as a 32.32 fixed-point number.
+        static constexpr int Shift { 32 };
+        static constexpr int CalibrationAttempts { 16 };
+
+        struct Sample
+        {
+            uint64_t tsc { 0 };
+            uint64_t nanoseconds { 0 };
+        };
+
+        struct Parameters
+        {
+            std::atomic<uint64_t> sequence { 0 };
+            std::atomic<uint64_t> baseTsc { 0 };
+            std::atomic<uint64_t> baseNanoseconds { 0 };
+            std::atomic<uint64_t> multiplier { 0 };
+        };
+
+        TscClock() noexcept:
+            usesTsc { TRADING_CORE_HAS_TSC && hasInvariantTsc() }
+        {
+#if TRADING_CORE_HAS_TSC
+            if (usesTsc)
+                calibrate();
+#endif
+        }
+
+        [[nodiscard]]
+        static uint64_t multiplierOf(const uint64_t nanoseconds, const uint64_t ticks) noexcept
+        {
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(nanoseconds) << Shift) / ticks);
+        }
+
+#if TRADING_CORE_HAS_TSC
+        [[nodiscard]]
+        static Sample measure() noexcept
+        {
+            Sample best {};
+            uint64_t bestWidth { ~uint64_t { 0 } };
+
+            for (int attempt { 0 }; attempt < CalibrationAttempts; ++attempt)
+            {
+                timespec time {};
+                const uint64_t before = __rdtsc();
+                ::clock_gettime(CLOCK_MONOTONIC, &time);
+                const uint64_t after = __rdtsc();
+
+                if (after - before < bestWidth)
+                {
+                    bestWidth = after - before;
+                    best = Sample {
+                        .tsc = before + (after - before) / 2,
+                        .nanoseconds = static_cast<uint64_t>(time.tv_sec) * 1'000'000'000 + static_cast<uint64_t>(time.tv_nsec)
+                    };
+                }
+            }
+
+            return best;
+        }
+
+        void calibrate() noexcept
+        {
+            origin = measure();
+
+            Sample last {};
+            do {
+                last = measure();
+            } while (last.nanoseconds - origin.nanoseconds < CalibrationNanoseconds);
+
+            publish(last.tsc, last.nanoseconds, multiplierOf(last.nanoseconds - origin.nanoseconds, last.tsc - origin.tsc));
+        }
+
+        [[nodiscard]]
+        uint64_t toNanoseconds(const uint64_t tsc) const noexcept
+        {
+            uint64_t sequence { 0 };
+            uint64_t baseTsc { 0 };
+            uint64_t baseNanoseconds { 0 };
+            uint64_t multiplier { 0 };
+
+            do {
+                sequence = parameters.sequence.load(std::memory_order_acquire);
+                baseTsc = parameters.baseTsc.load(std::memory_order_relaxed);
+                baseNanoseconds = parameters.baseNanoseconds.load(std::memory_order_relaxed);
+                multiplier = parameters.multiplier.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+            } while ((sequence & 1) != 0 || sequence != parameters.sequence.load(std::memory_order_relaxed));
+
+            // A TSC read on another core may be a few ticks behind the base.
+            const auto ticks = static_cast<int64_t>(tsc - baseTsc);
+            const auto offset = static_cast<__int128>(ticks) * multiplier;
+            return baseNanoseconds + static_cast<uint64_t>(static_cast<int64_t>(offset >> Shift));
+        }
+
+        void publish(const uint64_t baseTsc, const uint64_t baseNanoseconds, const uint64_t multiplier) noexcept
+        {
+            const uint64_t sequence = parameters.sequence.load(std::memory_order_relaxed);
+            parameters.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            parameters.baseTsc.store(baseTsc, std::memory_order_relaxed);
+            parameters.baseNanoseconds.store(baseNanoseconds, std::memory_order_relaxed);
+            parameters.multiplier.store(multiplier, std::memory_order_relaxed);
+
+            parameters.sequence.store(sequence + 2, std::memory_order_release);
+        }
+#endif
+
+        const bool usesTsc;
+        Sample origin {};
+        Parameters parameters {};
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_TSC_CLOCK_HPP
@@ -0,0 +1,63 @@
+/**============================================================================
+Name        : hmac_sha256.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : HMAC-SHA256 (RFC 2104) with precomputed key pads.
+============================================================================**/
+
+#include "hmac_sha256.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    using trading::crypto::Sha256;
+
+    constexpr std::byte InnerPad { 0x36 };
+    constexpr std::byte OuterPad { 0x5c };
+
+    [[nodiscard]]
+    Sha256::State padState(const std::array<std::byte, Sha256::BlockSize>& key, const std::byte pad) noexcept
+    {
+        std::array<std::byte, Sha256::BlockSize> block;
+        std::ranges::transform(key, block.begin(), [pad](const std::byte value) { return value ^ pad; });
+
+        Sha256::State state { Sha256::InitialState };
+        Sha256::compress(state, block.data(), 1);
+        return state;
+    }
+}
+
+namespace trading::crypto
+{
+    HmacSha256::HmacSha256(const std::span<const std::byte> key) noexcept
+    {
+        std::array<std::byte, Sha256::BlockSize> block {};
+        if (key.size() > block.size())
+        {
+            const Sha256::Digest digest = Sha256::hash(key);
+            std::ranges::copy(digest, block.begin());
+        }
+        else
+        {
+            std::ranges::copy(key, block.begin());
+        }
+
+        innerState = padState(block, InnerPad);
+        outerState = padState(block, OuterPad);
+    }
+
+    HmacSha256::Digest HmacSha256::sign(const std::span<const std::byte> message) const noexcept
+    {
+        Sha256 inner { innerState, Sha256::BlockSize };
+        inner.update(message);
+        const Digest innerDigest = inner.finish();
+
+        Sha256 outer { outerState, Sha256::BlockSize };
+        outer.update(innerDigest);
+        return outer.finish();
+    }
+}
@@ -0,0 +1,65 @@
+/**============================================================================
+Name        : hmac_sha256.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : HMAC-SHA256 (RFC 2104) with precomputed key pads.
+============================================================================**/
+
+/*
+    HmacSha256 authenticates messages with one fixed key:
+
+        HMAC(K, m) = H((K ^ opad) || H((K ^ ipad) || m))
+
+    K ^ ipad and K ^ opad are exactly one block each, so the constructor
+    compresses both pads once and keeps only the two midstates. A sign()
+    then starts both hashes from the saved midstates:
+
+        constructor (once per key)              sign(message)
+               |                                       |
+        key (hashed first if longer than 64)           |
+               |                                       v
+               +--> K ^ ipad --> compress --> inner midstate + message --> inner digest
+               |                                                                 |
+               +--> K ^ opad --> compress --> outer midstate + inner digest -----+
+                                                                                 |
+                                                                                 v
+                                                                               Digest
+
+    A message of n bytes costs ceil((n + 9) / 64) + 1 block compressions
+    instead of ceil((n + 9) / 64) + 3 when the pads are rehashed every time.
+    Nothing allocates, and the key itself is not kept.
+
+    HmacSha256 does not:
+        - verify signatures in constant time;
+        - synchronize: sign() is const and may run on several threads.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_HMAC_SHA256_HPP
+#define FINANCETECHNOLOGYPROJECTS_HMAC_SHA256_HPP
+
+#include "sha256.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace trading::crypto
+{
+    class HmacSha256
+    {
+    public:
+        using Digest = Sha256::Digest;
+
+        explicit HmacSha256(std::span<const std::byte> key) noexcept;
+
+        [[nodiscard]]
+        Digest sign(std::span<const std::byte> message) const noexcept;
+
+    private:
+        Sha256::State innerState {};
+        Sha256::State outerState {};
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_HMAC_SHA256_HPP
@@ -0,0 +1,227 @@
+/**============================================================================
+Name        : sha256.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Incremental SHA-256 (FIPS 180-4).
+============================================================================**/
+
+#include "sha256.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SHA__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    using trading::crypto::Sha256;
+
+    alignas(16) constexpr std::array<uint32_t, 64> RoundConstants {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    void storeBigEndian(std::byte* data, const uint64_t value) noexcept
+    {
+        const uint64_t bigEndian = std::endian::native == std::endian::little ? std::byteswap(value) : value;
+        std::memcpy(data, &bigEndian, sizeof(bigEndian));
+    }
+
+#if defined(__SHA__)
+    /*
+        The SHA extensions keep the state as ABEF / CDGH register pairs;
+        sha256rnds2 performs two rounds, sha256msg1 / sha256msg2 extend the
+        message schedule four words at a time.
+    */
+    void compressBlocks(Sha256::State& state, const std::byte* blocks, std::size_t count) noexcept
+    {
+        const __m128i byteOrder = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+        __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+        __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+        __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+        __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+        for (; count > 0; --count, blocks += Sha256::BlockSize)
+        {
+            const __m128i abefSaved = abef;
+            const __m128i cdghSaved = cdgh;
+
+            // words[g % 4] holds schedule words 4g .. 4g + 3 of the current group g.
+            __m128i words[4];
+            for (std::size_t index { 0 }; index < 4; ++index)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 16 * index));
+                words[index] = _mm_shuffle_epi8(block, byteOrder);
+            }
+
+            for (std::size_t group { 0 }; group < 16; ++group)
+            {
+                __m128i& current = words[group % 4];
+                if (group >= 4)
+                {
+                    const __m128i previous = words[(group + 3) % 4];
+                    const __m128i sum = _mm_add_epi32(_mm_sha256msg1_epu32(current, words[(group + 1) % 4]),
+                                                      _mm_alignr_epi8(previous, words[(group + 2) % 4], 4));
+                    current = _mm_sha256msg2_epu32(sum, previous);
+                }
+
+                __m128i message = _mm_add_epi32(current,
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(&RoundConstants[4 * group])));
+                cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+                message = _mm_shuffle_epi32(message, 0x0E);
+                abef = _mm_sha256rnds2_epu32(abef, cdgh, message);
+            }
+
+            abef = _mm_add_epi32(abef, abefSaved);
+            cdgh = _mm_add_epi32(cdgh, cdghSaved);
+        }
+
+        const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+        const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+    }
+#else
+    [[nodiscard]]
+    uint32_t loadBigEndian(const std::byte* data) noexcept
+    {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return std::endian::native == std::endian::little ? std::byteswap(value) : value;
+    }
+
+    void compressBlocks(Sha256::State& state, const std::byte* blocks, std::size_t count) noexcept
+    {
+        for (; count > 0; --count, blocks += Sha256::BlockSize)
+        {
+            std::array<uint32_t, 64> words;
+            for (std::size_t index { 0 }; index < 16; ++index)
+                words[index] = loadBigEndian(blocks + 4 * index);
+
+            for (std::size_t index { 16 }; index < words.size(); ++index)
+            {
+                const uint32_t w15 = words[index - 15];
+                const uint32_t w2 = words[index - 2];
+                const uint32_t sigma0 = std::rotr(w15, 7) ^ std::rotr(w15, 18) ^ (w15 >> 3);
+                const uint32_t sigma1 = std::rotr(w2, 17) ^ std::rotr(w2, 19) ^ (w2 >> 10);
+                words[index] = words[index - 16] + sigma0 + words[index - 7] + sigma1;
+            }
+
+            auto [a, b, c, d, e, f, g, h] = state;
+            for (std::size_t index { 0 }; index < words.size(); ++index)
+            {
+                const uint32_t sum1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+                const uint32_t choice = (e & f) ^ (~e & g);
+                const uint32_t first = h + sum1 + choice + RoundConstants[index] + words[index];
+                const uint32_t sum0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+                const uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+                const uint32_t second = sum0 + majority;
+
+                h = g;
+                g = f;
+                f = e;
+                e = d + first;
+                d = c;
+                c = b;
+                b = a;
+                a = first + second;
+            }
+
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+            state[4] += e;
+            state[5] += f;
+            state[6] += g;
+            state[7] += h;
+        }
+    }
+#endif
+}
+
+namespace trading::crypto
+{
+    void Sha256::update(std::span<const std::byte> data) noexcept
+    {
+        if (data.empty())
+            return;
+
+        length += data.size();
+
+        if (pendingSize > 0)
+        {
+            const std::size_t taken = std::min(BlockSize - pendingSize, data.size());
+            std::memcpy(pending.data() + pendingSize, data.data(), taken);
+            pendingSize += taken;
+            data = data.subspan(taken);
+
+            if (pendingSize < BlockSize)
+                return;
+
+            compressBlocks(state_, pending.data(), 1);
+            pendingSize = 0;
+        }
+
+        const std::size_t blocks = data.size() / BlockSize;
+        if (blocks > 0)
+            compressBlocks(state_, data.data(), blocks);
+
+        const std::size_t tail = data.size() % BlockSize;
+        std::memcpy(pending.data(), data.data() + blocks * BlockSize, tail);
+        pendingSize = tail;
+    }
+
+    Sha256::Digest Sha256::finish() noexcept
+    {
+        constexpr std::size_t LengthSize { sizeof(uint64_t) };
+
+        const uint64_t bitLength = length * 8;
+
+        pending[pendingSize++] = std::byte { 0x80 };
+        if (pendingSize > BlockSize - LengthSize)
+        {
+            std::fill(pending.begin() + static_cast<std::ptrdiff_t>(pendingSize), pending.end(), std::byte { 0 });
+            compressBlocks(state_, pending.data(), 1);
+            pendingSize = 0;
+        }
+
+        std::fill(pending.begin() + static_cast<std::ptrdiff_t>(pendingSize),
+                  pending.end() - LengthSize, std::byte { 0 });
+        storeBigEndian(pending.data() + BlockSize - LengthSize, bitLength);
+        compressBlocks(state_, pending.data(), 1);
+        pendingSize = 0;
+
+        Digest digest;
+        for (std::size_t index { 0 }; index < state_.size(); ++index)
+        {
+            const uint32_t word = std::endian::native == std::endian::little ? std::byteswap(state_[index]) : state_[index];
+            std::memcpy(digest.data() + 4 * index, &word, sizeof(word));
+        }
+        return digest;
+    }
+
+    Sha256::Digest Sha256::hash(const std::span<const std::byte> data) noexcept
+    {
+        Sha256 sha;
+        sha.update(data);
+        return sha.finish();
+    }
+
+    void Sha256::compress(State& state, const std::byte* blocks, const std::size_t count) noexcept
+    {
+        compressBlocks(state, blocks, count);
+    }
+}
@@ -0,0 +1,105 @@
+/**============================================================================
+Name        : sha256.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Incremental SHA-256 (FIPS 180-4).
+============================================================================**/
+
+/*
+    Sha256 hashes a message fed in pieces with update() and returns the
+    digest from finish().
+
+    Data Flow:
+
+        update(bytes)
+               |
+               +--> full 64-byte blocks ---> compress() straight from the input
+               |
+               +--> tail -----------------> pending block
+                                                  |
+                                                  v
+        finish() ---> padding + bit length ---> compress() ---> Digest
+
+    Midstates:
+
+        After a whole number of blocks the hash is fully described by the
+        eight state words and the number of bytes processed. state() exposes
+        them and the (State, processedBytes) constructor resumes from them,
+        so a fixed prefix such as an HMAC key pad is compressed once and
+        every later message starts from the saved midstate (HmacSha256).
+
+    compress() uses the SHA extensions (SHA-NI) when the build enables them
+    (__SHA__) and portable code otherwise. Nothing allocates.
+
+    Sha256 does not:
+        - hash messages longer than 2^61 bytes;
+        - synchronize: one thread uses an instance.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_SHA256_HPP
+#define FINANCETECHNOLOGYPROJECTS_SHA256_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace trading::crypto
+{
+    class Sha256
+    {
+    public:
+        static constexpr std::size_t BlockSize { 64 };
+        static constexpr std::size_t DigestSize { 32 };
+
+        using State = std::array<uint32_t, 8>;
+        using Digest = std::array<std::byte, DigestSize>;
+
+        static constexpr State InitialState {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+
+        constexpr Sha256() noexcept = default;
+
+        // Resumes from a midstate; 'processedBytes' must be a multiple of BlockSize.
+        constexpr Sha256(const State& state, const uint64_t processedBytes) noexcept :
+            state_ { state },
+            length { processedBytes }
+        {
+        }
+
+        void update(std::span<const std::byte> data) noexcept;
+
+        // Digest of everything passed to update(); the instance must not be updated afterwards.
+        [[nodiscard]]
+        Digest finish() noexcept;
+
+        // Midstate; describes the hash only when processedBytes() is a multiple of BlockSize.
+        [[nodiscard]]
+        constexpr const State& state() const noexcept {
+            return state_;
+        }
+
+        [[nodiscard]]
+        constexpr uint64_t processedBytes() const noexcept {
+            return length;
+        }
+
+        [[nodiscard]]
+        static Digest hash(std::span<const std::byte> data) noexcept;
+
+        // Applies 'count' consecutive 64-byte blocks to 'state'.
+        static void compress(State& state, const std::byte* blocks, std::size_t count) noexcept;
+
+    private:
+        State state_ { InitialState };
+        std::array<std::byte, BlockSize> pending {};
+        std::size_t pendingSize { 0 };
+        uint64_t length { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_SHA256_HPP
@@ -9,10 +9,29 @@ Description : Binance execution gateway implementation.
 
 #include "binance_execution_gateway.hpp"
 
+#include <chrono>
+
+namespace
+{
+    [[nodiscard]]
+    uint64_t unixMilliseconds() noexcept
+    {
+        const auto duration = std::chrono::system_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+    }
+}
+
 namespace trading::exchanges::binance
 {
-    BinanceExecutionGateway::BinanceExecutionGateway(SendHandler sendHandler,
-                                                     CancelHandler cancelHandler) noexcept :
+    BinanceExecutionGateway::BinanceExecutionGateway(const std::span<const Instrument> instruments) :
+                                                     encoder { instruments }
+    {
+    }
+
+    BinanceExecutionGateway::BinanceExecutionGateway(const std::span<const Instrument> instruments,
+                                                     SendHandler sendHandler,
+                                                     CancelHandler cancelHandler) :
+                                                     encoder { instruments },
                                                      sendHandler { std::move(sendHandler) },
                                                      cancelHandler { std::move(cancelHandler) }
     {
@@ -28,11 +47,52 @@ namespace trading::exchanges::binance
         cancelHandler = std::move(handler);
     }
 
+    void BinanceExecutionGateway::setBatchCancelHandler(BatchCancelHandler handler) noexcept
+    {
+        batchCancelHandler = std::move(handler);
+    }
+
+    void BinanceExecutionGateway::setReportHandler(ReportHandler handler) noexcept
+    {
+        reportHandler = std::move(handler);
+    }
+
+    void BinanceExecutionGateway::setSigner(const BinanceRequestSigner& requestSigner) noexcept
+    {
+        signer = requestSigner;
+    }
+
     void BinanceExecutionGateway::send(const execution::Order& order)
     {
         if (!sendHandler)
             return;
-        sendHandler(order);
+        const BinanceRequestSigner* const requestSigner = signer ? &*signer : nullptr;
+        const std::span<const std::byte> request = encoder.encode(order, unixMilliseconds(), requestSigner);
+        if (request.empty())
+        {
+            reject(order);
+            return;
+        }
+
+        sendHandler(order, request);
+    }
+
+    void BinanceExecutionGateway::reject(const execution::Order& order) const
+    {
+        if (!reportHandler)
+            return;
+
+        reportHandler(execution::ExecutionReport {
+            .clientOrderId = order.clientOrderId,
+            .exchangeOrderId = order.exchangeOrderId,
+            .instrument = order.instrument,
+            .side = order.side,
+            .execType = ExecType::Reject,
+            .status = OrderStatus::Rejected,
+            .price = order.price,
+            .quantity = order.quantity,
+            .filledQuantity = order.filledQuantity
+        });
     }
 
     void BinanceExecutionGateway::cancel(const OrderId orderId)
@@ -42,4 +102,18 @@ namespace trading::exchanges::binance
 
         cancelHandler(orderId);
     }
+
+    void BinanceExecutionGateway::cancelBatch(const std::span<const OrderId> orderIds)
+    {
+        if (orderIds.empty())
+            return;
+
+        if (!batchCancelHandler)
+        {
+            IExecutionGateway::cancelBatch(orderIds);
+            return;
+        }
+
+        batchCancelHandler(orderIds);
+    }
 }
\ No newline at end of file
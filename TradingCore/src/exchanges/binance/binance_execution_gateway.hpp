@@ -10,9 +10,16 @@ Description : Binance implementation of the execution gateway.
 #ifndef FINANCETECHNOLOGYPROJECTS_BINANCE_EXECUTION_GATEWAY_HPP
 #define FINANCETECHNOLOGYPROJECTS_BINANCE_EXECUTION_GATEWAY_HPP
 
+#include "binance_order_encoder.hpp"
+#include "binance_request_signer.hpp"
 #include "execution_gateway.hpp"
+#include "execution_report.hpp"
+#include "instrument.hpp"
 
+#include <cstddef>
 #include <functional>
+#include <optional>
+#include <span>
 
 /**
  * Binance implementation of IExecutionGateway.
@@ -47,6 +54,25 @@ Description : Binance implementation of the execution gateway.
  * callbacks. This keeps the gateway independent from a particular HTTP
  * or WebSocket implementation and makes the component easy to test.
  *
+ * Orders are encoded before they reach the send handler: the gateway keeps
+ * pre-rendered request templates of the configured instruments
+ * (BinanceOrderEncoder) and hands the handler the order together with the
+ * request parameters, stamped with the current Unix time:
+ *
+ *     Order ---> BinanceOrderEncoder ---> span<const std::byte> ---> SendHandler
+ *
+ * The bytes are valid only during the call. An order that cannot be
+ * encoded (instrument not configured, price or quantity off the instrument
+ * grid) never reaches the send handler: the gateway hands a Rejected
+ * ExecutionReport for it to the report handler instead, inside send(), so
+ * OrderManager releases its risk reservation and retires it. Once a signer
+ * is set (setSigner), the request already ends with its HMAC-SHA256
+ * "&signature=" parameter.
+ *
+ * Batched cancels go to the batch cancel handler when one is set (for
+ * example a transport that groups them into one WebSocket API request);
+ * otherwise every order is cancelled through the cancel handler.
+ *
  * Execution reports travel in the opposite direction:
  *
  *     Binance execution API
@@ -66,25 +92,45 @@ namespace trading::exchanges::binance
     class BinanceExecutionGateway final : public execution::IExecutionGateway
     {
     public:
-        using SendHandler   = std::function<void(const execution::Order&)>;
+        using SendHandler   = std::function<void(const execution::Order&, std::span<const std::byte> request)>;
         using CancelHandler = std::function<void(OrderId)>;
+        using BatchCancelHandler = std::function<void(std::span<const OrderId>)>;
+        using ReportHandler = std::function<void(const execution::ExecutionReport&)>;
 
         BinanceExecutionGateway() = default;
 
-        BinanceExecutionGateway(SendHandler sendHandler,
-                                CancelHandler cancelHandler) noexcept;
+        explicit BinanceExecutionGateway(std::span<const Instrument> instruments);
+
+        BinanceExecutionGateway(std::span<const Instrument> instruments,
+                                SendHandler sendHandler,
+                                CancelHandler cancelHandler);
 
         void setSendHandler(SendHandler sendHandler) noexcept;
 
         void setCancelHandler(CancelHandler cancelHandler) noexcept;
 
+        void setBatchCancelHandler(BatchCancelHandler batchCancelHandler) noexcept;
+
+        // Receives the Rejected reports of orders that cannot be encoded.
+        void setReportHandler(ReportHandler reportHandler) noexcept;
+
+        void setSigner(const BinanceRequestSigner& signer) noexcept;
+
         void send(const execution::Order& order) override;
 
         void cancel(OrderId orderId) override;
 
+        void cancelBatch(std::span<const OrderId> orderIds) override;
+
     private:
+        void reject(const execution::Order& order) const;
+
+        BinanceOrderEncoder encoder;
+        std::optional<BinanceRequestSigner> signer;
         SendHandler sendHandler;
         CancelHandler cancelHandler;
+        BatchCancelHandler batchCancelHandler;
+        ReportHandler reportHandler;
     };
 }
 
@@ -29,146 +29,310 @@ Description : binance_market_data_parser.cpp
         IBookUpdateHandler
 
     Binance-specific JSON parsing remains entirely inside this class.
+
+    depthUpdate example:
+
+        {
+            "e": "depthUpdate",
+            "E": 1672515782136,
+            "s": "BTCUSDT",
+            "U": 157,
+            "u": 160,
+            "b": [ ["0.10000000", "1.00000000"] ],
+            "a": [ ["0.20000000", "2.00000000"] ]
+        }
+
+    Every level of the message becomes one BookUpdate with
+    firstSequence = U, sequence = u and exchangeTimestamp = E.
 */
 
 #include "binance_market_data_parser.hpp"
 
-// #include <nlohmann/json.hpp>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <utility>
 
 namespace trading::exchanges::binance
 {
-    market_data::ParseResult
-    BinanceMarketDataParser::parse([[maybe_unused]] std::string_view message,
-                                    market_data::BookUpdates& bookUpdates) const
+    namespace
     {
-        bookUpdates.clear();
+        using market_data::ParseResult;
 
-        /*
-            Existing Binance parsing logic goes here.
+        constexpr uint64_t NanosecondsPerMillisecond { 1'000'000 };
 
-            Every place where the previous implementation created or returned
-            a local vector must now write directly into bookUpdates.
+        /*
+            Reads a JSON string value directly from the input buffer without
+            unescaping it. Exchange decimals never contain escapes.
+        */
+        [[nodiscard]]
+        bool rawStringField(simdjson::ondemand::value value, std::string_view& text) noexcept
+        {
+            std::string_view token = value.raw_json_token();
+            if (token.size() < 2 || token.front() != '"')
+                return false;
 
-            Example:
-                bookUpdates.emplace_back(...);
+            token.remove_prefix(1);
+            const std::size_t end = token.find('"');
+            if (end == std::string_view::npos)
+                return false;
 
-            Successful parsing:
-                return market_data::ParseResult::Success;
+            text = token.substr(0, end);
+            return true;
+        }
 
-            Parsing failure:
-                return market_data::ParseResult::InvalidMessage;
+        [[nodiscard]]
+        ParseResult toParseResult(const simdjson::error_code error,
+                                  const ParseResult invalidValue) noexcept
+        {
+            switch (error)
+            {
+                case simdjson::NO_SUCH_FIELD:
+                    return ParseResult::MissingField;
+                case simdjson::INCORRECT_TYPE:
+                case simdjson::NUMBER_ERROR:
+                case simdjson::BIGINT_ERROR:
+                case simdjson::NUMBER_OUT_OF_RANGE:
+                    return invalidValue;
+                default:
+                    return ParseResult::InvalidJson;
+            }
+        }
 
-            The concrete error values should correspond to the actual
-            validation failure.
+        /*
+            Iterates [["price","quantity"], ...] and calls consumer(price, quantity)
+            for every level.
         */
+        template<typename Consumer>
+        [[nodiscard]]
+        ParseResult forEachLevel(simdjson::ondemand::array levels, Consumer&& consumer)
+        {
+            for (auto levelResult : levels)
+            {
+                simdjson::ondemand::array level;
+                if (const auto error = levelResult.get_array().get(level))
+                    return toParseResult(error, ParseResult::InvalidField);
 
-        return market_data::ParseResult::Success;;
+                std::array<std::string_view, 2> values {};
+                std::size_t count { 0 };
 
+                for (auto fieldResult : level)
+                {
+                    simdjson::ondemand::value field;
+                    if (const auto error = fieldResult.get(field))
+                        return toParseResult(error, ParseResult::InvalidField);
 
-#if 0
-        try
-        {
-            const auto json = nlohmann::json::parse(message);
+                    if (count == values.size())
+                        return ParseResult::InvalidField;
 
-            if (!json.is_object())
-                return std::unexpected { market_data::ParseError::InvalidMessage };
-            /*
-                Binance depthUpdate example:
+                    if (!rawStringField(field, values[count]))
+                        return count == 0 ? ParseResult::InvalidPrice : ParseResult::InvalidQuantity;
 
-                {
-                    "e": "depthUpdate",
-                    "E": 1672515782136,
-                    "s": "BTCUSDT",
-                    "U": 157,
-                    "u": 160,
-                    "b": [
-                        ["0.10000000", "1.00000000"]
-                    ],
-                    "a": [
-                        ["0.20000000", "2.00000000"]
-                    ]
+                    ++count;
                 }
 
-                The exact conversion to InstrumentId, Price and Quantity
-                should use the existing project-specific conversion logic.
-            */
+                if (count != values.size())
+                    return ParseResult::InvalidField;
 
-            if (!json.contains("e"))
-                return std::unexpected { market_data::ParseError::MissingField };
+                const auto price = Price::fromDecimalString(values[0]);
+                if (!price || price->raw() < 0)
+                    return ParseResult::InvalidPrice;
 
-            if (json.at("e") != "depthUpdate")
-                return std::unexpected {
-                    market_data::ParseError::UnsupportedMessage
-                };
+                const auto quantity = Quantity::fromDecimalString(values[1]);
+                if (!quantity || quantity->raw() < 0)
+                    return ParseResult::InvalidQuantity;
 
-            if (!json.contains("E") ||
-                !json.contains("U") ||
-                !json.contains("u") ||
-                !json.contains("b") ||
-                !json.contains("a"))
-            {
-                return std::unexpected {
-                    market_data::ParseError::MissingField
-                };
+                consumer(*price, *quantity);
             }
 
-            const auto sequence = json.at("u").get<SequenceNumber>();
-            const auto timestamp = json.at("E").get<Timestamp::Value>();
+            return ParseResult::Success;
+        }
+
+        /*
+            Combined streams wrap the payload into {"stream": ..., "data": {...}}.
+        */
+        [[nodiscard]]
+        simdjson::error_code payloadObject(simdjson::ondemand::document& document,
+                                           simdjson::ondemand::object& payload) noexcept
+        {
+            simdjson::ondemand::object root;
+            if (const auto error = document.get_object().get(root))
+                return error;
 
-            constexpr InstrumentId instrument {
-                // Use the existing Binance symbol -> InstrumentId mapping.
-                0
-            };
+            const auto error = root["data"].get_object().get(payload);
+            if (error != simdjson::NO_SUCH_FIELD)
+                return error;
 
-            std::vector<market_data::BookUpdate> updates;
+            payload = root;
+            return simdjson::SUCCESS;
+        }
+    }
 
-            for (const auto& level : json.at("b"))
+    BinanceMarketDataParser::BinanceMarketDataParser(const Instrument& instrument,
+                                                     const std::size_t bufferSize) :
+        BinanceMarketDataParser { std::span<const Instrument> { &instrument, 1 }, bufferSize }
+    {
+    }
+
+    BinanceMarketDataParser::BinanceMarketDataParser(const std::span<const Instrument> instruments,
+                                                     const std::size_t bufferSize) :
+        resolver { instruments },
+        buffer { std::make_unique<char[]>(bufferSize + simdjson::SIMDJSON_PADDING) },
+        bufferSize { bufferSize }
+    {
+    }
+
+    market_data::ParseResult
+    BinanceMarketDataParser::parse(const std::string_view message,
+                                   market_data::BookUpdates& bookUpdates) const
+    {
+        bookUpdates.clear();
+
+        if (message.empty())
+            return ParseResult::InvalidMessage;
+
+        simdjson::ondemand::document document;
+        if (parser.iterate(padded(message)).get(document))
+            return ParseResult::InvalidJson;
+
+        simdjson::ondemand::object data;
+        if (const auto error = payloadObject(document, data))
+            return toParseResult(error, ParseResult::InvalidMessage);
+
+        std::string_view eventType;
+        if (const auto error = data["e"].get_string().get(eventType))
+            return toParseResult(error, ParseResult::InvalidField);
+
+        if (eventType != "depthUpdate")
+            return ParseResult::UnsupportedMessage;
+
+        uint64_t eventTime { 0 };
+        if (const auto error = data["E"].get_uint64().get(eventTime))
+            return toParseResult(error, ParseResult::InvalidTimestamp);
+
+        std::string_view messageSymbol;
+        if (const auto error = data["s"].get_string().get(messageSymbol))
+            return toParseResult(error, ParseResult::InvalidField);
+
+        const std::optional<InstrumentId> instrument = resolver.resolve(messageSymbol);
+        if (!instrument)
+            return ParseResult::InvalidInstrument;
+
+        uint64_t firstSequence { 0 };
+        uint64_t lastSequence { 0 };
+        if (const auto error = data["U"].get_uint64().get(firstSequence))
+            return toParseResult(error, ParseResult::InvalidSequence);
+        if (const auto error = data["u"].get_uint64().get(lastSequence))
+            return toParseResult(error, ParseResult::InvalidSequence);
+
+        if (firstSequence == 0 || firstSequence > lastSequence)
+            return ParseResult::InvalidSequence;
+
+        const market_data::BookUpdate prototype {
+            .instrument = *instrument,
+            .firstSequence = firstSequence,
+            .sequence = lastSequence,
+            .exchangeTimestamp = Timestamp { eventTime * NanosecondsPerMillisecond }
+        };
+
+        for (const auto& [key, side] : { std::pair { "b", Side::Buy }, std::pair { "a", Side::Sell } })
+        {
+            simdjson::ondemand::array levels;
+            if (const auto error = data[key].get_array().get(levels))
+                return toParseResult(error, ParseResult::InvalidField);
+
+            const ParseResult result = forEachLevel(levels, [&](const Price price, const Quantity quantity) {
+                market_data::BookUpdate& update = bookUpdates.emplace_back(prototype);
+                update.side = side;
+                update.price = price;
+                update.quantity = quantity;
+            });
+
+            if (result != ParseResult::Success)
             {
-                if (!level.is_array() || level.size() != 2)
-                    return std::unexpected {
-                        market_data::ParseError::InvalidField
-                    };
-
-                market_data::BookUpdate update;
-                update.instrument = instrument;
-                update.sequence = sequence;
-                update.exchangeTimestamp = Timestamp { timestamp };
-                update.side = Side::Buy;
-
-                // Use the existing Price / Quantity construction logic here.
-                update.price = Price { level.at(0).get<double>() };
-                update.quantity = Quantity { level.at(1).get<double>() };
-
-                updates.push_back(update);
+                bookUpdates.clear();
+                return result;
             }
+        }
 
-            for (const auto& level : json.at("a"))
-            {
-                if (!level.is_array() || level.size() != 2)
-                    return std::unexpected {
-                        market_data::ParseError::InvalidField
-                    };
+        return ParseResult::Success;
+    }
 
-                market_data::BookUpdate update;
-                update.instrument = instrument;
-                update.sequence = sequence;
-                update.exchangeTimestamp = Timestamp { timestamp };
-                update.side = Side::Sell;
+    market_data::ParseResult
+    BinanceMarketDataParser::parseSnapshot(const std::string_view message,
+                                           market_data::BookSnapshot& snapshot) const
+    {
+        snapshot.bids.clear();
+        snapshot.asks.clear();
 
-                update.price = Price { level.at(0).get<double>() };
-                update.quantity = Quantity { level.at(1).get<double>() };
+        if (message.empty())
+            return ParseResult::InvalidMessage;
 
-                updates.push_back(update);
-            }
+        simdjson::ondemand::document document;
+        if (parser.iterate(padded(message)).get(document))
+            return ParseResult::InvalidJson;
 
-            return updates;
+        simdjson::ondemand::object data;
+        if (const auto error = payloadObject(document, data))
+            return toParseResult(error, ParseResult::InvalidMessage);
+
+        if (const auto error = data["lastUpdateId"].get_uint64().get(snapshot.sequence))
+            return toParseResult(error, ParseResult::InvalidSequence);
+
+        for (const auto& [key, levels] : { std::pair { "bids", &snapshot.bids }, std::pair { "asks", &snapshot.asks } })
+        {
+            simdjson::ondemand::array array;
+            if (const auto error = data[key].get_array().get(array))
+                return toParseResult(error, ParseResult::InvalidField);
+
+            const ParseResult result = forEachLevel(array, [&](const Price price, const Quantity quantity) {
+                if (!quantity.isZero())
+                    (*levels)[price] = quantity;
+            });
+
+            if (result != ParseResult::Success)
+                return result;
         }
-        catch (const nlohmann::json::exception&)
+
+        return ParseResult::Success;
+    }
+
+    std::optional<Timestamp> BinanceMarketDataParser::eventTime(const std::string_view message) noexcept
+    {
+        constexpr std::string_view key { R"("E":)" };
+
+        const std::size_t position = message.find(key);
+        if (position == std::string_view::npos)
+            return std::nullopt;
+
+        const char* const first = message.data() + position + key.size();
+        uint64_t milliseconds { 0 };
+        const auto [_, error] = std::from_chars(first, message.data() + message.size(), milliseconds);
+        if (error != std::errc {})
+            return std::nullopt;
+
+        return Timestamp { milliseconds * NanosecondsPerMillisecond };
+    }
+
+    simdjson::padded_string_view BinanceMarketDataParser::padded(const std::string_view message) const
+    {
+        /*
+            simdjson may read up to SIMDJSON_PADDING bytes past the end of the
+            input, and those bytes must belong to the buffer. The frame is
+            owned by the caller and has no such guarantee, so it is copied
+            into the parser's padded buffer. The buffer grows only for a
+            frame larger than any before it.
+        */
+        if (message.size() > bufferSize) [[unlikely]]
         {
-            return std::unexpected {
-                market_data::ParseError::InvalidJson
-            };
+            bufferSize = message.size();
+            buffer = std::make_unique<char[]>(bufferSize + simdjson::SIMDJSON_PADDING);
         }
-#endif
+
+        std::memcpy(buffer.get(), message.data(), message.size());
+        std::memset(buffer.get() + message.size(), 0, simdjson::SIMDJSON_PADDING);
+
+        return simdjson::padded_string_view { buffer.get(), message.size(), bufferSize + simdjson::SIMDJSON_PADDING };
     }
-}
\ No newline at end of file
+}
@@ -46,21 +46,75 @@ Description : binance_market_data_parser.hpp
 
     The supplied BookUpdates buffer is reused between calls. The parser must
     clear it before adding new updates.
+
+    The parser is configured with the list of traded instruments and resolves
+    the "s" symbol of every message to its InstrumentId, so downstream
+    components route updates by id only. Symbols are resolved through a
+    perfect-hash InstrumentResolver built once in the constructor. Messages
+    for other symbols, or for any symbol when the instrument list is invalid
+    (duplicate or over-long symbols), are rejected with InvalidInstrument.
 */
 
 #ifndef FINANCETECHNOLOGYPROJECTS_BINANCE_MARKET_DATA_PARSER_HPP
 #define FINANCETECHNOLOGYPROJECTS_BINANCE_MARKET_DATA_PARSER_HPP
 
+#include "instrument.hpp"
+#include "instrument_resolver.hpp"
 #include "market_data_parser.hpp"
+#include "model/book_snapshot.hpp"
+#include "timestamp.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "simdjson.h"
 
 namespace trading::exchanges::binance
 {
     class BinanceMarketDataParser final : public market_data::IMarketDataParser
     {
     public:
+        static constexpr std::size_t DefaultBufferSize { 64 * 1024 };
+
+        explicit BinanceMarketDataParser(const Instrument& instrument,
+                                         std::size_t bufferSize = DefaultBufferSize);
+
+        explicit BinanceMarketDataParser(std::span<const Instrument> instruments,
+                                         std::size_t bufferSize = DefaultBufferSize);
+
         [[nodiscard]]
         market_data::ParseResult parse(std::string_view message,
                                        market_data::BookUpdates& bookUpdates) const override;
+
+        /*
+            Parses a REST depth snapshot (GET /api/v3/depth) or a partial
+            depth stream message. Used on the recovery path only.
+        */
+        [[nodiscard]]
+        market_data::ParseResult parseSnapshot(std::string_view message,
+                                               market_data::BookSnapshot& snapshot) const;
+
+        /*
+            Exchange event time ("E") of a raw message, found by scanning the
+            message instead of parsing it. Paces replays of recorded messages
+            (market_data::ExchangeTimeReader).
+        */
+        [[nodiscard]]
+        static std::optional<Timestamp> eventTime(std::string_view message) noexcept;
+
+    private:
+        // Copy of 'message' followed by SIMDJSON_PADDING zero bytes, valid until the next call.
+        [[nodiscard]]
+        simdjson::padded_string_view padded(std::string_view message) const;
+
+        InstrumentResolver resolver;
+
+        mutable simdjson::ondemand::parser parser;
+        mutable std::unique_ptr<char[]> buffer;
+        mutable std::size_t bufferSize;
     };
 }
 
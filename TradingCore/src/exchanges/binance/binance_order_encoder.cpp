@@ -0,0 +1,159 @@
+/**============================================================================
+Name        : binance_order_encoder.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Pre-rendered Binance new order request templates.
+============================================================================**/
+
+#include "binance_order_encoder.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+namespace
+{
+    using trading::OrderType;
+    using trading::Side;
+
+    constexpr int ClientOrderIdDigits { 20 };
+    constexpr int TimestampDigits { 13 };
+    constexpr uint64_t MaxTimestamp { 9'999'999'999'999 };
+
+    constexpr std::string_view PriceParameter { "&price=" };
+
+    // Appends to a template buffer; the static_assert below bounds the longest request.
+    struct Writer
+    {
+        char* current;
+
+        void append(const std::string_view text) noexcept
+        {
+            current = std::copy(text.begin(), text.end(), current);
+        }
+
+        void appendZeros(const int count) noexcept
+        {
+            current = std::fill_n(current, count, '0');
+        }
+    };
+
+    [[nodiscard]]
+    constexpr std::string_view sideName(const Side side) noexcept
+    {
+        return side == Side::Buy ? "BUY" : "SELL";
+    }
+}
+
+namespace trading::exchanges::binance
+{
+    // symbol= &side=SELL &type=LIMIT&timeInForce=GTC &newClientOrderId= &timestamp= &quantity= &price=
+    static_assert(7 + BinanceOrderEncoder::MaxSymbolLength + 10 + 27
+                  + 18 + ClientOrderIdDigits + 11 + TimestampDigits
+                  + 10 + details::MaxDecimalChars + PriceParameter.size() + details::MaxDecimalChars
+                  + BinanceOrderEncoder::SignatureReserve <= BinanceOrderEncoder::BufferSize);
+
+    BinanceOrderEncoder::BinanceOrderEncoder(const std::span<const Instrument> instruments):
+        instrumentSlots { instruments }
+    {
+        templates.reserve(instruments.size());
+
+        for (const Instrument& instrument : instruments)
+        {
+            const std::string_view symbol = instrument.symbol();
+            if (symbol.empty() || symbol.size() > MaxSymbolLength
+                || instrumentSlots.add(instrument.id()) == InstrumentSlots::NoSlot)
+                continue;
+
+            InstrumentTemplates& entry = templates.emplace_back();
+            entry.priceDecimalPlaces = instrument.priceDecimalPlaces();
+            entry.quantityDecimalPlaces = instrument.quantityDecimalPlaces();
+
+            for (const Side side : { Side::Buy, Side::Sell })
+            {
+                for (const OrderType type : { OrderType::Market, OrderType::Limit })
+                    render(entry.requests[indexOf(side, type)], symbol, side, type);
+            }
+        }
+    }
+
+    std::span<const std::byte> BinanceOrderEncoder::encode(const execution::Order& order,
+                                                           const uint64_t timestampMilliseconds,
+                                                           const BinanceRequestSigner* const signer) noexcept
+    {
+        const InstrumentSlots::Slot slot = instrumentSlots.slotOf(order.instrument);
+        if (slot == InstrumentSlots::NoSlot || timestampMilliseconds > MaxTimestamp) [[unlikely]]
+            return {};
+
+        InstrumentTemplates& entry = templates[slot];
+        RequestTemplate& request = entry.requests[indexOf(order.side, order.type)];
+        char* const first = request.buffer.data();
+        char* const last = first + request.buffer.size() - SignatureReserve;
+
+        details::writeDigits(first + request.clientOrderIdOffset, ClientOrderIdDigits, order.clientOrderId);
+        details::writeDigits(first + request.timestampOffset, TimestampDigits, timestampMilliseconds);
+
+        char* current = first + request.quantityOffset;
+        const auto quantity = order.quantity.toChars(current, last, { .fractionDigits = entry.quantityDecimalPlaces });
+        if (order.quantity.raw() <= 0 || quantity.ec != std::errc {}) [[unlikely]]
+            return {};
+        current = quantity.ptr;
+
+        if (request.hasPrice)
+        {
+            current = std::copy(PriceParameter.begin(), PriceParameter.end(), current);
+            const auto price = order.price.toChars(current, last, { .fractionDigits = entry.priceDecimalPlaces });
+            if (order.price.raw() <= 0 || price.ec != std::errc {}) [[unlikely]]
+                return {};
+            current = price.ptr;
+        }
+
+        std::size_t length = static_cast<std::size_t>(current - first);
+        if (signer != nullptr)
+            length = signer->appendSignature(request.buffer, length);
+
+        return std::as_bytes(std::span { first, length });
+    }
+
+    bool BinanceOrderEncoder::contains(const InstrumentId instrument) const noexcept
+    {
+        return instrumentSlots.contains(instrument);
+    }
+
+    std::size_t BinanceOrderEncoder::indexOf(const Side side, const OrderType type) noexcept
+    {
+        return static_cast<std::size_t>(side) * 2 + static_cast<std::size_t>(type);
+    }
+
+    void BinanceOrderEncoder::render(RequestTemplate& request,
+                                     const std::string_view symbol,
+                                     const Side side,
+                                     const OrderType type) noexcept
+    {
+        char* const first = request.buffer.data();
+        Writer writer { first };
+
+        writer.append("symbol=");
+        writer.append(symbol);
+        writer.append("&side=");
+        writer.append(sideName(side));
+
+        if (type == OrderType::Limit)
+            writer.append("&type=LIMIT&timeInForce=GTC");
+        else
+            writer.append("&type=MARKET");
+
+        writer.append("&newClientOrderId=");
+        request.clientOrderIdOffset = static_cast<uint16_t>(writer.current - first);
+        writer.appendZeros(ClientOrderIdDigits);
+
+        writer.append("&timestamp=");
+        request.timestampOffset = static_cast<uint16_t>(writer.current - first);
+        writer.appendZeros(TimestampDigits);
+
+        writer.append("&quantity=");
+        request.quantityOffset = static_cast<uint16_t>(writer.current - first);
+        request.hasPrice = type == OrderType::Limit;
+    }
+}
@@ -0,0 +1,145 @@
+/**============================================================================
+Name        : binance_order_encoder.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Pre-rendered Binance new order request templates.
+============================================================================**/
+
+/*
+    BinanceOrderEncoder turns an Order into the parameters of a Binance new
+    order request (POST /api/v3/order, or the params of the WebSocket API
+    order.place) without building strings on the send path.
+
+    Data Flow:
+
+        configured instruments                    execution::Order
+               |                                        |
+               | constructor (startup)                  | send path
+               v                                        v
+        +---------------------------------------------------------------+
+        |  templates[slot][side][type]   fixed part rendered once       |
+        |  patch newClientOrderId / timestamp digits in place           |
+        |  append quantity (and price) on the instrument grid           |
+        +---------------------------------------------------------------+
+                                    |
+                                    v
+                    std::span<const std::byte> request
+
+    Layout:
+
+        One template per instrument, side and order type. Everything the
+        order cannot change is rendered in the constructor, followed by the
+        fixed-width fields and finally the two decimals:
+
+            symbol=BTCUSDT&side=BUY&type=LIMIT&timeInForce=GTC
+            &newClientOrderId=00000000000000000042&timestamp=1765107346014
+            &quantity=0.00100&price=89218.34
+
+        newClientOrderId is the OrderId with leading zeros (always 20 digits)
+        and timestamp the Unix time in milliseconds (13 digits until the year
+        2286), so both are overwritten at fixed offsets. Quantity and price
+        are written with the fraction digits of the instrument lot and tick
+        size by formatDecimal(); only these bytes are rendered per order.
+        Market orders carry neither price nor timeInForce.
+
+    Buffers:
+
+        Every template owns its buffer and the fixed part is never rewritten,
+        so an encode() is a few digit stores and two decimal conversions into
+        memory that stays in cache. Buffers leave room for the signature
+        parameter (SignatureReserve): with a BinanceRequestSigner, encode()
+        appends "&signature=..." in place behind the parameters.
+
+        The returned span points into the template buffer and stays valid
+        until the next encode() of the same instrument, side and type.
+
+    Instrument indexing:
+
+        An InstrumentSlots table maps InstrumentId to a dense template slot.
+        Instruments with an id above MaxInstrumentId, a duplicate id, or a
+        symbol longer than MaxSymbolLength get no template.
+
+    encode() returns an empty span when the order cannot be encoded: no
+    template for the instrument, a price or quantity that is negative or not
+    on the instrument grid, or a timestamp that does not fit 13 digits.
+
+    BinanceOrderEncoder does not:
+        - hold API keys; the caller passes the signer;
+        - know the transport (REST query string or WebSocket API params);
+        - validate orders against risk limits;
+        - synchronize: one thread encodes.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BINANCE_ORDER_ENCODER_HPP
+#define FINANCETECHNOLOGYPROJECTS_BINANCE_ORDER_ENCODER_HPP
+
+#include "binance_request_signer.hpp"
+#include "instrument.hpp"
+#include "instrument_slots.hpp"
+#include "order.hpp"
+#include "types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace trading::exchanges::binance
+{
+    class BinanceOrderEncoder
+    {
+    public:
+        static constexpr std::size_t MaxSymbolLength { 20 };
+
+        static constexpr std::size_t SignatureReserve { BinanceRequestSigner::SignatureSize };
+        static constexpr std::size_t BufferSize { 320 };
+
+        BinanceOrderEncoder() = default;
+
+        explicit BinanceOrderEncoder(std::span<const Instrument> instruments);
+
+        /*
+            Request parameters of the order stamped with 'timestampMilliseconds'
+            (Unix time) and signed by 'signer' when given, or an empty span
+            when the order cannot be encoded.
+        */
+        [[nodiscard]]
+        std::span<const std::byte> encode(const execution::Order& order,
+                                          uint64_t timestampMilliseconds,
+                                          const BinanceRequestSigner* signer = nullptr) noexcept;
+
+        [[nodiscard]]
+        bool contains(InstrumentId instrument) const noexcept;
+
+    private:
+        struct alignas(64) RequestTemplate
+        {
+            std::array<char, BufferSize> buffer {};
+            uint16_t clientOrderIdOffset { 0 };
+            uint16_t timestampOffset { 0 };
+            uint16_t quantityOffset { 0 };
+            bool hasPrice { false };
+        };
+
+        struct InstrumentTemplates
+        {
+            std::array<RequestTemplate, 4> requests {};
+            int priceDecimalPlaces { 0 };
+            int quantityDecimalPlaces { 0 };
+        };
+
+        [[nodiscard]]
+        static std::size_t indexOf(Side side, OrderType type) noexcept;
+
+        static void render(RequestTemplate& request, std::string_view symbol, Side side, OrderType type) noexcept;
+
+        InstrumentSlots instrumentSlots;
+        std::vector<InstrumentTemplates> templates;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BINANCE_ORDER_ENCODER_HPP
@@ -0,0 +1,39 @@
+/**============================================================================
+Name        : binance_request_signer.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : HMAC-SHA256 signatures of Binance signed requests.
+============================================================================**/
+
+#include "binance_request_signer.hpp"
+#include "HexConverter.hpp"
+
+#include <algorithm>
+
+namespace trading::exchanges::binance
+{
+    BinanceRequestSigner::BinanceRequestSigner(const std::string_view secretKey) noexcept :
+        hmac { std::as_bytes(std::span { secretKey }) }
+    {
+    }
+
+    void BinanceRequestSigner::sign(const std::string_view payload,
+                                    const std::span<char, HexSignatureSize> signature) const noexcept
+    {
+        const crypto::HmacSha256::Digest digest = hmac.sign(std::as_bytes(std::span { payload }));
+        HexConverter::bytesToLowerHex(reinterpret_cast<const uint8_t*>(digest.data()), digest.size(), signature.data());
+    }
+
+    std::size_t BinanceRequestSigner::appendSignature(const std::span<char> buffer,
+                                                      const std::size_t length) const noexcept
+    {
+        if (length > buffer.size() || buffer.size() - length < SignatureSize)
+            return 0;
+
+        char* const parameter = std::ranges::copy(SignatureParameter, buffer.data() + length).out;
+        sign({ buffer.data(), length }, std::span<char, HexSignatureSize> { parameter, HexSignatureSize });
+        return length + SignatureSize;
+    }
+}
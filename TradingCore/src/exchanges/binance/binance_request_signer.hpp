@@ -0,0 +1,75 @@
+/**============================================================================
+Name        : binance_request_signer.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : HMAC-SHA256 signatures of Binance signed requests.
+============================================================================**/
+
+/*
+    BinanceRequestSigner signs the parameters of Binance SIGNED endpoints
+    (new order, cancel, ...) with the API secret key:
+
+        signature = hex(HMAC-SHA256(secretKey, totalParams))
+
+    Data Flow:
+
+        secret key ---> HmacSha256 (key pads compressed once)
+                                 |
+        request buffer           |
+        [params .... | free ]    |
+               |                 |
+               v                 v
+        appendSignature(buffer, length)
+               |
+               | HMAC from the midstates, SIMD hex (HexConverter)
+               v
+        [params&signature=<64 lowercase hex digits>]
+
+    The signature is appended in place behind the parameters, so a request
+    rendered into a buffer with SignatureSize bytes of headroom (see
+    BinanceOrderEncoder) is signed without a copy or an allocation.
+
+    BinanceRequestSigner does not:
+        - add timestamp or recvWindow; they are part of the parameters;
+        - keep the secret key, only the HMAC midstates.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BINANCE_REQUEST_SIGNER_HPP
+#define FINANCETECHNOLOGYPROJECTS_BINANCE_REQUEST_SIGNER_HPP
+
+#include "hmac_sha256.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace trading::exchanges::binance
+{
+    class BinanceRequestSigner
+    {
+    public:
+        static constexpr std::string_view SignatureParameter { "&signature=" };
+        static constexpr std::size_t HexSignatureSize { 2 * crypto::Sha256::DigestSize };
+        static constexpr std::size_t SignatureSize { SignatureParameter.size() + HexSignatureSize };
+
+        explicit BinanceRequestSigner(std::string_view secretKey) noexcept;
+
+        // Writes the lowercase hex signature of 'payload' into 'signature'.
+        void sign(std::string_view payload, std::span<char, HexSignatureSize> signature) const noexcept;
+
+        /*
+            Signs buffer[0, length) and appends "&signature=<hex>" behind it.
+            Returns the signed length, or 0 when the buffer has less than
+            SignatureSize bytes after 'length'.
+        */
+        [[nodiscard]]
+        std::size_t appendSignature(std::span<char> buffer, std::size_t length) const noexcept;
+
+    private:
+        crypto::HmacSha256 hmac;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BINANCE_REQUEST_SIGNER_HPP
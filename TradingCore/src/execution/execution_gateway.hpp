@@ -48,6 +48,8 @@ Description : execution_gateway.hpp
         - provide an abstraction over the external execution venue;
         - send an Order to the external venue;
         - request cancellation of an existing order;
+        - request cancellation of several orders at once where the venue
+          supports batched cancels (the default sends one cancel per order);
         - hide transport and exchange-specific execution details from the trading core.
 
     IExecutionGateway defines a boundary, not an execution implementation.
@@ -63,6 +65,15 @@ Description : execution_gateway.hpp
 
     Transport-specific details must remain inside the concrete gateway  implementation.
 
+    Re-entrancy:
+
+        An implementation may hand a report to the trading core while
+        send() runs: BinanceExecutionGateway rejects an order it cannot
+        encode from inside send(). OrderManager::createOrder() allows that
+        and does not touch the order after send() returns. Reports caused by
+        cancel() or cancelBatch() must be delivered after the call, as
+        Pipeline and SimulatedExecutionGateway do.
+
     IExecutionGateway does not:
 
         - create Orders;
@@ -72,7 +83,8 @@ Description : execution_gateway.hpp
         - calculate PnL;
         - update Order state from execution reports;
         - parse exchange-specific execution messages;
-        - generate ExecutionReport objects.
+        - generate ExecutionReport objects, except the rejection of an
+          order it cannot send.
 
     Execution state flows back into the trading core through execution reports.
     The gateway therefore represents the outbound direction of the execution
@@ -87,6 +99,8 @@ Description : execution_gateway.hpp
 
 #include "order.hpp"
 
+#include <span>
+
 namespace trading::execution
 {
     struct IExecutionGateway
@@ -95,6 +109,21 @@ namespace trading::execution
 
         virtual void send(const Order& order) = 0;
         virtual void cancel(OrderId orderId) = 0;
+
+        // Override where the venue accepts several cancels in one request.
+        virtual void cancelBatch(const std::span<const OrderId> orderIds)
+        {
+            for (const OrderId orderId : orderIds)
+                cancel(orderId);
+        }
+    };
+
+    // Static counterpart of IExecutionGateway for compile-time wiring.
+    template<typename Gateway>
+    concept OrderGateway = requires(Gateway& gateway, const Order& order, OrderId orderId)
+    {
+        gateway.send(order);
+        gateway.cancel(orderId);
     };
 }
 
@@ -147,6 +147,10 @@ Description : order.hpp
     An OrderRequest may result in the creation of an Order, while an Order
     continues to exist and change state as execution reports are received.
 
+    Both carry the tick-to-trade stamps of the market data message that
+    led to them in 'trace' (see TraceContext); the member is empty unless
+    built with TRADING_CORE_TRACING.
+
     The execution lifecycle is therefore:
 
         OrderRequest
@@ -181,6 +185,7 @@ Description : order.hpp
 
 #include "price.hpp"
 #include "quantity.hpp"
+#include "trace_context.hpp"
 #include "types.hpp"
 
 namespace trading::execution
@@ -197,6 +202,7 @@ namespace trading::execution
         OrderType type;
         Price price;
         Quantity quantity;
+        [[no_unique_address]] trace::TraceContext trace {};
     };
 
     /*
@@ -215,6 +221,7 @@ namespace trading::execution
         Quantity quantity {};
         Quantity filledQuantity {};
         OrderStatus status { OrderStatus::New };
+        [[no_unique_address]] trace::TraceContext trace {};
     };
 }
 
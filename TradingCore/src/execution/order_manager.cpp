@@ -25,7 +25,7 @@ Description : order_manager.cpp
     return 0    create Order
                    |
                    v
-                store
+            OrderStore
                    |
                    v
             gateway.send()
@@ -33,6 +33,10 @@ Description : order_manager.cpp
     Execution reports are handled separately and update the locally stored
     order state.
 
+    An accepted order is reserved in the risk manager. Execution reports
+    release the filled part and, once the order is Filled, Cancelled or
+    Rejected, the rest of it.
+
     Position changes are intentionally not performed when an order is created.
     PositionManager must update the position only after an execution report
     confirms an actual trade.
@@ -44,60 +48,33 @@ namespace trading::execution
 {
     OrderManager::OrderManager(IExecutionGateway& gateway,
                                risk::IRiskManager& riskManager,
-                               position::Position& position) noexcept:
+                               position::Position& position,
+                               const OrderStoreConfig& storeConfig):
         gateway { gateway },
         riskManager { riskManager },
-        position { position }
+        position { position },
+        orders { storeConfig }
     {
+        // Never more open orders than live slots: cancelAll() does not allocate.
+        cancelBatch.reserve(orders.capacity());
     }
 
     OrderCreationResult OrderManager::createOrder(const OrderRequest& request)
     {
-        if (request.instrument == InstrumentId { 0 } ||
-            request.quantity.isZero() ||
-            !request.quantity.isPositive() ||
-            request.price.isZero() ||
-            !request.price.isPositive())
-        {
-            return std::unexpected(OrderCreationError::InvalidRequest);
-        }
-
-        const risk::RiskResult riskResult = riskManager.checkOrder(request, position);
-
-        if (riskResult != risk::RiskResult::Accepted)
-            return std::unexpected(OrderCreationError::RiskRejected);
-
-        const OrderId orderId = nextOrderId++;
-
-        Order order {
-            .clientOrderId = orderId,
-            .exchangeOrderId = ExchangeOrderId { 0 },
-            .instrument = request.instrument,
-            .side = request.side,
-            .type = request.type,
-            .price = request.price,
-            .quantity = request.quantity,
-            .filledQuantity = Quantity {},
-            .status = OrderStatus::New
-        };
-
-        const auto [it, inserted] = orders.emplace(orderId, order);
-
-        if (!inserted)
-            return std::unexpected(OrderCreationError::InvalidRequest);
-
-        gateway.send(it->second);
-
-        return orderId;
+        return createOrder(request, riskManager, position, gateway);
     }
 
     bool OrderManager::applyExecution(const ExecutionReport& report)
     {
-        const auto it = orders.find(report.clientOrderId);
-        if (it == orders.end())
+        Order* const tracked = orders.find(report.clientOrderId);
+        if (tracked == nullptr)
             return false;
 
-        Order& order = it->second;
+        Order& order = *tracked;
+
+        // Only live orders hold a risk reservation.
+        const bool live = orders.findLive(report.clientOrderId) != nullptr;
+        const Quantity pendingBefore = remainingQuantity(order);
 
         order.exchangeOrderId = report.exchangeOrderId;
         order.status = report.status;
@@ -106,24 +83,66 @@ namespace trading::execution
         if (report.execType == ExecType::Trade)
             position.applyTrade(report.side, report.price, report.quantity);
 
+        if (live)
+        {
+            const Quantity pendingAfter = isTerminal(order.status) ? Quantity {} : remainingQuantity(order);
+            if (pendingBefore > pendingAfter)
+                riskManager.release(order, pendingBefore - pendingAfter);
+        }
+
+        // No-op for an order that is already in the history.
+        if (isTerminal(order.status))
+            orders.retire(report.clientOrderId);
+
         return true;
     }
 
     const Order* OrderManager::find(const OrderId orderId) const noexcept
     {
-        const auto it = orders.find(orderId);
-        if (it == orders.end())
-            return nullptr;
-
-        return &it->second;
+        return orders.find(orderId);
     }
 
     bool OrderManager::cancel(const OrderId orderId)
     {
-        if (const auto it = orders.find(orderId); it == orders.end())
+        if (orders.find(orderId) == nullptr)
             return false;
         gateway.cancel(orderId);
 
         return true;
     }
+
+    std::size_t OrderManager::cancelAll(const InstrumentId instrument)
+    {
+        cancelBatch.clear();
+        collectOpenOrders(instrument, Side::Buy);
+        collectOpenOrders(instrument, Side::Sell);
+
+        if (!cancelBatch.empty())
+            gateway.cancelBatch(cancelBatch);
+
+        return cancelBatch.size();
+    }
+
+    std::size_t OrderManager::cancelAll(const InstrumentId instrument, const Side side)
+    {
+        cancelBatch.clear();
+        collectOpenOrders(instrument, side);
+
+        if (!cancelBatch.empty())
+            gateway.cancelBatch(cancelBatch);
+
+        return cancelBatch.size();
+    }
+
+    std::size_t OrderManager::openOrderCount(const InstrumentId instrument, const Side side) const noexcept
+    {
+        return orders.liveCount(instrument, side);
+    }
+
+    void OrderManager::collectOpenOrders(const InstrumentId instrument, const Side side)
+    {
+        orders.forEachLive(instrument, side, [this](const Order& order) {
+            cancelBatch.push_back(order.clientOrderId);
+        });
+    }
 }
\ No newline at end of file
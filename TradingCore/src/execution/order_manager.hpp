@@ -98,6 +98,12 @@ Description : order_manager.hpp
     OrderManager therefore acts as the coordinator between risk validation,
     internal order state and the external execution gateway.
 
+    Every tracked order is reserved in IRiskManager (reserve()) when it is
+    accepted. applyExecution() releases the filled quantity on each trade
+    and the remaining quantity when the order becomes Filled, Cancelled or
+    Rejected, so the risk manager sees the exposure of open orders without
+    scanning them.
+
 
     --------------------------------------------------------------------------
     OrderManager::applyExecution
@@ -196,12 +202,36 @@ Description : order_manager.hpp
             -> applies confirmed execution state
 
 
+    --------------------------------------------------------------------------
+    OrderManager::cancelAll
+    --------------------------------------------------------------------------
+
+    cancelAll() requests cancellation of every open order of an instrument,
+    or of one side of it (requoting, kill switch). The open orders are taken
+    from the per-(instrument, side) lists of OrderStore, so the cost depends
+    only on the number of open orders of that instrument side, and all
+    cancels go to the gateway in one IExecutionGateway::cancelBatch() call.
+
+    As with cancel(), the orders stay open until execution reports confirm
+    the cancellation. forEachOpenOrder() visits the same open orders.
+
+
     --------------------------------------------------------------------------
     Order state
     --------------------------------------------------------------------------
 
     OrderManager owns the collection of internally tracked Orders.
 
+    Orders are kept in a preallocated OrderStore indexed by OrderId (see
+    order_store.hpp). An order that reaches Filled, Cancelled or Rejected
+    retires to a bounded history and stays available to find() and cancel()
+    until newer retired orders replace it. OrderStoreConfig::overflow
+    decides what happens when the slot of a new id still holds a live order:
+    with Reject the id is skipped and createOrder() fails with
+    CapacityExceeded only when every slot is taken; with RetireOldest the old
+    order is retired and its risk reservation released although it may still
+    rest on the exchange (see order_store.hpp).
+
     The Order object represents the current internal execution state of an
     order, while OrderRequest represents the original trading intent.
 
@@ -242,12 +272,16 @@ Description : order_manager.hpp
 #ifndef FINANCETECHNOLOGYPROJECTS_ORDER_MANAGER_HPP
 #define FINANCETECHNOLOGYPROJECTS_ORDER_MANAGER_HPP
 
+#include <cassert>
+#include <concepts>
+#include <cstddef>
 #include <expected>
-#include <map>
+#include <vector>
 
 #include "execution_gateway.hpp"
 #include "execution_report.hpp"
 #include "order.hpp"
+#include "order_store.hpp"
 #include "risk_manager.hpp"
 #include "position.hpp"
 
@@ -256,7 +290,8 @@ namespace trading::execution
     enum class OrderCreationError: uint8_t
     {
         RiskRejected,
-        InvalidRequest
+        InvalidRequest,
+        CapacityExceeded
     };
 
     using OrderCreationResult = std::expected<OrderId, OrderCreationError>;
@@ -266,11 +301,101 @@ namespace trading::execution
     public:
         OrderManager(IExecutionGateway& gateway,
                      risk::IRiskManager& riskManager,
-                     position::Position& position) noexcept;
+                     position::Position& position,
+                     const OrderStoreConfig& storeConfig = {});
 
         [[nodiscard]]
         OrderCreationResult createOrder(const OrderRequest& request);
 
+        /*
+            createOrder() over concrete risk and gateway types, for callers
+            wired at compile time (InlineTradingPath): validation, risk
+            check, acceptOrder() and send, without a virtual call.
+            'orderRisk', 'orderPosition' and 'orderGateway' must be the ones
+            OrderManager was constructed with: applyExecution() releases the
+            reservations through the constructor's risk manager (checked by
+            an assert when Risk is an IRiskManager). createOrder(request)
+            runs the same sequence over the interfaces.
+        */
+        template<risk::PreTradeRisk Risk, OrderGateway Gateway>
+        [[nodiscard]]
+        OrderCreationResult createOrder(const OrderRequest& request,
+                                        Risk& orderRisk,
+                                        const position::Position& orderPosition,
+                                        Gateway& orderGateway)
+        {
+            if (!isValidRequest(request))
+                return std::unexpected(OrderCreationError::InvalidRequest);
+
+            if (orderRisk.checkOrder(request, orderPosition) != risk::RiskResult::Accepted)
+                return std::unexpected(OrderCreationError::RiskRejected);
+
+            const Order* order = acceptOrder(request, orderRisk);
+            if (order == nullptr)
+                return std::unexpected(OrderCreationError::CapacityExceeded);
+
+            // The gateway may report a rejection from inside send(), which retires the order.
+            const OrderId orderId = order->clientOrderId;
+            trace::finish(order->trace);
+            orderGateway.send(*order);
+            return orderId;
+        }
+
+        /*
+            Second half of createOrder(): assigns the OrderId, starts
+            tracking the order and reserves it in 'orderRisk' (the risk
+            manager OrderManager was constructed with). 'request' must be
+            valid and accepted by risk, so its trace is stamped RiskPassed
+            here. Returns nullptr if the order cannot be tracked.
+        */
+        template<risk::PreTradeRisk Risk>
+        [[nodiscard]]
+        const Order* acceptOrder(const OrderRequest& request, Risk& orderRisk)
+        {
+            if constexpr (std::derived_from<Risk, risk::IRiskManager>)
+                assert(static_cast<const risk::IRiskManager*>(&orderRisk) == &riskManager);
+
+            // Skips the ids whose slot still holds a resting order.
+            const OrderId orderId = orders.nextInsertableId(nextOrderId);
+            if (orderId == OrderId { 0 })
+                return nullptr;
+
+            Order order {
+                .clientOrderId = orderId,
+                .exchangeOrderId = ExchangeOrderId { 0 },
+                .instrument = request.instrument,
+                .side = request.side,
+                .type = request.type,
+                .price = request.price,
+                .quantity = request.quantity,
+                .filledQuantity = Quantity {},
+                .status = OrderStatus::New,
+                .trace = request.trace
+            };
+            order.trace.stamp(trace::Stage::RiskPassed);
+
+            Order evicted {};
+            const Order* stored = orders.insert(order, &evicted);
+            if (stored == nullptr)
+                return nullptr;
+
+            // An evicted order is no longer tracked, its reservation goes with it.
+            if (evicted.clientOrderId != OrderId { 0 })
+                orderRisk.release(evicted, remainingQuantity(evicted));
+
+            orderRisk.reserve(*stored);
+            nextOrderId = orderId + 1;
+            return stored;
+        }
+
+        [[nodiscard]]
+        static constexpr bool isValidRequest(const OrderRequest& request) noexcept
+        {
+            return request.instrument != InstrumentId { 0 } &&
+                   request.quantity.isPositive() &&
+                   request.price.isPositive();
+        }
+
         [[nodiscard]]
         bool applyExecution(const ExecutionReport& report);
 
@@ -280,11 +405,41 @@ namespace trading::execution
         [[nodiscard]]
         bool cancel(OrderId orderId);
 
+        // Returns the number of cancel requests sent.
+        std::size_t cancelAll(InstrumentId instrument);
+        std::size_t cancelAll(InstrumentId instrument, Side side);
+
+        // Calls visitor(const Order&) for every open order, oldest first per side.
+        template<typename Visitor>
+        void forEachOpenOrder(const InstrumentId instrument, const Side side, Visitor&& visitor) const
+        {
+            orders.forEachLive(instrument, side, visitor);
+        }
+
+        template<typename Visitor>
+        void forEachOpenOrder(const InstrumentId instrument, Visitor&& visitor) const
+        {
+            orders.forEachLive(instrument, Side::Buy, visitor);
+            orders.forEachLive(instrument, Side::Sell, visitor);
+        }
+
+        [[nodiscard]]
+        std::size_t openOrderCount(InstrumentId instrument, Side side) const noexcept;
+
     private:
+        [[nodiscard]]
+        static constexpr Quantity remainingQuantity(const Order& order) noexcept
+        {
+            return order.filledQuantity < order.quantity ? order.quantity - order.filledQuantity : Quantity {};
+        }
+
+        void collectOpenOrders(InstrumentId instrument, Side side);
+
         IExecutionGateway& gateway;
         risk::IRiskManager& riskManager;
         position::Position& position;
-        std::map<OrderId, Order> orders;
+        OrderStore orders;
+        std::vector<OrderId> cancelBatch;
         OrderId nextOrderId { 1 };
     };
 }
@@ -0,0 +1,189 @@
+/**============================================================================
+Name        : order_store.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Preallocated order storage indexed by OrderId.
+============================================================================**/
+
+#include "order_store.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace trading::execution
+{
+    namespace
+    {
+        constexpr OrderId EmptySlot { 0 };
+
+        [[nodiscard]]
+        constexpr std::size_t ringSize(const std::size_t capacity) noexcept
+        {
+            return std::bit_ceil(std::max<std::size_t>(capacity, 1));
+        }
+    }
+
+    OrderStore::OrderStore(const OrderStoreConfig& config):
+        overflow { config.overflow },
+        liveMask { ringSize(config.capacity) - 1 },
+        historyMask { ringSize(config.historyCapacity) - 1 },
+        live(liveMask + 1),
+        links(liveMask + 1),
+        history(historyMask + 1),
+        openOrders(instrumentTableSize(config.instruments))
+    {
+    }
+
+    Order* OrderStore::insert(const Order& order, Order* evicted)
+    {
+        if (evicted != nullptr)
+            *evicted = Order {};
+
+        if (order.clientOrderId == EmptySlot || order.instrument >= openOrders.size())
+            return nullptr;
+
+        Order& slot = live[order.clientOrderId & liveMask];
+        if (slot.clientOrderId != EmptySlot)
+        {
+            if (slot.clientOrderId >= order.clientOrderId || overflow == OrderStoreOverflow::Reject)
+                return nullptr;
+
+            if (evicted != nullptr)
+                *evicted = slot;
+
+            moveToHistory(slot);
+            ++evictedOrders;
+        }
+        else if (find(order.clientOrderId) != nullptr)
+        {
+            return nullptr;
+        }
+
+        slot = order;
+        link(static_cast<Slot>(order.clientOrderId & liveMask));
+        ++liveOrders;
+        return &slot;
+    }
+
+    OrderId OrderStore::nextInsertableId(const OrderId candidate) const noexcept
+    {
+        if (overflow == OrderStoreOverflow::RetireOldest)
+            return candidate;
+
+        if (liveOrders == live.size())
+            return EmptySlot;
+
+        // Terminates within 'capacity' steps: at least one slot is free.
+        OrderId orderId = candidate;
+        while (orderId == EmptySlot || live[orderId & liveMask].clientOrderId != EmptySlot)
+            ++orderId;
+        return orderId;
+    }
+
+    Order* OrderStore::findLive(const OrderId orderId) noexcept
+    {
+        Order& slot = live[orderId & liveMask];
+        return slot.clientOrderId == orderId && orderId != EmptySlot ? &slot : nullptr;
+    }
+
+    Order* OrderStore::find(const OrderId orderId) noexcept
+    {
+        if (Order* order = findLive(orderId))
+            return order;
+
+        Order& slot = history[orderId & historyMask];
+        return slot.clientOrderId == orderId && orderId != EmptySlot ? &slot : nullptr;
+    }
+
+    const Order* OrderStore::find(const OrderId orderId) const noexcept
+    {
+        return const_cast<OrderStore*>(this)->find(orderId);
+    }
+
+    bool OrderStore::retire(const OrderId orderId) noexcept
+    {
+        Order* order = findLive(orderId);
+        if (order == nullptr)
+            return false;
+
+        moveToHistory(*order);
+        return true;
+    }
+
+    void OrderStore::link(const Slot slot)
+    {
+        const Order& order = live[slot];
+        OpenOrders& lists = openOrders[order.instrument];
+        const std::size_t side = sideIndex(order.side);
+
+        links[slot] = Link { .previous = lists.tail[side], .next = NoSlot };
+        if (lists.tail[side] != NoSlot)
+            links[lists.tail[side]].next = slot;
+        else
+            lists.head[side] = slot;
+
+        lists.tail[side] = slot;
+        ++lists.count[side];
+    }
+
+    void OrderStore::unlink(const Slot slot) noexcept
+    {
+        const Order& order = live[slot];
+        OpenOrders& lists = openOrders[order.instrument];
+        const std::size_t side = sideIndex(order.side);
+        const Link link = links[slot];
+
+        if (link.previous != NoSlot)
+            links[link.previous].next = link.next;
+        else
+            lists.head[side] = link.next;
+
+        if (link.next != NoSlot)
+            links[link.next].previous = link.previous;
+        else
+            lists.tail[side] = link.previous;
+
+        links[slot] = Link {};
+        --lists.count[side];
+    }
+
+    void OrderStore::moveToHistory(Order& order) noexcept
+    {
+        unlink(static_cast<Slot>(order.clientOrderId & liveMask));
+
+        // A late retirement must not overwrite a newer retired order.
+        Order& slot = history[order.clientOrderId & historyMask];
+        if (slot.clientOrderId < order.clientOrderId)
+            slot = order;
+
+        order = Order {};
+        --liveOrders;
+    }
+
+    std::size_t OrderStore::liveCount() const noexcept
+    {
+        return liveOrders;
+    }
+
+    std::size_t OrderStore::liveCount(const InstrumentId instrument, const Side side) const noexcept
+    {
+        return instrument < openOrders.size() ? openOrders[instrument].count[sideIndex(side)] : 0;
+    }
+
+    std::size_t OrderStore::capacity() const noexcept
+    {
+        return live.size();
+    }
+
+    std::size_t OrderStore::historyCapacity() const noexcept
+    {
+        return history.size();
+    }
+
+    uint64_t OrderStore::evictions() const noexcept
+    {
+        return evictedOrders;
+    }
+}
@@ -0,0 +1,228 @@
+/**============================================================================
+Name        : order_store.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Preallocated order storage indexed by OrderId.
+============================================================================**/
+
+/*
+    OrderStore keeps the orders of OrderManager in two preallocated rings
+    indexed by OrderId. OrderManager assigns ids from a monotonic counter, so
+    the id selects the slot directly and every operation is O(1) without
+    hashing, tree walks or allocation.
+
+    Data Flow:
+
+        OrderManager::acceptOrder()
+             |
+             | insert(order)           live[id & (capacity - 1)]
+             v
+        +------------------------+
+        | live orders            | <--- findLive(id): OrderManager::applyExecution()
+        +------------------------+
+             |
+             | retire(id)              order reached Filled / Cancelled / Rejected
+             v
+        +------------------------+
+        | history                |      history[id & (historyCapacity - 1)]
+        +------------------------+
+             ^
+             |
+        find(id): live first, then history
+
+    A slot belongs to the order whose clientOrderId it holds; an empty slot
+    holds OrderId 0, which OrderManager never assigns.
+
+    Overflow:
+
+        A new order maps to the slot of the order created 'capacity' ids
+        before it. If that order is still live:
+
+            Reject       - the slot is skipped: nextInsertableId() hands
+                           OrderManager the next id whose slot is free, so a
+                           long-resting order never blocks new orders. Orders
+                           are rejected only when every slot holds a live
+                           order;
+            RetireOldest - the old order moves to the history as it is and is
+                           no longer live (counted by evictions()).
+
+        An evicted order is only forgotten locally: it still rests on the
+        exchange. OrderManager releases its risk reservation, it is no longer
+        visited by forEachLive() (so cancelAll() misses it) and it stays
+        findable only as long as it is in the history. Execution reports for
+        it are still applied while it is there. evictions() is the counter to
+        monitor; a non-zero value means the capacity is too small for the
+        number of resting orders.
+
+    History:
+
+        Retired orders stay findable until a newer retired order takes their
+        history slot. The history never grows: memory is fixed for the whole
+        trading day.
+
+    Open-order lists:
+
+        Every live order is linked into the list of its (instrument, side),
+        oldest first. The links are kept next to the live slots and the list
+        heads in a table indexed directly by InstrumentId, so linking and
+        unlinking an order are O(1) and forEachLive() visits only the open
+        orders of one instrument side. The table is sized once in the
+        constructor by instrumentTableSize(OrderStoreConfig::instruments).
+        Orders of instruments outside the table are not stored.
+
+    Capacities are rounded up to a power of two.
+
+    OrderStore does not:
+
+        - assign order ids;
+        - decide when an order is terminal (OrderManager does);
+        - keep pointers valid after the slot is reused.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_ORDER_STORE_HPP
+#define FINANCETECHNOLOGYPROJECTS_ORDER_STORE_HPP
+
+#include "instrument.hpp"
+#include "instrument_slots.hpp"
+#include "order.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace trading::execution
+{
+    enum class OrderStoreOverflow : uint8_t
+    {
+        Reject,
+        RetireOldest
+    };
+
+    struct OrderStoreConfig
+    {
+        std::size_t capacity { 4096 };
+        std::size_t historyCapacity { 4096 };
+        OrderStoreOverflow overflow { OrderStoreOverflow::Reject };
+        // Traded instruments; read only by the constructor.
+        std::span<const Instrument> instruments {};
+    };
+
+    [[nodiscard]]
+    constexpr bool isTerminal(const OrderStatus status) noexcept
+    {
+        return status == OrderStatus::Filled ||
+               status == OrderStatus::Cancelled ||
+               status == OrderStatus::Rejected;
+    }
+
+    class OrderStore
+    {
+    public:
+        explicit OrderStore(const OrderStoreConfig& config = {});
+
+        /*
+            Stores a new live order. Returns nullptr if the order id is 0,
+            already known, its instrument is outside the open-order table, or
+            its slot is taken by a live order and the overflow policy is Reject. If 'evicted' is given, it receives the
+            live order retired by RetireOldest (clientOrderId 0 if none).
+        */
+        [[nodiscard]]
+        Order* insert(const Order& order, Order* evicted = nullptr);
+
+        /*
+            The id to assign to the next order, not below 'candidate'. With
+            Reject it is the first id whose slot is free, or OrderId 0 when
+            every slot holds a live order; with RetireOldest it is 'candidate'.
+        */
+        [[nodiscard]]
+        OrderId nextInsertableId(OrderId candidate) const noexcept;
+
+        [[nodiscard]]
+        Order* findLive(OrderId orderId) noexcept;
+
+        // Live or retired order.
+        [[nodiscard]]
+        Order* find(OrderId orderId) noexcept;
+
+        [[nodiscard]]
+        const Order* find(OrderId orderId) const noexcept;
+
+        // Moves a live order to the history. Returns false if it is not live.
+        bool retire(OrderId orderId) noexcept;
+
+        /*
+            Calls visitor(const Order&) for every live order of the instrument
+            side, oldest first. The visitor must not insert or retire orders.
+        */
+        template<typename Visitor>
+        void forEachLive(const InstrumentId instrument, const Side side, Visitor&& visitor) const
+        {
+            if (instrument >= openOrders.size())
+                return;
+
+            for (Slot slot = openOrders[instrument].head[sideIndex(side)]; slot != NoSlot; slot = links[slot].next)
+                visitor(live[slot]);
+        }
+
+        [[nodiscard]]
+        std::size_t liveCount() const noexcept;
+
+        [[nodiscard]]
+        std::size_t liveCount(InstrumentId instrument, Side side) const noexcept;
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept;
+
+        [[nodiscard]]
+        std::size_t historyCapacity() const noexcept;
+
+        [[nodiscard]]
+        uint64_t evictions() const noexcept;
+
+    private:
+        using Slot = uint32_t;
+
+        static constexpr Slot NoSlot { std::numeric_limits<Slot>::max() };
+
+        struct Link
+        {
+            Slot previous { NoSlot };
+            Slot next { NoSlot };
+        };
+
+        // List heads of one instrument, indexed by Side.
+        struct OpenOrders
+        {
+            std::array<Slot, 2> head { NoSlot, NoSlot };
+            std::array<Slot, 2> tail { NoSlot, NoSlot };
+            std::array<uint32_t, 2> count {};
+        };
+
+        [[nodiscard]]
+        static constexpr std::size_t sideIndex(const Side side) noexcept
+        {
+            return side == Side::Buy ? 0 : 1;
+        }
+
+        void link(Slot slot);
+        void unlink(Slot slot) noexcept;
+        void moveToHistory(Order& order) noexcept;
+
+        OrderStoreOverflow overflow;
+        std::size_t liveMask;
+        std::size_t historyMask;
+        std::vector<Order> live;
+        std::vector<Link> links;
+        std::vector<Order> history;
+        std::vector<OpenOrders> openOrders;
+        std::size_t liveOrders { 0 };
+        uint64_t evictedOrders { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_ORDER_STORE_HPP
@@ -0,0 +1,478 @@
+/**============================================================================
+Name        : simulated_execution_gateway.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Exchange simulator behind IExecutionGateway.
+============================================================================**/
+
+/*
+    Storage:
+
+        instrumentSlots[id]  -> states[slot]   per-instrument levels and market
+        orderSlotById[id]    -> orders[slot]   resting orders, free-listed
+        levelByPrice[price]  -> levels[slot]   one level per side and price,
+                                               free-listed
+
+        A level exists while it holds at least one resting order. Removing
+        the last order of a level removes the level.
+*/
+
+#include "simulated_execution_gateway.hpp"
+
+#include <algorithm>
+
+namespace trading::execution
+{
+    namespace
+    {
+        // True if an order with 'limit' on 'side' trades against 'price' of the opposite side.
+        [[nodiscard]]
+        bool crosses(const Side side, const Price limit, const Price price) noexcept
+        {
+            return side == Side::Buy ? limit >= price : limit <= price;
+        }
+
+        [[nodiscard]]
+        Side opposite(const Side side) noexcept
+        {
+            return side == Side::Buy ? Side::Sell : Side::Buy;
+        }
+    }
+
+    std::optional<Price> SimulatedExecutionGateway::InstrumentState::best(const Side side) const
+    {
+        if (book != nullptr)
+        {
+            const std::optional<market_data::BookLevel> level = side == Side::Buy ? book->bestBid() : book->bestAsk();
+            if (!level || !level->quantity.isPositive())
+                return std::nullopt;
+            return level->price;
+        }
+
+        if (side == Side::Buy)
+            return top.bestBidQuantity.isPositive() ? std::optional<Price> { top.bestBid } : std::nullopt;
+        return top.bestAskQuantity.isPositive() ? std::optional<Price> { top.bestAsk } : std::nullopt;
+    }
+
+    SimulatedExecutionGateway::SimulatedExecutionGateway(const SimulatedExecutionConfig& config) noexcept:
+        config { config }
+    {
+    }
+
+    void SimulatedExecutionGateway::send(const Order& order)
+    {
+        ++counters.orders;
+
+        requests.push_back(Request { .arrival = now() + config.orderEntryLatency, .order = order });
+        processRequests();
+    }
+
+    void SimulatedExecutionGateway::cancel(const OrderId orderId)
+    {
+        requests.push_back(Request {
+            .arrival = now() + config.orderEntryLatency,
+            .order = Order { .clientOrderId = orderId },
+            .cancel = true
+        });
+        processRequests();
+    }
+
+    void SimulatedExecutionGateway::setOrderBook(const InstrumentId instrument, const market_data::OrderBook& book)
+    {
+        InstrumentState* state = stateOf(instrument);
+        if (state == nullptr)
+            state = addState(instrument);
+
+        if (state != nullptr)
+            state->book = &book;
+    }
+
+    void SimulatedExecutionGateway::advanceTo(const Timestamp time)
+    {
+        if (config.clock == SimulatedClock::Virtual && time > virtualTime)
+            virtualTime = time;
+
+        processRequests();
+    }
+
+    Timestamp SimulatedExecutionGateway::now() const noexcept
+    {
+        return config.clock == SimulatedClock::Wall ? Timestamp::now() : virtualTime;
+    }
+
+    void SimulatedExecutionGateway::onMarketEvent(const market_data::MarketEvent& event)
+    {
+        processRequests();
+
+        InstrumentState* state = stateOf(event.instrument);
+        if (state == nullptr)
+            state = addState(event.instrument);
+        if (state == nullptr)
+            return;
+
+        state->top = event;
+        const Timestamp time = now();
+
+        // With a book the levels follow onBookUpdate(); without one only the best levels are known.
+        if (state->book == nullptr)
+        {
+            if (const Slot level = findLevel(*state, Side::Buy, event.bestBid); level != NoSlot)
+                updateLevel(level, event.bestBidQuantity.raw(), time);
+            if (const Slot level = findLevel(*state, Side::Sell, event.bestAsk); level != NoSlot)
+                updateLevel(level, event.bestAskQuantity.raw(), time);
+        }
+
+        if (event.bestAskQuantity.isPositive())
+            fillCrossed(*state, Side::Buy, event.bestAsk, time);
+        if (event.bestBidQuantity.isPositive())
+            fillCrossed(*state, Side::Sell, event.bestBid, time);
+    }
+
+    void SimulatedExecutionGateway::onBookUpdate(const market_data::BookUpdate& update)
+    {
+        processRequests();
+
+        InstrumentState* const state = stateOf(update.instrument);
+        if (state == nullptr)
+            return;
+
+        const Timestamp time = now();
+        if (const Slot level = findLevel(*state, update.side, update.price); level != NoSlot)
+            updateLevel(level, update.quantity.raw(), time);
+
+        if (update.quantity.isPositive())
+            fillCrossed(*state, opposite(update.side), update.price, time);
+    }
+
+    std::size_t SimulatedExecutionGateway::restingOrderCount() const noexcept
+    {
+        return orderSlotById.size();
+    }
+
+    std::size_t SimulatedExecutionGateway::inFlightCount() const noexcept
+    {
+        return requests.size() - nextRequest;
+    }
+
+    const SimulatedExecutionStatistics& SimulatedExecutionGateway::statistics() const noexcept
+    {
+        return counters;
+    }
+
+    SimulatedExecutionGateway::InstrumentState* SimulatedExecutionGateway::stateOf(const InstrumentId instrument) noexcept
+    {
+        const InstrumentSlots::Slot slot = instrumentSlots.slotOf(instrument);
+        return slot != InstrumentSlots::NoSlot ? &states[slot] : nullptr;
+    }
+
+    SimulatedExecutionGateway::InstrumentState* SimulatedExecutionGateway::addState(const InstrumentId instrument)
+    {
+        if (instrumentSlots.add(instrument) == InstrumentSlots::NoSlot)
+            return nullptr;
+
+        InstrumentState& state = states.emplace_back();
+        state.instrument = instrument;
+        return &state;
+    }
+
+    void SimulatedExecutionGateway::processDueRequests(const Timestamp time)
+    {
+        // Constant latency keeps the requests ordered by arrival.
+        while (nextRequest < requests.size() && requests[nextRequest].arrival <= time)
+        {
+            const Request request = requests[nextRequest++];
+
+            if (request.cancel)
+                cancelResting(request.order.clientOrderId, request.arrival);
+            else
+                accept(request.order, request.arrival);
+        }
+        compact(requests, nextRequest);
+    }
+
+    void SimulatedExecutionGateway::accept(Order order, const Timestamp time)
+    {
+        order.exchangeOrderId = nextExchangeOrderId++;
+
+        InstrumentState* state = stateOf(order.instrument);
+        if (state == nullptr)
+            state = addState(order.instrument);
+
+        if (state == nullptr)
+        {
+            order.status = OrderStatus::Rejected;
+            report(order, ExecType::Reject, OrderStatus::Rejected, order.price, order.quantity, time);
+            return;
+        }
+
+        order.status = OrderStatus::New;
+        report(order, ExecType::New, OrderStatus::New, order.price, order.quantity, time);
+
+        const std::optional<Price> touch = state->best(opposite(order.side));
+        if (touch && crosses(order.side, order.price, *touch))
+        {
+            fill(order, order.quantity - order.filledQuantity, *touch, time);
+            return;
+        }
+
+        rest(*state, order);
+    }
+
+    void SimulatedExecutionGateway::cancelResting(const OrderId orderId, const Timestamp time)
+    {
+        const auto it = orderSlotById.find(orderId);
+        if (it == orderSlotById.end())
+            return;
+
+        const Slot orderSlot = it->second;
+        Order& order = orders[orderSlot].order;
+
+        ++counters.cancels;
+        order.status = OrderStatus::Cancelled;
+        report(order, ExecType::Cancel, OrderStatus::Cancelled, order.price, order.quantity - order.filledQuantity, time);
+        removeOrder(orderSlot);
+    }
+
+    void SimulatedExecutionGateway::rest(InstrumentState& state, const Order& order)
+    {
+        Slot levelSlot = findLevel(state, order.side, order.price);
+        if (levelSlot == NoSlot)
+            levelSlot = addLevel(state, order.side, order.price);
+
+        Slot orderSlot;
+        if (freeOrders.empty())
+        {
+            orderSlot = static_cast<Slot>(orders.size());
+            orders.emplace_back();
+        }
+        else
+        {
+            orderSlot = freeOrders.back();
+            freeOrders.pop_back();
+        }
+
+        Level& level = levels[levelSlot];
+        orders[orderSlot] = RestingOrder {
+            .order = order,
+            .queueStart = level.back,
+            .level = levelSlot,
+            .previous = level.last
+        };
+        level.back += (order.quantity - order.filledQuantity).raw();
+
+        if (level.last != NoSlot)
+            orders[level.last].next = orderSlot;
+        else
+            level.first = orderSlot;
+        level.last = orderSlot;
+
+        orderSlotById.emplace(order.clientOrderId, orderSlot);
+    }
+
+    void SimulatedExecutionGateway::updateLevel(const Slot levelSlot, const QueuePosition marketQuantity, const Timestamp time)
+    {
+        Level& level = levels[levelSlot];
+
+        if (marketQuantity < level.marketQuantity)
+            level.front += level.marketQuantity - marketQuantity;
+        else
+            level.back += marketQuantity - level.marketQuantity;
+
+        level.marketQuantity = marketQuantity;
+        level.back = std::max(level.back, level.front);
+
+        fillQueue(levelSlot, time);
+    }
+
+    void SimulatedExecutionGateway::fillQueue(const Slot levelSlot, const Timestamp time)
+    {
+        // Orders are queued in order of queueStart: stop at the first one 'front' has not passed.
+        while (true)
+        {
+            const Level& level = levels[levelSlot];
+            const Slot orderSlot = level.first;
+            RestingOrder& resting = orders[orderSlot];
+
+            const QueuePosition reached = level.front - resting.queueStart;
+            if (reached <= 0)
+                return;
+
+            const QueuePosition quantity = resting.order.quantity.raw();
+            const QueuePosition filled = std::min(reached, quantity);
+            if (filled > resting.order.filledQuantity.raw())
+                fill(resting.order, Quantity { filled - resting.order.filledQuantity.raw() }, level.price, time);
+
+            if (filled < quantity)
+                return;
+
+            const bool last = resting.next == NoSlot;
+            removeOrder(orderSlot);
+            if (last)
+                return;
+        }
+    }
+
+    void SimulatedExecutionGateway::fillCrossed(InstrumentState& state, const Side side, const Price price, const Timestamp time)
+    {
+        if (side == Side::Buy)
+        {
+            while (!state.buyLevels.empty() && state.buyLevels.begin()->first >= price)
+                fillLevel(state.buyLevels.begin()->second, time);
+        }
+        else
+        {
+            while (!state.sellLevels.empty() && state.sellLevels.begin()->first <= price)
+                fillLevel(state.sellLevels.begin()->second, time);
+        }
+    }
+
+    void SimulatedExecutionGateway::fillLevel(const Slot levelSlot, const Timestamp time)
+    {
+        while (true)
+        {
+            const Slot orderSlot = levels[levelSlot].first;
+            RestingOrder& resting = orders[orderSlot];
+
+            fill(resting.order, resting.order.quantity - resting.order.filledQuantity, levels[levelSlot].price, time);
+
+            const bool last = resting.next == NoSlot;
+            removeOrder(orderSlot);
+            if (last)
+                return;
+        }
+    }
+
+    SimulatedExecutionGateway::Slot SimulatedExecutionGateway::findLevel(const InstrumentState& state,
+                                                                         const Side side,
+                                                                         const Price price) const noexcept
+    {
+        const std::unordered_map<Price::Value, Slot>& levelByPrice =
+            side == Side::Buy ? state.buyLevelByPrice : state.sellLevelByPrice;
+
+        // Most book changes hit a side without resting orders: skip the hash.
+        if (levelByPrice.empty())
+            return NoSlot;
+
+        const auto it = levelByPrice.find(price.raw());
+        return it == levelByPrice.end() ? NoSlot : it->second;
+    }
+
+    SimulatedExecutionGateway::Slot SimulatedExecutionGateway::addLevel(InstrumentState& state, const Side side, const Price price)
+    {
+        // The queue ahead of the first order is what the market shows at this price.
+        QueuePosition marketQuantity { 0 };
+        if (state.book != nullptr)
+            marketQuantity = (side == Side::Buy ? state.book->bidVolume(price) : state.book->askVolume(price)).raw();
+        else if (side == Side::Buy && state.top.bestBid == price)
+            marketQuantity = state.top.bestBidQuantity.raw();
+        else if (side == Side::Sell && state.top.bestAsk == price)
+            marketQuantity = state.top.bestAskQuantity.raw();
+
+        Slot levelSlot;
+        if (freeLevels.empty())
+        {
+            levelSlot = static_cast<Slot>(levels.size());
+            levels.emplace_back();
+        }
+        else
+        {
+            levelSlot = freeLevels.back();
+            freeLevels.pop_back();
+        }
+
+        levels[levelSlot] = Level {
+            .instrument = state.instrument,
+            .side = side,
+            .price = price,
+            .marketQuantity = marketQuantity,
+            .front = 0,
+            .back = marketQuantity
+        };
+
+        if (side == Side::Buy)
+        {
+            state.buyLevels.emplace(price, levelSlot);
+            state.buyLevelByPrice.emplace(price.raw(), levelSlot);
+        }
+        else
+        {
+            state.sellLevels.emplace(price, levelSlot);
+            state.sellLevelByPrice.emplace(price.raw(), levelSlot);
+        }
+        return levelSlot;
+    }
+
+    void SimulatedExecutionGateway::removeOrder(const Slot orderSlot)
+    {
+        const RestingOrder& resting = orders[orderSlot];
+        Level& level = levels[resting.level];
+
+        if (resting.previous != NoSlot)
+            orders[resting.previous].next = resting.next;
+        else
+            level.first = resting.next;
+
+        if (resting.next != NoSlot)
+            orders[resting.next].previous = resting.previous;
+        else
+            level.last = resting.previous;
+
+        orderSlotById.erase(resting.order.clientOrderId);
+        freeOrders.push_back(orderSlot);
+
+        if (level.first == NoSlot)
+            removeLevel(resting.level);
+    }
+
+    void SimulatedExecutionGateway::removeLevel(const Slot levelSlot)
+    {
+        const Level& level = levels[levelSlot];
+        InstrumentState& state = *stateOf(level.instrument);
+
+        if (level.side == Side::Buy)
+        {
+            state.buyLevels.erase(level.price);
+            state.buyLevelByPrice.erase(level.price.raw());
+        }
+        else
+        {
+            state.sellLevels.erase(level.price);
+            state.sellLevelByPrice.erase(level.price.raw());
+        }
+        freeLevels.push_back(levelSlot);
+    }
+
+    void SimulatedExecutionGateway::report(const Order& order,
+                                           const ExecType execType,
+                                           const OrderStatus status,
+                                           const Price price,
+                                           const Quantity quantity,
+                                           const Timestamp time)
+    {
+        reports.push_back(PendingReport {
+            .due = time + config.ackLatency,
+            .report = ExecutionReport {
+                .clientOrderId = order.clientOrderId,
+                .exchangeOrderId = order.exchangeOrderId,
+                .instrument = order.instrument,
+                .side = order.side,
+                .execType = execType,
+                .status = status,
+                .price = price,
+                .quantity = quantity,
+                .filledQuantity = order.filledQuantity
+            }
+        });
+    }
+
+    void SimulatedExecutionGateway::fill(Order& order, const Quantity quantity, const Price price, const Timestamp time)
+    {
+        ++counters.fills;
+
+        order.filledQuantity += quantity;
+        order.status = order.filledQuantity < order.quantity ? OrderStatus::PartiallyFilled : OrderStatus::Filled;
+        report(order, ExecType::Trade, order.status, price, quantity, time);
+    }
+}
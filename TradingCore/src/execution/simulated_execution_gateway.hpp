@@ -0,0 +1,343 @@
+/**============================================================================
+Name        : simulated_execution_gateway.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Exchange simulator behind IExecutionGateway.
+============================================================================**/
+
+/*
+    SimulatedExecutionGateway plays the exchange for backtests and soak
+    tests: it accepts orders, matches them against the market it is shown
+    and produces the ExecutionReports an exchange would send back.
+
+    Data Flow:
+
+        OrderManager                          market data
+           |                                        |
+           | send() / cancel()                      | onBookUpdate() (after the OrderBook applied it)
+           v                                        | onMarketEvent()
+        in-flight requests                          |
+           |                                        |
+           | + orderEntryLatency                    |
+           v                                        v
+        SimulatedExecutionGateway  <---- OrderBook / top of book per instrument
+           |
+           | New / Trade / Cancel ExecutionReports
+           | + ackLatency
+           v
+        deliverReports(handler)
+           |
+           v
+        ExecutionReportHandler -> OrderManager / PositionManager
+
+    Fill model:
+
+        - an order that crosses the opposite best price when it reaches the
+          exchange trades in full at that price (taker);
+        - any other order rests at its price level behind the quantity the
+          market shows there on arrival (queue position);
+        - every decrease of the level quantity is taken from the front of
+          the queue: once the quantity ahead is gone, further decreases fill
+          the resting order, partially if they are smaller than it;
+        - increases join the back of the queue;
+        - a resting order trades in full at its own price (maker) once the
+          opposite side reaches its price (trade-through).
+
+        Decreases are counted as trades although some are cancels, so the
+        model fills resting orders rather early.
+
+        The queue quantity comes from the OrderBook given to setOrderBook().
+        Without one, only the top of book of onMarketEvent() is known: the
+        level at the best price follows the best quantity, deeper levels
+        fill by trade-through only.
+
+    Queue:
+
+        Positions are counted on one axis per price level:
+
+            front                 back
+              |                     |
+              v                     v
+              [ market | order A | market | order B ]
+
+        A decrease moves 'front', an increase or a new order moves 'back'.
+        An order owns [queueStart, queueStart + quantity); it is filled up
+        to 'front'. Orders of a level form a FIFO list, so a book change
+        looks up its level in a hash table and touches only the orders it
+        fills: O(1) per book change, whatever the number of resting orders.
+        A trade-through walks the crossed levels from the best price.
+
+    Time:
+
+        Requests reach the exchange orderEntryLatency after send() or
+        cancel(); reports are delivered ackLatency after the exchange event.
+
+        Virtual clock
+            time moves only through advanceTo(), so a replay runs on the
+            recorded timestamps and produces the same reports on every run.
+            Call advanceTo() before showing the market of that time.
+
+        Wall clock
+            time is Timestamp::now(); requests and reports become due as it
+            passes and are processed by the next call into the gateway.
+
+        With zero latencies requests are processed inside send() and
+        cancel(), and their reports are delivered by the next
+        deliverReports().
+
+    Reports:
+
+        Reports are queued and handed over by deliverReports(), never from
+        inside send() or cancel(), so OrderManager is not re-entered while it
+        creates an order. The handler may send new orders; their reports are
+        delivered in the same call if they are already due.
+
+    SimulatedExecutionGateway does not:
+
+        - take liquidity beyond the opposite best price or partially fill a
+          taker order;
+        - match resting orders against each other;
+        - move orders up when an order ahead of them on the same level is
+          cancelled (its range stays on the queue axis);
+        - reject orders or cancels (risk checks belong to OrderManager),
+          except orders of instruments above MaxInstrumentId.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_SIMULATED_EXECUTION_GATEWAY_HPP
+#define FINANCETECHNOLOGYPROJECTS_SIMULATED_EXECUTION_GATEWAY_HPP
+
+#include "book_update.hpp"
+#include "execution_gateway.hpp"
+#include "execution_report.hpp"
+#include "instrument_slots.hpp"
+#include "market_event.hpp"
+#include "order_book.hpp"
+#include "timestamp.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace trading::execution
+{
+    enum class SimulatedClock : uint8_t
+    {
+        Virtual,
+        Wall
+    };
+
+    struct SimulatedExecutionConfig
+    {
+        SimulatedClock clock { SimulatedClock::Virtual };
+
+        // Nanoseconds from send() / cancel() until the exchange processes the request.
+        uint64_t orderEntryLatency { 0 };
+
+        // Nanoseconds from an exchange event until its report is delivered.
+        uint64_t ackLatency { 0 };
+    };
+
+    struct SimulatedExecutionStatistics
+    {
+        uint64_t orders { 0 };
+        uint64_t fills { 0 };
+        uint64_t cancels { 0 };
+    };
+
+    class SimulatedExecutionGateway final : public IExecutionGateway
+    {
+    public:
+        explicit SimulatedExecutionGateway(const SimulatedExecutionConfig& config = {}) noexcept;
+
+        void send(const Order& order) override;
+        void cancel(OrderId orderId) override;
+
+        // Queue positions of the instrument come from 'book', which must outlive the gateway.
+        void setOrderBook(InstrumentId instrument, const market_data::OrderBook& book);
+
+        // Virtual clock only: moves time forward and processes the requests due by then.
+        void advanceTo(Timestamp time);
+
+        [[nodiscard]]
+        Timestamp now() const noexcept;
+
+        // Updates the top of book of the instrument and fills the resting orders it reaches.
+        void onMarketEvent(const market_data::MarketEvent& event);
+
+        // Call after the OrderBook of the instrument applied 'update'.
+        void onBookUpdate(const market_data::BookUpdate& update);
+
+        // Calls handler(const ExecutionReport&) for every due report, oldest first.
+        template<typename Handler>
+        std::size_t deliverReports(Handler&& handler)
+        {
+            processRequests();
+
+            std::size_t delivered { 0 };
+            while (nextReport < reports.size() && reports[nextReport].due <= now())
+            {
+                // A copy: the handler may queue new reports.
+                const ExecutionReport report = reports[nextReport++].report;
+
+                handler(report);
+                ++delivered;
+            }
+            compact(reports, nextReport);
+            return delivered;
+        }
+
+        [[nodiscard]]
+        std::size_t restingOrderCount() const noexcept;
+
+        // Requests sent but not yet processed by the exchange.
+        [[nodiscard]]
+        std::size_t inFlightCount() const noexcept;
+
+        [[nodiscard]]
+        const SimulatedExecutionStatistics& statistics() const noexcept;
+
+    private:
+        using Slot = uint32_t;
+        using QueuePosition = Quantity::Value;
+
+        static constexpr Slot NoSlot { std::numeric_limits<Slot>::max() };
+
+        struct Request
+        {
+            Timestamp arrival {};
+            Order order {};
+            bool cancel { false };
+        };
+
+        struct PendingReport
+        {
+            Timestamp due {};
+            ExecutionReport report {};
+        };
+
+        struct RestingOrder
+        {
+            Order order {};
+            QueuePosition queueStart { 0 };
+            Slot level { NoSlot };
+            Slot previous { NoSlot };
+            Slot next { NoSlot };
+        };
+
+        struct Level
+        {
+            InstrumentId instrument { 0 };
+            Side side { Side::Buy };
+            Price price {};
+
+            // Last quantity the market showed at this price.
+            QueuePosition marketQuantity { 0 };
+            QueuePosition front { 0 };
+            QueuePosition back { 0 };
+
+            Slot first { NoSlot };
+            Slot last { NoSlot };
+        };
+
+        struct InstrumentState
+        {
+            InstrumentId instrument { 0 };
+            const market_data::OrderBook* book { nullptr };
+
+            // Top of book of the last MarketEvent, used without a book.
+            market_data::MarketEvent top {};
+
+            // Best price first.
+            std::map<Price, Slot, std::greater<>> buyLevels;
+            std::map<Price, Slot> sellLevels;
+
+            std::unordered_map<Price::Value, Slot> buyLevelByPrice;
+            std::unordered_map<Price::Value, Slot> sellLevelByPrice;
+
+            // Best price the market shows on 'side'.
+            [[nodiscard]]
+            std::optional<Price> best(Side side) const;
+        };
+
+        [[nodiscard]]
+        InstrumentState* stateOf(InstrumentId instrument) noexcept;
+
+        [[nodiscard]]
+        InstrumentState* addState(InstrumentId instrument);
+
+        // Queues are vectors consumed from 'next'; drops the consumed head.
+        template<typename Entry>
+        static void compact(std::vector<Entry>& queue, std::size_t& next)
+        {
+            if (next == queue.size())
+            {
+                queue.clear();
+                next = 0;
+            }
+            else if (next >= 1024 && 2 * next >= queue.size())
+            {
+                queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(next));
+                next = 0;
+            }
+        }
+
+        // Called on every gateway entry: the common case, nothing in flight, stays inline.
+        void processRequests()
+        {
+            if (nextRequest != requests.size())
+                processDueRequests(now());
+        }
+
+        void processDueRequests(Timestamp time);
+        void accept(Order order, Timestamp time);
+        void cancelResting(OrderId orderId, Timestamp time);
+
+        void rest(InstrumentState& state, const Order& order);
+        void updateLevel(Slot levelSlot, QueuePosition marketQuantity, Timestamp time);
+        void fillQueue(Slot levelSlot, Timestamp time);
+        void fillCrossed(InstrumentState& state, Side side, Price price, Timestamp time);
+        void fillLevel(Slot levelSlot, Timestamp time);
+
+        [[nodiscard]]
+        Slot findLevel(const InstrumentState& state, Side side, Price price) const noexcept;
+
+        [[nodiscard]]
+        Slot addLevel(InstrumentState& state, Side side, Price price);
+
+        void removeOrder(Slot orderSlot);
+        void removeLevel(Slot levelSlot);
+
+        void report(const Order& order, ExecType execType, OrderStatus status, Price price, Quantity quantity, Timestamp time);
+        void fill(Order& order, Quantity quantity, Price price, Timestamp time);
+
+        SimulatedExecutionConfig config;
+        Timestamp virtualTime {};
+
+        InstrumentSlots instrumentSlots;
+        std::vector<InstrumentState> states;
+
+        std::vector<RestingOrder> orders;
+        std::vector<Slot> freeOrders;
+        std::unordered_map<OrderId, Slot> orderSlotById;
+
+        std::vector<Level> levels;
+        std::vector<Slot> freeLevels;
+
+        std::vector<Request> requests;
+        std::vector<PendingReport> reports;
+        std::size_t nextRequest { 0 };
+        std::size_t nextReport { 0 };
+
+        ExchangeOrderId nextExchangeOrderId { 1 };
+        SimulatedExecutionStatistics counters {};
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_SIMULATED_EXECUTION_GATEWAY_HPP
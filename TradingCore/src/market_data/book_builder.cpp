@@ -35,26 +35,33 @@ Description : book_builder.cpp
     An update that belongs to another instrument or cannot be applied because
     the OrderBook is invalid or the sequence is incorrect is ignored and does
     not produce a MarketEvent.
-*/
-#include "book_builder.hpp"
 
+    A batch passed to onBookUpdates() holds every level change of a single
+    exchange message. The whole batch is applied first and one MarketEvent is
+    published afterwards, carrying the sequence and exchange timestamp of the
+    last applied update. If any update of the batch cannot be applied, the
+    book is left in an intermediate state the exchange never showed, so no
+    MarketEvent is published.
+*/
 #include "book_builder.hpp"
 
 namespace trading::market_data
 {
-    BookBuilder::BookBuilder(const InstrumentId instrument,
-                             OrderBook& orderBook,
-                             IMarketEventHandler& eventHandler) noexcept :
+    template<BookStorage Book>
+    BasicBookBuilder<Book>::BasicBookBuilder(const InstrumentId instrument,
+                                             Book& orderBook,
+                                             IMarketEventHandler& eventHandler) noexcept :
         instrument { instrument },
         orderBook { orderBook },
         eventHandler { eventHandler }
     {
     }
 
-    bool BookBuilder::applySnapshot(const SequenceNumber sequence,
-                                    const OrderBook::Levels& bids,
-                                    const OrderBook::Levels& asks,
-                                    const Timestamp exchangeTimestamp) const
+    template<BookStorage Book>
+    bool BasicBookBuilder<Book>::applySnapshot(const SequenceNumber sequence,
+                                               const Levels& bids,
+                                               const Levels& asks,
+                                               const Timestamp exchangeTimestamp) const
     {
         orderBook.replace(sequence, bids, asks);
 
@@ -63,7 +70,8 @@ namespace trading::market_data
         return true;
     }
 
-    void BookBuilder::onBookUpdate(const BookUpdate& update)
+    template<BookStorage Book>
+    void BasicBookBuilder<Book>::onBookUpdate(const BookUpdate& update)
     {
         if (update.instrument != instrument)
             return;
@@ -71,24 +79,27 @@ namespace trading::market_data
         if (!orderBook.applyUpdate(update))
             return;
 
-        publishMarketEvent(update.sequence, update.exchangeTimestamp);
+        publishMarketEvent(update.sequence, update.exchangeTimestamp, update.trace);
     }
 
-    void BookBuilder::publishMarketEvent(const SequenceNumber sequence,
-                                         const Timestamp exchangeTimestamp) const
+    template<BookStorage Book>
+    void BasicBookBuilder<Book>::onBookUpdates(const std::span<const BookUpdate> updates)
     {
-        const auto bestBid = orderBook.bestBid();
-        const auto bestAsk = orderBook.bestAsk();
-
-        eventHandler.onMarketEvent(MarketEvent {
-            .instrument = instrument,
-            .sequence = sequence,
-            .exchangeTimestamp = exchangeTimestamp,
-            .receiveTimestamp = Timestamp::now(),
-            .bestBid = bestBid ? bestBid->price : Price {},
-            .bestBidQuantity = bestBid ? bestBid->quantity : Quantity {},
-            .bestAsk = bestAsk ? bestAsk->price : Price {},
-            .bestAskQuantity = bestAsk ? bestAsk->quantity : Quantity {}
-        });
+        const BookUpdate* lastApplied = applyUpdates(orderBook, instrument, updates);
+        if (!lastApplied)
+            return;
+
+        publishMarketEvent(lastApplied->sequence, lastApplied->exchangeTimestamp, lastApplied->trace);
     }
-}
\ No newline at end of file
+
+    template<BookStorage Book>
+    void BasicBookBuilder<Book>::publishMarketEvent(const SequenceNumber sequence,
+                                                    const Timestamp exchangeTimestamp,
+                                                    const trace::TraceContext& trace) const
+    {
+        eventHandler.onMarketEvent(makeMarketEvent(orderBook, instrument, sequence, exchangeTimestamp, trace));
+    }
+
+    template class BasicBookBuilder<OrderBook>;
+    template class BasicBookBuilder<TickOrderBook>;
+}
@@ -10,7 +10,7 @@ Description : book_builder.hpp
 /*
     BookBuilder is responsible for applying normalized BookUpdate events to
     an OrderBook and publishing a MarketEvent after each successfully applied
-    update.
+    update or batch of updates.
 
     BookBuilder sits between the normalized market data stream and consumers
     interested in the resulting order book state.
@@ -48,7 +48,14 @@ Description : book_builder.hpp
         - apply updates to OrderBook;
         - detect invalid or out-of-sequence updates through OrderBook;
         - obtain the resulting best bid and best ask;
-        - create and publish MarketEvent.
+        - create and publish MarketEvent;
+        - apply all updates of one exchange message as a single batch and
+          publish one MarketEvent for the whole batch.
+
+    BookBuilder is a class template over the order book storage. BookBuilder
+    is the std::map based OrderBook instantiation and TickBookBuilder is the
+    tick-indexed TickOrderBook instantiation. Both are explicitly instantiated
+    in book_builder.cpp.
 
     BookBuilder does not know the exchange-specific market data format and
     does not perform protocol parsing. Those responsibilities belong to the
@@ -61,34 +68,128 @@ Description : book_builder.hpp
 #include "interfaces/book_update_handler.hpp"
 #include "interfaces/market_event_handler.hpp"
 #include "order_book.hpp"
+#include "tick_order_book.hpp"
 #include "timestamp.hpp"
 #include "types.hpp"
 
+#include <concepts>
+#include <optional>
+#include <span>
+
 namespace trading::market_data
 {
-    class BookBuilder final : public IBookUpdateHandler
+    /*
+        BookStorage describes the order book interface required by BookBuilder.
+
+        Both OrderBook (std::map based) and TickOrderBook (tick-indexed arrays)
+        satisfy it.
+    */
+    template<typename Book>
+    concept BookStorage = requires(Book& book,
+                                   const Book& constBook,
+                                   const BookUpdate& update,
+                                   const typename Book::Levels& levels,
+                                   SequenceNumber sequence)
+    {
+        { book.replace(sequence, levels, levels) };
+        { book.applyUpdate(update) } -> std::same_as<bool>;
+        { constBook.isValid() } -> std::same_as<bool>;
+        { constBook.bestBid() } -> std::same_as<std::optional<BookLevel>>;
+        { constBook.bestAsk() } -> std::same_as<std::optional<BookLevel>>;
+    };
+
+    /*
+        Applies the updates of 'instrument' in order and returns the last
+        applied one. Returns nullptr if no update was applied or the book
+        rejected one, in which case no MarketEvent must be published.
+        Shared by BasicBookBuilder and the statically wired trading path.
+    */
+    template<BookStorage Book>
+    [[nodiscard]]
+    const BookUpdate* applyUpdates(Book& book,
+                                   const InstrumentId instrument,
+                                   const std::span<const BookUpdate> updates)
+    {
+        const BookUpdate* lastApplied { nullptr };
+
+        for (const BookUpdate& update : updates)
+        {
+            if (update.instrument != instrument)
+                continue;
+
+            if (!book.applyUpdate(update))
+                return nullptr;
+
+            lastApplied = &update;
+        }
+
+        return lastApplied;
+    }
+
+    /*
+        Top of book of 'book' as a MarketEvent received now. 'trace' is the
+        context of the applied update, stamped BookApplied.
+    */
+    template<BookStorage Book>
+    [[nodiscard]]
+    MarketEvent makeMarketEvent(const Book& book,
+                                const InstrumentId instrument,
+                                const SequenceNumber sequence,
+                                const Timestamp exchangeTimestamp,
+                                trace::TraceContext trace = {})
+    {
+        const auto bestBid = book.bestBid();
+        const auto bestAsk = book.bestAsk();
+
+        trace.stamp(trace::Stage::BookApplied);
+        return MarketEvent {
+            .instrument = instrument,
+            .sequence = sequence,
+            .exchangeTimestamp = exchangeTimestamp,
+            .receiveTimestamp = Timestamp::nowFast(),
+            .bestBid = bestBid ? bestBid->price : Price {},
+            .bestBidQuantity = bestBid ? bestBid->quantity : Quantity {},
+            .bestAsk = bestAsk ? bestAsk->price : Price {},
+            .bestAskQuantity = bestAsk ? bestAsk->quantity : Quantity {},
+            .trace = trace
+        };
+    }
+
+    template<BookStorage Book>
+    class BasicBookBuilder final : public IBookUpdateHandler
     {
     public:
-        BookBuilder(InstrumentId instrument,
-                    OrderBook& orderBook,
-                    IMarketEventHandler& eventHandler) noexcept;
+        using Levels = typename Book::Levels;
+
+        BasicBookBuilder(InstrumentId instrument,
+                         Book& orderBook,
+                         IMarketEventHandler& eventHandler) noexcept;
 
         [[nodiscard]]
         bool applySnapshot(SequenceNumber sequence,
-                           const OrderBook::Levels& bids,
-                           const OrderBook::Levels& asks,
+                           const Levels& bids,
+                           const Levels& asks,
                            Timestamp exchangeTimestamp) const;
 
         void onBookUpdate(const BookUpdate& update) override;
 
+        void onBookUpdates(std::span<const BookUpdate> updates) override;
+
     private:
         void publishMarketEvent(SequenceNumber sequence,
-                                Timestamp exchangeTimestamp) const;
+                                Timestamp exchangeTimestamp,
+                                const trace::TraceContext& trace = {}) const;
 
         InstrumentId instrument;
-        OrderBook& orderBook;
+        Book& orderBook;
         IMarketEventHandler& eventHandler;
     };
+
+    extern template class BasicBookBuilder<OrderBook>;
+    extern template class BasicBookBuilder<TickOrderBook>;
+
+    using BookBuilder = BasicBookBuilder<OrderBook>;
+    using TickBookBuilder = BasicBookBuilder<TickOrderBook>;
 }
 
-#endif //FINANCETECHNOLOGYPROJECTS_BOOK_BUILDER_HPP
\ No newline at end of file
+#endif //FINANCETECHNOLOGYPROJECTS_BOOK_BUILDER_HPP
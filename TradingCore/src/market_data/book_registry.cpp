@@ -0,0 +1,150 @@
+/**============================================================================
+Name        : book_registry.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Order books of all traded instruments.
+============================================================================**/
+
+#include "book_registry.hpp"
+
+#include <concepts>
+
+namespace trading::market_data
+{
+    template<BookStorage Book>
+    BasicBookRegistry<Book>::BasicBookRegistry(const std::span<const Instrument> instruments,
+                                               IMarketEventHandler& eventHandler) :
+        instrumentSlots { instruments },
+        eventHandler { eventHandler }
+    {
+        // Builders keep references to the books: both vectors are sized once.
+        books.reserve(instruments.size());
+        builders.reserve(instruments.size());
+
+        for (const Instrument& instrument : instruments)
+        {
+            if (instrumentSlots.add(instrument.id()) == NoSlot)
+                continue;
+
+            if constexpr (std::constructible_from<Book, const Instrument&>)
+                books.push_back(BookSlot { Book { instrument } });
+            else
+                books.emplace_back();
+
+            topOfBooks.push_back(TopOfBookSlot { MarketEvent { .instrument = instrument.id() } });
+        }
+
+        for (std::size_t slot { 0 }; slot < books.size(); ++slot)
+            builders.emplace_back(topOfBooks[slot].event.instrument, books[slot].book, *this);
+
+        updateHandlers.reserve(builders.size());
+        for (BasicBookBuilder<Book>& builder : builders)
+            updateHandlers.push_back(&builder);
+    }
+
+    template<BookStorage Book>
+    void BasicBookRegistry<Book>::onBookUpdate(const BookUpdate& update)
+    {
+        route(std::span<const BookUpdate> { &update, 1 });
+    }
+
+    template<BookStorage Book>
+    void BasicBookRegistry<Book>::onBookUpdates(const std::span<const BookUpdate> updates)
+    {
+        /*
+            One exchange message normally carries a single instrument, so the
+            whole batch is usually one run and one call.
+        */
+        std::size_t begin { 0 };
+        while (begin < updates.size())
+        {
+            const InstrumentId instrument = updates[begin].instrument;
+
+            std::size_t end { begin + 1 };
+            while (end < updates.size() && updates[end].instrument == instrument)
+                ++end;
+
+            route(updates.subspan(begin, end - begin));
+            begin = end;
+        }
+    }
+
+    template<BookStorage Book>
+    void BasicBookRegistry<Book>::onMarketEvent(const MarketEvent& event)
+    {
+        const Slot slot = instrumentSlots.slotOf(event.instrument);
+        if (slot != NoSlot)
+            topOfBooks[slot].event = event;
+
+        eventHandler.onMarketEvent(event);
+    }
+
+    template<BookStorage Book>
+    bool BasicBookRegistry<Book>::setUpdateHandler(const InstrumentId instrument,
+                                                   IBookUpdateHandler& handler) noexcept
+    {
+        const Slot slot = instrumentSlots.slotOf(instrument);
+        if (slot == NoSlot)
+            return false;
+
+        updateHandlers[slot] = &handler;
+        return true;
+    }
+
+    template<BookStorage Book>
+    bool BasicBookRegistry<Book>::contains(const InstrumentId instrument) const noexcept
+    {
+        return instrumentSlots.slotOf(instrument) != NoSlot;
+    }
+
+    template<BookStorage Book>
+    std::size_t BasicBookRegistry<Book>::size() const noexcept
+    {
+        return books.size();
+    }
+
+    template<BookStorage Book>
+    Book* BasicBookRegistry<Book>::book(const InstrumentId instrument) noexcept
+    {
+        const Slot slot = instrumentSlots.slotOf(instrument);
+        return slot != NoSlot ? &books[slot].book : nullptr;
+    }
+
+    template<BookStorage Book>
+    BasicBookBuilder<Book>* BasicBookRegistry<Book>::builder(const InstrumentId instrument) noexcept
+    {
+        const Slot slot = instrumentSlots.slotOf(instrument);
+        return slot != NoSlot ? &builders[slot] : nullptr;
+    }
+
+    template<BookStorage Book>
+    const MarketEvent& BasicBookRegistry<Book>::topOfBook(const InstrumentId instrument) const noexcept
+    {
+        const Slot slot = instrumentSlots.slotOf(instrument);
+        return slot != NoSlot ? topOfBooks[slot].event : emptyTopOfBook.event;
+    }
+
+    template<BookStorage Book>
+    uint64_t BasicBookRegistry<Book>::droppedUpdates() const noexcept
+    {
+        return dropped;
+    }
+
+    template<BookStorage Book>
+    void BasicBookRegistry<Book>::route(const std::span<const BookUpdate> updates)
+    {
+        const Slot slot = instrumentSlots.slotOf(updates.front().instrument);
+        if (slot == NoSlot) [[unlikely]]
+        {
+            dropped += updates.size();
+            return;
+        }
+
+        updateHandlers[slot]->onBookUpdates(updates);
+    }
+
+    template class BasicBookRegistry<OrderBook>;
+    template class BasicBookRegistry<TickOrderBook>;
+}
@@ -0,0 +1,181 @@
+/**============================================================================
+Name        : book_registry.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Order books of all traded instruments.
+============================================================================**/
+
+/*
+    BookRegistry owns one order book per configured instrument and routes
+    normalized BookUpdate batches to them.
+
+    Data Flow:
+
+        MarketDataMessageHandler
+               |
+               | onBookUpdates(one message, any instruments)
+               v
+        BookRegistry
+               |
+               | split into runs of the same instrument
+               | slot = instrumentSlots.slotOf(instrument)
+               v
+        per-instrument IBookUpdateHandler
+        (BookBuilder or BookSynchronizer in front of it)
+               |
+               v
+        BookBuilder[slot] ---> Book[slot]
+               |
+               | MarketEvent
+               v
+        BookRegistry ---> topOfBook[slot]
+               |
+               v
+        IMarketEventHandler
+
+    Instrument indexing:
+
+        Instrument ids are small integers assigned by the instrument
+        configuration. BookRegistry finds the dense slot of an instrument
+        through an InstrumentSlots table, so routing an update or reading the
+        top of book of an instrument is one array load and no hashing. Slots
+        follow the order of the configured instrument list.
+
+        Instruments with an id above MaxInstrumentId, or with an id that is
+        already registered, are not registered; contains() reports whether an
+        instrument has a book. Updates for instruments without a book are
+        counted and dropped.
+
+    Memory layout:
+
+        Books are stored contiguously, one slot per instrument, each slot
+        aligned to a cache line so that two instruments never share one.
+        The last published top of book of every instrument is kept in a
+        separate contiguous array of cache-line sized entries that strategies
+        can read for any instrument without touching the book itself.
+
+    Sequencing:
+
+        By default a slot routes updates straight to its BookBuilder.
+        setUpdateHandler() puts another handler, normally a BookSynchronizer
+        that owns the builder of the slot, in front of it.
+
+    BookRegistry does not:
+
+        - parse exchange messages;
+        - resolve exchange symbols (the parser does);
+        - fetch snapshots.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BOOK_REGISTRY_HPP
+#define FINANCETECHNOLOGYPROJECTS_BOOK_REGISTRY_HPP
+
+#include "book_builder.hpp"
+#include "instrument.hpp"
+#include "instrument_slots.hpp"
+#include "interfaces/book_update_handler.hpp"
+#include "interfaces/market_event_handler.hpp"
+#include "model/market_event.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace trading::market_data
+{
+    inline constexpr std::size_t CacheLineSize { 64 };
+
+    template<BookStorage Book>
+    class BasicBookRegistry final : public IBookUpdateHandler,
+                                    public IMarketEventHandler
+    {
+    public:
+        BasicBookRegistry(std::span<const Instrument> instruments,
+                          IMarketEventHandler& eventHandler);
+
+        BasicBookRegistry(const BasicBookRegistry&) = delete;
+        BasicBookRegistry& operator=(const BasicBookRegistry&) = delete;
+
+        BasicBookRegistry(BasicBookRegistry&&) = delete;
+        BasicBookRegistry& operator=(BasicBookRegistry&&) = delete;
+
+        void onBookUpdate(const BookUpdate& update) override;
+
+        void onBookUpdates(std::span<const BookUpdate> updates) override;
+
+        void onMarketEvent(const MarketEvent& event) override;
+
+        /*
+            Routes the updates of 'instrument' to 'handler' instead of the
+            builder of the slot. Returns false if the instrument has no book.
+        */
+        [[nodiscard]]
+        bool setUpdateHandler(InstrumentId instrument,
+                              IBookUpdateHandler& handler) noexcept;
+
+        [[nodiscard]]
+        bool contains(InstrumentId instrument) const noexcept;
+
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+
+        /*
+            Book and builder of an instrument, or nullptr if the instrument
+            has no book.
+        */
+        [[nodiscard]]
+        Book* book(InstrumentId instrument) noexcept;
+
+        [[nodiscard]]
+        BasicBookBuilder<Book>* builder(InstrumentId instrument) noexcept;
+
+        /*
+            Last MarketEvent published for the instrument. An instrument
+            without a book, or without a published event yet, has an empty
+            top of book.
+        */
+        [[nodiscard]]
+        const MarketEvent& topOfBook(InstrumentId instrument) const noexcept;
+
+        [[nodiscard]]
+        uint64_t droppedUpdates() const noexcept;
+
+    private:
+        using Slot = InstrumentSlots::Slot;
+
+        static constexpr Slot NoSlot { InstrumentSlots::NoSlot };
+
+        struct alignas(CacheLineSize) BookSlot
+        {
+            Book book;
+        };
+
+        struct alignas(CacheLineSize) TopOfBookSlot
+        {
+            MarketEvent event;
+        };
+
+        void route(std::span<const BookUpdate> updates);
+
+        InstrumentSlots instrumentSlots;
+        std::vector<BookSlot> books;
+        std::vector<BasicBookBuilder<Book>> builders;
+        std::vector<IBookUpdateHandler*> updateHandlers;
+        std::vector<TopOfBookSlot> topOfBooks;
+        TopOfBookSlot emptyTopOfBook {};
+
+        IMarketEventHandler& eventHandler;
+        uint64_t dropped { 0 };
+    };
+
+    extern template class BasicBookRegistry<OrderBook>;
+    extern template class BasicBookRegistry<TickOrderBook>;
+
+    using BookRegistry = BasicBookRegistry<OrderBook>;
+    using TickBookRegistry = BasicBookRegistry<TickOrderBook>;
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BOOK_REGISTRY_HPP
@@ -0,0 +1,232 @@
+/**============================================================================
+Name        : book_synchronizer.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Depth stream sequencing and gap recovery.
+============================================================================**/
+
+#include "book_synchronizer.hpp"
+
+#include <utility>
+
+namespace trading::market_data
+{
+    namespace
+    {
+        [[nodiscard]]
+        constexpr SequenceNumber firstSequenceOf(const BookUpdate& update) noexcept
+        {
+            return update.firstSequence == 0 ? update.sequence : update.firstSequence;
+        }
+
+        [[nodiscard]]
+        constexpr bool sameMessage(const BookUpdate& first, const BookUpdate& second) noexcept
+        {
+            return first.firstSequence == second.firstSequence && first.sequence == second.sequence;
+        }
+    }
+
+    template<BookStorage Book>
+    BasicBookSynchronizer<Book>::BasicBookSynchronizer(BasicBookBuilder<Book>& bookBuilder,
+                                                       const Book& orderBook,
+                                                       SnapshotRequestHandler requestSnapshot,
+                                                       const std::size_t bufferCapacity) :
+        bookBuilder { bookBuilder },
+        orderBook { orderBook },
+        requestSnapshot { std::move(requestSnapshot) },
+        capacity { bufferCapacity }
+    {
+        buffered.reserve(capacity);
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::onBookUpdate(const BookUpdate& update)
+    {
+        onBookUpdates(std::span<const BookUpdate> { &update, 1 });
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::onBookUpdates(const std::span<const BookUpdate> updates)
+    {
+        applyOfferedSnapshot();
+
+        if (updates.empty())
+            return;
+
+        if (syncState == BookSyncState::AwaitingSnapshot)
+        {
+            buffer(updates);
+            startRecovery();
+            return;
+        }
+
+        switch (forward(updates))
+        {
+            case Outcome::Applied:
+            case Outcome::Stale:
+                return;
+
+            case Outcome::Gap:
+                ++stats.gaps;
+                syncState = BookSyncState::AwaitingSnapshot;
+                buffered.clear();
+                bufferedMessageCount = 0;
+                buffer(updates);
+                startRecovery();
+                return;
+        }
+    }
+
+    template<BookStorage Book>
+    bool BasicBookSynchronizer<Book>::offerSnapshot(BookSnapshot&& offered)
+    {
+        if (snapshotOffered.load(std::memory_order_acquire))
+            return false;
+
+        snapshot = std::move(offered);
+        snapshotOffered.store(true, std::memory_order_release);
+        return true;
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::poll()
+    {
+        applyOfferedSnapshot();
+    }
+
+    template<BookStorage Book>
+    BookSyncState BasicBookSynchronizer<Book>::state() const noexcept
+    {
+        return syncState;
+    }
+
+    template<BookStorage Book>
+    const BookSyncStatistics& BasicBookSynchronizer<Book>::statistics() const noexcept
+    {
+        return stats;
+    }
+
+    template<BookStorage Book>
+    typename BasicBookSynchronizer<Book>::Outcome
+    BasicBookSynchronizer<Book>::forward(const std::span<const BookUpdate> message)
+    {
+        const BookUpdate& head = message.front();
+
+        if (head.sequence <= lastSequence)
+        {
+            ++stats.staleMessages;
+            return Outcome::Stale;
+        }
+
+        const SequenceNumber first = firstSequenceOf(head);
+        const bool continues = bridging
+            ? first <= lastSequence + 1 && lastSequence + 1 <= head.sequence
+            : first == lastSequence + 1;
+
+        if (!continues)
+            return Outcome::Gap;
+
+        bookBuilder.onBookUpdates(message);
+
+        // The book rejects updates it cannot represent (sequence or price window).
+        if (!orderBook.isValid())
+            return Outcome::Gap;
+
+        lastSequence = head.sequence;
+        bridging = false;
+        return Outcome::Applied;
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::applyOfferedSnapshot()
+    {
+        if (!snapshotOffered.load(std::memory_order_acquire))
+            return;
+
+        const bool _ = bookBuilder.applySnapshot(snapshot.sequence,
+                                                 snapshot.bids,
+                                                 snapshot.asks,
+                                                 snapshot.exchangeTimestamp);
+        lastSequence = snapshot.sequence;
+        snapshotOffered.store(false, std::memory_order_release);
+
+        ++stats.snapshotsApplied;
+        snapshotRequested = false;
+        bridging = true;
+        syncState = BookSyncState::Live;
+
+        replayBuffered();
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::replayBuffered()
+    {
+        std::size_t begin { 0 };
+        std::size_t replayed { 0 };
+
+        while (begin < buffered.size())
+        {
+            std::size_t end { begin + 1 };
+            while (end < buffered.size() && sameMessage(buffered[begin], buffered[end]))
+                ++end;
+
+            const std::span<const BookUpdate> message { buffered.data() + begin, end - begin };
+
+            if (forward(message) == Outcome::Gap)
+            {
+                // Keep the messages that are still newer than the book.
+                ++stats.gaps;
+                buffered.erase(buffered.begin(), buffered.begin() + static_cast<std::ptrdiff_t>(begin));
+                bufferedMessageCount -= replayed;
+                syncState = BookSyncState::AwaitingSnapshot;
+                startRecovery();
+                return;
+            }
+
+            begin = end;
+            ++replayed;
+        }
+
+        buffered.clear();
+        bufferedMessageCount = 0;
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::startRecovery()
+    {
+        if (snapshotRequested)
+            return;
+
+        snapshotRequested = true;
+        ++stats.snapshotRequests;
+
+        if (requestSnapshot)
+            requestSnapshot();
+    }
+
+    template<BookStorage Book>
+    void BasicBookSynchronizer<Book>::buffer(const std::span<const BookUpdate> updates)
+    {
+        if (updates.size() > capacity - buffered.size())
+        {
+            stats.discardedMessages += bufferedMessageCount;
+            buffered.clear();
+            bufferedMessageCount = 0;
+        }
+
+        if (updates.size() > capacity)
+        {
+            ++stats.discardedMessages;
+            return;
+        }
+
+        buffered.insert(buffered.end(), updates.begin(), updates.end());
+        ++bufferedMessageCount;
+        ++stats.bufferedMessages;
+    }
+
+    template class BasicBookSynchronizer<OrderBook>;
+    template class BasicBookSynchronizer<TickOrderBook>;
+}
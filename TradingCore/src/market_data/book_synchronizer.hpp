@@ -0,0 +1,194 @@
+/**============================================================================
+Name        : book_synchronizer.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Depth stream sequencing and gap recovery.
+============================================================================**/
+
+/*
+    BookSynchronizer keeps a local OrderBook consistent with an exchange depth
+    stream that is identified by sequence ranges and bootstrapped from a REST
+    snapshot (the Binance "How to manage a local order book" procedure).
+
+    Data Flow:
+
+        MarketDataMessageHandler
+               |
+               | onBookUpdates(one message)
+               v
+        BookSynchronizer ---------------------+
+               |                              |
+               | Live                         | AwaitingSnapshot
+               v                              v
+          BookBuilder                  preallocated buffer
+               |                              |
+               v                              | snapshot arrived
+           OrderBook  <--- applySnapshot -----+
+                                              |
+                            replay buffered messages newer than the snapshot
+
+    States:
+
+        AwaitingSnapshot
+            Incoming messages are copied into a buffer allocated in the
+            constructor. A snapshot has been requested through the injected
+            SnapshotRequestHandler.
+
+        Live
+            Messages are forwarded to BookBuilder directly.
+
+    Sequencing rules for a message [U, u] (firstSequence, sequence):
+
+        - u <= last applied sequence            -> stale, discarded;
+        - first message after a snapshot S      -> U <= S + 1 <= u;
+        - every following message               -> U == previous u + 1.
+
+    Any other message is a gap. The synchronizer then buffers the message,
+    requests a new snapshot and switches to AwaitingSnapshot. Trading on the
+    instrument continues as soon as the new snapshot and the buffered messages
+    have been applied.
+
+    Threading:
+
+        onBookUpdates() and poll() are called on the parser thread.
+
+        offerSnapshot() is called on the thread that fetched the snapshot. It
+        moves the snapshot into a single slot and publishes it with one atomic
+        store. The parser thread picks the snapshot up on its next call without
+        waiting on any lock. The parser thread therefore never blocks on the
+        REST request.
+
+        The SnapshotRequestHandler is called on the parser thread and must only
+        schedule the request, not perform it.
+
+    Buffer overflow:
+
+        Messages are stored contiguously so that each one can be forwarded to
+        BookBuilder as a span. If a message does not fit into the remaining
+        buffer space, the buffered messages are discarded and buffering starts
+        again with the new message. The discarded messages are older than the
+        retained ones; if the snapshot turns out to be older than the retained
+        messages, the replay detects a gap and requests a newer snapshot.
+
+    BookSynchronizer does not:
+
+        - fetch snapshots;
+        - parse exchange messages;
+        - publish MarketEvent itself.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BOOK_SYNCHRONIZER_HPP
+#define FINANCETECHNOLOGYPROJECTS_BOOK_SYNCHRONIZER_HPP
+
+#include "book_builder.hpp"
+#include "interfaces/book_update_handler.hpp"
+#include "model/book_snapshot.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace trading::market_data
+{
+    enum class BookSyncState : uint8_t
+    {
+        AwaitingSnapshot,
+        Live
+    };
+
+    struct BookSyncStatistics
+    {
+        uint64_t snapshotRequests { 0 };
+        uint64_t snapshotsApplied { 0 };
+        uint64_t gaps { 0 };
+        uint64_t staleMessages { 0 };
+        uint64_t bufferedMessages { 0 };
+        uint64_t discardedMessages { 0 };
+    };
+
+    template<BookStorage Book>
+    class BasicBookSynchronizer final : public IBookUpdateHandler
+    {
+    public:
+        using SnapshotRequestHandler = std::function<void()>;
+
+        static constexpr std::size_t DefaultBufferCapacity { 64 * 1024 };
+
+        BasicBookSynchronizer(BasicBookBuilder<Book>& bookBuilder,
+                              const Book& orderBook,
+                              SnapshotRequestHandler requestSnapshot,
+                              std::size_t bufferCapacity = DefaultBufferCapacity);
+
+        void onBookUpdate(const BookUpdate& update) override;
+
+        void onBookUpdates(std::span<const BookUpdate> updates) override;
+
+        /*
+            Hands a snapshot over to the parser thread.
+            Returns false if the previous snapshot has not been consumed yet.
+        */
+        [[nodiscard]]
+        bool offerSnapshot(BookSnapshot&& snapshot);
+
+        /*
+            Applies an offered snapshot, if any. Called on the parser thread
+            when no market-data messages arrive.
+        */
+        void poll();
+
+        [[nodiscard]]
+        BookSyncState state() const noexcept;
+
+        [[nodiscard]]
+        const BookSyncStatistics& statistics() const noexcept;
+
+    private:
+        enum class Outcome : uint8_t
+        {
+            Applied,
+            Stale,
+            Gap
+        };
+
+        [[nodiscard]]
+        Outcome forward(std::span<const BookUpdate> message);
+
+        void applyOfferedSnapshot();
+
+        void replayBuffered();
+
+        void startRecovery();
+
+        void buffer(std::span<const BookUpdate> updates);
+
+        BasicBookBuilder<Book>& bookBuilder;
+        const Book& orderBook;
+        SnapshotRequestHandler requestSnapshot;
+
+        std::vector<BookUpdate> buffered;
+        std::size_t capacity;
+        std::size_t bufferedMessageCount { 0 };
+
+        BookSnapshot snapshot;
+        std::atomic<bool> snapshotOffered { false };
+
+        BookSyncState syncState { BookSyncState::AwaitingSnapshot };
+        bool snapshotRequested { false };
+        bool bridging { false };
+        SequenceNumber lastSequence { 0 };
+        BookSyncStatistics stats {};
+    };
+
+    extern template class BasicBookSynchronizer<OrderBook>;
+    extern template class BasicBookSynchronizer<TickOrderBook>;
+
+    using BookSynchronizer = BasicBookSynchronizer<OrderBook>;
+    using TickBookSynchronizer = BasicBookSynchronizer<TickOrderBook>;
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BOOK_SYNCHRONIZER_HPP
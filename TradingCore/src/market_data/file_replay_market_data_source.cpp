@@ -0,0 +1,215 @@
+/**============================================================================
+Name        : file_replay_market_data_source.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Replay of recorded market data from a file.
+============================================================================**/
+
+#include "file_replay_market_data_source.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    using trading::Timestamp;
+
+    // Waits longer than this are slept, the rest is spun for precision.
+    constexpr uint64_t SpinThresholdNanoseconds { 100'000 };
+
+    // Longest single sleep, so that stop() is noticed during long gaps.
+    constexpr uint64_t MaxSleepNanoseconds { 1'000'000 };
+
+    [[nodiscard]]
+    std::string_view trimFrame(const char* begin, const char* end) noexcept
+    {
+        if (end != begin && *(end - 1) == '\r')
+            --end;
+        return std::string_view { begin, static_cast<std::size_t>(end - begin) };
+    }
+}
+
+namespace trading::market_data
+{
+    double ReplayStatistics::messagesPerSecond() const noexcept
+    {
+        if (elapsedNanoseconds == 0)
+            return 0.0;
+        return static_cast<double>(messages) * 1e9 / static_cast<double>(elapsedNanoseconds);
+    }
+
+    double ReplayStatistics::nanosecondsPerMessage() const noexcept
+    {
+        if (messages == 0)
+            return 0.0;
+        return static_cast<double>(elapsedNanoseconds) / static_cast<double>(messages);
+    }
+
+    FileReplayMarketDataSource::FileReplayMarketDataSource(const std::string& path,
+                                                           const ReplayOptions options):
+        options { options }
+    {
+        const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0)
+            return;
+
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0)
+        {
+            ::close(descriptor);
+            return;
+        }
+
+        size = static_cast<std::size_t>(status.st_size);
+        if (size > 0)
+        {
+            // MAP_POPULATE prefaults the whole file: the replay loop must not take page faults.
+            void* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, descriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ::close(descriptor);
+                size = 0;
+                return;
+            }
+
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(mapping);
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        ::close(descriptor);
+        open = true;
+    }
+
+    FileReplayMarketDataSource::~FileReplayMarketDataSource()
+    {
+        if (data != nullptr)
+            ::munmap(const_cast<char*>(data), size);
+    }
+
+    void FileReplayMarketDataSource::start()
+    {
+        replayStatistics = ReplayStatistics {};
+
+        if (!open || messageHandler == nullptr)
+            return;
+
+        running.store(true, std::memory_order_relaxed);
+
+        const Timestamp started = Timestamp::now();
+        for (uint32_t pass { 0 }; pass < options.passes; ++pass)
+        {
+            if (!replayPass())
+                break;
+        }
+        replayStatistics.elapsedNanoseconds = Timestamp::now() - started;
+
+        running.store(false, std::memory_order_relaxed);
+    }
+
+    void FileReplayMarketDataSource::stop()
+    {
+        running.store(false, std::memory_order_relaxed);
+    }
+
+    void FileReplayMarketDataSource::setMessageHandler(IMarketDataMessageHandler& handler)
+    {
+        messageHandler = &handler;
+    }
+
+    bool FileReplayMarketDataSource::isOpen() const noexcept
+    {
+        return open;
+    }
+
+    std::size_t FileReplayMarketDataSource::fileSize() const noexcept
+    {
+        return size;
+    }
+
+    const ReplayStatistics& FileReplayMarketDataSource::statistics() const noexcept
+    {
+        return replayStatistics;
+    }
+
+    bool FileReplayMarketDataSource::replayPass()
+    {
+        const bool paced = options.mode == ReplayMode::ExchangeTimePaced
+                           && options.exchangeTimeReader != nullptr
+                           && options.speed > 0.0;
+
+        const Timestamp passStart = Timestamp::now();
+        std::optional<Timestamp> firstExchangeTime;
+        Timestamp previousExchangeTime {};
+
+        const char* position = data;
+        const char* const end = data + size;
+
+        while (position < end)
+        {
+            if (!running.load(std::memory_order_relaxed)) [[unlikely]]
+                return false;
+
+            const auto* newline = static_cast<const char*>(std::memchr(position, '\n', end - position));
+            const char* const frameEnd = newline != nullptr ? newline : end;
+            const std::string_view frame = trimFrame(position, frameEnd);
+            position = frameEnd + 1;
+
+            if (frame.empty())
+                continue;
+
+            if (paced)
+            {
+                /*
+                    Frames are scheduled relative to the first frame of the
+                    pass, so the replay does not drift when the handler is
+                    slower than the recording for a while.
+                */
+                const std::optional<Timestamp> exchangeTime = options.exchangeTimeReader(frame);
+                if (exchangeTime && *exchangeTime >= previousExchangeTime)
+                {
+                    if (!firstExchangeTime)
+                        firstExchangeTime = exchangeTime;
+
+                    const auto offset = static_cast<uint64_t>(
+                        static_cast<double>(*exchangeTime - *firstExchangeTime) / options.speed);
+                    waitUntil(passStart + offset);
+                    previousExchangeTime = *exchangeTime;
+                }
+            }
+
+            messageHandler->onMessage(frame);
+
+            ++replayStatistics.messages;
+            replayStatistics.bytes += frame.size();
+        }
+
+        return true;
+    }
+
+    void FileReplayMarketDataSource::waitUntil(const Timestamp deadline) const
+    {
+        while (running.load(std::memory_order_relaxed))
+        {
+            const Timestamp now = Timestamp::now();
+            if (now >= deadline)
+                return;
+
+            const uint64_t remaining = deadline - now;
+            if (remaining > SpinThresholdNanoseconds)
+            {
+                const uint64_t sleep = std::min(remaining - SpinThresholdNanoseconds, MaxSleepNanoseconds);
+                std::this_thread::sleep_for(std::chrono::nanoseconds { sleep });
+            }
+        }
+    }
+}
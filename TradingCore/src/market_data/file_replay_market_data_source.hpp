@@ -0,0 +1,172 @@
+/**============================================================================
+Name        : file_replay_market_data_source.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Replay of recorded market data from a file.
+============================================================================**/
+
+/*
+    FileReplayMarketDataSource replays a recording of raw market-data frames
+    into the market-data pipeline. It is the market-data source of offline
+    runs and of the throughput test of the market-data path.
+
+    Data Flow:
+
+        recording (one raw frame per line)
+               |
+               | mmap, read-only
+               v
+        FileReplayMarketDataSource
+               |
+               | std::string_view into the mapping
+               v
+        IMarketDataMessageHandler
+               |
+               v
+        IMarketDataParser ---> BookRegistry ---> ...
+
+    File format:
+
+        Newline-delimited frames exactly as received from the exchange, for
+        example resources/data/binance/depth.json. A trailing '\r' is not part
+        of the frame and empty lines are skipped.
+
+    Zero copy:
+
+        The file is mapped once when the source is constructed and prefaulted,
+        so that the replay loop neither copies frames nor takes page faults.
+        Frames are handed to the message handler as views into the mapping;
+        they stay valid until the source is destroyed. The Binance parser
+        copies each frame into its own padded buffer before parsing it.
+
+    Modes:
+
+        AsFastAsPossible
+            Frames are delivered back to back. ReplayStatistics reports the
+            number of frames, msgs/s and ns/msg of the whole run.
+
+        ExchangeTimePaced
+            Frames are delivered at the exchange time distance of the
+            recording divided by the speed multiplier (2.0 replays twice as
+            fast as recorded). The exchange time of a frame is read by the
+            injected ExchangeTimeReader; frames without one, or with a time
+            older than the previous frame, are delivered immediately.
+
+    Threading:
+
+        start() replays on the calling thread and returns when the recording
+        (all passes) has been replayed or stop() has been called. stop() may
+        be called from the message handler or from any other thread.
+
+    FileReplayMarketDataSource does not:
+
+        - parse frames (beyond reading the exchange time in paced mode);
+        - record market data;
+        - loop forever: the number of passes is configured.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_FILE_REPLAY_MARKET_DATA_SOURCE_HPP
+#define FINANCETECHNOLOGYPROJECTS_FILE_REPLAY_MARKET_DATA_SOURCE_HPP
+
+#include "market_data_message_handler.hpp"
+#include "interfaces/market_data_source.hpp"
+#include "timestamp.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace trading::market_data
+{
+    enum class ReplayMode : uint8_t
+    {
+        AsFastAsPossible,
+        ExchangeTimePaced
+    };
+
+    // Reads the exchange time of a raw frame without parsing the whole frame.
+    using ExchangeTimeReader = std::optional<Timestamp> (*)(std::string_view message) noexcept;
+
+    struct ReplayOptions
+    {
+        ReplayMode mode { ReplayMode::AsFastAsPossible };
+        double speed { 1.0 };
+        uint32_t passes { 1 };
+        ExchangeTimeReader exchangeTimeReader { nullptr };
+    };
+
+    struct ReplayStatistics
+    {
+        uint64_t messages { 0 };
+        uint64_t bytes { 0 };
+        uint64_t elapsedNanoseconds { 0 };
+
+        [[nodiscard]]
+        double messagesPerSecond() const noexcept;
+
+        [[nodiscard]]
+        double nanosecondsPerMessage() const noexcept;
+    };
+
+    class FileReplayMarketDataSource final : public IMarketDataSource
+    {
+    public:
+        explicit FileReplayMarketDataSource(const std::string& path,
+                                            ReplayOptions options = {});
+
+        ~FileReplayMarketDataSource() override;
+
+        FileReplayMarketDataSource(const FileReplayMarketDataSource&) = delete;
+        FileReplayMarketDataSource& operator=(const FileReplayMarketDataSource&) = delete;
+
+        FileReplayMarketDataSource(FileReplayMarketDataSource&&) = delete;
+        FileReplayMarketDataSource& operator=(FileReplayMarketDataSource&&) = delete;
+
+        /*
+            Replays the recording on the calling thread. Does nothing if the
+            file could not be mapped or no message handler is set.
+        */
+        void start() override;
+        void stop() override;
+
+        void setMessageHandler(IMarketDataMessageHandler& handler) override;
+
+        /*
+            False if the file could not be opened or mapped. An empty file is
+            open and replays no frames.
+        */
+        [[nodiscard]]
+        bool isOpen() const noexcept;
+
+        [[nodiscard]]
+        std::size_t fileSize() const noexcept;
+
+        // Statistics of the last start().
+        [[nodiscard]]
+        const ReplayStatistics& statistics() const noexcept;
+
+    private:
+        // Returns false if the replay has been stopped.
+        [[nodiscard]]
+        bool replayPass();
+
+        void waitUntil(Timestamp deadline) const;
+
+        IMarketDataMessageHandler* messageHandler { nullptr };
+        ReplayOptions options;
+        ReplayStatistics replayStatistics {};
+
+        const char* data { nullptr };
+        std::size_t size { 0 };
+        bool open { false };
+
+        std::atomic<bool> running { false };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_FILE_REPLAY_MARKET_DATA_SOURCE_HPP
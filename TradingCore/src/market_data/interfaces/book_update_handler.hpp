@@ -7,11 +7,24 @@ Copyright   : Your copyright notice
 Description : book_update_handler.hpp
 ============================================================================**/
 
+/*
+    IBookUpdateHandler represents a consumer of normalized BookUpdate objects.
+
+    onBookUpdate() applies a single level change.
+
+    onBookUpdates() applies all level changes parsed from one exchange message
+    as a single unit. Consumers must treat the batch atomically: intermediate
+    book states between two updates of the same message were never shown by
+    the exchange and must not be published downstream.
+*/
+
 #ifndef FINANCETECHNOLOGYPROJECTS_BOOK_UPDATE_HANDLER_HPP
 #define FINANCETECHNOLOGYPROJECTS_BOOK_UPDATE_HANDLER_HPP
 
 #include "../model/book_update.hpp"
 
+#include <span>
+
 namespace trading::market_data
 {
     struct IBookUpdateHandler
@@ -19,6 +32,8 @@ namespace trading::market_data
         virtual ~IBookUpdateHandler() = default;
 
         virtual void onBookUpdate(const BookUpdate& update) = 0;
+
+        virtual void onBookUpdates(std::span<const BookUpdate> updates) = 0;
     };
 }
 
@@ -66,6 +66,7 @@ Description : market_data_parser.hpp
 #ifndef FINANCETECHNOLOGYPROJECTS_MARKET_DATA_PARSER_HPP
 #define FINANCETECHNOLOGYPROJECTS_MARKET_DATA_PARSER_HPP
 
+#include <concepts>
 #include <string_view>
 #include <vector>
 
@@ -84,6 +85,15 @@ namespace trading::market_data
         virtual ParseResult parse(std::string_view message,
                                    BookUpdates& bookUpdates) const = 0;
     };
+
+    // Static counterpart of IMarketDataParser for compile-time wiring.
+    template<typename Parser>
+    concept MarketDataParser = requires(const Parser& parser,
+                                        std::string_view message,
+                                        BookUpdates& bookUpdates)
+    {
+        { parser.parse(message, bookUpdates) } -> std::same_as<ParseResult>;
+    };
 }
 
 #endif //FINANCETECHNOLOGYPROJECTS_MARKET_DATA_PARSER_HPP
\ No newline at end of file
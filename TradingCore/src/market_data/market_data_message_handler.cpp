@@ -33,6 +33,15 @@ Description : market_data_message_handler.cpp
 
     The BookUpdates buffer is reused between messages to avoid allocations
     on the market-data hot path.
+
+    All updates parsed from one message are forwarded with a single
+    onBookUpdates() call, so the message is applied to the OrderBook as one
+    unit and produces at most one MarketEvent.
+
+    With TRADING_CORE_TRACING the message is stamped SocketRead on entry
+    (the source calls onMessage() right after the read; behind Pipeline
+    the wait in Q1 is reported by PipelineStatistics instead) and Parsed
+    after parsing. Every BookUpdate of the message carries these stamps.
 */
 
 #include "market_data_message_handler.hpp"
@@ -49,11 +58,23 @@ namespace trading::market_data
 
     void MarketDataMessageHandler::onMessage(std::string_view message)
     {
+        trace::TraceContext context {};
+        context.stamp(trace::Stage::SocketRead);
+
         const ParseResult result = parser.parse(message, bookUpdates);
 
         if (result != ParseResult::Success)
             return;
-        for (const auto& update : bookUpdates)
-            bookUpdateHandler.onBookUpdate(update);
+        if (bookUpdates.empty())
+            return;
+
+        context.stamp(trace::Stage::Parsed);
+        if constexpr (trace::TracingEnabled)
+        {
+            for (BookUpdate& update : bookUpdates)
+                update.trace = context;
+        }
+
+        bookUpdateHandler.onBookUpdates(bookUpdates);
     }
 }
\ No newline at end of file
@@ -30,7 +30,7 @@ Description : market_data_message_handler.hpp
                v
         BookUpdates
                |
-               | onBookUpdate()
+               | onBookUpdates()
                v
         IBookUpdateHandler
                |
@@ -46,7 +46,8 @@ Description : market_data_message_handler.hpp
         - provide a reusable BookUpdates buffer to the parser;
         - invoke IMarketDataParser;
         - handle the ParseResult;
-        - forward parsed BookUpdate instances to IBookUpdateHandler.
+        - forward all BookUpdate instances of a message to IBookUpdateHandler
+          as one batch.
 
     The BookUpdates buffer is owned by MarketDataMessageHandler and reused
     between messages.
@@ -0,0 +1,67 @@
+/**============================================================================
+Name        : book_snapshot.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Full order book snapshot.
+============================================================================**/
+
+/*
+    BookSnapshot represents a full copy of an exchange order book, normally
+    obtained through a REST request such as Binance GET /api/v3/depth
+    (see resources/data/binance/bookDepthSnapshot.json).
+
+    Data Flow:
+
+        Exchange REST API
+               |
+               v
+        BookSnapshot
+               |
+               v
+        BookSynchronizer
+               |
+               v
+        BookBuilder::applySnapshot()
+               |
+               v
+        OrderBook
+
+    Fields:
+        sequence
+            Last sequence number included in the snapshot ("lastUpdateId").
+            Incremental updates with sequence <= this value are already part of
+            the snapshot and must be discarded.
+
+        exchangeTimestamp
+            Exchange time of the snapshot, if known.
+
+        bids / asks
+            Price levels of the snapshot.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_BOOK_SNAPSHOT_HPP
+#define FINANCETECHNOLOGYPROJECTS_BOOK_SNAPSHOT_HPP
+
+#include "price.hpp"
+#include "quantity.hpp"
+#include "timestamp.hpp"
+#include "types.hpp"
+
+#include <map>
+
+namespace trading::market_data
+{
+    struct BookSnapshot
+    {
+        using Levels = std::map<Price, Quantity>;
+
+        SequenceNumber sequence { 0 };
+        Timestamp exchangeTimestamp {};
+        Levels bids;
+        Levels asks;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_BOOK_SNAPSHOT_HPP
@@ -55,9 +55,16 @@ Description : Market data update representing a single order book level change.
         instrument
             Identifier of the financial instrument whose order book is being updated.
 
+        firstSequence
+            First sequence number of the exchange message the update belongs to. Exchanges such as Binance
+            send one message per batch of changes and identify it by the range [firstSequence, sequence]
+            ("U" and "u" fields). All updates parsed from the same message carry the same range.
+            Zero means that the update covers a single sequence number, i.e. firstSequence == sequence.
+
         sequence
             Sequence number assigned to the market data update. It identifies  the position of this  update
             in the ordered market data stream and is used by OrderBook to detect missing or out-of-order updates.
+            For ranged messages it is the last sequence number of the range.
 
         side
             Order book side affected by the update:
@@ -71,6 +78,10 @@ Description : Market data update representing a single order book level change.
             New quantity available at the specified price level.
             A non-zero quantity creates a new price level or replaces the existing quantity at that level.
             A zero quantity removes the price level from the OrderBook.
+
+        trace
+            Tick-to-trade stamps of the message the update was parsed from
+            (SocketRead, Parsed). Empty unless built with TRADING_CORE_TRACING.
 */
 
 #ifndef FINANCETECHNOLOGYPROJECTS_BOOK_UPDATE_HPP
@@ -79,6 +90,7 @@ Description : Market data update representing a single order book level change.
 #include "price.hpp"
 #include "quantity.hpp"
 #include "timestamp.hpp"
+#include "trace_context.hpp"
 #include "types.hpp"
 
 namespace trading::market_data
@@ -86,12 +98,35 @@ namespace trading::market_data
     struct BookUpdate
     {
         InstrumentId instrument { 0 };
+        SequenceNumber firstSequence { 0 };
         SequenceNumber sequence { 0 };
         Timestamp exchangeTimestamp {};
         Side side { Side::Buy };
         Price price {};
         Quantity quantity {};
+        [[no_unique_address]] trace::TraceContext trace {};
     };
+
+    /*
+        Returns true if the update can be applied to a book whose last applied
+        sequence number is 'current':
+
+            - the update range contains current + 1 (next message), or
+            - the update belongs to the ranged message applied last
+              (the remaining levels of the same message).
+    */
+    [[nodiscard]]
+    constexpr bool continuesSequence(const BookUpdate& update,
+                                     const SequenceNumber current) noexcept
+    {
+        if (update.firstSequence == 0)
+            return update.sequence == current + 1;
+
+        if (update.sequence == current)
+            return update.firstSequence <= current;
+
+        return update.firstSequence <= current + 1 && current + 1 <= update.sequence;
+    }
 }
 
 #endif //FINANCETECHNOLOGYPROJECTS_BOOK_UPDATE_HPP
\ No newline at end of file
@@ -77,6 +77,10 @@ Description : Market data event representing the current top-of-book state.
 
         bestAskQuantity
             Available quantity at the best ask price.
+
+        trace
+            Tick-to-trade stamps up to BookApplied. Empty unless built with
+            TRADING_CORE_TRACING; never journaled.
 */
 
 #ifndef FINANCETECHNOLOGYPROJECTS_MARKET_EVENT_HPP
@@ -85,6 +89,7 @@ Description : Market data event representing the current top-of-book state.
 #include "price.hpp"
 #include "quantity.hpp"
 #include "timestamp.hpp"
+#include "trace_context.hpp"
 #include "types.hpp"
 
 namespace trading::market_data
@@ -99,6 +104,7 @@ namespace trading::market_data
         Quantity bestBidQuantity {};
         Price bestAsk {};
         Quantity bestAskQuantity {};
+        [[no_unique_address]] trace::TraceContext trace {};
     };
 }
 
@@ -44,7 +44,7 @@ namespace trading::market_data
         if (!valid)
             return false;
 
-        if (update.sequence != sequenceNumber + 1)
+        if (!continuesSequence(update, sequenceNumber))
         {
             valid = false;
             return false;
@@ -0,0 +1,318 @@
+/**============================================================================
+Name        : tick_order_book.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tick-indexed order book state management.
+============================================================================**/
+
+#include "tick_order_book.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace trading::market_data
+{
+    namespace
+    {
+        constexpr std::size_t BitsPerWord { 64 };
+
+        [[nodiscard]]
+        constexpr std::size_t roundUpToWord(const std::size_t value) noexcept
+        {
+            return std::max<std::size_t>(BitsPerWord, (value + BitsPerWord - 1) / BitsPerWord * BitsPerWord);
+        }
+    }
+
+    TickOrderBook::TickOrderBook(const Instrument& instrument,
+                                 const std::size_t levelCount) :
+        tickSize { instrument.tickSize().isPositive() ? instrument.tickSize() : Price { 1 } },
+        count { roundUpToWord(levelCount) }
+    {
+        for (LevelArray* side : { &bids, &asks })
+        {
+            side->quantities.resize(count);
+            side->occupied.resize(count / BitsPerWord);
+        }
+    }
+
+    bool TickOrderBook::isValid() const noexcept
+    {
+        return valid;
+    }
+
+    SequenceNumber TickOrderBook::sequence() const noexcept
+    {
+        return sequenceNumber;
+    }
+
+    Price TickOrderBook::basePrice() const noexcept
+    {
+        return base;
+    }
+
+    std::size_t TickOrderBook::levelCount() const noexcept
+    {
+        return count;
+    }
+
+    uint64_t TickOrderBook::droppedUpdates() const noexcept
+    {
+        return dropped;
+    }
+
+    void TickOrderBook::clear() noexcept
+    {
+        resetSide(bids);
+        resetSide(asks);
+        sequenceNumber = 0;
+        dropped = 0;
+        valid = false;
+    }
+
+    void TickOrderBook::replace(const SequenceNumber sequence,
+                                const Levels& spanBids,
+                                const Levels& spanAsks)
+    {
+        resetSide(bids);
+        resetSide(asks);
+        recentre(spanBids, spanAsks);
+
+        std::size_t index { 0 };
+        for (const auto& [price, quantity] : spanBids)
+        {
+            if (!quantity.isZero() && locate(price, index) == Position::Inside)
+                setBid(index, quantity);
+        }
+
+        for (const auto& [price, quantity] : spanAsks)
+        {
+            if (!quantity.isZero() && locate(price, index) == Position::Inside)
+                setAsk(index, quantity);
+        }
+
+        sequenceNumber = sequence;
+        valid = true;
+    }
+
+    bool TickOrderBook::applyUpdate(const BookUpdate& update) noexcept
+    {
+        if (!valid)
+            return false;
+
+        if (!continuesSequence(update, sequenceNumber))
+        {
+            valid = false;
+            return false;
+        }
+
+        const bool isBid = update.side == trading::Side::Buy;
+
+        std::size_t index { 0 };
+        switch (locate(update.price, index))
+        {
+            case Position::Inside:
+                if (isBid)
+                    setBid(index, update.quantity);
+                else
+                    setAsk(index, update.quantity);
+                break;
+
+            case Position::Below:
+                if (!isBid)
+                {
+                    valid = false;
+                    return false;
+                }
+                ++dropped;
+                break;
+
+            case Position::Above:
+                if (isBid)
+                {
+                    valid = false;
+                    return false;
+                }
+                ++dropped;
+                break;
+
+            case Position::Misaligned:
+                valid = false;
+                return false;
+        }
+
+        sequenceNumber = update.sequence;
+        return true;
+    }
+
+    std::optional<BookLevel> TickOrderBook::bestBid() const noexcept
+    {
+        if (bids.best == NoLevel)
+            return std::nullopt;
+
+        return BookLevel { .price = priceAt(bids.best), .quantity = bids.quantities[bids.best] };
+    }
+
+    std::optional<BookLevel> TickOrderBook::bestAsk() const noexcept
+    {
+        if (asks.best == NoLevel)
+            return std::nullopt;
+
+        return BookLevel { .price = priceAt(asks.best), .quantity = asks.quantities[asks.best] };
+    }
+
+    Quantity TickOrderBook::bidVolume(const Price price) const noexcept
+    {
+        std::size_t index { 0 };
+        if (locate(price, index) != Position::Inside)
+            return {};
+
+        return bids.quantities[index];
+    }
+
+    Quantity TickOrderBook::askVolume(const Price price) const noexcept
+    {
+        std::size_t index { 0 };
+        if (locate(price, index) != Position::Inside)
+            return {};
+
+        return asks.quantities[index];
+    }
+
+    TickOrderBook::Position TickOrderBook::locate(const Price price,
+                                                  std::size_t& index) const noexcept
+    {
+        const Price::Value offset = price.raw() - base.raw();
+
+        if (offset < 0)
+            return Position::Below;
+
+        if (offset % tickSize.raw() != 0)
+            return Position::Misaligned;
+
+        const auto ticks = static_cast<uint64_t>(offset / tickSize.raw());
+        if (ticks >= count)
+            return Position::Above;
+
+        index = static_cast<std::size_t>(ticks);
+        return Position::Inside;
+    }
+
+    Price TickOrderBook::priceAt(const std::size_t index) const noexcept
+    {
+        return base + tickSize * static_cast<Price::Value>(index);
+    }
+
+    void TickOrderBook::recentre(const Levels& spanBids,
+                                 const Levels& spanAsks) noexcept
+    {
+        /*
+            The window is centred on the middle of the spread so that the top
+            of book can move by count / 2 ticks in either direction before the
+            book has to be rebuilt. The base price is aligned to the tick size
+            and never goes below zero.
+        */
+        Price::Value anchor { 0 };
+
+        if (!spanBids.empty() && !spanAsks.empty())
+            anchor = (spanBids.rbegin()->first.raw() + spanAsks.begin()->first.raw()) / 2;
+        else if (!spanBids.empty())
+            anchor = spanBids.rbegin()->first.raw();
+        else if (!spanAsks.empty())
+            anchor = spanAsks.begin()->first.raw();
+
+        const Price::Value tick = tickSize.raw();
+        const Price::Value halfWindow = static_cast<Price::Value>(count / 2) * tick;
+        const Price::Value aligned = anchor / tick * tick;
+
+        base = Price { std::max<Price::Value>(0, aligned - halfWindow) };
+    }
+
+    void TickOrderBook::setBid(const std::size_t index,
+                               const Quantity quantity) noexcept
+    {
+        const uint64_t bit = uint64_t { 1 } << (index % BitsPerWord);
+        bids.quantities[index] = quantity;
+
+        if (!quantity.isZero())
+        {
+            bids.occupied[index / BitsPerWord] |= bit;
+            if (bids.best == NoLevel || index > bids.best)
+                bids.best = index;
+            return;
+        }
+
+        bids.occupied[index / BitsPerWord] &= ~bit;
+        if (index == bids.best)
+            bids.best = highestOccupied(bids, index);
+    }
+
+    void TickOrderBook::setAsk(const std::size_t index,
+                               const Quantity quantity) noexcept
+    {
+        const uint64_t bit = uint64_t { 1 } << (index % BitsPerWord);
+        asks.quantities[index] = quantity;
+
+        if (!quantity.isZero())
+        {
+            asks.occupied[index / BitsPerWord] |= bit;
+            if (asks.best == NoLevel || index < asks.best)
+                asks.best = index;
+            return;
+        }
+
+        asks.occupied[index / BitsPerWord] &= ~bit;
+        if (index == asks.best)
+            asks.best = lowestOccupied(asks, index);
+    }
+
+    std::size_t TickOrderBook::highestOccupied(const LevelArray& side,
+                                               const std::size_t from) const noexcept
+    {
+        std::size_t word = from / BitsPerWord;
+        const std::size_t shift = BitsPerWord - 1 - from % BitsPerWord;
+
+        // Keep only the bits at or below 'from' in the first word.
+        uint64_t bits = (side.occupied[word] << shift) >> shift;
+
+        while (true)
+        {
+            if (bits != 0)
+                return word * BitsPerWord + (BitsPerWord - 1 - std::countl_zero(bits));
+
+            if (word == 0)
+                return NoLevel;
+
+            bits = side.occupied[--word];
+        }
+    }
+
+    std::size_t TickOrderBook::lowestOccupied(const LevelArray& side,
+                                              const std::size_t from) const noexcept
+    {
+        std::size_t word = from / BitsPerWord;
+        const std::size_t words = side.occupied.size();
+
+        // Keep only the bits at or above 'from' in the first word.
+        uint64_t bits = side.occupied[word] & (~uint64_t { 0 } << (from % BitsPerWord));
+
+        while (true)
+        {
+            if (bits != 0)
+                return word * BitsPerWord + static_cast<std::size_t>(std::countr_zero(bits));
+
+            if (++word == words)
+                return NoLevel;
+
+            bits = side.occupied[word];
+        }
+    }
+
+    void TickOrderBook::resetSide(LevelArray& side) noexcept
+    {
+        std::ranges::fill(side.quantities, Quantity {});
+        std::ranges::fill(side.occupied, uint64_t { 0 });
+        side.best = NoLevel;
+    }
+}
@@ -0,0 +1,181 @@
+/**============================================================================
+Name        : tick_order_book.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tick-indexed order book state.
+              TickOrderBook stores bid/ask levels in flat arrays indexed by
+              the integer tick offset from a base price.
+============================================================================**/
+
+/*
+    TickOrderBook is an array-based alternative to OrderBook.
+
+    Price levels are addressed by their tick offset from a base price:
+
+        index = (price.raw() - basePrice.raw()) / tickSize.raw()
+
+    Each side is stored as a fixed array of Quantity values together with an
+    occupancy bitmap. All storage is allocated in the constructor. Applying an
+    update, reading the best level and reading the volume of a level never
+    allocate.
+
+    Data Flow:
+
+        BookUpdate
+            |
+            v
+        BookBuilder
+            |
+            v
+        TickOrderBook
+            |
+            +----> price -> tick index
+            |
+            +----> levels[index] = quantity
+            |
+            +----> update cached best index
+            |
+            v
+        best bid / best ask
+
+    The array covers a window of levelCount ticks. The window is centred on the
+    top of book every time a snapshot is applied through replace().
+
+    Updates outside of the window are handled as follows:
+
+        - a bid below the window or an ask above the window is a deep level
+          which cannot affect top-of-book; it is dropped and counted;
+
+        - a bid above the window, an ask below the window or a price that is
+          not a multiple of the tick size means the window no longer describes
+          the top of book; the book becomes invalid and must be rebuilt from a
+          snapshot.
+
+    The best bid/ask indices are cached. Adding a level moves the cached index
+    directly. Removing the best level scans the occupancy bitmap 64 levels at a
+    time towards the next occupied level.
+
+    TickOrderBook provides the same interface as OrderBook, so BookBuilder can
+    use either implementation.
+
+    TickOrderBook does not:
+
+        - know about snapshots or market-data sources;
+        - know about exchange-specific message formats;
+        - generate MarketEvent.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_TICK_ORDER_BOOK_HPP
+#define FINANCETECHNOLOGYPROJECTS_TICK_ORDER_BOOK_HPP
+
+#include "model/book_level.hpp"
+#include "model/book_update.hpp"
+#include "order_book.hpp"
+#include "instrument.hpp"
+#include "price.hpp"
+#include "quantity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace trading::market_data
+{
+    class TickOrderBook
+    {
+    public:
+        using Levels = OrderBook::Levels;
+
+        static constexpr std::size_t DefaultLevelCount { 1 << 16 };
+
+        explicit TickOrderBook(const Instrument& instrument,
+                               std::size_t levelCount = DefaultLevelCount);
+
+        [[nodiscard]]
+        bool isValid() const noexcept;
+
+        [[nodiscard]]
+        SequenceNumber sequence() const noexcept;
+
+        void clear() noexcept;
+
+        void replace(SequenceNumber sequence,
+                     const Levels& bids,
+                     const Levels& asks);
+
+        [[nodiscard]]
+        bool applyUpdate(const BookUpdate& update) noexcept;
+
+        [[nodiscard]]
+        std::optional<BookLevel> bestBid() const noexcept;
+
+        [[nodiscard]]
+        std::optional<BookLevel> bestAsk() const noexcept;
+
+        [[nodiscard]]
+        Quantity bidVolume(Price price) const noexcept;
+
+        [[nodiscard]]
+        Quantity askVolume(Price price) const noexcept;
+
+        [[nodiscard]]
+        Price basePrice() const noexcept;
+
+        [[nodiscard]]
+        std::size_t levelCount() const noexcept;
+
+        [[nodiscard]]
+        uint64_t droppedUpdates() const noexcept;
+
+    private:
+        static constexpr std::size_t NoLevel { static_cast<std::size_t>(-1) };
+
+        struct LevelArray
+        {
+            std::vector<Quantity> quantities;
+            std::vector<uint64_t> occupied;
+            std::size_t best { NoLevel };
+        };
+
+        enum class Position : uint8_t
+        {
+            Inside,
+            Below,
+            Above,
+            Misaligned
+        };
+
+        [[nodiscard]]
+        Position locate(Price price, std::size_t& index) const noexcept;
+
+        [[nodiscard]]
+        Price priceAt(std::size_t index) const noexcept;
+
+        void recentre(const Levels& bids, const Levels& asks) noexcept;
+
+        void setBid(std::size_t index, Quantity quantity) noexcept;
+        void setAsk(std::size_t index, Quantity quantity) noexcept;
+
+        [[nodiscard]]
+        std::size_t highestOccupied(const LevelArray& side, std::size_t from) const noexcept;
+
+        [[nodiscard]]
+        std::size_t lowestOccupied(const LevelArray& side, std::size_t from) const noexcept;
+
+        static void resetSide(LevelArray& side) noexcept;
+
+        LevelArray bids;
+        LevelArray asks;
+        Price tickSize;
+        Price base {};
+        std::size_t count;
+        uint64_t dropped { 0 };
+        SequenceNumber sequenceNumber { 0 };
+        bool valid { false };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_TICK_ORDER_BOOK_HPP
@@ -55,12 +55,39 @@ Description : pnl_calculator.cpp
 
     PnLCalculator does not update Position. PositionManager remains the owner
     of position state.
+
+    Portfolio mark-to-market:
+
+        markToMarket() values one position per 64-bit lane. A long position is
+        marked at the bid, a short one at the ask, so both reduce to
+
+            (mark - average entry price) * signed quantity / Scale
+
+        The product of two raw values does not fit 64 bits. The scalar path
+        uses __int128 like calculateUnrealized(). The SIMD path (AVX-512F/DQ,
+        eight positions per iteration) splits both magnitudes at Scale,
+
+            a = aHigh * Scale + aLow,  b = bHigh * Scale + bLow
+
+            a * b / Scale = aHigh * bHigh * Scale + aHigh * bLow + aLow * bHigh
+                            + aLow * bLow / Scale
+
+        so that every partial product fits 64 bits whenever the result does.
+        Lanes have no integer division: x / Scale is taken from a double
+        multiplication, which is off by at most one, and corrected with the
+        remainder. Both paths truncate toward zero and return identical
+        results; the positions left after the last full vector go through the
+        scalar path.
 */
 
 #include "pnl_calculator.hpp"
 
 #include <algorithm>
 
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+#include <immintrin.h>
+#endif
+
 namespace trading::pnl
 {
     namespace
@@ -82,6 +109,81 @@ namespace trading::pnl
             const WideValue value = priceDifference * quantity / PRICE_SCALE;
             return Price { static_cast<Price::Value>(value) };
         }
+
+        [[nodiscard]]
+        constexpr Price::Value markPosition(const position::Position::Value quantity,
+                                            const Price averagePrice,
+                                            const Price bestBid,
+                                            const Price bestAsk) noexcept
+        {
+            const Price mark = quantity > 0 ? bestBid : bestAsk;
+            if (quantity == 0 || mark.isZero())
+                return 0;
+
+            const WideValue priceDifference = static_cast<WideValue>(mark.raw()) -
+                static_cast<WideValue>(averagePrice.raw());
+            return fromProduct(priceDifference, quantity).raw();
+        }
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+        constexpr std::size_t LaneCount { sizeof(__m512i) / sizeof(Price::Value) };
+
+        static_assert(sizeof(Price) == sizeof(Price::Value), "Price columns are loaded as raw 64-bit lanes");
+
+        // x / Scale and x % Scale for 0 <= x < 2^63 in every lane.
+        inline void divideByScale(const __m512i x, __m512i& quotient, __m512i& remainder) noexcept
+        {
+            const __m512i scale = _mm512_set1_epi64(Price::Scale);
+            const __m512i one = _mm512_set1_epi64(1);
+
+            const __m512d estimate = _mm512_mul_pd(_mm512_cvtepi64_pd(x), _mm512_set1_pd(1.0 / Price::Scale));
+            quotient = _mm512_cvttpd_epi64(estimate);
+            remainder = _mm512_sub_epi64(x, _mm512_mullo_epi64(quotient, scale));
+
+            const __mmask8 below = _mm512_cmplt_epi64_mask(remainder, _mm512_setzero_si512());
+            quotient = _mm512_mask_sub_epi64(quotient, below, quotient, one);
+            remainder = _mm512_mask_add_epi64(remainder, below, remainder, scale);
+
+            const __mmask8 above = _mm512_cmpge_epi64_mask(remainder, scale);
+            quotient = _mm512_mask_add_epi64(quotient, above, quotient, one);
+            remainder = _mm512_mask_sub_epi64(remainder, above, remainder, scale);
+        }
+
+        // Same as markPosition() for LaneCount positions.
+        [[nodiscard]]
+        inline __m512i markPositions(const __m512i quantity,
+                                     const __m512i averagePrice,
+                                     const __m512i bestBid,
+                                     const __m512i bestAsk) noexcept
+        {
+            const __m512i zero = _mm512_setzero_si512();
+            const __m512i scale = _mm512_set1_epi64(Price::Scale);
+
+            const __mmask8 isLong = _mm512_cmpgt_epi64_mask(quantity, zero);
+            const __m512i mark = _mm512_mask_blend_epi64(isLong, bestAsk, bestBid);
+            const __mmask8 isMarked = _mm512_cmpneq_epi64_mask(quantity, zero) &
+                                      _mm512_cmpneq_epi64_mask(mark, zero);
+
+            const __m512i priceDifference = _mm512_sub_epi64(mark, averagePrice);
+            const __mmask8 isLoss = _mm512_cmplt_epi64_mask(priceDifference, zero) ^
+                                    _mm512_cmplt_epi64_mask(quantity, zero);
+
+            __m512i differenceHigh, differenceLow, quantityHigh, quantityLow;
+            divideByScale(_mm512_abs_epi64(priceDifference), differenceHigh, differenceLow);
+            divideByScale(_mm512_abs_epi64(quantity), quantityHigh, quantityLow);
+
+            __m512i lowHigh, lowLow;
+            divideByScale(_mm512_mullo_epi64(differenceLow, quantityLow), lowHigh, lowLow);
+
+            __m512i magnitude = _mm512_mullo_epi64(_mm512_mullo_epi64(differenceHigh, quantityHigh), scale);
+            magnitude = _mm512_add_epi64(magnitude, _mm512_mullo_epi64(differenceHigh, quantityLow));
+            magnitude = _mm512_add_epi64(magnitude, _mm512_mullo_epi64(differenceLow, quantityHigh));
+            magnitude = _mm512_add_epi64(magnitude, lowHigh);
+
+            const __m512i value = _mm512_mask_sub_epi64(magnitude, isLoss, zero, magnitude);
+            return _mm512_maskz_mov_epi64(isMarked, value);
+        }
+#endif
     }
 
     Price PnLCalculator::calculateRealized(const position::Position& position,
@@ -142,6 +244,44 @@ namespace trading::pnl
         return fromProduct(priceDifference, absolute(positionQuantity));
     }
 
+    Price PnLCalculator::markToMarket(const position::PositionManager& positions,
+                                      const std::span<const Price> bestBids,
+                                      const std::span<const Price> bestAsks,
+                                      const std::span<Price> unrealized) noexcept
+    {
+        const std::span<const position::Position::Value> quantities = positions.quantities();
+        const std::span<const Price> averagePrices = positions.averagePrices();
+        const std::size_t count = quantities.size();
+
+        std::size_t index { 0 };
+        Price::Value total { 0 };
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+        __m512i totals = _mm512_setzero_si512();
+        for (; index + LaneCount <= count; index += LaneCount)
+        {
+            const __m512i value = markPositions(
+                _mm512_loadu_si512(quantities.data() + index),
+                _mm512_loadu_si512(averagePrices.data() + index),
+                _mm512_loadu_si512(bestBids.data() + index),
+                _mm512_loadu_si512(bestAsks.data() + index));
+
+            _mm512_storeu_si512(unrealized.data() + index, value);
+            totals = _mm512_add_epi64(totals, value);
+        }
+        total = _mm512_reduce_add_epi64(totals);
+#endif
+
+        for (; index < count; ++index)
+        {
+            const Price::Value value = markPosition(quantities[index], averagePrices[index], bestBids[index], bestAsks[index]);
+            unrealized[index] = Price { value };
+            total += value;
+        }
+
+        return Price { total };
+    }
+
     PnL PnLCalculator::calculate(const position::Position& position,
                                  const execution::ExecutionReport& report,
                                  const market_data::MarketEvent& marketEvent) noexcept
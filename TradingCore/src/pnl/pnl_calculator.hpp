@@ -74,6 +74,25 @@ Description : pnl_calculator.hpp
     price to value a short position. This provides a conservative executable
     mark.
 
+    Portfolio mark-to-market:
+
+        PositionManager columns          bestBids / bestAsks (by position slot)
+               |                                     |
+               +------------------+------------------+
+                                  |
+                                  v
+                           markToMarket()
+                                  |
+                                  +-----> unrealized[slot]
+                                  |
+                                  v
+                           total unrealized PnL
+
+        markToMarket() applies the unrealized PnL formula above to every
+        position in one pass. A zero (missing) mark price gives zero PnL for
+        that position, as an empty book side does in calculateUnrealized().
+        The result of every position equals calculateUnrealized().
+
     PnLCalculator does not:
 
         - own Position state;
@@ -92,9 +111,12 @@ Description : pnl_calculator.hpp
 #include "execution_report.hpp"
 #include "market_event.hpp"
 #include "position.hpp"
+#include "position_manager.hpp"
 #include "price.hpp"
 #include "pnl.hpp"
 
+#include <span>
+
 namespace trading::pnl
 {
     class PnLCalculator
@@ -108,6 +130,17 @@ namespace trading::pnl
         static Price calculateUnrealized(const position::Position& position,
                                          const market_data::MarketEvent& marketEvent) noexcept;
 
+        /*
+            bestBids, bestAsks and unrealized are indexed by PositionManager
+            slot and must hold at least positions.size() elements. Returns
+            the sum of unrealized PnL over all positions.
+        */
+        [[nodiscard]]
+        static Price markToMarket(const position::PositionManager& positions,
+                                  std::span<const Price> bestBids,
+                                  std::span<const Price> bestAsks,
+                                  std::span<Price> unrealized) noexcept;
+
         [[nodiscard]]
         static PnL calculate(const position::Position& position,
                              const execution::ExecutionReport& report,
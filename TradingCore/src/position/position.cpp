@@ -270,6 +270,17 @@ namespace trading::position
                               const Price price,
                               const Quantity quantity) noexcept
     {
+        position::applyTrade(currentQuantity, averageEntryPrice, side, price, quantity);
+    }
+
+    void applyTrade(Position::Value& currentQuantity,
+                    Price& averageEntryPrice,
+                    const Side side,
+                    const Price price,
+                    const Quantity quantity) noexcept
+    {
+        using Value = Position::Value;
+
         if (quantity.isZero())
             return;
 
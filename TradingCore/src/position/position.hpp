@@ -83,6 +83,17 @@ namespace trading::position
         {
         }
 
+        constexpr Position(const InstrumentId instrument,
+                           const Value quantity,
+                           const Price averagePrice,
+                           const Price realizedPnl) noexcept :
+            instrument { instrument },
+            currentQuantity { quantity },
+            averageEntryPrice { averagePrice },
+            realizedPnL { realizedPnl }
+        {
+        }
+
         [[nodiscard]]
         constexpr InstrumentId instrumentId() const noexcept {
             return instrument;
@@ -126,6 +137,13 @@ namespace trading::position
         Price averageEntryPrice {};
         Price realizedPnL {};
     };
+
+    // Position::applyTrade() on separately stored fields (see PositionManager).
+    void applyTrade(Position::Value& currentQuantity,
+                    Price& averageEntryPrice,
+                    Side side,
+                    Price price,
+                    Quantity quantity) noexcept;
 }
 
 #endif //FINANCETECHNOLOGYPROJECTS_POSITION_HPP
\ No newline at end of file
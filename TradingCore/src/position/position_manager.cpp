@@ -23,10 +23,10 @@ Description : position_manager.cpp
                |
                | instrument / side / price / quantity
                v
-        Position::applyTrade()
+        position::applyTrade()
                |
                v
-        Position
+        quantities[slot] / averagePrices[slot] / realizedPnls[slot]
                |
                +------------------+
                |                  |
@@ -38,17 +38,21 @@ Description : position_manager.cpp
 
         - reject execution reports that do not represent trades;
         - reject trades with zero execution quantity;
-        - locate or create the position for the instrument;
-        - forward the trade information to Position;
+        - locate the position slot for the instrument or append a new one;
+        - accumulate the realized PnL of reducing and closing fills;
+        - apply the trade to the slot columns with the Position arithmetic;
         - provide read-only access to stored positions.
 
     Position arithmetic is implemented by Position. PositionManager is
     responsible only for routing execution events to the correct position.
 
-    PnL calculation is outside the responsibility of this module.
+    Realized PnL uses PnLCalculator::calculateRealized() on the position
+    before the fill, the same value ReplayEngine accumulates. Unrealized PnL
+    is outside the responsibility of this module.
 */
 
 #include "position_manager.hpp"
+#include "pnl_calculator.hpp"
 
 namespace trading::position
 {
@@ -57,20 +61,62 @@ namespace trading::position
         if (report.execType != ExecType::Trade || report.quantity.isZero())
             return false;
 
-        auto [it, inserted] = positions.try_emplace(report.instrument, report.instrument);
+        Slot slot = instrumentSlots.slotOf(report.instrument);
+        if (slot == NoSlot)
+        {
+            slot = instrumentSlots.add(report.instrument);
+            if (slot == NoSlot)
+                return false;
 
-        Position& position = it->second;
-        position.applyTrade(report.side, report.price, report.quantity);
+            instrumentIds.push_back(report.instrument);
+            quantity.push_back(0);
+            averagePrice.emplace_back();
+            realizedPnl.emplace_back();
+        }
 
+        const Position before { report.instrument, quantity[slot], averagePrice[slot], realizedPnl[slot] };
+        realizedPnl[slot] += pnl::PnLCalculator::calculateRealized(before, report);
+
+        applyTrade(quantity[slot], averagePrice[slot], report.side, report.price, report.quantity);
         return true;
     }
 
-    const Position* PositionManager::find(const InstrumentId instrument) const noexcept
+    std::optional<Position> PositionManager::find(const InstrumentId instrument) const noexcept
+    {
+        const Slot slot = slotOf(instrument);
+        if (slot == NoSlot)
+            return std::nullopt;
+
+        return Position { instrument, quantity[slot], averagePrice[slot], realizedPnl[slot] };
+    }
+
+    PositionManager::Slot PositionManager::slotOf(const InstrumentId instrument) const noexcept
     {
-        const auto it = positions.find(instrument);
-        if (it == positions.end())
-            return nullptr;
+        return instrumentSlots.slotOf(instrument);
+    }
 
-        return &it->second;
+    std::size_t PositionManager::size() const noexcept
+    {
+        return instrumentIds.size();
+    }
+
+    std::span<const InstrumentId> PositionManager::instruments() const noexcept
+    {
+        return instrumentIds;
+    }
+
+    std::span<const Position::Value> PositionManager::quantities() const noexcept
+    {
+        return quantity;
+    }
+
+    std::span<const Price> PositionManager::averagePrices() const noexcept
+    {
+        return averagePrice;
+    }
+
+    std::span<const Price> PositionManager::realizedPnls() const noexcept
+    {
+        return realizedPnl;
     }
-}
\ No newline at end of file
+}
@@ -41,12 +41,35 @@ Responsibility :
       - communicate with an exchange;
       - create or send orders;
       - perform risk checks;
-      - calculate realized or unrealized PnL;
+      - calculate unrealized PnL or mark positions to market;
       - process market data;
       - manage order lifecycle.
 
     Only ExecutionReport messages with ExecType::Trade can change a position.
 
+Storage :
+    Positions are stored as parallel arrays indexed by a dense position
+    slot. An instrument gets the next slot of an InstrumentSlots table on
+    its first trade.
+
+        instrumentSlots.slotOf(instrument) --> slot
+                                  |
+                                  v
+        instruments    [ id  | id  | id  | ... ]
+        quantities     [ q   | q   | q   | ... ]
+        averagePrices  [ avg | avg | avg | ... ]
+        realizedPnls   [ pnl | pnl | pnl | ... ]
+
+    A portfolio pass (PnLCalculator::markToMarket) reads the quantity and
+    average price columns sequentially, one 64-bit lane per instrument,
+    without touching the rest of the position state.
+
+    The realized PnL column accumulates PnLCalculator::calculateRealized()
+    for every fill that reduces, closes or reverses the position, evaluated
+    against the position before the fill.
+
+    Instruments with an id above MaxInstrumentId cannot hold a position.
+
 Position semantics :
     Positive quantity represents a long position.
     Negative quantity represents a short position.
@@ -60,24 +83,55 @@ Position semantics :
 #define FINANCETECHNOLOGYPROJECTS_POSITION_MANAGER_HPP
 
 #include "execution_report.hpp"
+#include "instrument_slots.hpp"
 #include "position.hpp"
 #include "types.hpp"
 
-#include <map>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace trading::position
 {
     class PositionManager
     {
     public:
+        using Slot = InstrumentSlots::Slot;
+
+        static constexpr Slot NoSlot { InstrumentSlots::NoSlot };
+
         [[nodiscard]]
         bool applyExecution(const trading::execution::ExecutionReport& report);
 
+        // A copy of the position state, std::nullopt if the instrument never traded.
+        [[nodiscard]]
+        std::optional<Position> find(InstrumentId instrument) const noexcept;
+
+        [[nodiscard]]
+        Slot slotOf(InstrumentId instrument) const noexcept;
+
+        // Number of positions, the columns below have this size.
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+
+        [[nodiscard]]
+        std::span<const InstrumentId> instruments() const noexcept;
+
+        [[nodiscard]]
+        std::span<const Position::Value> quantities() const noexcept;
+
+        [[nodiscard]]
+        std::span<const Price> averagePrices() const noexcept;
+
         [[nodiscard]]
-        const Position* find(InstrumentId instrument) const noexcept;
+        std::span<const Price> realizedPnls() const noexcept;
 
     private:
-        std::map<InstrumentId, Position> positions;
+        InstrumentSlots instrumentSlots;
+        std::vector<InstrumentId> instrumentIds;
+        std::vector<Position::Value> quantity;
+        std::vector<Price> averagePrice;
+        std::vector<Price> realizedPnl;
     };
 }
 
@@ -0,0 +1,128 @@
+/**============================================================================
+Name        : journal_format.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Binary layout of journal files.
+============================================================================**/
+
+/*
+    Layout of the files written by JournalRecorder.
+
+    File:
+
+        +--------------------+  offset 0
+        | JournalFileHeader  |  64 bytes
+        +--------------------+  offset 64
+        | JournalRecord      |  80 bytes
+        | JournalRecord      |
+        | ...                |
+        +--------------------+  header + recordCount * recordSize
+
+    Every file is pre-allocated to the configured size and truncated to the
+    written records when it is closed. A file left behind by a crash keeps
+    its full size: readers take header.recordCount records, which counts
+    every batch the writer completed.
+
+    Record:
+
+        sequence   - 1, 2, 3, ... over all files of one recorder run; a gap
+                     means the records in between were dropped;
+        type       - EventType of the payload;
+        payload    - the domain object, copied as it is in memory; a
+                     MarketEvent without its trace context, so journals
+                     written with and without TRADING_CORE_TRACING match.
+
+    Files use the byte order and struct layout of the machine that wrote
+    them; the header carries the record size as a compatibility check.
+
+    journal_format.hpp does not:
+
+        - read or write files (see JournalRecorder and JournalReader);
+        - convert between byte orders.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_JOURNAL_FORMAT_HPP
+#define FINANCETECHNOLOGYPROJECTS_JOURNAL_FORMAT_HPP
+
+#include "execution_report.hpp"
+#include "market_event.hpp"
+#include "recording_event.hpp"
+#include "timestamp.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace trading::recording
+{
+    // "TRJRNL01" read as a little-endian word.
+    inline constexpr uint64_t JournalMagic { 0x31304C4E524A5254 };
+    inline constexpr uint32_t JournalVersion { 1 };
+
+    struct JournalFileHeader
+    {
+        uint64_t magic { JournalMagic };
+        uint32_t version { JournalVersion };
+        uint32_t recordSize { 0 };
+        uint64_t fileIndex { 0 };
+        uint64_t firstSequence { 0 };
+
+        // Updated by the writer after every batch.
+        uint64_t recordCount { 0 };
+
+        Timestamp created {};
+        std::array<std::byte, 16> reserved {};
+    };
+
+    struct JournalRecord
+    {
+        static constexpr std::size_t PayloadSize { 64 };
+
+        uint64_t sequence { 0 };
+        EventType type { EventType::MarketEvent };
+        std::array<std::byte, 7> reserved {};
+        std::array<std::byte, PayloadSize> payload {};
+    };
+
+    static_assert(sizeof(JournalFileHeader) == 64);
+    static_assert(sizeof(JournalRecord) == 80);
+    static_assert(std::is_trivially_copyable_v<JournalRecord>);
+
+    // Bytes of 'Event' stored in the payload.
+    template<typename Event>
+    inline constexpr std::size_t PayloadBytes { sizeof(Event) };
+
+#if defined(TRADING_CORE_TRACING)
+    // The trace context is the last member and local to the process.
+    template<>
+    inline constexpr std::size_t PayloadBytes<market_data::MarketEvent> { offsetof(market_data::MarketEvent, trace) };
+#endif
+
+    static_assert(std::is_trivially_copyable_v<market_data::MarketEvent>);
+    static_assert(std::is_trivially_copyable_v<execution::ExecutionReport>);
+    static_assert(PayloadBytes<market_data::MarketEvent> <= JournalRecord::PayloadSize);
+    static_assert(PayloadBytes<execution::ExecutionReport> <= JournalRecord::PayloadSize);
+
+    [[nodiscard]]
+    inline market_data::MarketEvent marketEventOf(const JournalRecord& record) noexcept
+    {
+        market_data::MarketEvent event {};
+        // Without tracing this is the whole event; with it the trace stays empty.
+        std::memcpy(static_cast<void*>(&event), record.payload.data(), PayloadBytes<market_data::MarketEvent>);
+        return event;
+    }
+
+    [[nodiscard]]
+    inline execution::ExecutionReport executionReportOf(const JournalRecord& record) noexcept
+    {
+        execution::ExecutionReport report;
+        std::memcpy(&report, record.payload.data(), sizeof(report));
+        return report;
+    }
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_JOURNAL_FORMAT_HPP
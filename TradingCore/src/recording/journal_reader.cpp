@@ -0,0 +1,97 @@
+/**============================================================================
+Name        : journal_reader.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Read-only view of a journal file.
+============================================================================**/
+
+#include "journal_reader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace trading::recording
+{
+    JournalReader::JournalReader(const std::filesystem::path& path)
+    {
+        const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0)
+            return;
+
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0)
+        {
+            ::close(descriptor);
+            return;
+        }
+
+        const auto fileSize = static_cast<std::size_t>(status.st_size);
+        if (fileSize < sizeof(JournalFileHeader))
+        {
+            ::close(descriptor);
+            readStatus = JournalReadStatus::InvalidHeader;
+            return;
+        }
+
+        // MAP_POPULATE prefaults the whole file: the replay loop must not take page faults.
+        void* const mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE | MAP_POPULATE, descriptor, 0);
+        ::close(descriptor);
+        if (mapping == MAP_FAILED)
+            return;
+
+        ::madvise(mapping, fileSize, MADV_SEQUENTIAL);
+        data = static_cast<const std::byte*>(mapping);
+        size = fileSize;
+
+        std::memcpy(&fileHeader, data, sizeof(JournalFileHeader));
+        if (fileHeader.magic != JournalMagic ||
+            fileHeader.version != JournalVersion ||
+            fileHeader.recordSize != sizeof(JournalRecord))
+        {
+            readStatus = JournalReadStatus::InvalidHeader;
+            return;
+        }
+
+        const std::size_t available = (size - sizeof(JournalFileHeader)) / sizeof(JournalRecord);
+        recordCount = static_cast<std::size_t>(std::min<uint64_t>(fileHeader.recordCount, available));
+        readStatus = JournalReadStatus::Open;
+    }
+
+    JournalReader::~JournalReader()
+    {
+        if (data != nullptr)
+            ::munmap(const_cast<std::byte*>(data), size);
+    }
+
+    bool JournalReader::isOpen() const noexcept
+    {
+        return readStatus == JournalReadStatus::Open;
+    }
+
+    JournalReadStatus JournalReader::status() const noexcept
+    {
+        return readStatus;
+    }
+
+    const JournalFileHeader& JournalReader::header() const noexcept
+    {
+        return fileHeader;
+    }
+
+    std::span<const JournalRecord> JournalReader::records() const noexcept
+    {
+        if (!isOpen())
+            return {};
+
+        // The header is 64 bytes and the mapping page aligned: records are suitably aligned.
+        const auto* const first = reinterpret_cast<const JournalRecord*>(data + sizeof(JournalFileHeader));
+        return std::span<const JournalRecord> { first, recordCount };
+    }
+}
@@ -0,0 +1,90 @@
+/**============================================================================
+Name        : journal_reader.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Read-only view of a journal file.
+============================================================================**/
+
+/*
+    JournalReader maps one file written by JournalRecorder and exposes its
+    records in place (see journal_format.hpp).
+
+    Data Flow:
+
+        <prefix>.000001.journal
+               |
+               | mmap, read-only, prefaulted
+               v
+        JournalReader
+               |
+               | header(), records()
+               v
+        replay / analysis
+
+    A file whose header has the wrong magic, version or record size is not
+    open (status() says why). records() holds header.recordCount records,
+    or fewer if the file is shorter.
+
+    JournalReader does not:
+
+        - follow a file that is still being written;
+        - open the next file of a journal (callers pass the files in order).
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_JOURNAL_READER_HPP
+#define FINANCETECHNOLOGYPROJECTS_JOURNAL_READER_HPP
+
+#include "journal_format.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace trading::recording
+{
+    enum class JournalReadStatus : uint8_t
+    {
+        Open,
+        CannotOpenFile,
+        InvalidHeader
+    };
+
+    class JournalReader
+    {
+    public:
+        explicit JournalReader(const std::filesystem::path& path);
+        ~JournalReader();
+
+        JournalReader(const JournalReader&) = delete;
+        JournalReader& operator=(const JournalReader&) = delete;
+
+        JournalReader(JournalReader&&) = delete;
+        JournalReader& operator=(JournalReader&&) = delete;
+
+        [[nodiscard]]
+        bool isOpen() const noexcept;
+
+        [[nodiscard]]
+        JournalReadStatus status() const noexcept;
+
+        [[nodiscard]]
+        const JournalFileHeader& header() const noexcept;
+
+        // Valid while the reader exists.
+        [[nodiscard]]
+        std::span<const JournalRecord> records() const noexcept;
+
+    private:
+        JournalReadStatus readStatus { JournalReadStatus::CannotOpenFile };
+        JournalFileHeader fileHeader {};
+
+        const std::byte* data { nullptr };
+        std::size_t size { 0 };
+        std::size_t recordCount { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_JOURNAL_READER_HPP
@@ -0,0 +1,360 @@
+/**============================================================================
+Name        : journal_recorder.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Asynchronous binary journal of recorded events.
+============================================================================**/
+
+/*
+    Writer thread:
+
+        start()
+           |
+           v
+        openFile()  ---- create, posix_fallocate, mmap(MAP_SHARED | MAP_POPULATE),
+           |             write JournalFileHeader
+           v
+        drain() <-----------------------------+
+           |                                  |
+           | no file: reopenFile()            |
+           | up to MaxBatch records           |
+           v                                  |
+        write() -- file full --> closeFile() + reopenFile()
+           |                                  |
+           v                                  |
+        header.recordCount = records ---------+
+        (header.firstSequence at the first record of a file)
+           |
+           | stop(): ring empty and writerActive cleared
+           v
+        closeFile() ---- munmap, ftruncate to the written records, close
+
+    The counters have a single writer (the recording thread or the writer
+    thread) and are updated with relaxed load + store, statistics() reads
+    them from any thread.
+
+    start() scans the directory for "<prefix>.<index>.journal" and sets
+    fileIndex to the highest index found, so the first file of the run
+    follows the files already there. openFile() creates the file with
+    O_EXCL; if it exists (another recorder on the same directory) the index
+    is skipped, so the retry tries the next one.
+
+    reopenFile() retries a file that could not be created. After a failure
+    it waits reopenBackoff (reopenDelay, doubled per failure up to
+    MaxReopenDelay); records drained in the meantime are counted as lost.
+    A successful open resets the backoff, so the next rotation is tried
+    immediately.
+*/
+
+#include "journal_recorder.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace trading::recording
+{
+    namespace
+    {
+        constexpr std::size_t HeaderSize { sizeof(JournalFileHeader) };
+        constexpr std::size_t RecordSize { sizeof(JournalRecord) };
+
+        void increase(std::atomic<uint64_t>& counter, const uint64_t value) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        // Highest index of the "<prefix>.<index>.journal" files in the directory, 0 if there are none.
+        [[nodiscard]]
+        std::expected<uint64_t, std::error_code> lastFileIndex(const std::filesystem::path& directory,
+                                                               const std::string& prefix)
+        {
+            constexpr std::string_view Extension { ".journal" };
+
+            std::error_code error;
+            std::filesystem::directory_iterator iterator { directory, error };
+            if (error)
+                return std::unexpected(error);
+
+            uint64_t last { 0 };
+            for (; iterator != std::filesystem::directory_iterator {}; iterator.increment(error))
+            {
+                if (error)
+                    return std::unexpected(error);
+
+                const std::string name = iterator->path().filename().string();
+                if (name.size() <= prefix.size() + 1 + Extension.size() || !name.starts_with(prefix) ||
+                    name[prefix.size()] != '.' || !name.ends_with(Extension))
+                    continue;
+
+                const std::string_view digits { name.data() + prefix.size() + 1,
+                                                name.size() - prefix.size() - 1 - Extension.size() };
+                uint64_t index { 0 };
+                const auto [end, status] = std::from_chars(digits.data(), digits.data() + digits.size(), index);
+                if (status == std::errc {} && end == digits.data() + digits.size())
+                    last = std::max(last, index);
+            }
+            if (error)
+                return std::unexpected(error);
+            return last;
+        }
+
+        [[nodiscard]]
+        Timestamp wallClock() noexcept
+        {
+            const auto duration = std::chrono::system_clock::now().time_since_epoch();
+            return Timestamp { static_cast<Timestamp::Value>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) };
+        }
+    }
+
+    JournalRecorder::JournalRecorder(JournalConfig config):
+        configuration { std::move(config) },
+        ring { std::make_unique<SpscQueue<JournalRecord, RingCapacity>>() }
+    {
+    }
+
+    JournalRecorder::~JournalRecorder()
+    {
+        stop();
+    }
+
+    std::expected<void, JournalError> JournalRecorder::start()
+    {
+        if (writerThread.joinable())
+            return std::unexpected(JournalError::AlreadyStarted);
+
+        if (configuration.prefix.empty() || configuration.fileSize < HeaderSize + RecordSize ||
+            configuration.reopenDelay < std::chrono::milliseconds::zero())
+            return std::unexpected(JournalError::InvalidConfiguration);
+        recordsPerFile = (configuration.fileSize - HeaderSize) / RecordSize;
+        reopenAt = {};
+        reopenBackoff = configuration.reopenDelay;
+
+        std::error_code error;
+        std::filesystem::create_directories(configuration.directory, error);
+        if (error)
+            return std::unexpected(JournalError::CannotCreateFile);
+
+        const std::expected<uint64_t, std::error_code> lastIndex = lastFileIndex(configuration.directory, configuration.prefix);
+        if (!lastIndex)
+            return std::unexpected(JournalError::CannotCreateFile);
+        fileIndex = std::max(fileIndex, *lastIndex);
+
+        if (!openFile())
+            return std::unexpected(JournalError::CannotCreateFile);
+
+        writerActive.store(true, std::memory_order_release);
+        writerThread = std::thread { &JournalRecorder::runWriter, this };
+        return {};
+    }
+
+    void JournalRecorder::stop()
+    {
+        if (!writerThread.joinable())
+            return;
+
+        writerActive.store(false, std::memory_order_release);
+        writerThread.join();
+    }
+
+    bool JournalRecorder::isRunning() const noexcept
+    {
+        return writerThread.joinable();
+    }
+
+    void JournalRecorder::record(const market_data::MarketEvent& event)
+    {
+        append(EventType::MarketEvent, event);
+    }
+
+    void JournalRecorder::record(const execution::ExecutionReport& report)
+    {
+        append(EventType::ExecutionReport, report);
+    }
+
+    template<typename Event>
+    void JournalRecorder::append(const EventType type, const Event& event) noexcept
+    {
+        const uint64_t sequence = producer.nextSequence++;
+
+        JournalRecord* const slot = ring->tryClaim();
+        if (slot == nullptr)
+        {
+            increase(producer.dropped, 1);
+            return;
+        }
+
+        slot->sequence = sequence;
+        slot->type = type;
+        constexpr std::size_t Bytes { PayloadBytes<Event> };
+        std::memcpy(slot->payload.data(), &event, Bytes);
+        if constexpr (Bytes < JournalRecord::PayloadSize)
+            std::memset(slot->payload.data() + Bytes, 0, JournalRecord::PayloadSize - Bytes);
+        ring->publish();
+
+        increase(producer.recorded, 1);
+    }
+
+    JournalStatistics JournalRecorder::statistics() const noexcept
+    {
+        return JournalStatistics {
+            .recorded = producer.recorded.load(std::memory_order_relaxed),
+            .dropped = producer.dropped.load(std::memory_order_relaxed),
+            .written = writer.written.load(std::memory_order_relaxed),
+            .lost = writer.lost.load(std::memory_order_relaxed),
+            .files = writer.files.load(std::memory_order_relaxed)
+        };
+    }
+
+    std::filesystem::path JournalRecorder::filePath(const uint64_t index) const
+    {
+        char suffix[32];
+        const int length = std::snprintf(suffix, sizeof(suffix), ".%06llu.journal", static_cast<unsigned long long>(index));
+        return configuration.directory / (configuration.prefix + std::string { suffix, static_cast<std::size_t>(length) });
+    }
+
+    void JournalRecorder::runWriter()
+    {
+        while (writerActive.load(std::memory_order_acquire))
+        {
+            if (drain() == 0)
+                std::this_thread::yield();
+        }
+        while (drain() != 0) {
+        }
+        closeFile();
+    }
+
+    std::size_t JournalRecorder::drain() noexcept
+    {
+        if (mapping == nullptr && ring->front() != nullptr)
+            reopenFile();
+
+        std::size_t count { 0 };
+        for (; count < MaxBatch; ++count)
+        {
+            const JournalRecord* const record = ring->front();
+            if (record == nullptr)
+                break;
+
+            write(*record);
+            ring->pop();
+        }
+
+        if (count != 0 && mapping != nullptr)
+            std::memcpy(mapping + offsetof(JournalFileHeader, recordCount), &fileRecords, sizeof(fileRecords));
+        return count;
+    }
+
+    void JournalRecorder::write(const JournalRecord& record) noexcept
+    {
+        if (mapping != nullptr && fileRecords == recordsPerFile)
+        {
+            closeFile();
+            reopenFile();
+        }
+
+        if (mapping == nullptr)
+        {
+            increase(writer.lost, 1);
+            return;
+        }
+
+        if (fileRecords == 0)
+            std::memcpy(mapping + offsetof(JournalFileHeader, firstSequence), &record.sequence, sizeof(record.sequence));
+
+        std::memcpy(mapping + HeaderSize + fileRecords * RecordSize, &record, RecordSize);
+        ++fileRecords;
+        increase(writer.written, 1);
+    }
+
+    bool JournalRecorder::openFile() noexcept
+    {
+        const std::filesystem::path path = filePath(fileIndex + 1);
+        const int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (file < 0)
+        {
+            // Never overwrite: another recorder owns this index, try the next one.
+            if (errno == EEXIST)
+                ++fileIndex;
+            return false;
+        }
+
+        const std::size_t size = HeaderSize + recordsPerFile * RecordSize;
+        if (::posix_fallocate(file, 0, static_cast<off_t>(size)) != 0)
+        {
+            ::close(file);
+            ::unlink(path.c_str());
+            return false;
+        }
+
+        // MAP_POPULATE prefaults the whole file: appending must not take page faults.
+        void* const region = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file, 0);
+        if (region == MAP_FAILED)
+        {
+            ::close(file);
+            ::unlink(path.c_str());
+            return false;
+        }
+
+        descriptor = file;
+        mapping = static_cast<std::byte*>(region);
+        mappedSize = size;
+        fileRecords = 0;
+        ++fileIndex;
+
+        const JournalFileHeader header {
+            .recordSize = static_cast<uint32_t>(RecordSize),
+            .fileIndex = fileIndex,
+            .created = wallClock()
+        };
+        std::memcpy(mapping, &header, HeaderSize);
+
+        increase(writer.files, 1);
+        return true;
+    }
+
+    void JournalRecorder::reopenFile() noexcept
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now < reopenAt)
+            return;
+
+        if (openFile())
+        {
+            reopenAt = {};
+            reopenBackoff = configuration.reopenDelay;
+            return;
+        }
+
+        reopenAt = now + reopenBackoff;
+        reopenBackoff = std::min(reopenBackoff * 2, MaxReopenDelay);
+    }
+
+    void JournalRecorder::closeFile() noexcept
+    {
+        if (mapping == nullptr)
+            return;
+
+        std::memcpy(mapping + offsetof(JournalFileHeader, recordCount), &fileRecords, sizeof(fileRecords));
+        ::munmap(mapping, mappedSize);
+        const int _ = ::ftruncate(descriptor, static_cast<off_t>(HeaderSize + fileRecords * RecordSize));
+        ::close(descriptor);
+
+        descriptor = -1;
+        mapping = nullptr;
+        mappedSize = 0;
+    }
+}
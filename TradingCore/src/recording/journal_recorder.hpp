@@ -0,0 +1,217 @@
+/**============================================================================
+Name        : journal_recorder.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Asynchronous binary journal of recorded events.
+============================================================================**/
+
+/*
+    JournalRecorder persists MarketEvents and ExecutionReports to append-only
+    binary files (see journal_format.hpp) without doing any I/O on the
+    recording thread.
+
+    Data Flow:
+
+        recording thread                    writer thread
+           |                                     ^
+           | record()                            | drain up to MaxBatch records
+           |   sequence + type + 64-byte copy    |
+           v                                     |
+        SpscQueue<JournalRecord> ----------------+
+                                                 |
+                                                 | memcpy
+                                                 v
+                                  <directory>/<prefix>.000001.journal   (mmap, pre-allocated)
+                                  <directory>/<prefix>.000002.journal   (next file once full)
+                                  ...
+
+    Hot path:
+
+        record() claims a ring slot, writes the sequence number and type tag
+        and copies the event into the slot. It never allocates, blocks or
+        makes a system call. When the ring is full the record is dropped and
+        counted; its sequence number is still consumed, so the journal shows
+        the gap.
+
+    Writer:
+
+        The writer thread copies batches of records into the memory-mapped
+        file and updates header.recordCount after each batch. Files are
+        pre-allocated with posix_fallocate and prefaulted, so appending does
+        not allocate disk blocks or take page faults. When the next record
+        does not fit, the file is truncated to its records, unmapped, and
+        the next file is created. If a file cannot be created the writer
+        keeps draining the ring and counts the records as lost. It retries
+        the file at the start of a later batch: the first retry waits
+        reopenDelay and every further failure doubles the wait, up to
+        MaxReopenDelay.
+
+        Files are never overwritten. start() continues after the highest
+        file index already in the directory for the prefix, so a restarted
+        process appends new files after those of the earlier run, and files
+        are created with O_EXCL: start() fails with CannotCreateFile if the
+        next file exists, a rotation that meets an existing file skips to
+        the next index. Sequence numbers restart at 1 for every recorder.
+
+        stop() lets the writer drain the ring, closes the current file and
+        joins the thread.
+
+    Threads:
+
+        record() must be called from one thread at a time (the trading
+        thread, or the background stage of the Pipeline). Records taken
+        before start() wait in the ring. start() and stop() belong to the
+        control thread; statistics() is safe from any thread.
+
+    JournalRecorder does not:
+
+        - flush to disk (the page cache writes the mapping back; the data
+          survives a process crash but not a power loss);
+        - read journals back (see the replay engine);
+        - delete old journal files.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_JOURNAL_RECORDER_HPP
+#define FINANCETECHNOLOGYPROJECTS_JOURNAL_RECORDER_HPP
+
+#include "journal_format.hpp"
+#include "recorder.hpp"
+#include "spsc_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace trading::recording
+{
+    enum class JournalError : uint8_t
+    {
+        AlreadyStarted,
+        InvalidConfiguration,
+        CannotCreateFile
+    };
+
+    struct JournalConfig
+    {
+        std::filesystem::path directory { "journal" };
+        std::string prefix { "journal" };
+
+        // Size of every file including its header; rounded down to whole records.
+        std::size_t fileSize { 64 * 1024 * 1024 };
+
+        // Wait before retrying a file that could not be created, doubled per failure.
+        std::chrono::milliseconds reopenDelay { 10 };
+    };
+
+    struct JournalStatistics
+    {
+        uint64_t recorded { 0 };
+        uint64_t dropped { 0 };
+        uint64_t written { 0 };
+        uint64_t lost { 0 };
+        uint64_t files { 0 };
+    };
+
+    class JournalRecorder final : public IRecorder
+    {
+    public:
+        static constexpr std::size_t RingCapacity { 16 * 1024 };
+        static constexpr std::size_t MaxBatch { 256 };
+        static constexpr std::chrono::milliseconds MaxReopenDelay { 1'000 };
+
+        explicit JournalRecorder(JournalConfig config = {});
+        ~JournalRecorder() override;
+
+        JournalRecorder(const JournalRecorder&) = delete;
+        JournalRecorder& operator=(const JournalRecorder&) = delete;
+
+        JournalRecorder(JournalRecorder&&) = delete;
+        JournalRecorder& operator=(JournalRecorder&&) = delete;
+
+        // Creates the first file and starts the writer thread.
+        [[nodiscard]]
+        std::expected<void, JournalError> start();
+
+        // Writes every record taken so far, closes the file and joins the writer.
+        void stop();
+
+        [[nodiscard]]
+        bool isRunning() const noexcept;
+
+        void record(const market_data::MarketEvent& event) override;
+        void record(const execution::ExecutionReport& report) override;
+
+        [[nodiscard]]
+        JournalStatistics statistics() const noexcept;
+
+        // Path of the file with the given index (1 for the first file in an empty directory).
+        [[nodiscard]]
+        std::filesystem::path filePath(uint64_t fileIndex) const;
+
+    private:
+        static constexpr std::size_t CacheLineSize { 64 };
+
+        struct alignas(CacheLineSize) ProducerCounters
+        {
+            uint64_t nextSequence { 1 };
+            std::atomic<uint64_t> recorded { 0 };
+            std::atomic<uint64_t> dropped { 0 };
+        };
+
+        struct alignas(CacheLineSize) WriterCounters
+        {
+            std::atomic<uint64_t> written { 0 };
+            std::atomic<uint64_t> lost { 0 };
+            std::atomic<uint64_t> files { 0 };
+        };
+
+        template<typename Event>
+        void append(EventType type, const Event& event) noexcept;
+
+        void runWriter();
+
+        [[nodiscard]]
+        std::size_t drain() noexcept;
+
+        void write(const JournalRecord& record) noexcept;
+
+        [[nodiscard]]
+        bool openFile() noexcept;
+
+        // openFile() unless the backoff after the last failure is still running.
+        void reopenFile() noexcept;
+
+        void closeFile() noexcept;
+
+        JournalConfig configuration;
+        std::size_t recordsPerFile { 0 };
+
+        // Heap allocated: the ring holds more than a megabyte.
+        std::unique_ptr<SpscQueue<JournalRecord, RingCapacity>> ring;
+
+        ProducerCounters producer {};
+        WriterCounters writer {};
+
+        // Owned by the writer thread while it runs.
+        int descriptor { -1 };
+        std::byte* mapping { nullptr };
+        std::size_t mappedSize { 0 };
+        uint64_t fileIndex { 0 };
+        uint64_t fileRecords { 0 };
+        std::chrono::steady_clock::time_point reopenAt {};
+        std::chrono::milliseconds reopenBackoff { 0 };
+
+        std::atomic<bool> writerActive { false };
+        std::thread writerThread;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_JOURNAL_RECORDER_HPP
@@ -0,0 +1,49 @@
+/**============================================================================
+Name        : reference_prices.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Per-instrument reference prices for the pre-trade price band.
+============================================================================**/
+
+#include "reference_prices.hpp"
+
+namespace trading::risk
+{
+    ReferencePrices::ReferencePrices(const std::span<const Instrument> instruments,
+                                     market_data::IMarketEventHandler& next):
+        next { next },
+        instrumentSlots { instruments }
+    {
+        for (const Instrument& instrument : instruments)
+        {
+            if (instrumentSlots.add(instrument.id()) != InstrumentSlots::NoSlot)
+                tickSizes.push_back(instrument.tickSize());
+        }
+
+        // Seqlock is neither copyable nor movable: the slots are allocated once.
+        slots = std::make_unique<Seqlock<ReferencePrice>[]>(tickSizes.size());
+        for (std::size_t slot { 0 }; slot < tickSizes.size(); ++slot)
+            slots[slot].store(ReferencePrice { .tickSize = tickSizes[slot] });
+    }
+
+    void ReferencePrices::onMarketEvent(const market_data::MarketEvent& event)
+    {
+        if (const InstrumentSlots::Slot slot = instrumentSlots.slotOf(event.instrument); slot != InstrumentSlots::NoSlot)
+        {
+            slots[slot].store(ReferencePrice {
+                .bid = event.bestBid,
+                .ask = event.bestAsk,
+                .tickSize = tickSizes[slot]
+            });
+        }
+
+        next.onMarketEvent(event);
+    }
+
+    bool ReferencePrices::contains(const InstrumentId instrument) const noexcept
+    {
+        return instrumentSlots.contains(instrument);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**============================================================================
+Name        : reference_prices.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Per-instrument reference prices for the pre-trade price band.
+============================================================================**/
+
+/*
+    ReferencePrices keeps the last best bid and ask of every configured
+    instrument for the price-band check of RiskManager. It sits in the
+    market-event path and passes every event on unchanged.
+
+    Data Flow:
+
+        BookRegistry
+           |
+           | MarketEvent                  (market-data thread)
+           v
+        ReferencePrices ---- Seqlock slot per instrument ----+
+           |                                                 |
+           v                                                 | reference()
+        next IMarketEventHandler                             v
+        (Pipeline / ConfigReloader)                  RiskManager::checkOrder()
+                                                     (trading thread)
+
+    Threads:
+
+        One thread writes (the one that produces MarketEvents), any number
+        of threads read. Each instrument has its own cache-line aligned
+        Seqlock slot: the writer never waits and a reader only retries when
+        it overlaps the update of that very instrument, so market data and
+        order entry can run on different cores without blocking each other.
+
+    Instrument indexing:
+
+        Instruments are configured at construction and found through an
+        InstrumentSlots table. The table never changes afterwards, which is
+        what makes concurrent reads safe.
+        Events of instruments that are not configured are passed on without
+        updating anything.
+
+    ReferencePrices does not:
+
+        - decide whether an order price is acceptable (RiskManager does);
+        - keep a price history or compute averages;
+        - filter or reorder market events.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_REFERENCE_PRICES_HPP
+#define FINANCETECHNOLOGYPROJECTS_REFERENCE_PRICES_HPP
+
+#include "instrument.hpp"
+#include "instrument_slots.hpp"
+#include "interfaces/market_event_handler.hpp"
+#include "model/market_event.hpp"
+#include "price.hpp"
+#include "seqlock.hpp"
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace trading::risk
+{
+    // Last top of book of an instrument. Zero prices mean the side is unknown.
+    struct ReferencePrice
+    {
+        Price bid {};
+        Price ask {};
+        Price tickSize {};
+
+        [[nodiscard]]
+        constexpr bool isValid() const noexcept
+        {
+            return bid.isPositive() && ask.isPositive();
+        }
+    };
+
+    class ReferencePrices final : public market_data::IMarketEventHandler
+    {
+    public:
+        ReferencePrices(std::span<const Instrument> instruments,
+                        market_data::IMarketEventHandler& next);
+
+        ReferencePrices(const ReferencePrices&) = delete;
+        ReferencePrices& operator=(const ReferencePrices&) = delete;
+
+        // Writer thread.
+        void onMarketEvent(const market_data::MarketEvent& event) override;
+
+        // Any thread. Zero prices if the instrument is unknown or has no top of book yet.
+        [[nodiscard]]
+        ReferencePrice reference(const InstrumentId instrument) const noexcept
+        {
+            const InstrumentSlots::Slot slot = instrumentSlots.slotOf(instrument);
+            if (slot == InstrumentSlots::NoSlot)
+                return ReferencePrice {};
+
+            return slots[slot].load();
+        }
+
+        [[nodiscard]]
+        bool contains(InstrumentId instrument) const noexcept;
+
+    private:
+        market_data::IMarketEventHandler& next;
+        InstrumentSlots instrumentSlots;
+        std::vector<Price> tickSizes;
+        std::unique_ptr<Seqlock<ReferencePrice>[]> slots;
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_REFERENCE_PRICES_HPP
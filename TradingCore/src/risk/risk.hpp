@@ -61,7 +61,10 @@ namespace trading::risk
         None,
         MaxOrderQuantity,
         MaxPositionQuantity,
-        MaxNotional
+        MaxNotional,
+        MaxOpenNotional,
+        PriceBand,
+        NoReferencePrice
     };
 }
 
@@ -27,7 +27,10 @@ Description : risk_limits.hpp
 
         - define the maximum quantity of a single order;
         - define the maximum absolute position;
-        - define the maximum order notional.
+        - define the maximum order notional;
+        - define the maximum notional of open orders of one instrument;
+        - define how far an order price may be through the opposite best
+          price (price band), in ticks or basis points.
 
     A zero limit means that the corresponding limit is disabled.
 
@@ -40,13 +43,24 @@ Description : risk_limits.hpp
 #include "price.hpp"
 #include "quantity.hpp"
 
+#include <cstdint>
+
 namespace trading::risk
 {
+    enum class PriceBandUnit : uint8_t
+    {
+        Ticks,
+        BasisPoints
+    };
+
     struct RiskLimits
     {
         Quantity maxOrderQuantity {};
         Quantity maxPositionQuantity {};
         Price maxNotional {};
+        Price maxOpenNotional {};
+        int64_t priceBand { 0 };
+        PriceBandUnit priceBandUnit { PriceBandUnit::BasisPoints };
     };
 }
 
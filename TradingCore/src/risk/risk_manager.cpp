@@ -36,13 +36,15 @@ Description : risk_manager.cpp
     The position used for validation is the position immediately before the
     order is executed.
 
-    RiskManager does not reserve risk or modify the position. Actual position
-    changes happen later when ExecutionReport events are processed.
+    Orders accepted by OrderManager are reserved as pending exposure until
+    execution reports fill or end them; checkOrder() adds the pending orders
+    of the requested side to the position. RiskManager does not modify the
+    position: actual position changes happen when ExecutionReport events are
+    processed.
 */
 
 #include "risk_manager.hpp"
-
-#include <algorithm>
+#include "reference_prices.hpp"
 
 namespace trading::risk
 {
@@ -62,12 +64,28 @@ namespace trading::risk
             const WideValue quantity = static_cast<WideValue>(request.quantity.raw());
             return request.side == trading::Side::Buy ? quantity : -quantity;
         }
-    }
 
-    RiskManager::RiskManager() noexcept = default;
+        constexpr int64_t BasisPointsPerUnit { 10'000 };
+
+        // value * basisPoints / 10'000 without a 128-bit division, exact for any price.
+        [[nodiscard]]
+        constexpr int64_t basisPointsOf(const int64_t value, const int64_t basisPoints) noexcept
+        {
+            const int64_t whole = value / BasisPointsPerUnit;
+            const int64_t rest = value % BasisPointsPerUnit;
+            return whole * basisPoints + rest * basisPoints / BasisPointsPerUnit;
+        }
 
-    RiskManager::RiskManager(const RiskLimits& limits) noexcept :
-        limits { limits }
+        [[nodiscard]]
+        constexpr WideValue notionalProduct(const Price price, const Quantity quantity) noexcept
+        {
+            return static_cast<WideValue>(price.raw()) * static_cast<WideValue>(quantity.raw());
+        }
+    }
+
+    RiskManager::RiskManager(const RiskLimits& limits, const std::span<const Instrument> instruments) :
+        limits { limits },
+        pending(instrumentTableSize(instruments))
     {
     }
 
@@ -77,6 +95,16 @@ namespace trading::risk
         reason = RiskReason::None;
     }
 
+    const RiskLimits& RiskManager::activeLimits() const noexcept
+    {
+        return limits;
+    }
+
+    void RiskManager::setReferencePrices(const ReferencePrices& prices) noexcept
+    {
+        referencePrices = &prices;
+    }
+
     RiskResult RiskManager::checkOrder(const execution::OrderRequest& request,
                                        const position::Position& position)
     {
@@ -88,8 +116,13 @@ namespace trading::risk
             return RiskResult::Rejected;
         }
 
+        const Pending& open = pendingOf(request.instrument);
+        const WideValue pendingDelta = request.side == trading::Side::Buy
+            ? static_cast<WideValue>(open.buyQuantity)
+            : -static_cast<WideValue>(open.sellQuantity);
+
         const WideValue currentPosition = static_cast<WideValue>(position.quantity());
-        const WideValue resultingPosition = currentPosition + positionDelta(request);
+        const WideValue resultingPosition = currentPosition + pendingDelta + positionDelta(request);
 
         if (!limits.maxPositionQuantity.isZero())
         {
@@ -114,11 +147,105 @@ namespace trading::risk
             }
         }
 
+        if (!limits.maxOpenNotional.isZero())
+        {
+            const WideValue openNotional = open.buyNotional + open.sellNotional +
+                                           notionalProduct(request.price, request.quantity);
+            const WideValue maximum = static_cast<WideValue>(limits.maxOpenNotional.raw()) * trading::Price::Scale;
+
+            if (absolute(openNotional) > maximum)
+            {
+                reason = RiskReason::MaxOpenNotional;
+                return RiskResult::Rejected;
+            }
+        }
+
+        if (limits.priceBand != 0)
+        {
+            reason = checkPriceBand(request);
+            if (reason != RiskReason::None)
+                return RiskResult::Rejected;
+        }
+
         return RiskResult::Accepted;
     }
 
+    RiskReason RiskManager::checkPriceBand(const execution::OrderRequest& request) const noexcept
+    {
+        if (referencePrices == nullptr)
+            return RiskReason::NoReferencePrice;
+
+        const ReferencePrice reference = referencePrices->reference(request.instrument);
+        if (!reference.isValid())
+            return RiskReason::NoReferencePrice;
+
+        const bool buy = request.side == trading::Side::Buy;
+        const Price::Value best = buy ? reference.ask.raw() : reference.bid.raw();
+        const Price::Value band = limits.priceBandUnit == PriceBandUnit::Ticks
+            ? limits.priceBand * reference.tickSize.raw()
+            : basisPointsOf(best, limits.priceBand);
+
+        const Price::Value price = request.price.raw();
+        const bool inside = buy ? price - best <= band : best - price <= band;
+
+        return inside ? RiskReason::None : RiskReason::PriceBand;
+    }
+
     RiskReason RiskManager::lastReason() const noexcept
     {
         return reason;
     }
+
+    void RiskManager::reserve(const execution::Order& order) noexcept
+    {
+        if (order.instrument >= pending.size())
+            return;
+
+        Pending& open = pending[order.instrument];
+        if (order.side == trading::Side::Buy)
+        {
+            open.buyQuantity += order.quantity.raw();
+            open.buyNotional += notionalProduct(order.price, order.quantity);
+        }
+        else
+        {
+            open.sellQuantity += order.quantity.raw();
+            open.sellNotional += notionalProduct(order.price, order.quantity);
+        }
+    }
+
+    void RiskManager::release(const execution::Order& order, const Quantity quantity) noexcept
+    {
+        if (order.instrument >= pending.size())
+            return;
+
+        Pending& open = pending[order.instrument];
+        if (order.side == trading::Side::Buy)
+        {
+            open.buyQuantity -= quantity.raw();
+            open.buyNotional -= notionalProduct(order.price, quantity);
+        }
+        else
+        {
+            open.sellQuantity -= quantity.raw();
+            open.sellNotional -= notionalProduct(order.price, quantity);
+        }
+    }
+
+    PendingExposure RiskManager::pendingExposure(const InstrumentId instrument) const noexcept
+    {
+        const Pending& open = pendingOf(instrument);
+        return PendingExposure {
+            .buyQuantity = Quantity { open.buyQuantity },
+            .sellQuantity = Quantity { open.sellQuantity },
+            .buyNotional = Price { static_cast<int64_t>(open.buyNotional / trading::Price::Scale) },
+            .sellNotional = Price { static_cast<int64_t>(open.sellNotional / trading::Price::Scale) }
+        };
+    }
+
+    const RiskManager::Pending& RiskManager::pendingOf(const InstrumentId instrument) const noexcept
+    {
+        static constexpr Pending None {};
+        return instrument < pending.size() ? pending[instrument] : None;
+    }
 }
\ No newline at end of file
@@ -41,12 +41,55 @@ Description : risk_manager.hpp
     Position is supplied by PositionManager and represents the current
     position before the requested order is executed.
 
+    Open-order reservation:
+
+        Orders that were sent but are not filled yet are not part of
+        Position. Without them a burst of signals passes the position check
+        again and again before the first fill arrives. RiskManager therefore
+        keeps the pending (unfilled) buy and sell quantity and notional of
+        every instrument:
+
+            OrderManager::acceptOrder()     reserve(order)
+            ExecutionReport (Trade)         release(order, filled quantity)
+                                            -> the fill moves into Position
+            Filled / Cancelled / Rejected   release(order, remaining quantity)
+
+        checkOrder() treats every pending order on the side of the request
+        as filled: a buy is checked against position + pending buys + the
+        order, a sell against position - pending sells - the order. The
+        aggregates are kept incrementally in a table indexed by
+        InstrumentId, so a check is O(1) whatever the number of open orders.
+        The table is sized once in the constructor by instrumentTableSize()
+        of the traded instruments, so reserve() never allocates on the
+        trading thread. Orders of instruments outside the table are not
+        reserved (OrderStore does not track them either).
+        Notional is released at the order price it was reserved at, so the
+        aggregates return to exactly zero when all orders are done.
+
+    Price band:
+
+        With RiskLimits::priceBand set, a buy may be priced at most the band
+        above the best ask and a sell at most the band below the best bid.
+        The best prices come from ReferencePrices, which the market-data
+        thread updates through a per-instrument seqlock; the check reads
+        them without locks and compares raw fixed-point prices:
+
+            ticks         band = priceBand * tickSize
+            basis points  band = best * priceBand / 10'000
+
+        Without a reference price (no ReferencePrices attached, unknown
+        instrument, or no two-sided book yet) the order is rejected with
+        NoReferencePrice.
+
     Responsibilities:
 
         - validate a requested order;
         - validate maximum order quantity;
         - validate maximum resulting position;
         - validate maximum order notional;
+        - validate maximum notional of the open orders of an instrument;
+        - validate the order price against the live top of book;
+        - keep pending quantity and notional of open orders;
         - expose the reason for the most recent rejection.
 
     RiskManager does not:
@@ -54,6 +97,7 @@ Description : risk_manager.hpp
         - send or cancel orders;
         - modify Position;
         - modify Order;
+        - decide when an order is filled or done (OrderManager reports it);
         - communicate with an exchange;
         - calculate PnL.
 
@@ -64,13 +108,22 @@ Description : risk_manager.hpp
 #ifndef FINANCETECHNOLOGYPROJECTS_RISK_MANAGER_HPP
 #define FINANCETECHNOLOGYPROJECTS_RISK_MANAGER_HPP
 
+#include "instrument.hpp"
+#include "instrument_slots.hpp"
 #include "order.hpp"
 #include "position.hpp"
 #include "risk.hpp"
 #include "risk_limits.hpp"
 
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace trading::risk
 {
+    class ReferencePrices;
+
     struct IRiskManager
     {
         virtual ~IRiskManager() = default;
@@ -81,17 +134,55 @@ namespace trading::risk
 
         [[nodiscard]]
         virtual RiskReason lastReason() const noexcept = 0;
+
+        // An accepted order entered the market: its quantity is pending.
+        virtual void reserve([[maybe_unused]] const execution::Order& order) noexcept
+        {
+        }
+
+        // 'quantity' of the order is no longer pending (filled or done).
+        virtual void release([[maybe_unused]] const execution::Order& order,
+                             [[maybe_unused]] Quantity quantity) noexcept
+        {
+        }
+    };
+
+    // Static counterpart of IRiskManager for compile-time wiring.
+    template<typename Risk>
+    concept PreTradeRisk = requires(Risk& risk,
+                                    const execution::OrderRequest& request,
+                                    const position::Position& position,
+                                    const execution::Order& order,
+                                    Quantity quantity)
+    {
+        { risk.checkOrder(request, position) } -> std::same_as<RiskResult>;
+        { risk.reserve(order) } noexcept;
+        { risk.release(order, quantity) } noexcept;
     };
 
 
+    struct PendingExposure
+    {
+        Quantity buyQuantity {};
+        Quantity sellQuantity {};
+        Price buyNotional {};
+        Price sellNotional {};
+    };
+
     class RiskManager final : public IRiskManager
     {
     public:
-        RiskManager() noexcept;
-        explicit RiskManager(const RiskLimits& limits) noexcept;
+        // 'instruments' sizes the pending-exposure table, see above.
+        explicit RiskManager(const RiskLimits& limits = {}, std::span<const Instrument> instruments = {});
 
         void setLimits(const RiskLimits& newLimits) noexcept;
 
+        [[nodiscard]]
+        const RiskLimits& activeLimits() const noexcept;
+
+        // Source of the price-band reference prices, must outlive RiskManager.
+        void setReferencePrices(const ReferencePrices& prices) noexcept;
+
         [[nodiscard]]
         RiskResult checkOrder(const execution::OrderRequest& request,
                               const position::Position& position) override;
@@ -99,9 +190,35 @@ namespace trading::risk
         [[nodiscard]]
         RiskReason lastReason() const noexcept override;
 
+        void reserve(const execution::Order& order) noexcept override;
+
+        void release(const execution::Order& order, Quantity quantity) noexcept override;
+
+        [[nodiscard]]
+        PendingExposure pendingExposure(InstrumentId instrument) const noexcept;
+
     private:
+        using WideValue = __int128_t;
+
+        // Notional is kept as the unscaled price * quantity product.
+        struct Pending
+        {
+            int64_t buyQuantity { 0 };
+            int64_t sellQuantity { 0 };
+            WideValue buyNotional { 0 };
+            WideValue sellNotional { 0 };
+        };
+
+        [[nodiscard]]
+        const Pending& pendingOf(InstrumentId instrument) const noexcept;
+
+        [[nodiscard]]
+        RiskReason checkPriceBand(const execution::OrderRequest& request) const noexcept;
+
         RiskLimits limits {};
         RiskReason reason { RiskReason::None };
+        std::vector<Pending> pending;
+        const ReferencePrices* referencePrices { nullptr };
     };
 }
 
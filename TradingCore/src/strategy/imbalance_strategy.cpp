@@ -96,6 +96,26 @@ namespace trading::strategy
     {
     }
 
+    bool ImbalanceStrategy::setThreshold(const Value numerator, const Value denominator) noexcept
+    {
+        if (denominator <= 0 || numerator < 0)
+            return false;
+
+        thresholdNumerator = numerator;
+        thresholdDenominator = denominator;
+        return true;
+    }
+
+    ImbalanceStrategy::Value ImbalanceStrategy::activeThresholdNumerator() const noexcept
+    {
+        return thresholdNumerator;
+    }
+
+    ImbalanceStrategy::Value ImbalanceStrategy::activeThresholdDenominator() const noexcept
+    {
+        return thresholdDenominator;
+    }
+
     Signal ImbalanceStrategy::evaluate(const market_data::MarketEvent& event) const
     {
         using BigInt = __int128;
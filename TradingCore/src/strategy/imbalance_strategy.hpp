@@ -107,6 +107,16 @@ namespace trading::strategy
         [[nodiscard]]
         Signal evaluate(const market_data::MarketEvent& event) const override;
 
+        // Returns false and keeps the current threshold if the new one is not valid.
+        [[nodiscard]]
+        bool setThreshold(Value numerator, Value denominator) noexcept;
+
+        [[nodiscard]]
+        Value activeThresholdNumerator() const noexcept;
+
+        [[nodiscard]]
+        Value activeThresholdDenominator() const noexcept;
+
     private:
         Value thresholdNumerator;
         Value thresholdDenominator;
@@ -93,6 +93,8 @@ Description : Trading strategy interface.
 #include "signal.hpp"
 #include "model/market_event.hpp"
 
+#include <concepts>
+
 namespace trading::strategy
 {
     struct IStrategy
@@ -102,6 +104,13 @@ namespace trading::strategy
         [[nodiscard]]
         virtual Signal evaluate(const market_data::MarketEvent& event) const = 0;
     };
+
+    // Static counterpart of IStrategy for compile-time wiring.
+    template<typename Strategy>
+    concept SignalGenerator = requires(const Strategy& strategy, const market_data::MarketEvent& event)
+    {
+        { strategy.evaluate(event) } -> std::same_as<Signal>;
+    };
 }
 
 #endif //FINANCETECHNOLOGYPROJECTS_STRATEGY_HPP
\ No newline at end of file
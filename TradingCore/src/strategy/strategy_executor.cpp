@@ -68,21 +68,11 @@ namespace trading::strategy
     StrategyExecutionResult StrategyExecutor::execute(const Signal signal,
                                                       const market_data::MarketEvent& event) const
     {
-        if (signal == Signal::None)
+        const std::optional<OrderRequest> request = makeOrderRequest(signal, event, orderQuantity);
+        if (!request)
             return std::optional<OrderId> {};
 
-        const Side side = signal == Signal::Buy ? Side::Buy : Side::Sell;
-        const Price price = signal == Signal::Buy ? event.bestAsk : event.bestBid;
-
-        const OrderRequest request {
-            .instrument = event.instrument,
-            .side = side,
-            .type = OrderType::Limit,
-            .price = price,
-            .quantity = orderQuantity
-        };
-
-        const execution::OrderCreationResult result = orderManager.createOrder(request);
+        const execution::OrderCreationResult result = orderManager.createOrder(*request);
         if (!result)
             return std::unexpected(result.error());
 
@@ -87,6 +87,31 @@ namespace trading::strategy
 {
     using StrategyExecutionResult = std::expected<std::optional<OrderId>, execution::OrderCreationError>;
 
+    /*
+        OrderRequest for a Signal, std::nullopt for Signal::None. Shared by
+        StrategyExecutor and the statically wired trading path. The request
+        carries the trace of 'event', stamped StrategyDecided.
+    */
+    [[nodiscard]]
+    inline std::optional<execution::OrderRequest> makeOrderRequest(const Signal signal,
+                                                                   const market_data::MarketEvent& event,
+                                                                   const Quantity orderQuantity) noexcept
+    {
+        if (signal == Signal::None)
+            return std::nullopt;
+
+        execution::OrderRequest request {
+            .instrument = event.instrument,
+            .side = signal == Signal::Buy ? Side::Buy : Side::Sell,
+            .type = OrderType::Limit,
+            .price = signal == Signal::Buy ? event.bestAsk : event.bestBid,
+            .quantity = orderQuantity,
+            .trace = event.trace
+        };
+        request.trace.stamp(trace::Stage::StrategyDecided);
+        return request;
+    }
+
     class StrategyExecutor final
     {
     public:
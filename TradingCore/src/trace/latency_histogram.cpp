@@ -0,0 +1,75 @@
+/**============================================================================
+Name        : latency_histogram.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Log-linear latency histogram with tail percentiles.
+============================================================================**/
+
+/*
+    Percentile of N values:
+
+        rank = ceil(quantile * N), at least 1
+           |
+           v
+        walk the buckets, adding their counts, until the sum reaches rank
+           |
+           v
+        min(upper bound of that bucket, max)
+
+    p99.9 needs at least 1000 values to differ from max(); with fewer it
+    reports the largest value, which is the honest answer.
+*/
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace trading::trace
+{
+    uint64_t LatencyHistogram::valueAt(const double quantile) const noexcept
+    {
+        if (total == 0)
+            return 0;
+
+        const double clamped = std::clamp(quantile, 0.0, 1.0);
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(total))));
+
+        uint64_t seen { 0 };
+        for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+        {
+            seen += counts[bucket];
+            if (seen >= rank)
+                return std::min(upperBoundOf(bucket), largest);
+        }
+        return largest;
+    }
+
+    LatencySummary LatencyHistogram::summary() const noexcept
+    {
+        return LatencySummary {
+            .count = total,
+            .p50 = valueAt(0.50),
+            .p99 = valueAt(0.99),
+            .p999 = valueAt(0.999),
+            .max = largest
+        };
+    }
+
+    void LatencyHistogram::merge(const LatencyHistogram& other) noexcept
+    {
+        for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            counts[bucket] += other.counts[bucket];
+        total += other.total;
+        largest = std::max(largest, other.largest);
+    }
+
+    void LatencyHistogram::reset() noexcept
+    {
+        counts.fill(0);
+        total = 0;
+        largest = 0;
+    }
+}
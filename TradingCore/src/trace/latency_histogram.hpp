@@ -0,0 +1,118 @@
+/**============================================================================
+Name        : latency_histogram.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Log-linear latency histogram with tail percentiles.
+============================================================================**/
+
+/*
+    LatencyHistogram counts nanosecond latencies in log-linear buckets, the
+    layout of an HDR histogram: every power of two is split into SubBuckets
+    equal buckets, so a value is known within 1/SubBuckets (about 3%) from
+    one nanosecond up to the full uint64_t range.
+
+    Buckets:
+
+        value < SubBuckets            one bucket per nanosecond
+        2^k <= value < 2^(k+1)        SubBuckets buckets, 2^(k-5) ns wide
+
+        index = (k - 4) * SubBuckets + (value >> (k - 5)) - SubBuckets
+
+    record() is O(1) and never allocates; the counts are a fixed array.
+    Percentiles walk the buckets and report the upper bound of the bucket
+    that holds the rank, capped at the largest recorded value, so they never
+    understate a latency. max() is exact.
+
+    LatencyHistogram does not:
+
+        - synchronize: one thread records and reads it (TraceCollector);
+        - keep the individual values.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_LATENCY_HISTOGRAM_HPP
+#define FINANCETECHNOLOGYPROJECTS_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace trading::trace
+{
+    struct LatencySummary
+    {
+        uint64_t count { 0 };
+        uint64_t p50 { 0 };
+        uint64_t p99 { 0 };
+        uint64_t p999 { 0 };
+        uint64_t max { 0 };
+    };
+
+    class LatencyHistogram
+    {
+    public:
+        static constexpr unsigned SubBucketBits { 5 };
+        static constexpr uint64_t SubBuckets { uint64_t { 1 } << SubBucketBits };
+        static constexpr std::size_t BucketCount { (64 - SubBucketBits + 1) * SubBuckets };
+
+        void record(const uint64_t nanoseconds) noexcept
+        {
+            ++counts[bucketOf(nanoseconds)];
+            ++total;
+            if (nanoseconds > largest)
+                largest = nanoseconds;
+        }
+
+        // Upper bound of the bucket holding 'quantile' (0..1) of the values; 0 if empty.
+        [[nodiscard]]
+        uint64_t valueAt(double quantile) const noexcept;
+
+        [[nodiscard]]
+        LatencySummary summary() const noexcept;
+
+        void merge(const LatencyHistogram& other) noexcept;
+        void reset() noexcept;
+
+        [[nodiscard]]
+        uint64_t count() const noexcept {
+            return total;
+        }
+
+        [[nodiscard]]
+        uint64_t max() const noexcept {
+            return largest;
+        }
+
+        [[nodiscard]]
+        static constexpr std::size_t bucketOf(const uint64_t value) noexcept
+        {
+            if (value < SubBuckets)
+                return static_cast<std::size_t>(value);
+
+            const unsigned magnitude = static_cast<unsigned>(std::bit_width(value)) - 1;
+            const unsigned shift = magnitude - SubBucketBits;
+            return static_cast<std::size_t>((shift + 1) * SubBuckets + (value >> shift) - SubBuckets);
+        }
+
+        // Largest value that falls into 'bucket'.
+        [[nodiscard]]
+        static constexpr uint64_t upperBoundOf(const std::size_t bucket) noexcept
+        {
+            if (bucket < SubBuckets)
+                return bucket;
+
+            const uint64_t group = bucket / SubBuckets;
+            const uint64_t lower = (SubBuckets + bucket % SubBuckets) << (group - 1);
+            return lower + ((uint64_t { 1 } << (group - 1)) - 1);
+        }
+
+    private:
+        std::array<uint64_t, BucketCount> counts {};
+        uint64_t total { 0 };
+        uint64_t largest { 0 };
+    };
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_LATENCY_HISTOGRAM_HPP
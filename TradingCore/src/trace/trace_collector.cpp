@@ -0,0 +1,225 @@
+/**============================================================================
+Name        : trace_collector.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Per-thread trace buffers and per-stage latency histograms.
+============================================================================**/
+
+/*
+    commit() on a hot thread:
+
+        thread_local BufferHandle (claims on first use, retries while none is free)
+           |
+           | tryPush(stamps), a full buffer counts a drop
+           v
+        TraceBuffer
+
+    Every buffer has a state:
+
+        Free ---- claimBuffer() ----> Claimed ---- releaseBuffer() ----> Released
+          ^       (compare-and-swap)              (thread exit)             |
+          |                                                                 |
+          +---------------- collect(): drained after the release -----------+
+
+    collect() reads the state before draining: a buffer seen Released has
+    no producer any more, so once it is drained it goes back to Free. The
+    release and acquire on the state carry the last pushes and the drop
+    counter from the exiting thread to collect() and on to the next owner.
+
+    The mutex guards the histograms and the trace count: collect(),
+    record(), stage(), tickToTrade(), statistics() and reset() take it,
+    committing threads never do.
+
+    The drop counter of a buffer has a single writer (the producer thread)
+    and is updated with relaxed load + store, statistics() reads it from
+    any thread. 'unbuffered' has many writers and uses fetch_add.
+*/
+
+#include "trace_collector.hpp"
+
+namespace trading::trace
+{
+    namespace
+    {
+        void increase(std::atomic<uint64_t>& counter, const uint64_t value) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        bool isStamped(const Timestamp stamp) noexcept
+        {
+            return stamp != Timestamp {};
+        }
+    }
+
+    void TraceBuffer::push(const TraceStamps& stamps) noexcept
+    {
+        if (!queue.tryPush(stamps))
+            increase(droppedCount, 1);
+    }
+
+    uint64_t TraceBuffer::dropped() const noexcept
+    {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    TraceCollector::TraceCollector():
+        buffers { std::make_unique<TraceBuffer[]>(MaxBuffers) }
+    {
+    }
+
+    TraceBuffer* TraceCollector::claimBuffer() noexcept
+    {
+        for (std::size_t index { 0 }; index < MaxBuffers; ++index)
+        {
+            BufferState expected { BufferState::Free };
+            if (states[index].compare_exchange_strong(expected, BufferState::Claimed,
+                                                      std::memory_order_acq_rel, std::memory_order_relaxed))
+                return &buffers[index];
+        }
+        return nullptr;
+    }
+
+    void TraceCollector::releaseBuffer(TraceBuffer* const buffer) noexcept
+    {
+        const std::size_t index = static_cast<std::size_t>(buffer - buffers.get());
+        states[index].store(BufferState::Released, std::memory_order_release);
+    }
+
+    void TraceCollector::dropUnbuffered() noexcept
+    {
+        unbuffered.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t TraceCollector::collect()
+    {
+        const std::lock_guard lock { mutex };
+
+        std::size_t collected { 0 };
+        for (std::size_t index { 0 }; index < MaxBuffers; ++index)
+        {
+            const BufferState state = states[index].load(std::memory_order_acquire);
+            if (state == BufferState::Free)
+                continue;
+
+            collected += buffers[index].drain([this](const TraceStamps& stamps) { accumulate(stamps); });
+            if (state == BufferState::Released)
+                states[index].store(BufferState::Free, std::memory_order_release);
+        }
+        return collected;
+    }
+
+    void TraceCollector::record(const TraceStamps& stamps)
+    {
+        const std::lock_guard lock { mutex };
+        accumulate(stamps);
+    }
+
+    void TraceCollector::accumulate(const TraceStamps& stamps) noexcept
+    {
+        for (std::size_t index = 1; index < StageCount; ++index)
+        {
+            const Timestamp previous = stamps[index - 1];
+            const Timestamp current = stamps[index];
+            if (isStamped(previous) && isStamped(current) && current >= previous)
+                stages[index].record(current - previous);
+        }
+
+        const Timestamp first = stamps[indexOf(Stage::SocketRead)];
+        const Timestamp last = stamps[indexOf(Stage::GatewaySend)];
+        if (isStamped(first) && isStamped(last) && last >= first)
+            total.record(last - first);
+
+        ++traces;
+    }
+
+    LatencyHistogram TraceCollector::stage(const Stage stage) const
+    {
+        const std::lock_guard lock { mutex };
+        return stages[indexOf(stage)];
+    }
+
+    LatencyHistogram TraceCollector::tickToTrade() const
+    {
+        const std::lock_guard lock { mutex };
+        return total;
+    }
+
+    TraceStatistics TraceCollector::statistics() const
+    {
+        const std::lock_guard lock { mutex };
+
+        TraceStatistics statistics {
+            .traces = traces,
+            .dropped = unbuffered.load(std::memory_order_relaxed),
+            .buffers = 0
+        };
+        for (std::size_t index { 0 }; index < MaxBuffers; ++index)
+        {
+            // The drop counter stays with the buffer across owners.
+            statistics.dropped += buffers[index].dropped();
+            if (states[index].load(std::memory_order_acquire) != BufferState::Free)
+                ++statistics.buffers;
+        }
+        return statistics;
+    }
+
+    void TraceCollector::reset()
+    {
+        const std::lock_guard lock { mutex };
+
+        for (LatencyHistogram& histogram : stages)
+            histogram.reset();
+        total.reset();
+        traces = 0;
+    }
+
+    TraceCollector& collector() noexcept
+    {
+        static TraceCollector instance;
+        return instance;
+    }
+
+    namespace
+    {
+        // The buffer of one committing thread, released when the thread exits.
+        class BufferHandle
+        {
+        public:
+            BufferHandle() = default;
+
+            BufferHandle(const BufferHandle&) = delete;
+            BufferHandle& operator=(const BufferHandle&) = delete;
+
+            ~BufferHandle()
+            {
+                if (buffer != nullptr)
+                    collector().releaseBuffer(buffer);
+            }
+
+            // nullptr while every buffer is claimed; claims again on the next call.
+            [[nodiscard]]
+            TraceBuffer* get() noexcept
+            {
+                if (buffer == nullptr)
+                    buffer = collector().claimBuffer();
+                return buffer;
+            }
+
+        private:
+            TraceBuffer* buffer { nullptr };
+        };
+    }
+
+    void commit(const TraceStamps& stamps) noexcept
+    {
+        thread_local BufferHandle handle;
+        if (TraceBuffer* const buffer = handle.get(); buffer != nullptr)
+            buffer->push(stamps);
+        else
+            collector().dropUnbuffered();
+    }
+}
@@ -0,0 +1,182 @@
+/**============================================================================
+Name        : trace_collector.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Per-thread trace buffers and per-stage latency histograms.
+============================================================================**/
+
+/*
+    TraceCollector turns completed traces into per-stage latency
+    histograms.
+
+    Data Flow:
+
+        hot thread A          hot thread B
+             |                     |
+             | trace::finish()     | trace::finish()
+             v                     v
+        TraceBuffer A         TraceBuffer B      thread_local, SPSC, no locks
+             |                     |
+             +----------+----------+
+                        |
+                        | collect()              monitoring thread
+                        v
+        stage histograms:  Parsed       SocketRead      -> Parsed
+                           BookApplied  Parsed          -> BookApplied
+                           ...
+                           GatewaySend  RiskPassed      -> GatewaySend
+        tick-to-trade:                  SocketRead      -> GatewaySend
+
+    Buffers:
+
+        The collector allocates MaxBuffers TraceBuffers when it is
+        constructed. The first commit() of a thread claims a free one with
+        a compare-and-swap, so a hot thread never locks or allocates; owners
+        construct collector() before their hot threads start. The collector
+        owns the buffers, so a thread may exit while its traces are still
+        queued: the exiting thread releases its buffer, and the next
+        collect() drains it and makes it free for another thread. Threads
+        that come and go (Pipeline restarts, tests, benchmarks) therefore
+        do not use up the buffers. A full buffer drops the trace and counts
+        it, and so does commit() on a thread that found every buffer
+        claimed; such a thread tries to claim one again on its next commit.
+
+    Stages:
+
+        stage(s) holds the latency from the stage before s to s, for traces
+        that stamped both. stage(SocketRead) stays empty. tickToTrade()
+        needs both SocketRead and GatewaySend.
+
+        The histograms are written by collect() on the monitoring thread, so
+        stage() and tickToTrade() return copies taken under the mutex
+        rather than references that a concurrent collect() would change.
+
+    TraceCollector does not:
+
+        - report or print anything: callers read summary() of the
+          histograms they need;
+        - run a thread: collect() is called by its owner, e.g. once per
+          second next to TscClock::recalibrate().
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_TRACE_COLLECTOR_HPP
+#define FINANCETECHNOLOGYPROJECTS_TRACE_COLLECTOR_HPP
+
+#include "latency_histogram.hpp"
+#include "spsc_queue.hpp"
+#include "trace_context.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace trading::trace
+{
+    struct TraceStatistics
+    {
+        uint64_t traces { 0 };
+        uint64_t dropped { 0 };
+        std::size_t buffers { 0 };
+    };
+
+    class TraceBuffer
+    {
+    public:
+        static constexpr std::size_t Capacity { 4096 };
+
+        // Producer side: one thread.
+        void push(const TraceStamps& stamps) noexcept;
+
+        // Consumer side: hands every queued trace to consumer(const TraceStamps&).
+        template<typename Consumer>
+        std::size_t drain(Consumer&& consumer)
+        {
+            std::size_t count { 0 };
+            for (const TraceStamps* stamps = queue.front(); stamps != nullptr; stamps = queue.front())
+            {
+                consumer(*stamps);
+                queue.pop();
+                ++count;
+            }
+            return count;
+        }
+
+        [[nodiscard]]
+        uint64_t dropped() const noexcept;
+
+    private:
+        SpscQueue<TraceStamps, Capacity> queue;
+        std::atomic<uint64_t> droppedCount { 0 };
+    };
+
+    class TraceCollector
+    {
+    public:
+        static constexpr std::size_t MaxBuffers { 8 };
+
+        TraceCollector();
+
+        TraceCollector(const TraceCollector&) = delete;
+        TraceCollector& operator=(const TraceCollector&) = delete;
+
+        // A buffer for one producer thread, or nullptr when all MaxBuffers are claimed.
+        [[nodiscard]]
+        TraceBuffer* claimBuffer() noexcept;
+
+        // The producer is done with 'buffer'; it is free again once collect() has drained it.
+        void releaseBuffer(TraceBuffer* buffer) noexcept;
+
+        // Counts a trace of a thread without a buffer as dropped. Any thread.
+        void dropUnbuffered() noexcept;
+
+        // Moves the queued traces of all buffers into the histograms. One consumer thread.
+        std::size_t collect();
+
+        void record(const TraceStamps& stamps);
+
+        // Latency from the previous stage to 'stage', copied under the mutex.
+        [[nodiscard]]
+        LatencyHistogram stage(Stage stage) const;
+
+        [[nodiscard]]
+        LatencyHistogram tickToTrade() const;
+
+        [[nodiscard]]
+        TraceStatistics statistics() const;
+
+        // Clears the histograms; queued traces stay queued.
+        void reset();
+
+    private:
+        enum class BufferState : uint8_t
+        {
+            Free,
+            Claimed,
+            Released
+        };
+
+        // Adds one trace to the histograms; the caller holds the mutex.
+        void accumulate(const TraceStamps& stamps) noexcept;
+
+        // Serializes the consumer side: the histograms and the trace count.
+        mutable std::mutex mutex;
+        std::unique_ptr<TraceBuffer[]> buffers;
+        std::array<std::atomic<BufferState>, MaxBuffers> states {};
+        std::atomic<uint64_t> unbuffered { 0 };
+
+        std::array<LatencyHistogram, StageCount> stages {};
+        LatencyHistogram total {};
+        uint64_t traces { 0 };
+    };
+
+    // The collector fed by commit().
+    [[nodiscard]]
+    TraceCollector& collector() noexcept;
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_TRACE_COLLECTOR_HPP
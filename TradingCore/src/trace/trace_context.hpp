@@ -0,0 +1,135 @@
+/**============================================================================
+Name        : trace_context.hpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tick-to-trade trace stamps carried by the hot-path messages.
+============================================================================**/
+
+/*
+    TraceContext records when one market data message passed each stage of
+    the tick-to-trade path. It travels by value inside the messages of the
+    path, so no stage looks anything up to find it.
+
+    Data Flow:
+
+        MarketDataMessageHandler       SocketRead, Parsed
+               |
+               | BookUpdate::trace
+               v
+        makeMarketEvent()              BookApplied
+               |
+               | MarketEvent::trace
+               v
+        makeOrderRequest()             StrategyDecided
+               |
+               | OrderRequest::trace
+               v
+        OrderManager::acceptOrder()    RiskPassed
+               |
+               | Order::trace
+               v
+        trace::finish()                GatewaySend, commit to the buffer
+                                       of the calling thread (TraceCollector)
+
+    Build flag:
+
+        Tracing is compiled in with TRADING_CORE_TRACING. Without it
+        TraceContext is an empty class: the members that hold it are
+        [[no_unique_address]], stamp() and finish() are empty inline
+        functions, and no message changes size or layout.
+
+    Stamps:
+
+        Stamps are Timestamp::nowFast() values; a stage that was not passed
+        keeps a zero stamp. Events of a snapshot or of a replayed journal
+        start at BookApplied.
+
+    TraceContext does not:
+
+        - aggregate anything (see TraceCollector);
+        - travel through the journal: journaled events drop it.
+*/
+
+#ifndef FINANCETECHNOLOGYPROJECTS_TRACE_CONTEXT_HPP
+#define FINANCETECHNOLOGYPROJECTS_TRACE_CONTEXT_HPP
+
+#include "timestamp.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace trading::trace
+{
+#if defined(TRADING_CORE_TRACING)
+    inline constexpr bool TracingEnabled { true };
+#else
+    inline constexpr bool TracingEnabled { false };
+#endif
+
+    enum class Stage : uint8_t
+    {
+        SocketRead,
+        Parsed,
+        BookApplied,
+        StrategyDecided,
+        RiskPassed,
+        GatewaySend
+    };
+
+    inline constexpr std::size_t StageCount { 6 };
+
+    [[nodiscard]]
+    constexpr std::size_t indexOf(const Stage stage) noexcept
+    {
+        return static_cast<std::size_t>(stage);
+    }
+
+    // One completed trace, indexed by Stage.
+    using TraceStamps = std::array<Timestamp, StageCount>;
+
+    class TraceContext
+    {
+    public:
+        void stamp([[maybe_unused]] const Stage stage) noexcept
+        {
+#if defined(TRADING_CORE_TRACING)
+            values[indexOf(stage)] = Timestamp::nowFast();
+#endif
+        }
+
+        // Zero stamps without TRADING_CORE_TRACING.
+        [[nodiscard]]
+        TraceStamps stamps() const noexcept
+        {
+#if defined(TRADING_CORE_TRACING)
+            return values;
+#else
+            return TraceStamps {};
+#endif
+        }
+
+#if defined(TRADING_CORE_TRACING)
+    private:
+        TraceStamps values {};
+#endif
+    };
+
+    // Defined in trace_collector.cpp: queues 'stamps' in the buffer of the calling thread.
+    void commit(const TraceStamps& stamps) noexcept;
+
+    // Stamps GatewaySend on a copy of 'context' and commits the trace.
+    inline void finish([[maybe_unused]] const TraceContext& context) noexcept
+    {
+        if constexpr (TracingEnabled)
+        {
+            TraceContext completed = context;
+            completed.stamp(Stage::GatewaySend);
+            commit(completed.stamps());
+        }
+    }
+}
+
+#endif //FINANCETECHNOLOGYPROJECTS_TRACE_CONTEXT_HPP
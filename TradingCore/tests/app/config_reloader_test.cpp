@@ -0,0 +1,238 @@
+/**============================================================================
+Name        : config_reloader_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : ConfigChannel and ConfigReloader unit tests.
+============================================================================**/
+
+#include "config_reloader.hpp"
+#include "test_support/testing.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    using testing::Assert;
+
+    using trading::InstrumentId;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Side;
+    using trading::Timestamp;
+
+    using trading::app::ConfigReloader;
+    using trading::config::Config;
+    using trading::config::RiskLimitsConfig;
+    using trading::config::ConfigChannel;
+    using trading::execution::OrderRequest;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::position::Position;
+    using trading::risk::RiskLimits;
+    using trading::risk::RiskManager;
+    using trading::risk::RiskResult;
+    using trading::strategy::ImbalanceStrategy;
+    using trading::strategy::Signal;
+
+    constexpr OrderRequest TwoUnitBuy {
+        .instrument = InstrumentId { 1 },
+        .side = Side::Buy,
+        .type = OrderType::Limit,
+        .price = Price { 100 * Price::Scale },
+        .quantity = Quantity { 2 * Quantity::Scale }
+    };
+
+    // 60% of the top-of-book quantity on the bid side.
+    constexpr MarketEvent Imbalanced {
+        .instrument = InstrumentId { 1 },
+        .sequence = SequenceNumber { 1 },
+        .exchangeTimestamp = Timestamp {},
+        .receiveTimestamp = Timestamp {},
+        .bestBid = Price { 100 * Price::Scale },
+        .bestBidQuantity = Quantity { 8 * Quantity::Scale },
+        .bestAsk = Price { 101 * Price::Scale },
+        .bestAskQuantity = Quantity { 2 * Quantity::Scale }
+    };
+
+    // Observes the components at the moment the event arrives.
+    class ObservingHandler final : public IMarketEventHandler
+    {
+    public:
+        ObservingHandler(RiskManager& riskManager, const ImbalanceStrategy& strategy) noexcept:
+            riskManager { riskManager },
+            strategy { strategy }
+        {
+        }
+
+        void onMarketEvent(const MarketEvent& event) override
+        {
+            const Position position { InstrumentId { 1 } };
+            lastRisk = riskManager.checkOrder(TwoUnitBuy, position);
+            lastSignal = strategy.evaluate(event);
+            ++events;
+        }
+
+        RiskManager& riskManager;
+        const ImbalanceStrategy& strategy;
+        RiskResult lastRisk { RiskResult::Accepted };
+        Signal lastSignal { Signal::None };
+        uint64_t events { 0 };
+    };
+
+    [[nodiscard]]
+    Config tightConfig()
+    {
+        return Config {
+            .strategyThresholdNumerator = 9,
+            .strategyThresholdDenominator = 10,
+            .riskLimits = RiskLimitsConfig { .maxOrderQuantity = Quantity { Quantity::Scale } }
+        };
+    }
+
+    void testInvalidConfigIsNotPublished()
+    {
+        ConfigChannel channel;
+
+        Config config = tightConfig();
+        config.strategyThresholdDenominator = 0;
+        Assert(!channel.publish(config), "zero threshold denominator must be rejected");
+
+        config = tightConfig();
+        config.riskLimits.maxPositionQuantity = Quantity { -1 };
+        Assert(!channel.publish(config), "negative limit must be rejected");
+
+        Assert(channel.poll() == nullptr, "rejected config must not reach the trading thread");
+        Assert(channel.publishedCount() == 0, "rejected config must not be counted");
+    }
+
+    void testConfigIsAppliedBeforeNextEvent()
+    {
+        ConfigChannel channel;
+        RiskManager riskManager { RiskLimits {} };
+        ImbalanceStrategy strategy { 5, 10 };
+        ObservingHandler next { riskManager, strategy };
+        ConfigReloader reloader { channel, riskManager, strategy, next };
+
+        reloader.onMarketEvent(Imbalanced);
+        Assert(next.lastRisk == RiskResult::Accepted, "initial limits must accept the order");
+        Assert(next.lastSignal == Signal::Buy, "initial threshold must signal");
+        Assert(reloader.appliedCount() == 0, "nothing must be applied without a publish");
+
+        Assert(channel.publish(tightConfig()), "valid config must be published");
+
+        reloader.onMarketEvent(Imbalanced);
+        Assert(next.lastRisk == RiskResult::Rejected, "new limits must apply to the next event");
+        Assert(next.lastSignal == Signal::None, "new threshold must apply to the next event");
+        Assert(reloader.appliedCount() == 1, "config must be applied once");
+
+        reloader.onMarketEvent(Imbalanced);
+        Assert(reloader.appliedCount() == 1, "config must not be applied again");
+        Assert(next.events == 3, "every event must be forwarded");
+    }
+
+    void testMissingLimitsKeepActiveValues()
+    {
+        ConfigChannel channel;
+        RiskManager riskManager { RiskLimits { .maxPositionQuantity = Quantity { Quantity::Scale } } };
+        ImbalanceStrategy strategy {};
+        ObservingHandler next { riskManager, strategy };
+        ConfigReloader reloader { channel, riskManager, strategy, next };
+
+        /* Input:    active position limit of one unit, a reload that sets only the order quantity limit
+           Expected: the position limit stays active and still rejects a two unit buy */
+        reloader.onMarketEvent(Imbalanced);
+        Assert(next.lastRisk == RiskResult::Rejected, "initial position limit must reject the order");
+
+        Assert(channel.publish(Config { .riskLimits = RiskLimitsConfig { .maxOrderQuantity = Quantity { 5 * Quantity::Scale } } }),
+            "partial config must be published");
+        reloader.onMarketEvent(Imbalanced);
+
+        Assert(reloader.appliedCount() == 1, "config must be applied");
+        Assert(riskManager.activeLimits().maxOrderQuantity == Quantity { 5 * Quantity::Scale }, "present limit must be applied");
+        Assert(riskManager.activeLimits().maxPositionQuantity == Quantity { Quantity::Scale }, "missing limit must keep its value");
+        Assert(next.lastRisk == RiskResult::Rejected, "kept position limit must still reject the order");
+    }
+
+    void testMissingThresholdKeepsActiveValue()
+    {
+        ConfigChannel channel;
+        RiskManager riskManager { RiskLimits {} };
+        ImbalanceStrategy strategy {};
+        ObservingHandler next { riskManager, strategy };
+        ConfigReloader reloader { channel, riskManager, strategy, next };
+
+        /* Input:    a reload that lowers the threshold to 5/10, then a reload with risk limits only
+           Expected: the 5/10 threshold stays active and the 60% imbalance still signals */
+        Assert(channel.publish(Config { .strategyThresholdNumerator = 5, .strategyThresholdDenominator = 10 }),
+            "threshold config must be published");
+        reloader.onMarketEvent(Imbalanced);
+        Assert(next.lastSignal == Signal::Buy, "reloaded threshold must signal");
+
+        Assert(channel.publish(Config { .riskLimits = RiskLimitsConfig { .maxOrderQuantity = Quantity { 5 * Quantity::Scale } } }),
+            "risk-only config must be published");
+        reloader.onMarketEvent(Imbalanced);
+
+        Assert(reloader.appliedCount() == 2, "both configs must be applied");
+        Assert(next.lastSignal == Signal::Buy, "missing threshold must keep the reloaded value");
+
+        /* Input:    a numerator of 9 alone, then a denominator of 20 alone
+           Expected: 9/10 over the active denominator stops the signal, 9/20 signals again */
+        Assert(channel.publish(Config { .strategyThresholdNumerator = 9 }), "lone numerator must be published");
+        reloader.onMarketEvent(Imbalanced);
+        Assert(next.lastSignal == Signal::None, "lone numerator must apply over the active denominator");
+
+        Assert(channel.publish(Config { .strategyThresholdDenominator = 20 }), "lone denominator must be published");
+        reloader.onMarketEvent(Imbalanced);
+        Assert(next.lastSignal == Signal::Buy, "lone denominator must apply over the active numerator");
+    }
+
+    void testReloadWhileTrading()
+    {
+        constexpr uint64_t Reloads { 10'000 };
+
+        ConfigChannel channel;
+        RiskManager riskManager { RiskLimits {} };
+        ImbalanceStrategy strategy {};
+        ObservingHandler next { riskManager, strategy };
+        ConfigReloader reloader { channel, riskManager, strategy, next };
+
+        std::atomic<bool> done { false };
+        std::thread control { [&channel, &done] {
+            for (uint64_t reload { 1 }; reload <= Reloads; ++reload)
+            {
+                Config config = tightConfig();
+                config.riskLimits.maxOrderQuantity = Quantity { static_cast<Quantity::Value>(reload) };
+                const bool _ = channel.publish(config);
+            }
+            done.store(true, std::memory_order_release);
+        } };
+
+        while (!done.load(std::memory_order_acquire))
+            reloader.onMarketEvent(Imbalanced);
+        control.join();
+        reloader.onMarketEvent(Imbalanced);
+
+        Assert(channel.publishedCount() == Reloads, "every config must be published");
+        Assert(reloader.appliedCount() >= 1 && reloader.appliedCount() <= Reloads, "invalid applied count");
+        Assert(next.lastRisk == RiskResult::Rejected, "last limits must be active");
+        Assert(next.lastSignal == Signal::None, "last threshold must be active");
+    }
+}
+
+void config_reloader_test()
+{
+    testInvalidConfigIsNotPublished();
+    testConfigIsAppliedBeforeNextEvent();
+    testMissingLimitsKeepActiveValues();
+    testMissingThresholdKeepsActiveValue();
+    testReloadWhileTrading();
+
+    std::cout << "All ConfigReloader tests: OK\n";
+}
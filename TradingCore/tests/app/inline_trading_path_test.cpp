@@ -0,0 +1,209 @@
+/**============================================================================
+Name        : inline_trading_path_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : InlineTradingPath unit tests.
+============================================================================**/
+
+#include "inline_trading_path.hpp"
+#include "binance_market_data_parser.hpp"
+#include "imbalance_strategy.hpp"
+#include "market_data_message_handler.hpp"
+#include "market_event_handler.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::OrderId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::Timestamp;
+    using trading::app::InlineTradingPath;
+    using trading::exchanges::binance::BinanceMarketDataParser;
+    using trading::execution::IExecutionGateway;
+    using trading::execution::Order;
+    using trading::execution::OrderCreationError;
+    using trading::execution::OrderManager;
+    using trading::market_data::BookBuilder;
+    using trading::market_data::MarketDataMessageHandler;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::MarketEventHandler;
+    using trading::market_data::OrderBook;
+    using trading::position::Position;
+    using trading::recording::IRecorder;
+    using trading::risk::RiskLimits;
+    using trading::risk::RiskManager;
+    using trading::strategy::ImbalanceStrategy;
+    using trading::strategy::StrategyExecutionResult;
+    using trading::strategy::StrategyExecutor;
+    using testing::Assert;
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+    constexpr std::array instruments { btcUsdt };
+    constexpr Quantity OrderQuantity { 100'000'000 };
+
+    // Orders above 20'000 USDT notional are rejected.
+    constexpr RiskLimits Limits { .maxNotional = Price { 2'000'000'000'000 } };
+
+    struct RecordingGateway final : IExecutionGateway
+    {
+        void send(const Order& order) override {
+            sent.push_back(order);
+        }
+
+        void cancel(const OrderId orderId) override {
+            cancelled.push_back(orderId);
+        }
+
+        std::vector<Order> sent;
+        std::vector<OrderId> cancelled;
+    };
+
+    struct NullRecorder final : IRecorder
+    {
+        void record(const MarketEvent&) override {}
+        void record(const trading::execution::ExecutionReport&) override {}
+    };
+
+    using TestPath = InlineTradingPath<BinanceMarketDataParser, OrderBook, ImbalanceStrategy, RiskManager, RecordingGateway>;
+
+    static_assert(trading::market_data::MarketDataParser<BinanceMarketDataParser>);
+    static_assert(trading::strategy::SignalGenerator<ImbalanceStrategy>);
+    static_assert(trading::risk::PreTradeRisk<RiskManager>);
+    static_assert(trading::execution::OrderGateway<RecordingGateway>);
+
+    // Depth updates whose imbalance and ask price vary, so that the strategy
+    // buys, sells, does nothing and hits the notional limit.
+    [[nodiscard]]
+    std::vector<std::string> depthUpdates()
+    {
+        constexpr std::array bidQuantities { "9.0", "1.0", "5.0", "8.0", "0.5", "5.0" };
+        constexpr std::array askQuantities { "1.0", "9.0", "5.0", "1.0", "9.5", "5.5" };
+        constexpr std::array askPrices { "10000.01", "10000.02", "10000.03", "30000.00", "10000.01", "10000.04" };
+
+        std::vector<std::string> messages;
+        for (std::size_t index { 0 }; index < 60; ++index)
+        {
+            const std::string sequence = std::to_string(101 + index);
+            const std::size_t variant = index % bidQuantities.size();
+
+            messages.push_back(
+                R"({"e":"depthUpdate","E":1672515782136,"s":"BTCUSDT","U":)" + sequence + R"(,"u":)" + sequence +
+                R"(,"b":[["10000.00",")" + bidQuantities[variant] + R"("]],"a":[[")" + askPrices[variant] +
+                R"(",")" + askQuantities[variant] + R"("]]})");
+        }
+        return messages;
+    }
+
+    void testMatchesInterfaceWiring()
+    {
+        BinanceMarketDataParser parser { instruments };
+        ImbalanceStrategy strategy {};
+        NullRecorder recorder;
+
+        // Interface based wiring, as in Application.
+        OrderBook virtualBook;
+        RecordingGateway virtualGateway;
+        RiskManager virtualRisk { Limits };
+        Position virtualPosition { btcUsdt.id() };
+        OrderManager virtualOrders { virtualGateway, virtualRisk, virtualPosition };
+        StrategyExecutor executor { virtualOrders, OrderQuantity };
+        MarketEventHandler eventHandler { strategy, executor, recorder };
+        BookBuilder builder { btcUsdt.id(), virtualBook, eventHandler };
+        MarketDataMessageHandler messageHandler { parser, builder };
+
+        // Compile-time wiring.
+        OrderBook inlineBook;
+        RecordingGateway inlineGateway;
+        RiskManager inlineRisk { Limits };
+        Position inlinePosition { btcUsdt.id() };
+        OrderManager inlineOrders { inlineGateway, inlineRisk, inlinePosition };
+        TestPath path { btcUsdt.id(), parser, inlineBook, strategy, inlineRisk, inlineGateway,
+                        inlineOrders, inlinePosition, OrderQuantity };
+
+        Assert(builder.applySnapshot(100, {}, {}, Timestamp {}), "snapshot must be applied");
+        Assert(path.applySnapshot(100, {}, {}, Timestamp {}), "snapshot must be applied");
+
+        for (const std::string& message : depthUpdates())
+        {
+            messageHandler.onMessage(message);
+            path.onMessage(message);
+        }
+
+        Assert(!inlineGateway.sent.empty(), "depth updates must produce orders");
+        Assert(inlineGateway.sent.size() < 40, "some signals must be rejected by risk");
+        Assert(inlineGateway.sent.size() == virtualGateway.sent.size(), "both wirings must send the same orders");
+
+        for (std::size_t index { 0 }; index < inlineGateway.sent.size(); ++index)
+        {
+            const Order& expected = virtualGateway.sent[index];
+            const Order& actual = inlineGateway.sent[index];
+
+            Assert(actual.clientOrderId == expected.clientOrderId, "order ids must match");
+            Assert(actual.side == expected.side, "order sides must match");
+            Assert(actual.price == expected.price, "order prices must match");
+            Assert(actual.quantity == expected.quantity, "order quantities must match");
+            Assert(inlineOrders.find(actual.clientOrderId) != nullptr, "sent orders must be tracked");
+        }
+
+        Assert(inlineBook.sequence() == virtualBook.sequence(), "both books must apply the same updates");
+    }
+
+    void testOnMarketEventResults()
+    {
+        const BinanceMarketDataParser parser { instruments };
+        const ImbalanceStrategy strategy {};
+        OrderBook book;
+        RecordingGateway gateway;
+        RiskManager risk { Limits };
+        Position position { btcUsdt.id() };
+        OrderManager orders { gateway, risk, position };
+        TestPath path { btcUsdt.id(), parser, book, strategy, risk, gateway, orders, position, OrderQuantity };
+
+        MarketEvent event {
+            .instrument = btcUsdt.id(),
+            .bestBid = Price { 1'000'000'000'000 },
+            .bestBidQuantity = Quantity { 500'000'000 },
+            .bestAsk = Price { 1'000'100'000'000 },
+            .bestAskQuantity = Quantity { 500'000'000 }
+        };
+
+        const StrategyExecutionResult none = path.onMarketEvent(event);
+        Assert(none && !none->has_value(), "balanced book must not trade");
+
+        event.bestBidQuantity = Quantity { 900'000'000 };
+        event.bestAskQuantity = Quantity { 100'000'000 };
+        const StrategyExecutionResult sent = path.onMarketEvent(event);
+        Assert(sent && sent->has_value(), "imbalance must send an order");
+        Assert(gateway.sent.size() == 1 && gateway.sent.front().side == Side::Buy, "buy order must be sent");
+        Assert(gateway.sent.front().price == event.bestAsk, "buy order must take the ask");
+
+        event.bestAsk = Price { 3'000'000'000'000 };
+        const StrategyExecutionResult rejected = path.onMarketEvent(event);
+        Assert(!rejected && rejected.error() == OrderCreationError::RiskRejected, "risk must reject the order");
+
+        event.bestAsk = Price {};
+        const StrategyExecutionResult invalid = path.onMarketEvent(event);
+        Assert(!invalid && invalid.error() == OrderCreationError::InvalidRequest, "zero price must be invalid");
+
+        Assert(gateway.sent.size() == 1, "rejected orders must not be sent");
+    }
+}
+
+void inline_trading_path_test()
+{
+    testMatchesInterfaceWiring();
+    testOnMarketEventResults();
+
+    std::cout << "All InlineTradingPath tests: OK\n";
+}
@@ -0,0 +1,553 @@
+/**============================================================================
+Name        : pipeline_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Pipeline unit tests.
+============================================================================**/
+
+#include "pipeline.hpp"
+#include "execution_report_handler.hpp"
+#include "order_manager.hpp"
+#include "position_manager.hpp"
+#include "test_support/testing.hpp"
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using trading::ExecType;
+    using trading::InstrumentId;
+    using trading::OrderId;
+    using trading::OrderStatus;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Side;
+    using trading::app::Pipeline;
+    using trading::app::PipelineConfig;
+    using trading::app::PipelineStatistics;
+    using trading::app::PipelineTargets;
+    using trading::app::UnpinnedCore;
+    using trading::execution::ExecutionReport;
+    using trading::execution::IExecutionGateway;
+    using trading::execution::ExecutionReportHandler;
+    using trading::execution::Order;
+    using trading::execution::OrderManager;
+    using trading::execution::OrderRequest;
+    using trading::market_data::IMarketDataMessageHandler;
+    using trading::market_data::IMarketDataSource;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::recording::IRecorder;
+    using testing::Assert;
+
+    // The test host may have fewer cores than the production layout.
+    constexpr PipelineConfig Unpinned {
+        .networkCore = UnpinnedCore,
+        .marketDataCore = UnpinnedCore,
+        .tradingCore = UnpinnedCore,
+        .executionCore = UnpinnedCore,
+        .backgroundCore = UnpinnedCore
+    };
+
+    // Every OrderEvery-th market event sends an order.
+    constexpr SequenceNumber OrderEvery { 10 };
+
+    struct ScriptedSource final : IMarketDataSource
+    {
+        void start() override
+        {
+            for (const std::string& message : messages)
+            {
+                if (stopped.load())
+                    return;
+                handler->onMessage(message);
+            }
+
+            while (endless && !stopped.load())
+                handler->onMessage(messages.front());
+        }
+
+        void stop() override {
+            stopped.store(true);
+        }
+
+        void setMessageHandler(IMarketDataMessageHandler& messageHandler) override {
+            handler = &messageHandler;
+        }
+
+        std::vector<std::string> messages;
+        bool endless { false };
+        std::atomic<bool> stopped { false };
+        IMarketDataMessageHandler* handler { nullptr };
+    };
+
+    // Market-data stage: every message is a sequence number that becomes a MarketEvent.
+    struct SequenceMessageHandler final : IMarketDataMessageHandler
+    {
+        explicit SequenceMessageHandler(IMarketEventHandler& sink) noexcept: sink { sink } {
+        }
+
+        void onMessage(const std::string_view message) override
+        {
+            SequenceNumber sequence { 0 };
+            std::from_chars(message.data(), message.data() + message.size(), sequence);
+            sink.onMarketEvent(MarketEvent { .instrument = 1, .sequence = sequence });
+        }
+
+        IMarketEventHandler& sink;
+    };
+
+    // Trading stage: records every event and sends an order for some of them.
+    struct TradingHandler final : IMarketEventHandler
+    {
+        TradingHandler(IRecorder& recorder, IExecutionGateway& gateway) noexcept:
+            recorder { recorder }, gateway { gateway } {
+        }
+
+        void onMarketEvent(const MarketEvent& event) override
+        {
+            ordered = ordered && event.sequence == events + 1;
+            ++events;
+
+            recorder.record(event);
+            if (event.sequence % OrderEvery != 0)
+                return;
+
+            for (std::size_t order { 0 }; order < ordersPerEvent; ++order)
+                gateway.send(Order { .clientOrderId = event.sequence * ordersPerEvent + order });
+        }
+
+        IRecorder& recorder;
+        IExecutionGateway& gateway;
+        std::size_t ordersPerEvent { 1 };
+        uint64_t events { 0 };
+        bool ordered { true };
+    };
+
+    // Execution stage: acknowledges every order with an execution report.
+    struct AcknowledgingGateway final : IExecutionGateway
+    {
+        explicit AcknowledgingGateway(Pipeline& pipeline) noexcept: pipeline { pipeline } {
+        }
+
+        void send(const Order& order) override
+        {
+            orders.push_back(order.clientOrderId);
+            pipeline.submitExecutionReport(ExecutionReport {
+                .clientOrderId = order.clientOrderId,
+                .exchangeOrderId = 0,
+                .instrument = order.instrument,
+                .side = order.side,
+                .execType = ExecType::New,
+                .status = OrderStatus::New,
+                .price = order.price,
+                .quantity = order.quantity,
+                .filledQuantity = Quantity {}
+            });
+        }
+
+        void cancel(const OrderId orderId) override {
+            cancels.push_back(orderId);
+        }
+
+        Pipeline& pipeline;
+        std::vector<OrderId> orders;
+        std::vector<OrderId> cancels;
+    };
+
+    struct GatedRecorder final : IRecorder
+    {
+        void record(const MarketEvent&) override
+        {
+            while (!open.load())
+                std::this_thread::yield();
+            ++marketEvents;
+        }
+
+        void record(const ExecutionReport&) override {
+            ++executionReports;
+        }
+
+        std::atomic<bool> open { true };
+        uint64_t marketEvents { 0 };
+        uint64_t executionReports { 0 };
+    };
+
+    struct Harness
+    {
+        explicit Harness(const std::size_t messages):
+            pipeline { std::make_unique<Pipeline>(Unpinned) },
+            messageHandler { *pipeline },
+            tradingHandler { *pipeline, *pipeline },
+            gateway { *pipeline }
+        {
+            for (std::size_t sequence { 1 }; sequence <= messages; ++sequence)
+                source.messages.push_back(std::to_string(sequence));
+
+            source.setMessageHandler(*pipeline);
+            pipeline->connect(PipelineTargets {
+                .source = &source,
+                .messageHandler = &messageHandler,
+                .marketEventHandler = &tradingHandler,
+                .gateway = &gateway,
+                .recorder = &recorder
+            });
+        }
+
+        std::unique_ptr<Pipeline> pipeline;
+        ScriptedSource source;
+        SequenceMessageHandler messageHandler;
+        TradingHandler tradingHandler;
+        AcknowledgingGateway gateway;
+        GatedRecorder recorder;
+    };
+
+    void testDeliversThroughAllStages()
+    {
+        constexpr std::size_t Messages { 1000 };
+        constexpr std::size_t Orders { Messages / OrderEvery };
+
+        Harness harness { Messages };
+        harness.pipeline->start();
+        Assert(harness.pipeline->isRunning(), "pipeline must run after start");
+
+        harness.pipeline->join();
+        Assert(!harness.pipeline->isRunning(), "pipeline must stop after join");
+
+        Assert(harness.tradingHandler.events == Messages, "every message must reach the trading stage");
+        Assert(harness.tradingHandler.ordered, "market events must keep their order");
+        Assert(harness.gateway.orders.size() == Orders, "every order must reach the execution stage");
+        for (std::size_t index { 0 }; index < harness.gateway.orders.size(); ++index)
+            Assert(harness.gateway.orders[index] == (index + 1) * OrderEvery, "orders must keep their order");
+        Assert(harness.recorder.marketEvents == Messages, "every market event must be recorded");
+
+        const PipelineStatistics statistics = harness.pipeline->statistics();
+        Assert(statistics.marketData.processed == Messages, "market-data stage must count every message");
+        Assert(statistics.trading.processed == Messages + Orders, "trading stage must count events and reports");
+        Assert(statistics.execution.processed == Orders, "execution stage must count every order");
+        Assert(statistics.recorder.processed == Messages, "recorder stage must count every record");
+        Assert(statistics.rawMessages.depth == 0 && statistics.marketEvents.depth == 0 &&
+               statistics.orderCommands.depth == 0 && statistics.executionReports.depth == 0 &&
+               statistics.recording.depth == 0, "every queue must be drained after join");
+        Assert(statistics.rawMessages.maxDepth >= 1 && statistics.rawMessages.maxDepth <= Pipeline::RawMessageCapacity,
+            "max depth must be within the capacity");
+        Assert(statistics.recording.rejected == 0, "no record must be dropped");
+        Assert(statistics.marketData.maxWaitNanoseconds * Messages >= statistics.marketData.waitNanoseconds,
+            "max latency must bound the average");
+        Assert(statistics.marketData.averageServiceNanoseconds() > 0.0, "service latency must be measured");
+    }
+
+    void testSlowRecorderDoesNotStall()
+    {
+        constexpr std::size_t Messages { Pipeline::RecordingCapacity + 4096 };
+
+        Harness harness { Messages };
+        harness.recorder.open.store(false);
+        harness.pipeline->start();
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds { 60 };
+        while (harness.pipeline->statistics().trading.processed < Messages + Messages / OrderEvery &&
+               std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+        }
+
+        const PipelineStatistics blocked = harness.pipeline->statistics();
+        Assert(blocked.marketData.processed == Messages, "blocked recorder must not stall market data");
+        Assert(blocked.trading.processed == Messages + Messages / OrderEvery, "blocked recorder must not stall trading");
+        Assert(blocked.recording.rejected > 0, "records must be dropped while the recorder is blocked");
+
+        harness.recorder.open.store(true);
+        harness.pipeline->join();
+
+        const PipelineStatistics statistics = harness.pipeline->statistics();
+        Assert(harness.recorder.marketEvents + statistics.recording.rejected == Messages,
+            "every record must be either recorded or counted as dropped");
+    }
+
+    /*
+        Input:
+            One market event sends more orders than Q3 and Q4 hold together;
+            the execution stage acknowledges every order with a report.
+
+        Expected:
+            The trading stage takes the reports while it waits for room in
+            Q3, so both stages keep moving and every order and report gets
+            through.
+    */
+    void testOrderBurstDoesNotDeadlock()
+    {
+        constexpr std::size_t Orders { Pipeline::OrderCommandCapacity + Pipeline::ExecutionReportCapacity + 1000 };
+
+        Harness harness { OrderEvery };
+        harness.tradingHandler.ordersPerEvent = Orders;
+        harness.pipeline->start();
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds { 60 };
+        while (harness.pipeline->statistics().trading.processed < OrderEvery + Orders &&
+               std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+        }
+
+        Assert(harness.pipeline->statistics().trading.processed == OrderEvery + Orders,
+            "every execution report must reach the trading stage");
+
+        harness.pipeline->join();
+
+        const PipelineStatistics statistics = harness.pipeline->statistics();
+        Assert(harness.gateway.orders.size() == Orders, "every order must reach the execution stage");
+        Assert(statistics.orderCommands.rejected == 0 && statistics.executionReports.rejected == 0,
+            "no order or report must be dropped");
+        Assert(statistics.deferredReportOverflows == 0, "the deferred reports must fit the ring");
+    }
+
+    // Trading stage driving a real OrderManager: a burst of orders, then a cancel of all of them.
+    struct OrderFlowHandler final : IMarketEventHandler
+    {
+        explicit OrderFlowHandler(OrderManager& manager) noexcept: manager { manager } {
+        }
+
+        void onMarketEvent(const MarketEvent& event) override
+        {
+            inside = true;
+            if (event.sequence == 1)
+            {
+                for (std::size_t order { 0 }; order < orders; ++order)
+                {
+                    created += manager.createOrder(OrderRequest {
+                        .instrument = InstrumentId { 1 },
+                        .side = Side::Buy,
+                        .type = OrderType::Limit,
+                        .price = Price { 6'500'000'000'000 },
+                        .quantity = Quantity { 100'000 }
+                    }).has_value() ? 1 : 0;
+                }
+            }
+            else
+            {
+                cancelled = manager.cancelAll(InstrumentId { 1 });
+            }
+            inside = false;
+        }
+
+        OrderManager& manager;
+        std::size_t orders { 0 };
+        std::size_t created { 0 };
+        std::size_t cancelled { 0 };
+        bool inside { false };
+    };
+
+    // Records on the trading thread: notes reports applied inside onMarketEvent().
+    struct ReentrancyRecorder final : IRecorder
+    {
+        void record(const MarketEvent&) override {
+        }
+
+        void record(const ExecutionReport&) override
+        {
+            reentered = reentered || handler->inside;
+            ++reports;
+        }
+
+        const OrderFlowHandler* handler { nullptr };
+        uint64_t reports { 0 };
+        bool reentered { false };
+    };
+
+    // Execution stage: acknowledges orders and confirms cancels.
+    struct ConfirmingGateway final : IExecutionGateway
+    {
+        explicit ConfirmingGateway(Pipeline& pipeline) noexcept: pipeline { pipeline } {
+        }
+
+        void send(const Order& order) override
+        {
+            orders.emplace(order.clientOrderId, order);
+            submit(order, ExecType::New, OrderStatus::New);
+        }
+
+        void cancel(const OrderId orderId) override {
+            submit(orders.at(orderId), ExecType::Cancel, OrderStatus::Cancelled);
+        }
+
+        void submit(const Order& order, const ExecType execType, const OrderStatus status)
+        {
+            pipeline.submitExecutionReport(ExecutionReport {
+                .clientOrderId = order.clientOrderId,
+                .exchangeOrderId = 0,
+                .instrument = order.instrument,
+                .side = order.side,
+                .execType = execType,
+                .status = status,
+                .price = order.price,
+                .quantity = order.quantity,
+                .filledQuantity = Quantity {}
+            });
+        }
+
+        Pipeline& pipeline;
+        std::unordered_map<OrderId, Order> orders;
+    };
+
+    /*
+        Input:
+            OrderManager sends more orders than Q3 and Q4 hold together from
+            one market event and cancels all of them from the next one; the
+            execution stage answers every order and cancel.
+
+        Expected:
+            No report reaches ExecutionReportHandler while createOrder() or
+            cancelAll() runs; every order ends cancelled and its risk
+            reservation is released.
+    */
+    void testReportsAreNotAppliedInsideSend()
+    {
+        constexpr std::size_t Orders { Pipeline::OrderCommandCapacity + Pipeline::ExecutionReportCapacity + 1000 };
+
+        const auto pipeline = std::make_unique<Pipeline>(Unpinned);
+        trading::risk::RiskManager riskManager { trading::risk::RiskLimits {} };
+        trading::position::Position position { InstrumentId { 1 } };
+        trading::position::PositionManager positionManager;
+        OrderManager orderManager { *pipeline, riskManager, position };
+
+        OrderFlowHandler tradingHandler { orderManager };
+        tradingHandler.orders = Orders;
+        ReentrancyRecorder recorder;
+        recorder.handler = &tradingHandler;
+        ExecutionReportHandler reportHandler { orderManager, positionManager, recorder };
+
+        ScriptedSource source;
+        source.messages = { "1", "2" };
+        source.setMessageHandler(*pipeline);
+        SequenceMessageHandler messageHandler { *pipeline };
+        ConfirmingGateway gateway { *pipeline };
+        pipeline->connect(PipelineTargets {
+            .source = &source,
+            .messageHandler = &messageHandler,
+            .marketEventHandler = &tradingHandler,
+            .executionReportHandler = &reportHandler,
+            .gateway = &gateway,
+            .recorder = &recorder
+        });
+
+        pipeline->start();
+        pipeline->join();
+
+        Assert(tradingHandler.created == Orders, "every order must be created");
+        Assert(tradingHandler.cancelled == Orders, "every order must be cancelled");
+        Assert(!recorder.reentered, "reports must not be applied inside createOrder() or cancelAll()");
+        Assert(recorder.reports == 2 * Orders, "every report must be applied");
+        Assert(orderManager.openOrderCount(InstrumentId { 1 }, Side::Buy) == 0, "no order must stay open");
+        Assert(riskManager.pendingExposure(InstrumentId { 1 }).buyQuantity.isZero(), "every reservation must be released");
+        Assert(pipeline->statistics().orderCommands.rejected == 0, "no command must be dropped");
+        Assert(pipeline->statistics().deferredReportOverflows == 0, "the deferred reports must fit the ring");
+    }
+
+    /*
+        Input:
+            OrderManager sends one order more than Q3 holds and a cancel
+            while no execution stage consumes Q3, then the pipeline runs.
+
+        Expected:
+            The order that did not fit is answered with a Rejected report
+            and releases its reservation; the cancel is counted as dropped.
+    */
+    void testCommandsWithoutExecutionStageAreRejected()
+    {
+        constexpr std::size_t Orders { Pipeline::OrderCommandCapacity + 1 };
+
+        const auto pipeline = std::make_unique<Pipeline>(Unpinned);
+        trading::risk::RiskManager riskManager { trading::risk::RiskLimits {} };
+        trading::position::Position position { InstrumentId { 1 } };
+        trading::position::PositionManager positionManager;
+        OrderManager orderManager { *pipeline, riskManager, position };
+
+        OrderFlowHandler tradingHandler { orderManager };
+        ReentrancyRecorder recorder;
+        recorder.handler = &tradingHandler;
+        ExecutionReportHandler reportHandler { orderManager, positionManager, recorder };
+        ConfirmingGateway gateway { *pipeline };
+        pipeline->connect(PipelineTargets {
+            .executionReportHandler = &reportHandler,
+            .gateway = &gateway
+        });
+
+        std::vector<OrderId> ids;
+        for (std::size_t order { 0 }; order < Orders; ++order)
+        {
+            ids.push_back(orderManager.createOrder(OrderRequest {
+                .instrument = InstrumentId { 1 },
+                .side = Side::Buy,
+                .type = OrderType::Limit,
+                .price = Price { 6'500'000'000'000 },
+                .quantity = Quantity { 100'000 }
+            }).value());
+        }
+        Assert(orderManager.cancel(ids.front()), "cancel of a known order must be issued");
+
+        pipeline->start();
+        pipeline->join();
+
+        const PipelineStatistics statistics = pipeline->statistics();
+        Assert(gateway.orders.size() == Pipeline::OrderCommandCapacity, "queued orders must reach the execution stage");
+        Assert(orderManager.find(ids.back())->status == OrderStatus::Rejected, "the order that did not fit must be rejected");
+        Assert(riskManager.pendingExposure(InstrumentId { 1 }).buyQuantity == Quantity { 100'000 * static_cast<Quantity::Value>(Pipeline::OrderCommandCapacity) },
+            "the rejected order must release its reservation");
+        Assert(statistics.orderCommands.rejected == 2, "the dropped order and cancel must be counted");
+        Assert(statistics.droppedCancels == 1, "the dropped cancel must be reported");
+    }
+
+    void testRejectsOversizedMessages()
+    {
+        Harness harness { 0 };
+        harness.source.messages.push_back(std::string(Pipeline::MaxRawMessageSize + 1, '1'));
+        harness.source.messages.push_back("1");
+
+        harness.pipeline->start();
+        harness.pipeline->join();
+
+        Assert(harness.pipeline->statistics().rawMessages.rejected == 1, "oversized message must be rejected");
+        Assert(harness.tradingHandler.events == 1, "oversized message must not reach the trading stage");
+    }
+
+    void testStopInterruptsSource()
+    {
+        Harness harness { 1 };
+        harness.source.endless = true;
+
+        harness.pipeline->start();
+        std::this_thread::sleep_for(std::chrono::milliseconds { 10 });
+        harness.pipeline->stop();
+
+        Assert(!harness.pipeline->isRunning(), "pipeline must stop");
+        Assert(harness.source.stopped.load(), "stop must stop the source");
+        Assert(harness.pipeline->statistics().marketData.processed == harness.tradingHandler.events,
+            "messages accepted before stop must be drained");
+    }
+}
+
+void pipeline_test()
+{
+    testDeliversThroughAllStages();
+    testSlowRecorderDoesNotStall();
+    testOrderBurstDoesNotDeadlock();
+    testReportsAreNotAppliedInsideSend();
+    testCommandsWithoutExecutionStageAreRejected();
+    testRejectsOversizedMessages();
+    testStopInterruptsSource();
+
+    std::cout << "All Pipeline tests: OK\n";
+}
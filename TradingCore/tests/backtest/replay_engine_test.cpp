@@ -0,0 +1,207 @@
+/**============================================================================
+Name        : replay_engine_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tests for ReplayEngine.
+============================================================================**/
+
+#include "replay_engine.hpp"
+#include "journal_recorder.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using trading::ExecType;
+using trading::Instrument;
+using trading::InstrumentId;
+using trading::OrderStatus;
+using trading::Price;
+using trading::Quantity;
+using trading::SequenceNumber;
+using trading::Side;
+
+using trading::backtest::ReplayEngine;
+using trading::backtest::ReplayError;
+using trading::backtest::ReplayResult;
+using trading::execution::ExecutionReport;
+using trading::market_data::MarketEvent;
+using trading::recording::JournalConfig;
+using trading::recording::JournalFileHeader;
+using trading::recording::JournalRecord;
+using trading::recording::JournalRecorder;
+
+namespace
+{
+    using testing::Assert;
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+    constexpr Quantity Heavy { 900'000'000 };
+    constexpr Quantity Light { 100'000'000 };
+
+    [[nodiscard]]
+    MarketEvent marketEvent(const SequenceNumber sequence,
+                            const Price bid, const Quantity bidQuantity,
+                            const Price ask, const Quantity askQuantity)
+    {
+        return MarketEvent {
+            .instrument = btcUsdt.id(),
+            .sequence = sequence,
+            .bestBid = bid,
+            .bestBidQuantity = bidQuantity,
+            .bestAsk = ask,
+            .bestAskQuantity = askQuantity
+        };
+    }
+
+    /*
+        Buy at 65000.10, sell at 65010.00, buy at 65020.10, then the market
+        moves to 65030.00 / 65030.10 with a balanced book.
+    */
+    [[nodiscard]]
+    std::vector<MarketEvent> scenario()
+    {
+        return {
+            marketEvent(1, Price { 6'500'000'000'000 }, Heavy, Price { 6'500'010'000'000 }, Light),
+            marketEvent(2, Price { 6'501'000'000'000 }, Light, Price { 6'501'010'000'000 }, Heavy),
+            marketEvent(3, Price { 6'502'000'000'000 }, Heavy, Price { 6'502'010'000'000 }, Light),
+            marketEvent(4, Price { 6'503'000'000'000 }, Light, Price { 6'503'010'000'000 }, Light)
+        };
+    }
+
+    void assertScenarioResult(const ReplayResult& result)
+    {
+        Assert(result.marketEvents == 4, "all events must be replayed");
+        Assert(result.orders == 3 && result.fills == 3, "three orders must be sent and filled");
+        Assert(result.position.quantity() == 100'000'000, "final position must be one unit long");
+        Assert(result.position.averagePrice() == Price { 6'502'010'000'000 }, "invalid average entry price");
+        Assert(result.realizedPnl == Price { 990'000'000 }, "round trip must realize 9.90");
+        Assert(result.unrealizedPnl == Price { 990'000'000 }, "open unit must be marked at the last bid");
+        Assert(result.totalPnl() == Price { 1'980'000'000 }, "invalid total PnL");
+    }
+
+    /*
+        Input:
+            The scenario as a MarketEvent span, replayed twice.
+
+        Expected:
+            Realized PnL 9.90, unrealized PnL 9.90, one unit long; both runs
+            give the same result.
+    */
+    void testReplayOfEvents()
+    {
+        const ReplayEngine engine { btcUsdt };
+        const std::vector<MarketEvent> events = scenario();
+
+        const ReplayResult first = engine.run(events);
+        const ReplayResult second = engine.run(events);
+
+        assertScenarioResult(first);
+        assertScenarioResult(second);
+        Assert(first.records == 4 && first.skipped == 0, "no event must be skipped");
+    }
+
+    /*
+        Input:
+            The scenario recorded by JournalRecorder into files of two
+            records, with an execution report and an event of another
+            instrument in between.
+
+        Expected:
+            The same result as the event replay; the two foreign records are
+            skipped; no sequence gap.
+    */
+    void testReplayOfJournal()
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "replay_engine_journal";
+        std::filesystem::remove_all(directory);
+
+        JournalRecorder recorder { JournalConfig {
+            .directory = directory,
+            .prefix = "replay",
+            .fileSize = sizeof(JournalFileHeader) + 2 * sizeof(JournalRecord)
+        } };
+        Assert(recorder.start().has_value(), "journal must start");
+
+        const std::vector<MarketEvent> events = scenario();
+        recorder.record(events[0]);
+        recorder.record(ExecutionReport {
+            .clientOrderId = 1,
+            .instrument = btcUsdt.id(),
+            .side = Side::Buy,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::Filled,
+            .price = Price { 6'500'010'000'000 },
+            .quantity = Light,
+            .filledQuantity = Light
+        });
+        recorder.record(events[1]);
+        MarketEvent foreign = events[1];
+        foreign.instrument = InstrumentId { 2 };
+        recorder.record(foreign);
+        recorder.record(events[2]);
+        recorder.record(events[3]);
+        recorder.stop();
+
+        const std::array<std::filesystem::path, 3> journals { recorder.filePath(1), recorder.filePath(2), recorder.filePath(3) };
+        const ReplayEngine engine { btcUsdt };
+
+        const std::expected<ReplayResult, ReplayError> first = engine.run(journals);
+        const std::expected<ReplayResult, ReplayError> second = engine.run(journals);
+        Assert(first.has_value() && second.has_value(), "journal must be replayed");
+
+        assertScenarioResult(*first);
+        assertScenarioResult(*second);
+        Assert(first->records == 6, "every record must be read");
+        Assert(first->skipped == 2, "execution report and foreign event must be skipped");
+        Assert(first->sequenceGaps == 0, "journal must have no gap");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            A missing journal; a file that is not a journal.
+
+        Expected:
+            CannotOpenJournal and InvalidJournal.
+    */
+    void testInvalidJournals()
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "replay_engine_invalid";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+
+        const ReplayEngine engine { btcUsdt };
+
+        const std::array missing { directory / "missing.journal" };
+        const std::expected<ReplayResult, ReplayError> notFound = engine.run(missing);
+        Assert(!notFound && notFound.error() == ReplayError::CannotOpenJournal, "missing journal must be reported");
+
+        const std::array invalid { directory / "invalid.journal" };
+        {
+            std::ofstream file { invalid[0] };
+            file << std::string(sizeof(JournalFileHeader), 'x');
+        }
+        const std::expected<ReplayResult, ReplayError> rejected = engine.run(invalid);
+        Assert(!rejected && rejected.error() == ReplayError::InvalidJournal, "invalid journal must be reported");
+
+        std::filesystem::remove_all(directory);
+    }
+}
+
+void replay_engine_test()
+{
+    testReplayOfEvents();
+    testReplayOfJournal();
+    testInvalidJournals();
+
+    std::cout << "All ReplayEngine tests: OK\n";
+}
@@ -0,0 +1,92 @@
+/**============================================================================
+Name        : json_config_loader_test.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : JsonConfigLoader unit tests.
+============================================================================**/
+
+#include "json_config_loader.hpp"
+#include "test_support/testing.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+    using trading::Quantity;
+    using trading::config::Config;
+    using trading::config::Error;
+    using trading::config::JsonConfigLoader;
+    using testing::Assert;
+
+    [[nodiscard]]
+    std::filesystem::path writeConfig(const std::string_view name, const std::string_view content)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file { path, std::ios::trunc };
+        file << content;
+        return path;
+    }
+
+    void testLoadsAllKeys()
+    {
+        const auto loaded = JsonConfigLoader::load(writeConfig("config_full.json", R"({
+            "instrument": 3,
+            "strategy": { "orderQuantity": 50000000, "thresholdNumerator": 6, "thresholdDenominator": 10 },
+            "risk": { "maxOrderQuantity": 200000000, "priceBandTicks": 25 }
+        })"));
+
+        Assert(loaded.has_value(), "valid config must load");
+        Assert(loaded->instrument == 3, "instrument must be read");
+        Assert(loaded->strategyOrderQuantity == Quantity { 50'000'000 }, "order quantity must be read");
+        Assert(loaded->strategyThresholdNumerator == 6 && loaded->strategyThresholdDenominator == 10,
+            "threshold must be read");
+        Assert(loaded->riskLimits.maxOrderQuantity == Quantity { 200'000'000 }, "risk limit must be read");
+        Assert(loaded->riskLimits.priceBand == 25, "price band must be read");
+        Assert(!loaded->riskLimits.maxNotional.has_value(), "missing risk limit must stay unset");
+    }
+
+    void testLoadsLoneThresholdField()
+    {
+        /* Input:    a file with only the threshold numerator, then one with only the denominator
+           Expected: both load, the other field stays unset */
+        const auto numerator = JsonConfigLoader::load(writeConfig("config_numerator.json",
+            R"({ "strategy": { "thresholdNumerator": 9 } })"));
+
+        Assert(numerator.has_value(), "lone numerator must load");
+        Assert(numerator->strategyThresholdNumerator == 9, "numerator must be read");
+        Assert(!numerator->strategyThresholdDenominator.has_value(), "missing denominator must stay unset");
+
+        const auto denominator = JsonConfigLoader::load(writeConfig("config_denominator.json",
+            R"({ "strategy": { "thresholdDenominator": 20 } })"));
+
+        Assert(denominator.has_value(), "lone denominator must load");
+        Assert(denominator->strategyThresholdDenominator == 20, "denominator must be read");
+        Assert(!denominator->strategyThresholdNumerator.has_value(), "missing numerator must stay unset");
+    }
+
+    void testRejectsInvalidFiles()
+    {
+        Assert(JsonConfigLoader::load(writeConfig("config_broken.json", "{ \"instrument\": ")).error() == Error::InvalidJson,
+            "broken JSON must be rejected");
+        Assert(JsonConfigLoader::load(writeConfig("config_zero_denominator.json",
+                R"({ "strategy": { "thresholdDenominator": 0 } })")).error() == Error::InvalidConfiguration,
+            "zero denominator must be rejected");
+        Assert(JsonConfigLoader::load(std::filesystem::temp_directory_path() / "config_missing.json").error()
+                == Error::FileOpenFailed,
+            "missing file must be reported");
+    }
+}
+
+void json_config_loader_test()
+{
+    testLoadsAllKeys();
+    testLoadsLoneThresholdField();
+    testRejectsInvalidFiles();
+
+    std::cout << "All JsonConfigLoader tests: OK\n";
+}
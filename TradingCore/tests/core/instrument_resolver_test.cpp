@@ -0,0 +1,144 @@
+/**============================================================================
+Name        : instrument_resolver_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : InstrumentResolver unit tests.
+============================================================================**/
+
+#include "instrument_resolver.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using trading::BasicInstrumentResolver;
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::InstrumentResolver;
+    using trading::Price;
+    using trading::Quantity;
+    using testing::Assert;
+
+    constexpr std::array instruments {
+        Instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } },
+        Instrument { InstrumentId { 2 }, "ETHUSDT", Price { 1'000'000 }, Quantity { 10'000 } },
+        Instrument { InstrumentId { 7 }, "SOLUSDT", Price { 1'000'000 }, Quantity { 100'000 } },
+        Instrument { InstrumentId { 9 }, "1000SHIBUSDT", Price { 1'000 }, Quantity { 100'000'000 } },
+        Instrument { InstrumentId { 11 }, "BTCUSDT_260925", Price { 10'000'000 }, Quantity { 100'000 } },
+        Instrument { InstrumentId { 12 }, "OP", Price { 1 }, Quantity { 1 } },
+        Instrument { InstrumentId { 13 }, "ABCDEFGHIJKLMNOP", Price { 1 }, Quantity { 1 } }
+    };
+
+    // The table of a fixed instrument list is built by the compiler.
+    constexpr InstrumentResolver compileTimeResolver { instruments };
+
+    static_assert(compileTimeResolver.isValid());
+    static_assert(compileTimeResolver.size() == instruments.size());
+    static_assert(compileTimeResolver.resolve("SOLUSDT") == InstrumentId { 7 });
+    static_assert(!compileTimeResolver.resolve("SOLUSDC").has_value());
+
+    void testResolvesConfiguredSymbols()
+    {
+        const InstrumentResolver resolver { instruments };
+
+        Assert(resolver.isValid(), "resolver must be valid");
+        Assert(resolver.size() == instruments.size(), "every instrument must be registered");
+
+        for (const Instrument& instrument : instruments)
+        {
+            Assert(resolver.resolve(instrument.symbol()) == instrument.id(), "symbol must resolve to its id");
+            Assert(compileTimeResolver.resolve(instrument.symbol()) == instrument.id(),
+                "compile-time table must resolve at runtime");
+        }
+    }
+
+    void testRejectsUnknownSymbols()
+    {
+        const InstrumentResolver resolver { instruments };
+
+        Assert(!resolver.resolve("").has_value(), "empty symbol must not resolve");
+        Assert(!resolver.resolve("BTCUSD").has_value(), "prefix must not resolve");
+        Assert(!resolver.resolve("BTCUSDTT").has_value(), "longer symbol must not resolve");
+        Assert(!resolver.resolve("btcusdt").has_value(), "symbols are case sensitive");
+        Assert(!resolver.resolve("ABCDEFGHIJKLMNOPQ").has_value(), "too long symbol must not resolve");
+        Assert(!resolver.resolve(std::string_view { "OP\0", 3 }).has_value(), "trailing zero byte is part of the symbol");
+    }
+
+    void testUsesOnlySymbolBytes()
+    {
+        const InstrumentResolver resolver { instruments };
+
+        // Symbols are usually views into a larger message.
+        const std::string message { R"({"s":"BTCUSDT_260925","U":1})" };
+        const std::string_view symbol = std::string_view { message }.substr(6, 7);
+
+        Assert(resolver.resolve(symbol) == InstrumentId { 1 }, "view into a message must resolve");
+        Assert(resolver.resolve(std::string_view { message }.substr(6, 14)) == InstrumentId { 11 },
+            "longer view must resolve");
+    }
+
+    void testManyInstruments()
+    {
+        std::vector<std::string> symbols;
+        for (int base { 0 }; base < 50; ++base)
+        {
+            for (const char* quote : { "USDT", "USDC", "BTC", "FDUSD", "EUR" })
+                symbols.push_back("C" + std::to_string(base) + quote);
+        }
+
+        std::vector<Instrument> configured;
+        for (std::size_t index { 0 }; index < symbols.size(); ++index)
+            configured.emplace_back(static_cast<InstrumentId>(index + 100), symbols[index], Price { 1 }, Quantity { 1 });
+
+        const InstrumentResolver resolver { configured };
+
+        Assert(resolver.isValid(), "resolver with many instruments must be valid");
+        Assert(resolver.size() == configured.size(), "every instrument must be registered");
+
+        for (const Instrument& instrument : configured)
+            Assert(resolver.resolve(instrument.symbol()) == instrument.id(), "symbol must resolve to its id");
+
+        Assert(!resolver.resolve("C50USDT").has_value(), "unknown symbol must not resolve");
+    }
+
+    void testInvalidInstrumentLists()
+    {
+        constexpr std::array duplicates {
+            Instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1 }, Quantity { 1 } },
+            Instrument { InstrumentId { 2 }, "BTCUSDT", Price { 1 }, Quantity { 1 } }
+        };
+        constexpr std::array tooLong {
+            Instrument { InstrumentId { 1 }, "ABCDEFGHIJKLMNOPQ", Price { 1 }, Quantity { 1 } }
+        };
+        constexpr std::array tooMany {
+            Instrument { InstrumentId { 1 }, "A", Price { 1 }, Quantity { 1 } },
+            Instrument { InstrumentId { 2 }, "B", Price { 1 }, Quantity { 1 } },
+            Instrument { InstrumentId { 3 }, "C", Price { 1 }, Quantity { 1 } }
+        };
+
+        const InstrumentResolver duplicateResolver { duplicates };
+        Assert(!duplicateResolver.isValid(), "duplicate symbols must be rejected");
+        Assert(!duplicateResolver.resolve("BTCUSDT").has_value(), "invalid resolver must resolve nothing");
+
+        Assert(!InstrumentResolver { tooLong }.isValid(), "too long symbol must be rejected");
+        Assert(!BasicInstrumentResolver<2> { tooMany }.isValid(), "capacity overflow must be rejected");
+        Assert(!InstrumentResolver {}.resolve("BTCUSDT").has_value(), "empty resolver must resolve nothing");
+    }
+}
+
+void instrument_resolver_test()
+{
+    testResolvesConfiguredSymbols();
+    testRejectsUnknownSymbols();
+    testUsesOnlySymbolBytes();
+    testManyInstruments();
+    testInvalidInstrumentLists();
+
+    std::cout << "All InstrumentResolver tests: OK\n";
+}
@@ -0,0 +1,83 @@
+/**============================================================================
+Name        : instrument_slots_test.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : InstrumentSlots unit tests.
+============================================================================**/
+
+#include "instrument_slots.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <span>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::InstrumentSlots;
+    using trading::MaxInstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using testing::Assert;
+
+    constexpr std::array instruments {
+        Instrument { InstrumentId { 7 }, "SOLUSDT", Price { 1 }, Quantity { 1 } },
+        Instrument { InstrumentId { 2 }, "ETHUSDT", Price { 1 }, Quantity { 1 } },
+        Instrument { MaxInstrumentId + 1, "HUGE", Price { 1 }, Quantity { 1 } }
+    };
+
+    void testSlotsFollowAddOrder()
+    {
+        InstrumentSlots slots { instruments };
+
+        Assert(slots.add(InstrumentId { 7 }) == 0, "first instrument must get slot 0");
+        Assert(slots.add(InstrumentId { 2 }) == 1, "second instrument must get slot 1");
+        Assert(slots.size() == 2, "two slots must be handed out");
+
+        Assert(slots.slotOf(InstrumentId { 7 }) == 0, "slotOf must return the added slot");
+        Assert(slots.slotOf(InstrumentId { 2 }) == 1, "slotOf must return the added slot");
+        Assert(!slots.contains(InstrumentId { 3 }), "an instrument never added must have no slot");
+        Assert(slots.slotOf(InstrumentId { 1'000 }) == InstrumentSlots::NoSlot, "an id past the table must have no slot");
+    }
+
+    void testDuplicateAndOversizedIdsGetNoSlot()
+    {
+        InstrumentSlots slots { instruments };
+
+        Assert(slots.add(InstrumentId { 7 }) == 0, "first add must get a slot");
+        Assert(slots.add(InstrumentId { 7 }) == InstrumentSlots::NoSlot, "a duplicate id must get no slot");
+        Assert(slots.add(MaxInstrumentId + 1) == InstrumentSlots::NoSlot, "an id above MaxInstrumentId must get no slot");
+        Assert(slots.size() == 1, "rejected ids must not take a slot");
+    }
+
+    void testDefaultTableGrowsOnAdd()
+    {
+        InstrumentSlots slots;
+
+        Assert(!slots.contains(InstrumentId { 0 }), "an empty table must contain nothing");
+        Assert(slots.add(MaxInstrumentId) == 0, "the largest id must get a slot");
+        Assert(slots.add(InstrumentId { 5 }) == 1, "a smaller id must get the next slot");
+        Assert(slots.slotOf(MaxInstrumentId) == 0, "the grown table must keep earlier slots");
+    }
+
+    void testInstrumentTableSize()
+    {
+        Assert(trading::instrumentTableSize(instruments) == 8, "table must cover the largest id in range");
+        Assert(trading::instrumentTableSize(std::span<const Instrument> {}) == MaxInstrumentId + 1,
+               "no instruments must cover every id");
+    }
+}
+
+void instrument_slots_test()
+{
+    testSlotsFollowAddOrder();
+    testDuplicateAndOversizedIdsGetNoSlot();
+    testDefaultTableGrowsOnAdd();
+    testInstrumentTableSize();
+
+    std::cout << "All InstrumentSlots tests: OK\n";
+}
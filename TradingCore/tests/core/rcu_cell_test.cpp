@@ -0,0 +1,137 @@
+/**============================================================================
+Name        : rcu_cell_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : RcuCell unit tests.
+============================================================================**/
+
+#include "rcu_cell.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    using trading::RcuCell;
+    using testing::Assert;
+
+    // Every field carries the same value: a torn read shows up as a mismatch.
+    struct Snapshot
+    {
+        std::array<uint64_t, 16> values {};
+    };
+
+    [[nodiscard]]
+    Snapshot snapshotOf(const uint64_t value)
+    {
+        Snapshot snapshot {};
+        snapshot.values.fill(value);
+        return snapshot;
+    }
+
+    [[nodiscard]]
+    bool isConsistent(const Snapshot& snapshot)
+    {
+        for (const uint64_t value : snapshot.values)
+        {
+            if (value != snapshot.values.front())
+                return false;
+        }
+        return true;
+    }
+
+    void testInitialValueIsAlreadyRead()
+    {
+        RcuCell<int> cell { 7 };
+
+        Assert(cell.update() == nullptr, "initial value must not be reported as new");
+        Assert(cell.current() == 7, "current must return the initial value");
+    }
+
+    void testUpdateReturnsLatestValue()
+    {
+        RcuCell<int> cell { 0 };
+
+        cell.publish(1);
+        const int* value = cell.update();
+        Assert(value != nullptr && *value == 1, "update must return the published value");
+        Assert(cell.update() == nullptr, "value must be reported once");
+
+        cell.publish(2);
+        cell.publish(3);
+        cell.publish(4);
+        value = cell.update();
+        Assert(value != nullptr && *value == 4, "update must skip to the latest value");
+        Assert(cell.current() == 4, "current must return the latest value");
+    }
+
+    void testHeldValueIsNotOverwritten()
+    {
+        RcuCell<int> cell { 0 };
+
+        cell.publish(1);
+        const int* held = cell.update();
+
+        for (int value { 2 }; value < 10; ++value)
+            cell.publish(value);
+
+        Assert(*held == 1, "writer must not overwrite the value held by the reader");
+
+        const int* latest = cell.update();
+        Assert(latest != nullptr && *latest == 9, "reader must see the latest value");
+    }
+
+    void testConcurrentPublishHasNoTornReads()
+    {
+        constexpr uint64_t Publishes { 200'000 };
+
+        RcuCell<Snapshot> cell { snapshotOf(0) };
+        std::atomic<bool> done { false };
+
+        std::thread writer { [&cell, &done] {
+            for (uint64_t value { 1 }; value <= Publishes; ++value)
+                cell.publish(snapshotOf(value));
+            done.store(true, std::memory_order_release);
+        } };
+
+        uint64_t last { 0 };
+        bool consistent { true };
+        bool monotonic { true };
+
+        while (!done.load(std::memory_order_acquire) || last != Publishes)
+        {
+            const Snapshot* snapshot = cell.update();
+            if (snapshot == nullptr)
+                continue;
+
+            consistent = consistent && isConsistent(*snapshot);
+            monotonic = monotonic && snapshot->values.front() > last;
+            last = snapshot->values.front();
+
+            // Keep reading the held value while the writer publishes.
+            consistent = consistent && isConsistent(cell.current());
+        }
+
+        writer.join();
+
+        Assert(consistent, "reader must never see a partially written value");
+        Assert(monotonic, "reader must see values in publication order");
+        Assert(last == Publishes, "reader must end with the last published value");
+    }
+}
+
+void rcu_cell_test()
+{
+    testInitialValueIsAlreadyRead();
+    testUpdateReturnsLatestValue();
+    testHeldValueIsNotOverwritten();
+    testConcurrentPublishHasNoTornReads();
+
+    std::cout << "All RcuCell tests: OK\n";
+}
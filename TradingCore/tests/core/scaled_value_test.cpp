@@ -0,0 +1,236 @@
+/**============================================================================
+Name        : scaled_value_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : ScaledValue decimal parsing and formatting unit tests.
+============================================================================**/
+
+#include "price.hpp"
+#include "quantity.hpp"
+#include "instrument.hpp"
+#include "decimal_conversion.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::details::DecimalConversionError;
+    using trading::details::DecimalFormat;
+    using trading::details::DecimalRounding;
+    using trading::details::parseDecimal;
+    using trading::details::parseDecimalScalar;
+    using testing::Assert;
+
+    // The scalar path is the one used during constant evaluation.
+    static_assert(Price::fromDecimalString("89218.34000000")->raw() == 8'921'834'000'000);
+    static_assert(Quantity::fromDecimalString("0.001")->raw() == 100'000);
+    static_assert(Price::fromDecimalString("-1.5")->raw() == -150'000'000);
+    static_assert(Price::fromDecimalString("1.2.3").error() == DecimalConversionError::InvalidCharacter);
+    static_assert(trading::details::decimalPlacesOf<8>(1'000'000) == 2);
+    static_assert(trading::details::decimalPlacesOf<8>(100'000'000) == 0);
+    static_assert(trading::details::decimalPlacesOf<8>(1) == 8);
+
+    // BTCUSDT: tick size 0.01, lot size 0.00001
+    constexpr Instrument instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+    template<typename Value>
+    [[nodiscard]]
+    std::string format(const Value value, const DecimalFormat format = {})
+    {
+        std::array<char, Value::MaxChars> buffer {};
+        const auto [end, error] = value.toChars(buffer.data(), buffer.data() + buffer.size(), format);
+        Assert(error == std::errc {}, "formatting must succeed");
+        return std::string { buffer.data(), end };
+    }
+
+    void testTypicalExchangeValues()
+    {
+        Assert(Price::fromDecimalString("89218.34000000") == Price { 8'921'834'000'000 }, "invalid price");
+        Assert(Price::fromDecimalString("0.10000000") == Price { 10'000'000 }, "invalid price below one");
+        Assert(Quantity::fromDecimalString("1.00000000") == Quantity { 100'000'000 }, "invalid quantity");
+        Assert(Quantity::fromDecimalString("0.00000001") == Quantity { 1 }, "invalid smallest quantity");
+        Assert(Quantity::fromDecimalString("0.00000000") == Quantity {}, "invalid zero quantity");
+        Assert(Price::fromDecimalString("65000") == Price { 6'500'000'000'000 }, "invalid integer price");
+        Assert(Price::fromDecimalString("12345678.87654321") == Price { 1'234'567'887'654'321 }, "invalid 16-digit price");
+    }
+
+    void testSignsAndLeadingZeros()
+    {
+        Assert(Price::fromDecimalString("-0.5") == Price { -50'000'000 }, "invalid negative price");
+        Assert(Price::fromDecimalString("-0") == Price {}, "negative zero must be zero");
+        Assert(Price::fromDecimalString("000123.4") == Price { 12'340'000'000 }, "leading zeros must be ignored");
+    }
+
+    void testInvalidInput()
+    {
+        constexpr std::array invalid {
+            "-", ".5", "5.", "1.2.3", "1,5", "+1", " 1", "1 ", "1e5", "abc", "1.-5", "--1", "0x10"
+        };
+
+        Assert(Price::fromDecimalString("").error() == DecimalConversionError::Empty, "empty string must be rejected");
+
+        for (const std::string_view text : invalid)
+        {
+            const auto value = Price::fromDecimalString(text);
+            Assert(!value.has_value(), "invalid string must be rejected");
+            Assert(value.error() == DecimalConversionError::InvalidCharacter, "invalid error code");
+        }
+    }
+
+    void testOverflow()
+    {
+        // int64_t max is 92233720368.54775807 with eight decimal places.
+        Assert(Price::fromDecimalString("92233720368.54775807") == Price { std::numeric_limits<int64_t>::max() },
+            "largest value must be accepted");
+        Assert(Price::fromDecimalString("92233720368.54775808").error() == DecimalConversionError::Overflow,
+            "largest value + 1 must overflow");
+        Assert(Price::fromDecimalString("92233720369").error() == DecimalConversionError::Overflow,
+            "integer part must overflow");
+        Assert(Price::fromDecimalString("123456789012345678901234").error() == DecimalConversionError::Overflow,
+            "long integer part must overflow");
+        Assert(Price::fromDecimalString("00000000000000000000001.5") == Price { 150'000'000 },
+            "leading zeros must not count towards overflow");
+    }
+
+    void testRounding()
+    {
+        Assert(Price::fromDecimalString("1.123456780000") == Price { 112'345'678 }, "trailing zeros must be exact");
+        Assert(Price::fromDecimalString("1.123456789").error() == DecimalConversionError::PrecisionLoss,
+            "excess digits must be rejected by default");
+
+        Assert(Price::fromDecimalString("1.123456789", DecimalRounding::TowardZero) == Price { 112'345'678 },
+            "invalid truncation");
+        Assert(Price::fromDecimalString("1.123456785", DecimalRounding::HalfAwayFromZero) == Price { 112'345'679 },
+            "tie must round away from zero");
+        Assert(Price::fromDecimalString("1.1234567849", DecimalRounding::HalfAwayFromZero) == Price { 112'345'678 },
+            "value below the tie must round down");
+        Assert(Price::fromDecimalString("-1.123456785", DecimalRounding::HalfAwayFromZero) == Price { -112'345'679 },
+            "negative tie must round away from zero");
+        Assert(Price::fromDecimalString("92233720368.547758075", DecimalRounding::HalfAwayFromZero).error()
+            == DecimalConversionError::Overflow, "rounding must not overflow");
+    }
+
+    void testSimdAndScalarAgree()
+    {
+        /*
+            Every string is converted at the end of a buffer that is followed
+            by a page boundary as well as in the middle of the buffer, so that
+            both the in-place and the copying load of the SIMD path are used.
+        */
+        const std::array inputs {
+            "0", "1", "9", "10", "99999999", "100000000", "0.1", "0.12345678", "12345678.12345678",
+            "1234567.1234567", "89218.34000000", "65000.01", "1.", ".1", "1..0", "1.2.", "12a4.5",
+            "1/2", "1:2", "123456789.1", "1.123456789", "-5.5", "1 2", "12345678.123456789"
+        };
+
+        constexpr std::size_t PageSize { 4096 };
+        const auto pages = std::make_unique<char[]>(3 * PageSize);
+        char* const boundary = reinterpret_cast<char*>(
+            (reinterpret_cast<uintptr_t>(pages.get()) + 2 * PageSize) / PageSize * PageSize);
+
+        for (const std::string_view text : inputs)
+        {
+            const auto expected = parseDecimalScalar<8>(text, DecimalRounding::Exact);
+
+            char* const atBoundary = boundary - text.size();
+            std::memcpy(atBoundary, text.data(), text.size());
+
+            const std::string copy { text };
+
+            Assert(parseDecimal<8>({ atBoundary, text.size() }) == expected, "conversion at page end differs");
+            Assert(parseDecimal<8>(copy) == expected, "conversion differs from the scalar path");
+        }
+    }
+
+    void testToCharsFullPrecision()
+    {
+        Assert(format(Price { 8'921'834'000'000 }) == "89218.34000000", "invalid price text");
+        Assert(format(Quantity { 1 }) == "0.00000001", "invalid smallest quantity text");
+        Assert(format(Quantity {}) == "0.00000000", "invalid zero text");
+        Assert(format(Price { -150'000'000 }) == "-1.50000000", "invalid negative text");
+        Assert(format(Price { std::numeric_limits<int64_t>::max() }) == "92233720368.54775807", "invalid max text");
+        Assert(format(Price { std::numeric_limits<int64_t>::min() }) == "-92233720368.54775808", "invalid min text");
+    }
+
+    void testToCharsTrimmed()
+    {
+        constexpr DecimalFormat trimmed { .trimTrailingZeros = true };
+
+        Assert(format(Price { 8'921'834'000'000 }, trimmed) == "89218.34", "trailing zeros must be trimmed");
+        Assert(format(Price { 6'500'000'000'000 }, trimmed) == "65000", "decimal point must be dropped");
+        Assert(format(Quantity {}, trimmed) == "0", "zero must be trimmed to 0");
+        Assert(format(Quantity { 1 }, trimmed) == "0.00000001", "significant digits must be kept");
+    }
+
+    void testToCharsInstrumentPrecision()
+    {
+        Assert(instrument.priceDecimalPlaces() == 2, "invalid price precision");
+        Assert(instrument.quantityDecimalPlaces() == 5, "invalid quantity precision");
+
+        const DecimalFormat priceFormat { .fractionDigits = instrument.priceDecimalPlaces() };
+        const DecimalFormat quantityFormat { .fractionDigits = instrument.quantityDecimalPlaces() };
+
+        Assert(format(Price { 8'921'830'000'000 }, priceFormat) == "89218.30", "invalid tick precision text");
+        Assert(format(Quantity { 3'110'000 }, quantityFormat) == "0.03110", "invalid lot precision text");
+        Assert(format(Price { 8'921'800'000'000 }, { .fractionDigits = 0 }) == "89218", "invalid integer text");
+
+        // The value is not on the tick grid; formatting must not round it.
+        std::array<char, Price::MaxChars> buffer {};
+        const auto result = Price { 8'921'834'500'000 }.toChars(buffer.data(), buffer.data() + buffer.size(), priceFormat);
+        Assert(result.ec == std::errc::invalid_argument, "value off the tick grid must be rejected");
+    }
+
+    void testToCharsSmallBuffer()
+    {
+        std::array<char, 8> buffer {};
+        const Price price { 8'921'834'000'000 };
+
+        const auto result = price.toChars(buffer.data(), buffer.data() + buffer.size());
+        Assert(result.ec == std::errc::value_too_large, "small buffer must be rejected");
+        Assert(result.ptr == buffer.data() + buffer.size(), "ptr must be last on error");
+
+        const auto fits = price.toChars(buffer.data(), buffer.data() + buffer.size(), { .trimTrailingZeros = true });
+        Assert(fits.ec == std::errc {} && fits.ptr == buffer.data() + 8, "exact-size buffer must be accepted");
+    }
+
+    void testToCharsRoundTrip()
+    {
+        for (const int64_t raw : { int64_t { 0 }, int64_t { 1 }, int64_t { 99 }, int64_t { 100'000'000 },
+                                   int64_t { 123'456'789'012 }, int64_t { -987'654'321 } })
+        {
+            const Price price { raw };
+            Assert(Price::fromDecimalString(format(price)) == price, "full precision round trip failed");
+            Assert(Price::fromDecimalString(format(price, { .trimTrailingZeros = true })) == price,
+                "trimmed round trip failed");
+        }
+    }
+}
+
+void scaled_value_test()
+{
+    testTypicalExchangeValues();
+    testSignsAndLeadingZeros();
+    testInvalidInput();
+    testOverflow();
+    testRounding();
+    testSimdAndScalarAgree();
+    testToCharsFullPrecision();
+    testToCharsTrimmed();
+    testToCharsInstrumentPrecision();
+    testToCharsSmallBuffer();
+    testToCharsRoundTrip();
+
+    std::cout << "All ScaledValue tests: OK\n";
+}
@@ -0,0 +1,92 @@
+/**============================================================================
+Name        : seqlock_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Seqlock unit tests.
+============================================================================**/
+
+#include "seqlock.hpp"
+#include "test_support/testing.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    using trading::Seqlock;
+    using testing::Assert;
+
+    // Both words carry the same value: a torn read shows up as a mismatch.
+    struct Pair
+    {
+        uint64_t first { 0 };
+        uint64_t second { 0 };
+    };
+
+    void testStoreAndLoad()
+    {
+        Seqlock<Pair> slot;
+
+        Assert(slot.version() == 0, "new slot must have version zero");
+        Assert(slot.load().first == 0 && slot.load().second == 0, "new slot must hold a zero value");
+
+        slot.store(Pair { .first = 1, .second = 2 });
+        const Pair value = slot.load();
+
+        Assert(value.first == 1 && value.second == 2, "load must return the stored value");
+        Assert(slot.version() == 1, "store must increment the version");
+    }
+
+    void testInitialValue()
+    {
+        const Seqlock<Pair> slot { Pair { .first = 5, .second = 5 } };
+
+        Assert(slot.load().first == 5, "initial value must be stored");
+        Assert(slot.version() == 1, "initial value counts as one store");
+    }
+
+    void testConcurrentStoreHasNoTornReads()
+    {
+        constexpr uint64_t Stores { 1'000'000 };
+
+        Seqlock<Pair> slot;
+        std::atomic<bool> done { false };
+
+        std::thread writer { [&slot, &done] {
+            for (uint64_t value { 1 }; value <= Stores; ++value)
+                slot.store(Pair { .first = value, .second = value });
+            done.store(true, std::memory_order_release);
+        } };
+
+        bool consistent { true };
+        bool monotonic { true };
+        uint64_t last { 0 };
+
+        while (!done.load(std::memory_order_acquire))
+        {
+            const Pair value = slot.load();
+            consistent = consistent && value.first == value.second;
+            monotonic = monotonic && value.first >= last;
+            last = value.first;
+        }
+
+        writer.join();
+
+        Assert(consistent, "reader must never see a partially written value");
+        Assert(monotonic, "reader must never see an older value after a newer one");
+        Assert(slot.load().first == Stores, "last store must be visible");
+    }
+}
+
+void seqlock_test()
+{
+    testStoreAndLoad();
+    testInitialValue();
+    testConcurrentStoreHasNoTornReads();
+
+    std::cout << "All Seqlock tests: OK\n";
+}
@@ -0,0 +1,114 @@
+/**============================================================================
+Name        : spsc_queue_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : SpscQueue unit tests.
+============================================================================**/
+
+#include "spsc_queue.hpp"
+#include "test_support/testing.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    using trading::SpscQueue;
+    using testing::Assert;
+
+    void testFifoAndCapacity()
+    {
+        SpscQueue<int, 4> queue;
+
+        Assert(queue.empty(), "new queue must be empty");
+        Assert(queue.capacity() == 4, "invalid capacity");
+
+        for (int value { 0 }; value < 4; ++value)
+            Assert(queue.tryPush(value), "push into a non-full queue must succeed");
+
+        Assert(!queue.tryPush(4), "push into a full queue must fail");
+        Assert(queue.size() == 4, "full queue must report its capacity as size");
+
+        int value { -1 };
+        for (int expected { 0 }; expected < 4; ++expected)
+        {
+            Assert(queue.tryPop(value), "pop from a non-empty queue must succeed");
+            Assert(value == expected, "items must be popped in FIFO order");
+        }
+
+        Assert(!queue.tryPop(value), "pop from an empty queue must fail");
+        Assert(queue.empty(), "drained queue must be empty");
+    }
+
+    void testInPlaceAccess()
+    {
+        SpscQueue<int, 2> queue;
+
+        int* slot = queue.tryClaim();
+        Assert(slot != nullptr, "claim in an empty queue must succeed");
+        *slot = 7;
+        Assert(queue.front() == nullptr, "claimed slot must stay invisible until published");
+
+        queue.publish();
+        Assert(queue.front() != nullptr && *queue.front() == 7, "published slot must be visible");
+
+        queue.pop();
+        Assert(queue.empty(), "popped slot must be released");
+    }
+
+    void testWrapAround()
+    {
+        SpscQueue<uint32_t, 8> queue;
+        uint32_t value { 0 };
+
+        for (uint32_t round { 0 }; round < 100; ++round)
+        {
+            Assert(queue.tryPush(round) && queue.tryPush(round + 1), "push must succeed after wrap around");
+            Assert(queue.tryPop(value) && value == round, "wrap around must keep FIFO order");
+            Assert(queue.tryPop(value) && value == round + 1, "wrap around must keep FIFO order");
+        }
+    }
+
+    void testTwoThreads()
+    {
+        constexpr uint64_t Count { 200'000 };
+        SpscQueue<uint64_t, 1024> queue;
+
+        std::thread producer { [&queue] {
+            for (uint64_t value { 0 }; value < Count; ++value)
+            {
+                while (!queue.tryPush(value))
+                    std::this_thread::yield();
+            }
+        } };
+
+        uint64_t expected { 0 };
+        uint64_t value { 0 };
+        while (expected < Count)
+        {
+            if (!queue.tryPop(value))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            Assert(value == expected, "consumer must see every item once and in order");
+            ++expected;
+        }
+
+        producer.join();
+        Assert(queue.empty(), "queue must be empty after the consumer drained it");
+    }
+}
+
+void spsc_queue_test()
+{
+    testFifoAndCapacity();
+    testInPlaceAccess();
+    testWrapAround();
+    testTwoThreads();
+
+    std::cout << "All SpscQueue tests: OK\n";
+}
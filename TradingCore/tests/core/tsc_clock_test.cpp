@@ -0,0 +1,118 @@
+/**============================================================================
+Name        : tsc_clock_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : TscClock unit tests.
+============================================================================**/
+
+#include "timestamp.hpp"
+#include "tsc_clock.hpp"
+#include "test_support/testing.hpp"
+
+#include <cstdint>
+#include <iostream>
+
+namespace
+{
+    using trading::Timestamp;
+    using trading::TscClock;
+    using testing::Assert;
+
+    constexpr uint64_t Tolerance { 1'000'000 };
+
+    [[nodiscard]]
+    uint64_t distance(const Timestamp lhs, const Timestamp rhs) noexcept
+    {
+        return lhs > rhs ? lhs - rhs : rhs - lhs;
+    }
+
+    void testCalibration()
+    {
+        const TscClock& clock = TscClock::instance();
+
+        Assert(clock.isTscBased() == TscClock::hasInvariantTsc(), "TSC must be used only if it is invariant");
+        if (clock.isTscBased())
+        {
+            Assert(clock.ticksPerNanosecond() > 0.1 && clock.ticksPerNanosecond() < 10.0,
+                "calibrated TSC frequency must be plausible");
+        }
+    }
+
+    void testFollowsSteadyClock()
+    {
+        for (int sample { 0 }; sample < 100; ++sample)
+        {
+            const Timestamp fast = Timestamp::nowFast();
+            const Timestamp steady = Timestamp::now();
+            Assert(distance(fast, steady) < Tolerance, "nowFast must stay close to now");
+        }
+    }
+
+    void testMonotonic()
+    {
+        Timestamp previous = Timestamp::nowFast();
+        for (int sample { 0 }; sample < 100'000; ++sample)
+        {
+            if (sample % 10'000 == 0)
+                TscClock::instance().recalibrate();
+
+            const Timestamp current = Timestamp::nowFast();
+            Assert(current >= previous, "nowFast must not go backwards");
+            previous = current;
+        }
+
+        Assert(distance(Timestamp::nowFast(), Timestamp::now()) < Tolerance,
+            "recalibrated clock must stay close to now");
+    }
+
+    [[nodiscard]]
+    uint64_t advance(const TscClock::Correction& correction, const uint64_t ticks) noexcept
+    {
+        return correction.baseNanoseconds + static_cast<uint64_t>((static_cast<unsigned __int128>(ticks) * correction.multiplier) >> 32);
+    }
+
+    void testAheadClockIsSlewed()
+    {
+        /* Input:    a clock 5 us ahead of CLOCK_MONOTONIC, one tick per nanosecond
+           Expected: the base stays, the clock meets CLOCK_MONOTONIC one period later */
+        constexpr uint64_t Rate { uint64_t { 1 } << 32 };
+        constexpr uint64_t Period { TscClock::RecalibrationPeriodNanoseconds };
+        constexpr uint64_t Monotonic { 1'000'000'000'000 };
+
+        const TscClock::Correction ahead = TscClock::slew(Monotonic + 5'000, Monotonic, Rate);
+        Assert(ahead.baseNanoseconds == Monotonic + 5'000, "an ahead clock must not move backwards");
+        Assert(ahead.multiplier < Rate, "an ahead clock must slow down");
+        Assert(distance(Timestamp { advance(ahead, Period) }, Timestamp { Monotonic + Period }) <= 1,
+            "an ahead clock must converge within a period");
+
+        /* Input:    a clock three periods ahead
+           Expected: half rate, the offset shrinks by half a period per period */
+        uint64_t monotonic { Monotonic };
+        uint64_t current { Monotonic + 3 * Period };
+        for (int period { 0 }; period < 6; ++period)
+        {
+            const TscClock::Correction correction = TscClock::slew(current, monotonic, Rate);
+            Assert(correction.multiplier >= Rate / TscClock::MaxSlewDivisor, "slewing must keep the clock advancing");
+            current = advance(correction, Period);
+            monotonic += Period;
+        }
+        Assert(distance(Timestamp { current }, Timestamp { monotonic }) <= 6, "a large offset must be slewed away");
+
+        /* Input:    a clock 5 us behind
+           Expected: jumps forward to CLOCK_MONOTONIC at the measured rate */
+        const TscClock::Correction behind = TscClock::slew(Monotonic - 5'000, Monotonic, Rate);
+        Assert(behind.baseNanoseconds == Monotonic && behind.multiplier == Rate, "a late clock must jump forward");
+    }
+}
+
+void tsc_clock_test()
+{
+    testCalibration();
+    testFollowsSteadyClock();
+    testMonotonic();
+    testAheadClockIsSlewed();
+
+    std::cout << "All TscClock tests: OK\n";
+}
@@ -0,0 +1,116 @@
+/**============================================================================
+Name        : hmac_sha256_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Sha256 / HmacSha256 unit tests.
+============================================================================**/
+
+#include "hmac_sha256.hpp"
+#include "sha256.hpp"
+#include "HexConverter.hpp"
+#include "test_support/testing.hpp"
+
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using trading::crypto::HmacSha256;
+    using trading::crypto::Sha256;
+    using testing::Assert;
+
+    [[nodiscard]]
+    std::span<const std::byte> bytesOf(const std::string_view text)
+    {
+        return std::as_bytes(std::span { text });
+    }
+
+    [[nodiscard]]
+    std::string hexOf(const Sha256::Digest& digest)
+    {
+        std::string hex(2 * digest.size(), '\0');
+        HexConverter::bytesToLowerHex(reinterpret_cast<const uint8_t*>(digest.data()), digest.size(), hex.data());
+        return hex;
+    }
+
+    void testHashVectors()
+    {
+        /* Input:    FIPS 180-4 examples: empty, "abc", the two-block 448-bit message
+           Expected: published digests */
+        Assert(hexOf(Sha256::hash({})) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+            "invalid digest of the empty message");
+        Assert(hexOf(Sha256::hash(bytesOf("abc"))) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+            "invalid digest of abc");
+        Assert(hexOf(Sha256::hash(bytesOf("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"))) ==
+               "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+            "invalid digest of the 448-bit message");
+    }
+
+    void testIncrementalUpdate()
+    {
+        /* Input:    1000 'a' in pieces of every size from 1 to 130 bytes
+           Expected: the digest of the whole message */
+        const std::string message(1000, 'a');
+        const std::string expected { "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3" };
+        Assert(hexOf(Sha256::hash(bytesOf(message))) == expected, "invalid digest of 1000 'a'");
+
+        for (std::size_t piece { 1 }; piece <= 130; ++piece)
+        {
+            Sha256 sha;
+            for (std::size_t offset { 0 }; offset < message.size(); offset += piece)
+                sha.update(bytesOf(std::string_view { message }.substr(offset, piece)));
+
+            Assert(hexOf(sha.finish()) == expected, "incremental digest must match");
+        }
+    }
+
+    void testMidstate()
+    {
+        /* Input:    hash resumed from the midstate after the first block
+           Expected: the digest of the whole message */
+        const std::string message(200, 'a');
+
+        Sha256 prefix;
+        prefix.update(bytesOf(std::string_view { message }.substr(0, Sha256::BlockSize)));
+        Assert(prefix.processedBytes() == Sha256::BlockSize, "invalid processed bytes");
+
+        Sha256 resumed { prefix.state(), prefix.processedBytes() };
+        resumed.update(bytesOf(std::string_view { message }.substr(Sha256::BlockSize)));
+        Assert(resumed.finish() == Sha256::hash(bytesOf(message)), "resumed digest must match");
+    }
+
+    void testHmacVectors()
+    {
+        /* Input:    RFC 4231 test cases 1, 2 and 6 (key longer than a block)
+           Expected: published HMAC-SHA256 values, for repeated signs too */
+        const std::string key1(20, '\x0b');
+        const HmacSha256 hmac1 { bytesOf(key1) };
+        Assert(hexOf(hmac1.sign(bytesOf("Hi There"))) ==
+               "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7", "invalid RFC 4231 case 1");
+        Assert(hexOf(hmac1.sign(bytesOf("Hi There"))) ==
+               "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7", "sign must not change the midstates");
+
+        const HmacSha256 hmac2 { bytesOf("Jefe") };
+        Assert(hexOf(hmac2.sign(bytesOf("what do ya want for nothing?"))) ==
+               "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843", "invalid RFC 4231 case 2");
+
+        const std::string key6(131, '\xaa');
+        const HmacSha256 hmac6 { bytesOf(key6) };
+        Assert(hexOf(hmac6.sign(bytesOf("Test Using Larger Than Block-Size Key - Hash Key First"))) ==
+               "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54", "invalid RFC 4231 case 6");
+    }
+}
+
+void hmac_sha256_test()
+{
+    testHashVectors();
+    testIncrementalUpdate();
+    testMidstate();
+    testHmacVectors();
+
+    std::cout << "All HmacSha256 tests: OK\n";
+}
@@ -0,0 +1,185 @@
+/**============================================================================
+Name        : binance_market_data_parser_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : BinanceMarketDataParser unit tests.
+============================================================================**/
+
+#include "binance_market_data_parser.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::Timestamp;
+    using trading::exchanges::binance::BinanceMarketDataParser;
+    using trading::market_data::BookSnapshot;
+    using trading::market_data::BookUpdates;
+    using trading::market_data::ParseResult;
+    using testing::Assert;
+
+    constexpr Instrument btcUsdt { InstrumentId { 7 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+    // First message of resources/data/binance/depth.json
+    const std::string combinedDepthUpdate {
+        R"({"stream":"btcusdt@depth@100ms","data":{"e":"depthUpdate","E":1765107346014,"s":"BTCUSDT",)"
+        R"("U":82626886844,"u":82626886850,"b":[["89218.34000000","0.03110000"],["80325.00000000","0.00266000"],)"
+        R"(["71400.63000000","0.14033000"]],"a":[["89309.47000000","0.00000000"],["89309.63000000","0.03400000"]]}})"
+    };
+
+    void testCombinedStreamDepthUpdate()
+    {
+        BinanceMarketDataParser parser { btcUsdt };
+        BookUpdates updates;
+
+        const ParseResult result = parser.parse(combinedDepthUpdate, updates);
+
+        Assert(result == ParseResult::Success, "depth update must be parsed");
+        Assert(updates.size() == 5, "every level must produce one update");
+
+        const auto& first = updates.front();
+        Assert(first.instrument == btcUsdt.id(), "invalid instrument");
+        Assert(first.firstSequence == 82626886844, "invalid first sequence");
+        Assert(first.sequence == 82626886850, "invalid sequence");
+        Assert(first.exchangeTimestamp == Timestamp { 1765107346014ULL * 1'000'000 }, "invalid exchange timestamp");
+        Assert(first.side == Side::Buy, "invalid side");
+        Assert(first.price == Price { 8'921'834'000'000 }, "invalid price");
+        Assert(first.quantity == Quantity { 3'110'000 }, "invalid quantity");
+
+        const auto& removed = updates[3];
+        Assert(removed.side == Side::Sell, "asks must follow bids");
+        Assert(removed.price == Price { 8'930'947'000'000 }, "invalid ask price");
+        Assert(removed.quantity.isZero(), "zero quantity must be preserved");
+    }
+
+    void testRawStreamDepthUpdate()
+    {
+        BinanceMarketDataParser parser { btcUsdt };
+        BookUpdates updates;
+
+        const std::string message {
+            R"({"e":"depthUpdate","E":1672515782136,"s":"BTCUSDT","U":157,"u":160,)"
+            R"("b":[["0.10000000","1.00000000"]],"a":[["0.2","2.000123"]]})"
+        };
+
+        Assert(parser.parse(message, updates) == ParseResult::Success, "raw depth update must be parsed");
+        Assert(updates.size() == 2, "invalid number of updates");
+        Assert(updates[0].price == Price { 10'000'000 }, "invalid bid price");
+        Assert(updates[0].quantity == Quantity { 100'000'000 }, "invalid bid quantity");
+        Assert(updates[1].price == Price { 20'000'000 }, "short fraction must be scaled");
+        Assert(updates[1].quantity == Quantity { 200'012'300 }, "invalid ask quantity");
+    }
+
+    void testBufferIsReused()
+    {
+        BinanceMarketDataParser parser { btcUsdt };
+        BookUpdates updates;
+
+        Assert(parser.parse(combinedDepthUpdate, updates) == ParseResult::Success, "message must be parsed");
+        const auto* storage = updates.data();
+
+        Assert(parser.parse(combinedDepthUpdate, updates) == ParseResult::Success, "message must be parsed");
+        Assert(updates.size() == 5, "buffer must be cleared before parsing");
+        Assert(updates.data() == storage, "buffer storage must be reused");
+    }
+
+    void testErrors()
+    {
+        BinanceMarketDataParser parser { btcUsdt };
+        BookUpdates updates;
+
+        Assert(parser.parse("", updates) == ParseResult::InvalidMessage, "empty message must be rejected");
+        Assert(parser.parse("{\"e\":", updates) == ParseResult::InvalidJson, "truncated JSON must be rejected");
+        Assert(parser.parse(R"({"e":"trade","E":1,"s":"BTCUSDT"})", updates) == ParseResult::UnsupportedMessage,
+            "trade must be unsupported");
+        Assert(parser.parse(R"({"e":"depthUpdate","E":1,"s":"ETHUSDT","U":1,"u":2,"b":[],"a":[]})", updates)
+            == ParseResult::InvalidInstrument, "unknown symbol must be rejected");
+        Assert(parser.parse(R"({"e":"depthUpdate","E":1,"s":"BTCUSDT","u":2,"b":[],"a":[]})", updates)
+            == ParseResult::MissingField, "missing U must be rejected");
+        Assert(parser.parse(R"({"e":"depthUpdate","E":1,"s":"BTCUSDT","U":3,"u":2,"b":[],"a":[]})", updates)
+            == ParseResult::InvalidSequence, "inverted range must be rejected");
+        Assert(parser.parse(R"({"e":"depthUpdate","E":1,"s":"BTCUSDT","U":1,"u":2,"b":[["1.x","1"]],"a":[]})", updates)
+            == ParseResult::InvalidPrice, "invalid price must be rejected");
+        Assert(parser.parse(R"({"e":"depthUpdate","E":1,"s":"BTCUSDT","U":1,"u":2,"b":[["1","-1"]],"a":[]})", updates)
+            == ParseResult::InvalidQuantity, "negative quantity must be rejected");
+        Assert(parser.parse(R"({"e":"depthUpdate","E":1,"s":"BTCUSDT","U":1,"u":2,"b":[["1.000000001","1"]],"a":[]})", updates)
+            == ParseResult::InvalidPrice, "unrepresentable precision must be rejected");
+        Assert(updates.empty(), "failed parse must leave buffer empty");
+    }
+
+    void testMultipleInstruments()
+    {
+        constexpr std::array instruments {
+            Instrument { InstrumentId { 3 }, "ETHUSDT", Price { 1'000'000 }, Quantity { 10'000 } },
+            btcUsdt
+        };
+
+        BinanceMarketDataParser parser { instruments };
+        BookUpdates updates;
+
+        Assert(parser.parse(combinedDepthUpdate, updates) == ParseResult::Success, "BTCUSDT must be parsed");
+        Assert(updates.front().instrument == btcUsdt.id(), "BTCUSDT must resolve to its id");
+
+        const std::string ethUpdate {
+            R"({"e":"depthUpdate","E":1,"s":"ETHUSDT","U":5,"u":5,"b":[["3000.10","1.5"]],"a":[]})"
+        };
+
+        Assert(parser.parse(ethUpdate, updates) == ParseResult::Success, "ETHUSDT must be parsed");
+        Assert(updates.size() == 1 && updates.front().instrument == InstrumentId { 3 }, "ETHUSDT must resolve to its id");
+
+        const std::string unknown {
+            R"({"e":"depthUpdate","E":1,"s":"XRPUSDT","U":5,"u":5,"b":[],"a":[]})"
+        };
+        Assert(parser.parse(unknown, updates) == ParseResult::InvalidInstrument, "unknown symbol must be rejected");
+    }
+
+    void testSnapshot()
+    {
+        BinanceMarketDataParser parser { btcUsdt };
+        BookSnapshot snapshot;
+
+        const std::string message {
+            R"({"lastUpdateId":80089389252,"bids":[["102571.17000000","0.38980000"],["102571.16000000","0.00309000"]],)"
+            R"("asks":[["102571.18000000","1.00000000"],["102571.19000000","0.00000000"]]})"
+        };
+
+        Assert(parser.parseSnapshot(message, snapshot) == ParseResult::Success, "snapshot must be parsed");
+        Assert(snapshot.sequence == 80089389252, "invalid snapshot sequence");
+        Assert(snapshot.bids.size() == 2, "invalid number of bids");
+        Assert(snapshot.asks.size() == 1, "empty levels must be skipped");
+        Assert(snapshot.bids.rbegin()->first == Price { 10'257'117'000'000 }, "invalid best bid");
+        Assert(snapshot.bids.rbegin()->second == Quantity { 38'980'000 }, "invalid best bid quantity");
+    }
+
+    void testEventTime()
+    {
+        Assert(BinanceMarketDataParser::eventTime(combinedDepthUpdate) == Timestamp { 1'765'107'346'014'000'000 },
+            "event time must be read from the raw message");
+        Assert(!BinanceMarketDataParser::eventTime(R"({"lastUpdateId":1,"bids":[],"asks":[]})").has_value(),
+            "message without event time must have none");
+        Assert(!BinanceMarketDataParser::eventTime(R"({"E":"x"})").has_value(), "invalid event time must be rejected");
+    }
+}
+
+void binance_market_data_parser_test()
+{
+    testCombinedStreamDepthUpdate();
+    testRawStreamDepthUpdate();
+    testBufferIsReused();
+    testErrors();
+    testMultipleInstruments();
+    testSnapshot();
+    testEventTime();
+
+    std::cout << "All BinanceMarketDataParser tests: OK\n";
+}
@@ -0,0 +1,233 @@
+/**============================================================================
+Name        : binance_order_encoder_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : BinanceOrderEncoder / BinanceExecutionGateway unit tests.
+============================================================================**/
+
+#include "binance_order_encoder.hpp"
+#include "binance_execution_gateway.hpp"
+#include "order_manager.hpp"
+#include "risk_manager.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::ExecType;
+    using trading::OrderStatus;
+    using trading::exchanges::binance::BinanceExecutionGateway;
+    using trading::exchanges::binance::BinanceOrderEncoder;
+    using trading::execution::ExecutionReport;
+    using trading::execution::Order;
+    using trading::execution::OrderCreationResult;
+    using trading::execution::OrderManager;
+    using trading::execution::OrderRequest;
+    using testing::Assert;
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+    constexpr Instrument ethUsdt { InstrumentId { 5 }, "ETHUSDT", Price { 1'000'000 }, Quantity { 10'000 } };
+    constexpr std::array instruments { btcUsdt, ethUsdt };
+
+    constexpr uint64_t Now { 1'765'107'346'014 };
+
+    [[nodiscard]]
+    std::string_view textOf(const std::span<const std::byte> request)
+    {
+        return { reinterpret_cast<const char*>(request.data()), request.size() };
+    }
+
+    void testLimitOrder()
+    {
+        /* Input:    limit buy 0.001 BTCUSDT at 89218.34, client order id 42
+           Expected: fixed fields in template order, decimals on the instrument grid */
+        BinanceOrderEncoder encoder { instruments };
+        const Order order {
+            .clientOrderId = 42,
+            .instrument = btcUsdt.id(),
+            .side = Side::Buy,
+            .type = OrderType::Limit,
+            .price = Price { 8'921'834'000'000 },
+            .quantity = Quantity { 100'000 }
+        };
+
+        Assert(textOf(encoder.encode(order, Now)) ==
+               "symbol=BTCUSDT&side=BUY&type=LIMIT&timeInForce=GTC&newClientOrderId=00000000000000000042"
+               "&timestamp=1765107346014&quantity=0.00100&price=89218.34", "invalid limit order request");
+    }
+
+    void testMarketOrder()
+    {
+        /* Input:    market sell 0.25 ETHUSDT
+           Expected: neither timeInForce nor price */
+        BinanceOrderEncoder encoder { instruments };
+        const Order order {
+            .clientOrderId = 7,
+            .instrument = ethUsdt.id(),
+            .side = Side::Sell,
+            .type = OrderType::Market,
+            .quantity = Quantity { 25'000'000 }
+        };
+
+        Assert(textOf(encoder.encode(order, Now)) ==
+               "symbol=ETHUSDT&side=SELL&type=MARKET&newClientOrderId=00000000000000000007"
+               "&timestamp=1765107346014&quantity=0.2500", "invalid market order request");
+    }
+
+    void testTemplateIsReused()
+    {
+        /* Input:    two orders on the same template, the second with shorter decimals
+           Expected: the second request has no bytes of the first one */
+        BinanceOrderEncoder encoder { instruments };
+        Order order {
+            .clientOrderId = 123'456'789,
+            .instrument = btcUsdt.id(),
+            .side = Side::Sell,
+            .type = OrderType::Limit,
+            .price = Price { 10'257'117'000'000 },
+            .quantity = Quantity { 1'234'500'000 }
+        };
+
+        const std::span<const std::byte> first = encoder.encode(order, Now);
+        Assert(textOf(first).ends_with("&quantity=12.34500&price=102571.17"), "invalid first request");
+
+        order.clientOrderId = 123'456'790;
+        order.price = Price { 900'000'000 };
+        order.quantity = Quantity { 100'000 };
+
+        const std::span<const std::byte> second = encoder.encode(order, Now + 1);
+        Assert(second.data() == first.data(), "the template buffer must be reused");
+        Assert(textOf(second) ==
+               "symbol=BTCUSDT&side=SELL&type=LIMIT&timeInForce=GTC&newClientOrderId=00000000000123456790"
+               "&timestamp=1765107346015&quantity=0.00100&price=9.00", "invalid second request");
+    }
+
+    void testRejectedOrders()
+    {
+        /* Input:    unknown instrument, off-grid price, zero quantity, 14-digit timestamp
+           Expected: empty request */
+        BinanceOrderEncoder encoder { instruments };
+        const Order valid {
+            .clientOrderId = 1,
+            .instrument = btcUsdt.id(),
+            .side = Side::Buy,
+            .type = OrderType::Limit,
+            .price = Price { 8'921'834'000'000 },
+            .quantity = Quantity { 100'000 }
+        };
+        Assert(!encoder.encode(valid, Now).empty(), "valid order must be encoded");
+
+        Order unknown = valid;
+        unknown.instrument = InstrumentId { 2 };
+        Assert(encoder.encode(unknown, Now).empty(), "unknown instrument must be rejected");
+        Assert(!encoder.contains(InstrumentId { 2 }) && encoder.contains(ethUsdt.id()), "invalid contains");
+
+        Order offGrid = valid;
+        offGrid.price = Price { 8'921'834'500'000 };
+        Assert(encoder.encode(offGrid, Now).empty(), "price off the tick grid must be rejected");
+
+        Order empty = valid;
+        empty.quantity = Quantity {};
+        Assert(encoder.encode(empty, Now).empty(), "zero quantity must be rejected");
+
+        Assert(encoder.encode(valid, 10'000'000'000'000).empty(), "timestamp must fit 13 digits");
+        Assert(BinanceOrderEncoder {}.encode(valid, Now).empty(), "encoder without instruments encodes nothing");
+    }
+
+    void testGatewayHandsOverRequest()
+    {
+        /* Input:    gateway send of a limit order
+           Expected: the handler receives the order and its encoded request */
+        std::string request;
+        uint64_t clientOrderId { 0 };
+        BinanceExecutionGateway gateway {
+            instruments,
+            [&](const Order& order, const std::span<const std::byte> bytes) {
+                clientOrderId = order.clientOrderId;
+                request = textOf(bytes);
+            },
+            {}
+        };
+
+        gateway.send(Order {
+            .clientOrderId = 9,
+            .instrument = btcUsdt.id(),
+            .side = Side::Buy,
+            .type = OrderType::Limit,
+            .price = Price { 8'921'834'000'000 },
+            .quantity = Quantity { 100'000 }
+        });
+
+        Assert(clientOrderId == 9, "handler must receive the order");
+        Assert(request.starts_with("symbol=BTCUSDT&side=BUY&type=LIMIT&timeInForce=GTC&newClientOrderId=00000000000000000009&timestamp="),
+            "handler must receive the request");
+        Assert(request.ends_with("&quantity=0.00100&price=89218.34"), "invalid request decimals");
+        Assert(request.find("&timestamp=0000000000000") == std::string::npos, "timestamp must be set");
+    }
+
+    void testGatewayRejectsUnencodableOrder()
+    {
+        /* Input:    an order off the tick grid created through OrderManager
+           Expected: no request reaches the send handler; a Rejected report
+                     retires the order and releases its risk reservation */
+        uint32_t sendCount { 0 };
+        std::vector<ExecutionReport> reports;
+        BinanceExecutionGateway gateway {
+            instruments,
+            [&](const Order&, const std::span<const std::byte>) { ++sendCount; },
+            {}
+        };
+
+        trading::risk::RiskManager riskManager { trading::risk::RiskLimits {} };
+        trading::position::Position position { btcUsdt.id() };
+        OrderManager manager { gateway, riskManager, position };
+        gateway.setReportHandler([&](const ExecutionReport& report) {
+            reports.push_back(report);
+            const bool _ = manager.applyExecution(report);
+        });
+
+        const OrderCreationResult result = manager.createOrder(OrderRequest {
+            .instrument = btcUsdt.id(),
+            .side = Side::Buy,
+            .type = OrderType::Limit,
+            .price = Price { 8'921'834'500'000 },
+            .quantity = Quantity { 100'000 }
+        });
+
+        Assert(result.has_value(), "risk-accepted order must get its id");
+        Assert(sendCount == 0, "unencodable order must not reach the send handler");
+        Assert(reports.size() == 1, "gateway must report the rejection");
+        Assert(reports.front().clientOrderId == *result, "report must carry the client order id");
+        Assert(reports.front().execType == ExecType::Reject && reports.front().status == OrderStatus::Rejected,
+            "report must be a rejection");
+        Assert(manager.find(*result)->status == OrderStatus::Rejected, "order must be rejected");
+        Assert(manager.openOrderCount(btcUsdt.id(), Side::Buy) == 0, "rejected order must not stay open");
+        Assert(riskManager.pendingExposure(btcUsdt.id()).buyQuantity.isZero(), "reservation must be released");
+    }
+}
+
+void binance_order_encoder_test()
+{
+    testLimitOrder();
+    testMarketOrder();
+    testTemplateIsReused();
+    testRejectedOrders();
+    testGatewayHandsOverRequest();
+    testGatewayRejectsUnencodableOrder();
+
+    std::cout << "All BinanceOrderEncoder tests: OK\n";
+}
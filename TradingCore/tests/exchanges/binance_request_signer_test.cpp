@@ -0,0 +1,104 @@
+/**============================================================================
+Name        : binance_request_signer_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : BinanceRequestSigner unit tests.
+============================================================================**/
+
+#include "binance_request_signer.hpp"
+#include "binance_order_encoder.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::OrderType;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::exchanges::binance::BinanceOrderEncoder;
+    using trading::exchanges::binance::BinanceRequestSigner;
+    using trading::execution::Order;
+    using testing::Assert;
+
+    // Example of the Binance API documentation (SIGNED endpoint security).
+    constexpr std::string_view SecretKey { "NhqPtmdSJYdKjVHjA7PZj4Mge3R5YNiP1e3UZjInClVN65XAbvqqM6A7H5fATj0j" };
+    constexpr std::string_view Parameters {
+        "symbol=LTCBTC&side=BUY&type=LIMIT&timeInForce=GTC&quantity=1&price=0.1&recvWindow=5000&timestamp=1499827319559"
+    };
+    constexpr std::string_view Signature { "c8db56825ae71d6d79447849e617115f4a920fa2acdcab2b053c4b2838bd6b71" };
+
+    void testDocumentationExample()
+    {
+        /* Input:    secret key and parameters of the Binance documentation
+           Expected: the documented signature */
+        const BinanceRequestSigner signer { SecretKey };
+        std::array<char, BinanceRequestSigner::HexSignatureSize> signature {};
+
+        signer.sign(Parameters, signature);
+
+        Assert(std::string_view { signature.data(), signature.size() } == Signature, "invalid signature");
+    }
+
+    void testAppendInPlace()
+    {
+        /* Input:    parameters in a buffer with room for the signature, then one without
+           Expected: "&signature=<hex>" appended behind them; 0 when it does not fit */
+        const BinanceRequestSigner signer { SecretKey };
+        std::string buffer { Parameters };
+        buffer.resize(Parameters.size() + BinanceRequestSigner::SignatureSize, '#');
+
+        const std::size_t length = signer.appendSignature(buffer, Parameters.size());
+
+        Assert(length == buffer.size(), "invalid signed length");
+        Assert(buffer == std::string { Parameters } + "&signature=" + std::string { Signature }, "invalid signed request");
+
+        std::string small { Parameters };
+        small.resize(Parameters.size() + BinanceRequestSigner::SignatureSize - 1, '#');
+        Assert(signer.appendSignature(small, Parameters.size()) == 0, "too small buffer must be rejected");
+        Assert(small.ends_with('#'), "a rejected buffer must stay unchanged");
+        Assert(signer.appendSignature(small, small.size() + 1) == 0, "length beyond the buffer must be rejected");
+    }
+
+    void testSignedOrder()
+    {
+        /* Input:    order encoded with a signer
+           Expected: the parameters followed by their signature */
+        constexpr std::array instruments { Instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } } };
+        BinanceOrderEncoder encoder { instruments };
+        const BinanceRequestSigner signer { SecretKey };
+        const Order order {
+            .clientOrderId = 42,
+            .instrument = InstrumentId { 1 },
+            .side = Side::Buy,
+            .type = OrderType::Limit,
+            .price = Price { 8'921'834'000'000 },
+            .quantity = Quantity { 100'000 }
+        };
+
+        const std::span<const std::byte> request = encoder.encode(order, 1'765'107'346'014, &signer);
+
+        Assert(std::string_view { reinterpret_cast<const char*>(request.data()), request.size() } ==
+               "symbol=BTCUSDT&side=BUY&type=LIMIT&timeInForce=GTC&newClientOrderId=00000000000000000042"
+               "&timestamp=1765107346014&quantity=0.00100&price=89218.34"
+               "&signature=d07fdf6fdc23e54b4861233ee5ec9dad55c179fbfe29e6c7870b8c120a24a293", "invalid signed order");
+    }
+}
+
+void binance_request_signer_test()
+{
+    testDocumentationExample();
+    testAppendInPlace();
+    testSignedOrder();
+
+    std::cout << "All BinanceRequestSigner tests: OK\n";
+}
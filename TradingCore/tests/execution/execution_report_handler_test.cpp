@@ -12,6 +12,7 @@ Description : execution_report_handler_test.cpp
 #include "test_support/testing.hpp"
 
 #include <iostream>
+#include <optional>
 
 using trading::ExchangeOrderId;
 using trading::InstrumentId;
@@ -279,11 +280,11 @@ namespace
         const ExecutionReport report = createExecutionReport(unknownOrderId);
         const bool applied = handler.onExecutionReport(report);
 
-        const Position* resPosition = positionManager.find(unknownOrderId);
+        const std::optional<Position> resPosition = positionManager.find(unknownOrderId);
 
         Assert(!applied, "unknown order execution must fail");
         Assert(recorder.executionReportRecordCount() == 1,"execution report must still be recorded");
-        Assert(resPosition == nullptr, "Position for unknown order execution must not exist");
+        Assert(!resPosition.has_value(), "Position for unknown order execution must not exist");
     }
 }
 
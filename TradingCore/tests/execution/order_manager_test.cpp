@@ -11,6 +11,8 @@ Description : order_manager_test.cpp
 #include "test_support/testing.hpp"
 
 #include <iostream>
+#include <span>
+#include <vector>
 
 using trading::ExchangeOrderId;
 using trading::InstrumentId;
@@ -27,6 +29,8 @@ using trading::execution::IExecutionGateway;
 using trading::execution::Order;
 using trading::execution::OrderManager;
 using trading::execution::OrderRequest;
+using trading::execution::OrderStoreConfig;
+using trading::execution::OrderStoreOverflow;
 using trading::risk::IRiskManager;
 using trading::risk::RiskResult;
 using trading::risk::RiskReason;
@@ -73,6 +77,24 @@ namespace
             cancelCount_++;
         }
 
+        void cancelBatch(const std::span<const OrderId> orderIds) override
+        {
+            batchCancelledOrderIds_.assign(orderIds.begin(), orderIds.end());
+            batchCancelCount_++;
+        }
+
+        [[nodiscard]]
+        const std::vector<OrderId>& batchCancelledOrderIds() const noexcept
+        {
+            return batchCancelledOrderIds_;
+        }
+
+        [[nodiscard]]
+        uint32_t batchCancelCount() const noexcept
+        {
+            return batchCancelCount_;
+        }
+
         [[nodiscard]]
         const Order& sentOrder() const noexcept
         {
@@ -102,6 +124,8 @@ namespace
         OrderId cancelledOrderId_ { 0 };
         uint32_t sendCount_ { 0 };
         uint32_t cancelCount_ { 0 };
+        std::vector<OrderId> batchCancelledOrderIds_;
+        uint32_t batchCancelCount_ { 0 };
     };
 
     void testCreateOrder()
@@ -485,6 +509,220 @@ namespace
         Assert(!cancelled, "cancel of unknown order must fail");
         Assert(gateway.cancelCount() == 0, "gateway cancel must not be called");
     }
+
+    OrderId createOrder(OrderManager& manager, const InstrumentId instrument, const Side side)
+    {
+        const OrderCreationResult result = manager.createOrder(OrderRequest {
+            .instrument = instrument,
+            .side = side,
+            .type = OrderType::Limit,
+            .price = Price { 6'500'000'000'000 },
+            .quantity = Quantity { 100'000'000 }
+        });
+
+        Assert(result.has_value(), "order creation must succeed");
+        return result.value();
+    }
+
+    void applyStatus(OrderManager& manager, const Order& order, const OrderStatus status, const ExecType execType)
+    {
+        const bool applied = manager.applyExecution(ExecutionReport {
+            .clientOrderId = order.clientOrderId,
+            .exchangeOrderId = ExchangeOrderId { 1 },
+            .instrument = order.instrument,
+            .side = order.side,
+            .execType = execType,
+            .status = status,
+            .price = order.price,
+            .quantity = execType == ExecType::Trade ? order.quantity : Quantity {},
+            .filledQuantity = status == OrderStatus::Filled ? order.quantity : Quantity {}
+        });
+
+        Assert(applied, "execution report must be applied");
+    }
+
+    void testOpenOrdersPerInstrumentSide()
+    {
+        TestExecutionGateway gateway;
+        TestRiskManager riskManager;
+        Position position { InstrumentId { 1 } };
+
+        OrderManager manager { gateway, riskManager, position };
+
+        const OrderId firstBid = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        const OrderId ask = createOrder(manager, InstrumentId { 1 }, Side::Sell);
+        const OrderId otherInstrument = createOrder(manager, InstrumentId { 2 }, Side::Buy);
+        const OrderId secondBid = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+
+        Assert(manager.openOrderCount(InstrumentId { 1 }, Side::Buy) == 2, "two bids must be open");
+        Assert(manager.openOrderCount(InstrumentId { 1 }, Side::Sell) == 1, "one ask must be open");
+        Assert(manager.openOrderCount(InstrumentId { 2 }, Side::Buy) == 1, "one bid must be open on instrument 2");
+        Assert(manager.openOrderCount(InstrumentId { 3 }, Side::Buy) == 0, "unknown instrument has no open orders");
+
+        std::vector<OrderId> bids;
+        manager.forEachOpenOrder(InstrumentId { 1 }, Side::Buy, [&bids](const Order& order) {
+            bids.push_back(order.clientOrderId);
+        });
+        Assert(bids == std::vector<OrderId> { firstBid, secondBid }, "bids must be visited oldest first");
+
+        std::vector<OrderId> all;
+        manager.forEachOpenOrder(InstrumentId { 1 }, [&all](const Order& order) {
+            all.push_back(order.clientOrderId);
+        });
+        Assert(all == std::vector<OrderId> { firstBid, secondBid, ask }, "both sides must be visited");
+        Assert(otherInstrument != 0, "order on instrument 2 must exist");
+    }
+
+    void testTerminalOrdersLeaveOpenOrders()
+    {
+        TestExecutionGateway gateway;
+        TestRiskManager riskManager;
+        Position position { InstrumentId { 1 } };
+
+        OrderManager manager { gateway, riskManager, position };
+
+        const OrderId filled = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        const OrderId partiallyFilled = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        const OrderId cancelled = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+
+        applyStatus(manager, *manager.find(filled), OrderStatus::Filled, ExecType::Trade);
+        applyStatus(manager, *manager.find(partiallyFilled), OrderStatus::PartiallyFilled, ExecType::New);
+        applyStatus(manager, *manager.find(cancelled), OrderStatus::Cancelled, ExecType::Cancel);
+
+        std::vector<OrderId> open;
+        manager.forEachOpenOrder(InstrumentId { 1 }, Side::Buy, [&open](const Order& order) {
+            open.push_back(order.clientOrderId);
+        });
+
+        Assert(open == std::vector<OrderId> { partiallyFilled }, "only the non-terminal order must stay open");
+        Assert(manager.find(filled) != nullptr, "filled order must still be found");
+    }
+
+    void testRestingOrderDoesNotBlockNewOrders()
+    {
+        TestExecutionGateway gateway;
+        TestRiskManager riskManager;
+        Position position { InstrumentId { 1 } };
+
+        OrderManager manager { gateway, riskManager, position, OrderStoreConfig {
+            .capacity = 2, .historyCapacity = 2, .overflow = OrderStoreOverflow::Reject } };
+
+        /* Input:    the first order rests while later orders fill, until the ids wrap onto its slot
+           Expected: the id of the resting slot is skipped; CapacityExceeded only when every slot is live */
+        const OrderId resting = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        const OrderId filled = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        applyStatus(manager, *manager.find(filled), OrderStatus::Filled, ExecType::Trade);
+
+        const OrderId wrapped = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        Assert(wrapped == resting + 3, "the id mapped to the resting order must be skipped");
+        Assert(manager.find(resting)->status == OrderStatus::New, "the resting order must stay tracked");
+
+        const OrderCreationResult full = manager.createOrder(OrderRequest {
+            .instrument = InstrumentId { 1 },
+            .side = Side::Buy,
+            .type = OrderType::Limit,
+            .price = Price { 6'500'000'000'000 },
+            .quantity = Quantity { 100'000'000 }
+        });
+        Assert(!full.has_value() && full.error() == trading::execution::OrderCreationError::CapacityExceeded,
+            "a full store must reject new orders");
+    }
+
+    void testCancelAllInstrumentSide()
+    {
+        TestExecutionGateway gateway;
+        TestRiskManager riskManager;
+        Position position { InstrumentId { 1 } };
+
+        OrderManager manager { gateway, riskManager, position };
+
+        const OrderId firstBid = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        createOrder(manager, InstrumentId { 1 }, Side::Sell);
+        const OrderId secondBid = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        createOrder(manager, InstrumentId { 2 }, Side::Buy);
+
+        const std::size_t requested = manager.cancelAll(InstrumentId { 1 }, Side::Buy);
+
+        Assert(requested == 2, "two cancels must be requested");
+        Assert(gateway.batchCancelCount() == 1, "cancels must be sent as one batch");
+        Assert(gateway.batchCancelledOrderIds() == std::vector<OrderId> { firstBid, secondBid },
+               "batch must contain the open bids");
+        Assert(manager.openOrderCount(InstrumentId { 1 }, Side::Buy) == 2,
+               "orders stay open until the cancel is confirmed");
+    }
+
+    void testCancelAllInstrument()
+    {
+        TestExecutionGateway gateway;
+        TestRiskManager riskManager;
+        Position position { InstrumentId { 1 } };
+
+        OrderManager manager { gateway, riskManager, position };
+
+        const OrderId bid = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        const OrderId ask = createOrder(manager, InstrumentId { 1 }, Side::Sell);
+        createOrder(manager, InstrumentId { 2 }, Side::Sell);
+
+        Assert(manager.cancelAll(InstrumentId { 1 }) == 2, "two cancels must be requested");
+        Assert(gateway.batchCancelledOrderIds() == std::vector<OrderId> { bid, ask },
+               "batch must contain both sides of the instrument");
+
+        Assert(manager.cancelAll(InstrumentId { 3 }) == 0, "instrument without orders must not cancel anything");
+        Assert(gateway.batchCancelCount() == 1, "empty batch must not be sent");
+    }
+
+    void testRiskReservationFollowsExecutions()
+    {
+        TestExecutionGateway gateway;
+        trading::risk::RiskManager riskManager { trading::risk::RiskLimits {} };
+        Position position { InstrumentId { 1 } };
+
+        OrderManager manager { gateway, riskManager, position };
+
+        const OrderId filled = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+        const OrderId cancelled = createOrder(manager, InstrumentId { 1 }, Side::Buy);
+
+        Assert(riskManager.pendingExposure(InstrumentId { 1 }).buyQuantity == Quantity { 200'000'000 },
+               "accepted orders must be reserved");
+
+        const Order order = *manager.find(filled);
+        const bool partial = manager.applyExecution(ExecutionReport {
+            .clientOrderId = filled,
+            .instrument = order.instrument,
+            .side = order.side,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::PartiallyFilled,
+            .price = order.price,
+            .quantity = Quantity { 40'000'000 },
+            .filledQuantity = Quantity { 40'000'000 }
+        });
+        Assert(partial, "partial fill must be applied");
+        Assert(riskManager.pendingExposure(InstrumentId { 1 }).buyQuantity == Quantity { 160'000'000 },
+               "filled quantity must be released");
+
+        applyStatus(manager, *manager.find(cancelled), OrderStatus::Cancelled, ExecType::Cancel);
+        Assert(riskManager.pendingExposure(InstrumentId { 1 }).buyQuantity == Quantity { 60'000'000 },
+               "cancelled order must release its remaining quantity");
+
+        applyStatus(manager, *manager.find(cancelled), OrderStatus::Cancelled, ExecType::Cancel);
+        Assert(riskManager.pendingExposure(InstrumentId { 1 }).buyQuantity == Quantity { 60'000'000 },
+               "report for a retired order must not release again");
+
+        const bool done = manager.applyExecution(ExecutionReport {
+            .clientOrderId = filled,
+            .instrument = order.instrument,
+            .side = order.side,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::Filled,
+            .price = order.price,
+            .quantity = Quantity { 60'000'000 },
+            .filledQuantity = order.quantity
+        });
+        Assert(done, "final fill must be applied");
+
+        const trading::risk::PendingExposure exposure = riskManager.pendingExposure(InstrumentId { 1 });
+        Assert(exposure.buyQuantity.isZero() && exposure.buyNotional.isZero(), "all reservations must be released");
+    }
 }
 
 void order_manager_test()
@@ -501,6 +739,12 @@ void order_manager_test()
     testUnknownExecutionReport();
     testCancelOrder();
     testCancelUnknownOrder();
+    testOpenOrdersPerInstrumentSide();
+    testTerminalOrdersLeaveOpenOrders();
+    testRestingOrderDoesNotBlockNewOrders();
+    testCancelAllInstrumentSide();
+    testCancelAllInstrument();
+    testRiskReservationFollowsExecutions();
 
     std::cout << "All OrderManager tests: OK\n";
 }
\ No newline at end of file
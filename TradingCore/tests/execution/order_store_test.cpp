@@ -0,0 +1,288 @@
+/**============================================================================
+Name        : order_store_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : order_store_test.cpp
+============================================================================**/
+
+#include "order_store.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <vector>
+
+using trading::Instrument;
+using trading::InstrumentId;
+using trading::MaxInstrumentId;
+using trading::OrderId;
+using trading::OrderStatus;
+using trading::Price;
+using trading::Quantity;
+using trading::Side;
+
+using trading::execution::Order;
+using trading::execution::OrderStore;
+using trading::execution::OrderStoreConfig;
+using trading::execution::OrderStoreOverflow;
+
+namespace
+{
+    using testing::Assert;
+
+    Order makeOrder(const OrderId orderId)
+    {
+        return Order {
+            .clientOrderId = orderId,
+            .instrument = InstrumentId { 1 },
+            .status = OrderStatus::New
+        };
+    }
+
+    void testCapacityIsRoundedToPowerOfTwo()
+    {
+        const OrderStore store { OrderStoreConfig { .capacity = 5, .historyCapacity = 3 } };
+
+        Assert(store.capacity() == 8, "live capacity must be rounded up to 8");
+        Assert(store.historyCapacity() == 4, "history capacity must be rounded up to 4");
+        Assert(store.liveCount() == 0, "new store must be empty");
+    }
+
+    void testInsertAndFind()
+    {
+        OrderStore store { OrderStoreConfig { .capacity = 4, .historyCapacity = 4 } };
+
+        const Order* inserted = store.insert(makeOrder(1));
+        Assert(inserted != nullptr, "insert must succeed");
+        Assert(store.findLive(1) == inserted, "live lookup must return the stored order");
+        Assert(store.find(1) == inserted, "lookup must return the stored order");
+        Assert(store.find(2) == nullptr, "unknown order must not be found");
+        Assert(store.find(5) == nullptr, "order mapped to the same slot must not be found");
+        Assert(store.liveCount() == 1, "one order must be live");
+    }
+
+    void testInsertRejectsInvalidIds()
+    {
+        OrderStore store { OrderStoreConfig { .capacity = 4, .historyCapacity = 4 } };
+
+        Assert(store.insert(makeOrder(0)) == nullptr, "order id zero must be rejected");
+        Assert(store.insert(makeOrder(1)) != nullptr, "insert must succeed");
+        Assert(store.insert(makeOrder(1)) == nullptr, "duplicate live id must be rejected");
+
+        Assert(store.retire(1), "retire must succeed");
+        Assert(store.insert(makeOrder(1)) == nullptr, "duplicate retired id must be rejected");
+    }
+
+    void testRetireMovesOrderToHistory()
+    {
+        OrderStore store { OrderStoreConfig { .capacity = 4, .historyCapacity = 4 } };
+
+        Order* order = store.insert(makeOrder(1));
+        order->status = OrderStatus::Filled;
+
+        Assert(store.retire(1), "retire must succeed");
+        Assert(!store.retire(1), "retired order must not be retired twice");
+        Assert(store.findLive(1) == nullptr, "retired order must not be live");
+        Assert(store.liveCount() == 0, "no order must be live");
+
+        const Order* retired = store.find(1);
+        Assert(retired != nullptr, "retired order must be found in the history");
+        Assert(retired->status == OrderStatus::Filled, "retired order must keep its state");
+
+        Assert(store.insert(makeOrder(5)) != nullptr, "freed slot must be reused");
+        Assert(store.find(1) != nullptr, "retired order must survive slot reuse");
+    }
+
+    void testHistoryKeepsNewestOrders()
+    {
+        OrderStore store { OrderStoreConfig { .capacity = 4, .historyCapacity = 2 } };
+
+        for (OrderId orderId = 1; orderId <= 3; ++orderId)
+        {
+            Assert(store.insert(makeOrder(orderId)) != nullptr, "insert must succeed");
+            Assert(store.retire(orderId), "retire must succeed");
+        }
+
+        Assert(store.find(1) == nullptr, "oldest retired order must be replaced");
+        Assert(store.find(2) != nullptr, "recent retired order must be found");
+        Assert(store.find(3) != nullptr, "latest retired order must be found");
+    }
+
+    void testLateRetirementDoesNotReplaceNewerHistory()
+    {
+        OrderStore store { OrderStoreConfig { .capacity = 4, .historyCapacity = 2 } };
+
+        Assert(store.insert(makeOrder(1)) != nullptr, "insert must succeed");
+        Assert(store.insert(makeOrder(3)) != nullptr, "insert must succeed");
+
+        Assert(store.retire(3), "retire must succeed");
+        Assert(store.retire(1), "retire must succeed");
+
+        Assert(store.find(3) != nullptr, "newer retired order must be kept");
+        Assert(store.find(1) == nullptr, "older order must not replace a newer one");
+    }
+
+    void testOverflowReject()
+    {
+        OrderStore store { OrderStoreConfig {
+            .capacity = 2, .historyCapacity = 2, .overflow = OrderStoreOverflow::Reject } };
+
+        Assert(store.insert(makeOrder(1)) != nullptr, "insert must succeed");
+        Assert(store.insert(makeOrder(2)) != nullptr, "insert must succeed");
+        Assert(store.insert(makeOrder(3)) == nullptr, "insert into a live slot must be rejected");
+
+        Assert(store.findLive(1) != nullptr, "live order must be kept");
+        Assert(store.liveCount() == 2, "live count must not change");
+        Assert(store.evictions() == 0, "reject policy must not evict");
+
+        Assert(store.retire(1), "retire must succeed");
+        Assert(store.insert(makeOrder(3)) != nullptr, "insert must succeed after retirement");
+    }
+
+    void testNextInsertableIdSkipsLiveSlots()
+    {
+        OrderStore rejecting { OrderStoreConfig {
+            .capacity = 4, .historyCapacity = 4, .overflow = OrderStoreOverflow::Reject } };
+
+        /* Input:    order 1 keeps resting while orders 2..4 come and go
+           Expected: ids mapped to the slot of order 1 are skipped, OrderId 0 once every slot is live */
+        Assert(rejecting.insert(makeOrder(1)) != nullptr, "insert must succeed");
+        for (OrderId orderId = 2; orderId <= 4; ++orderId)
+        {
+            Assert(rejecting.nextInsertableId(orderId) == orderId, "free slot must keep the candidate id");
+            Assert(rejecting.insert(makeOrder(orderId)) != nullptr, "insert must succeed");
+            Assert(rejecting.retire(orderId), "retire must succeed");
+        }
+
+        Assert(rejecting.nextInsertableId(5) == 6, "slot of the resting order must be skipped");
+        Assert(rejecting.insert(makeOrder(6)) != nullptr, "insert with the skipped id must succeed");
+        Assert(rejecting.nextInsertableId(0) == 3, "id zero must never be handed out");
+
+        Assert(rejecting.insert(makeOrder(7)) != nullptr, "insert must succeed");
+        Assert(rejecting.insert(makeOrder(8)) != nullptr, "insert must succeed");
+        Assert(rejecting.nextInsertableId(9) == OrderId { 0 }, "full store must have no insertable id");
+
+        OrderStore retiring { OrderStoreConfig {
+            .capacity = 2, .historyCapacity = 2, .overflow = OrderStoreOverflow::RetireOldest } };
+        Assert(retiring.insert(makeOrder(1)) != nullptr, "insert must succeed");
+        Assert(retiring.nextInsertableId(3) == 3, "RetireOldest must keep the candidate id");
+    }
+
+    void testOverflowRetireOldest()
+    {
+        OrderStore store { OrderStoreConfig {
+            .capacity = 2, .historyCapacity = 4, .overflow = OrderStoreOverflow::RetireOldest } };
+
+        Assert(store.insert(makeOrder(1)) != nullptr, "insert must succeed");
+        Assert(store.insert(makeOrder(2)) != nullptr, "insert must succeed");
+        Assert(store.insert(makeOrder(3)) != nullptr, "insert must evict the oldest order");
+
+        Assert(store.findLive(1) == nullptr, "evicted order must not be live");
+        Assert(store.find(1) != nullptr, "evicted order must be found in the history");
+        Assert(store.find(1)->status == OrderStatus::New, "evicted order must keep its state");
+        Assert(store.findLive(3) != nullptr, "new order must be live");
+        Assert(store.liveCount() == 2, "live count must stay at capacity");
+        Assert(store.evictions() == 1, "eviction must be counted");
+    }
+
+    std::vector<OrderId> liveIds(const OrderStore& store, const InstrumentId instrument, const Side side)
+    {
+        std::vector<OrderId> ids;
+        store.forEachLive(instrument, side, [&ids](const Order& order) {
+            ids.push_back(order.clientOrderId);
+        });
+        return ids;
+    }
+
+    void testLiveOrderLists()
+    {
+        OrderStore store { OrderStoreConfig { .capacity = 8, .historyCapacity = 8 } };
+
+        for (OrderId orderId = 1; orderId <= 5; ++orderId)
+        {
+            Order order = makeOrder(orderId);
+            order.side = orderId % 2 == 0 ? Side::Sell : Side::Buy;
+            Assert(store.insert(order) != nullptr, "insert must succeed");
+        }
+
+        Assert(liveIds(store, InstrumentId { 1 }, Side::Buy) == std::vector<OrderId> { 1, 3, 5 }, "bids must be linked in order");
+        Assert(liveIds(store, InstrumentId { 1 }, Side::Sell) == std::vector<OrderId> { 2, 4 }, "asks must be linked in order");
+
+        Assert(store.retire(3), "retire from the middle must succeed");
+        Assert(store.retire(1), "retire of the head must succeed");
+        Assert(store.retire(4), "retire of the tail must succeed");
+
+        Assert(liveIds(store, InstrumentId { 1 }, Side::Buy) == std::vector<OrderId> { 5 }, "retired bids must be unlinked");
+        Assert(liveIds(store, InstrumentId { 1 }, Side::Sell) == std::vector<OrderId> { 2 }, "retired asks must be unlinked");
+        Assert(store.liveCount(InstrumentId { 1 }, Side::Buy) == 1, "one bid must be live");
+        Assert(store.liveCount(InstrumentId { 2 }, Side::Buy) == 0, "unknown instrument has no live orders");
+        Assert(liveIds(store, InstrumentId { 2 }, Side::Buy).empty(), "unknown instrument has no live orders");
+    }
+
+    void testEvictedOrderIsUnlinked()
+    {
+        OrderStore store { OrderStoreConfig {
+            .capacity = 2, .historyCapacity = 4, .overflow = OrderStoreOverflow::RetireOldest } };
+
+        for (OrderId orderId = 1; orderId <= 3; ++orderId)
+            Assert(store.insert(makeOrder(orderId)) != nullptr, "insert must succeed");
+
+        Assert(liveIds(store, InstrumentId { 1 }, Side::Buy) == std::vector<OrderId> { 2, 3 }, "evicted order must be unlinked");
+    }
+
+    void testInstrumentAboveLimitIsRejected()
+    {
+        OrderStore store {};
+
+        Order order = makeOrder(1);
+        order.instrument = MaxInstrumentId + 1;
+
+        Assert(store.insert(order) == nullptr, "instrument above the limit must be rejected");
+    }
+
+    void testInstrumentTableIsSizedFromInstruments()
+    {
+        const std::array instruments {
+            Instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } },
+            Instrument { InstrumentId { 3 }, "ETHUSDT", Price { 1'000'000 }, Quantity { 10'000 } }
+        };
+        OrderStore store { OrderStoreConfig { .capacity = 4, .historyCapacity = 4, .instruments = instruments } };
+
+        /* Input:    orders of the configured instruments 1 and 3, of the unknown
+                     instruments 2 (inside the table) and 4 (above it)
+           Expected: the table covers ids up to 3; instrument 4 is rejected */
+        for (const InstrumentId instrument : { InstrumentId { 1 }, InstrumentId { 2 }, InstrumentId { 3 } })
+        {
+            Order order = makeOrder(instrument);
+            order.instrument = instrument;
+            Assert(store.insert(order) != nullptr, "instrument inside the table must be stored");
+            Assert(store.liveCount(instrument, Side::Buy) == 1, "order must be linked");
+        }
+
+        Order above = makeOrder(4);
+        above.instrument = InstrumentId { 4 };
+        Assert(store.insert(above) == nullptr, "instrument above the table must be rejected");
+        Assert(store.liveCount(InstrumentId { 4 }, Side::Buy) == 0, "instrument above the table has no live orders");
+    }
+}
+
+void order_store_test()
+{
+    testCapacityIsRoundedToPowerOfTwo();
+    testInsertAndFind();
+    testInsertRejectsInvalidIds();
+    testRetireMovesOrderToHistory();
+    testHistoryKeepsNewestOrders();
+    testLateRetirementDoesNotReplaceNewerHistory();
+    testOverflowReject();
+    testNextInsertableIdSkipsLiveSlots();
+    testOverflowRetireOldest();
+    testLiveOrderLists();
+    testEvictedOrderIsUnlinked();
+    testInstrumentAboveLimitIsRejected();
+    testInstrumentTableIsSizedFromInstruments();
+
+    std::cout << "All OrderStore tests: OK\n";
+}
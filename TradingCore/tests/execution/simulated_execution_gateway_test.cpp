@@ -0,0 +1,446 @@
+/**============================================================================
+Name        : simulated_execution_gateway_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tests for SimulatedExecutionGateway.
+============================================================================**/
+
+#include "simulated_execution_gateway.hpp"
+#include "test_support/testing.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using trading::ExecType;
+using trading::InstrumentId;
+using trading::OrderId;
+using trading::OrderStatus;
+using trading::OrderType;
+using trading::Price;
+using trading::Quantity;
+using trading::SequenceNumber;
+using trading::Side;
+using trading::Timestamp;
+
+using trading::execution::ExecutionReport;
+using trading::execution::Order;
+using trading::execution::SimulatedClock;
+using trading::execution::SimulatedExecutionConfig;
+using trading::execution::SimulatedExecutionGateway;
+using trading::market_data::BookUpdate;
+using trading::market_data::MarketEvent;
+using trading::market_data::OrderBook;
+
+namespace
+{
+    using testing::Assert;
+
+    constexpr InstrumentId Instrument { 1 };
+
+    [[nodiscard]]
+    MarketEvent topOfBook(const Price bid, const Price ask)
+    {
+        return MarketEvent {
+            .instrument = Instrument,
+            .bestBid = bid,
+            .bestBidQuantity = Quantity { 100'000'000 },
+            .bestAsk = ask,
+            .bestAskQuantity = Quantity { 100'000'000 }
+        };
+    }
+
+    [[nodiscard]]
+    Order order(const OrderId orderId, const Side side, const Price price)
+    {
+        return Order {
+            .clientOrderId = orderId,
+            .instrument = Instrument,
+            .side = side,
+            .type = OrderType::Limit,
+            .price = price,
+            .quantity = Quantity { 50'000'000 }
+        };
+    }
+
+    [[nodiscard]]
+    Order order(const OrderId orderId, const Side side, const Price price, const Quantity quantity)
+    {
+        Order result = order(orderId, side, price);
+        result.quantity = quantity;
+        return result;
+    }
+
+    // Applies level changes to the book and shows them to the gateway, as the market-data path would.
+    class BookFeed
+    {
+    public:
+        BookFeed(OrderBook& book, SimulatedExecutionGateway& gateway):
+            book { book },
+            gateway { gateway }
+        {
+            book.replace(sequence, {}, {});
+            gateway.setOrderBook(Instrument, book);
+        }
+
+        void update(const Side side, const Price price, const Quantity quantity)
+        {
+            const BookUpdate update {
+                .instrument = Instrument,
+                .sequence = ++sequence,
+                .side = side,
+                .price = price,
+                .quantity = quantity
+            };
+            const bool _ = book.applyUpdate(update);
+            gateway.onBookUpdate(update);
+        }
+
+    private:
+        OrderBook& book;
+        SimulatedExecutionGateway& gateway;
+        SequenceNumber sequence { 1 };
+    };
+
+    [[nodiscard]]
+    std::vector<ExecutionReport> deliver(SimulatedExecutionGateway& gateway)
+    {
+        std::vector<ExecutionReport> reports;
+        const std::size_t _ = gateway.deliverReports([&reports](const ExecutionReport& report) {
+            reports.push_back(report);
+        });
+        return reports;
+    }
+
+    /*
+        Input:
+            Top of book 100 / 101, a buy at 102 and a sell at 99.
+
+        Expected:
+            Both cross on arrival: New then Trade for each, the buy filled at
+            the ask (101) and the sell at the bid (100), in full.
+    */
+    void testCrossingOrderTakesTheOppositeBest()
+    {
+        SimulatedExecutionGateway gateway;
+        gateway.onMarketEvent(topOfBook(Price { 10'000'000'000 }, Price { 10'100'000'000 }));
+
+        gateway.send(order(1, Side::Buy, Price { 10'200'000'000 }));
+        gateway.send(order(2, Side::Sell, Price { 9'900'000'000 }));
+
+        const std::vector<ExecutionReport> reports = deliver(gateway);
+        Assert(reports.size() == 4, "each order must be acknowledged and filled");
+        Assert(reports[0].execType == ExecType::New && reports[0].clientOrderId == 1, "buy must be acknowledged first");
+        Assert(reports[0].exchangeOrderId != 0, "acknowledged order must carry an exchange order id");
+        Assert(reports[1].execType == ExecType::Trade && reports[1].status == OrderStatus::Filled, "buy must be filled");
+        Assert(reports[1].price == Price { 10'100'000'000 }, "buy must trade at the ask");
+        Assert(reports[1].quantity == Quantity { 50'000'000 }, "buy must be filled in full");
+        Assert(reports[3].price == Price { 10'000'000'000 }, "sell must trade at the bid");
+        Assert(gateway.restingOrderCount() == 0, "filled orders must not rest");
+        Assert(gateway.statistics().fills == 2, "two fills must be counted");
+    }
+
+    /*
+        Input:
+            Top of book 100 / 101, a buy at 100.5, then the ask falls to 100.2.
+
+        Expected:
+            The buy rests with a New report only and is filled at its own
+            price (100.5) by the later top of book.
+    */
+    void testRestingOrderFillsAtItsOwnPrice()
+    {
+        SimulatedExecutionGateway gateway;
+        gateway.onMarketEvent(topOfBook(Price { 10'000'000'000 }, Price { 10'100'000'000 }));
+
+        gateway.send(order(1, Side::Buy, Price { 10'050'000'000 }));
+        const std::vector<ExecutionReport> acknowledged = deliver(gateway);
+        Assert(acknowledged.size() == 1 && acknowledged[0].execType == ExecType::New, "passive order must only be acknowledged");
+        Assert(gateway.restingOrderCount() == 1, "passive order must rest");
+
+        gateway.onMarketEvent(topOfBook(Price { 10'000'000'000 }, Price { 10'020'000'000 }));
+        const std::vector<ExecutionReport> filled = deliver(gateway);
+        Assert(filled.size() == 1 && filled[0].execType == ExecType::Trade, "crossed order must be filled");
+        Assert(filled[0].price == Price { 10'050'000'000 }, "maker must trade at its own price");
+        Assert(filled[0].filledQuantity == Quantity { 50'000'000 }, "maker must be filled in full");
+        Assert(gateway.restingOrderCount() == 0, "filled order must not rest");
+    }
+
+    /*
+        Input:
+            A resting sell, cancelled; a cancel of an unknown order.
+
+        Expected:
+            One Cancel report for the open quantity; the unknown order is
+            ignored.
+    */
+    void testCancelRemovesRestingOrder()
+    {
+        SimulatedExecutionGateway gateway;
+        gateway.send(order(1, Side::Sell, Price { 10'500'000'000 }));
+        gateway.cancel(1);
+        gateway.cancel(2);
+
+        const std::vector<ExecutionReport> reports = deliver(gateway);
+        Assert(reports.size() == 2, "order must be acknowledged and cancelled");
+        Assert(reports[1].execType == ExecType::Cancel && reports[1].status == OrderStatus::Cancelled, "invalid cancel report");
+        Assert(reports[1].quantity == Quantity { 50'000'000 }, "cancel must report the open quantity");
+        Assert(gateway.restingOrderCount() == 0, "cancelled order must not rest");
+        Assert(gateway.statistics().cancels == 1, "unknown orders must not be counted");
+    }
+
+    /*
+        Input:
+            A handler that sends a crossing order when it sees the first
+            acknowledgement.
+
+        Expected:
+            The reports of the new order are delivered in the same call.
+    */
+    void testOrdersSentFromHandlerAreDelivered()
+    {
+        SimulatedExecutionGateway gateway;
+        gateway.onMarketEvent(topOfBook(Price { 10'000'000'000 }, Price { 10'100'000'000 }));
+        gateway.send(order(1, Side::Buy, Price { 9'000'000'000 }));
+
+        std::vector<ExecutionReport> reports;
+        const std::size_t delivered = gateway.deliverReports([&](const ExecutionReport& report) {
+            reports.push_back(report);
+            if (report.clientOrderId == 1)
+                gateway.send(order(2, Side::Sell, Price { 9'000'000'000 }));
+        });
+
+        Assert(delivered == 3, "reports queued by the handler must be delivered");
+        Assert(reports[2].clientOrderId == 2 && reports[2].execType == ExecType::Trade, "new order must be filled");
+    }
+
+    /*
+        Input:
+            Bid level 100 holds 5 units; a buy of 0.5 at 100 joins it. The
+            level then goes 5 -> 3 -> 4 -> 0.8 -> 0.5.
+
+        Expected:
+            The order waits behind the 5 units on arrival; the increase to 4
+            joins behind it. The decrease to 0.8 passes the 5 units ahead and
+            fills 0.2 (PartiallyFilled), the decrease to 0.5 fills the
+            remaining 0.3 at 100 (Filled).
+    */
+    void testQueuePositionFromOrderBook()
+    {
+        OrderBook book;
+        SimulatedExecutionGateway gateway;
+        BookFeed feed { book, gateway };
+
+        const Price level { 10'000'000'000 };
+        feed.update(Side::Buy, level, Quantity { 500'000'000 });
+        feed.update(Side::Sell, Price { 10'100'000'000 }, Quantity { 500'000'000 });
+
+        gateway.send(order(1, Side::Buy, level));
+        Assert(deliver(gateway).size() == 1, "passive order must only be acknowledged");
+
+        feed.update(Side::Buy, level, Quantity { 300'000'000 });
+        feed.update(Side::Buy, level, Quantity { 400'000'000 });
+        Assert(deliver(gateway).empty(), "order must wait for the quantity ahead of it");
+
+        feed.update(Side::Buy, level, Quantity { 80'000'000 });
+        const std::vector<ExecutionReport> partial = deliver(gateway);
+        Assert(partial.size() == 1 && partial[0].execType == ExecType::Trade, "passing the queue must fill the order");
+        Assert(partial[0].status == OrderStatus::PartiallyFilled, "smaller decrease must fill partially");
+        Assert(partial[0].quantity == Quantity { 20'000'000 }, "invalid partial fill quantity");
+        Assert(partial[0].price == level, "maker must trade at its own price");
+        Assert(gateway.restingOrderCount() == 1, "partially filled order must keep resting");
+
+        feed.update(Side::Buy, level, Quantity { 50'000'000 });
+        const std::vector<ExecutionReport> rest = deliver(gateway);
+        Assert(rest.size() == 1 && rest[0].status == OrderStatus::Filled, "order must be filled");
+        Assert(rest[0].quantity == Quantity { 30'000'000 }, "invalid last fill quantity");
+        Assert(rest[0].filledQuantity == Quantity { 50'000'000 }, "invalid cumulative quantity");
+        Assert(gateway.restingOrderCount() == 0, "filled order must not rest");
+    }
+
+    /*
+        Input:
+            Two buys of 0.5 at an empty bid level 99, the market adds 1 unit
+            behind them, then removes 0.7 units.
+
+        Expected:
+            The first order is filled in full and the second for 0.2: our
+            orders keep their arrival order in the queue.
+    */
+    void testOrdersOfOneLevelFillInArrivalOrder()
+    {
+        OrderBook book;
+        SimulatedExecutionGateway gateway;
+        BookFeed feed { book, gateway };
+
+        const Price level { 9'900'000'000 };
+        feed.update(Side::Sell, Price { 10'100'000'000 }, Quantity { 500'000'000 });
+
+        gateway.send(order(1, Side::Buy, level));
+        gateway.send(order(2, Side::Buy, level));
+        feed.update(Side::Buy, level, Quantity { 100'000'000 });
+        feed.update(Side::Buy, level, Quantity { 30'000'000 });
+
+        const std::vector<ExecutionReport> reports = deliver(gateway);
+        Assert(reports.size() == 4, "two acknowledgements and two fills expected");
+        Assert(reports[2].clientOrderId == 1 && reports[2].status == OrderStatus::Filled, "first order must fill first");
+        Assert(reports[3].clientOrderId == 2 && reports[3].quantity == Quantity { 20'000'000 }, "second order must fill the rest");
+        Assert(gateway.restingOrderCount() == 1, "second order must keep resting");
+    }
+
+    /*
+        Input:
+            Buys resting at 99, 98 and 97 behind large queues, then an ask
+            level appears at 98.
+
+        Expected:
+            The levels at 99 and 98 trade through, best price first, each at
+            its own price; 97 keeps resting.
+    */
+    void testTradeThroughFillsCrossedLevels()
+    {
+        OrderBook book;
+        SimulatedExecutionGateway gateway;
+        BookFeed feed { book, gateway };
+
+        feed.update(Side::Buy, Price { 9'900'000'000 }, Quantity { 1'000'000'000 });
+        feed.update(Side::Sell, Price { 10'100'000'000 }, Quantity { 500'000'000 });
+        gateway.send(order(1, Side::Buy, Price { 9'700'000'000 }));
+        gateway.send(order(2, Side::Buy, Price { 9'900'000'000 }));
+        gateway.send(order(3, Side::Buy, Price { 9'800'000'000 }));
+        Assert(deliver(gateway).size() == 3, "orders must be acknowledged");
+
+        feed.update(Side::Sell, Price { 9'800'000'000 }, Quantity { 100'000'000 });
+
+        const std::vector<ExecutionReport> fills = deliver(gateway);
+        Assert(fills.size() == 2, "two levels must trade through");
+        Assert(fills[0].clientOrderId == 2 && fills[0].price == Price { 9'900'000'000 }, "best level must fill first at its price");
+        Assert(fills[1].clientOrderId == 3 && fills[1].price == Price { 9'800'000'000 }, "crossed level must fill at its price");
+        Assert(fills[0].status == OrderStatus::Filled && fills[1].status == OrderStatus::Filled, "trade-through must fill in full");
+        Assert(gateway.restingOrderCount() == 1, "uncrossed level must keep resting");
+    }
+
+    /*
+        Input:
+            Virtual clock, order-entry latency 100 ns, ack latency 50 ns. A
+            buy is sent at 0 and cancelled at 150.
+
+        Expected:
+            The buy reaches the exchange at 100, its New report is due at
+            150; the cancel reaches it at 250, its report is due at 300.
+    */
+    void testVirtualLatency()
+    {
+        SimulatedExecutionGateway gateway { SimulatedExecutionConfig { .orderEntryLatency = 100, .ackLatency = 50 } };
+
+        gateway.send(order(1, Side::Buy, Price { 9'000'000'000 }));
+        Assert(gateway.inFlightCount() == 1 && gateway.restingOrderCount() == 0, "order must be in flight");
+
+        gateway.advanceTo(Timestamp { 99 });
+        Assert(gateway.inFlightCount() == 1, "order must not arrive early");
+
+        gateway.advanceTo(Timestamp { 100 });
+        Assert(gateway.inFlightCount() == 0 && gateway.restingOrderCount() == 1, "order must arrive after the entry latency");
+        Assert(deliver(gateway).empty(), "acknowledgement must not be delivered before the ack latency");
+
+        gateway.advanceTo(Timestamp { 150 });
+        const std::vector<ExecutionReport> acknowledged = deliver(gateway);
+        Assert(acknowledged.size() == 1 && acknowledged[0].execType == ExecType::New, "acknowledgement must be due");
+
+        gateway.cancel(1);
+        gateway.advanceTo(Timestamp { 250 });
+        Assert(gateway.restingOrderCount() == 0, "cancel must arrive after the entry latency");
+        Assert(deliver(gateway).empty(), "cancel report must wait for the ack latency");
+
+        gateway.advanceTo(Timestamp { 300 });
+        const std::vector<ExecutionReport> cancelled = deliver(gateway);
+        Assert(cancelled.size() == 1 && cancelled[0].execType == ExecType::Cancel, "cancel report must be due");
+    }
+
+    /*
+        Input:
+            Wall clock, order-entry latency 1 ms.
+
+        Expected:
+            The order is in flight at first and acknowledged once the wall
+            clock has passed the latency.
+    */
+    void testWallClockLatency()
+    {
+        SimulatedExecutionGateway gateway { SimulatedExecutionConfig {
+            .clock = SimulatedClock::Wall,
+            .orderEntryLatency = 1'000'000
+        } };
+
+        gateway.send(order(1, Side::Buy, Price { 9'000'000'000 }));
+        Assert(gateway.inFlightCount() == 1, "order must be in flight");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+        const std::vector<ExecutionReport> reports = deliver(gateway);
+        Assert(reports.size() == 1 && reports[0].execType == ExecType::New, "order must be acknowledged after the latency");
+        Assert(gateway.inFlightCount() == 0, "no request must be left in flight");
+    }
+
+    /*
+        Input:
+            4096 buys of 0.01 spread over 64 levels, each behind 1 unit;
+            one level then drops its market quantity to zero.
+
+        Expected:
+            Only the orders of that level that the decrease reaches fill:
+            the 1 unit ahead absorbs it, nothing is filled; removing another
+            unit fills 64 orders of that level.
+    */
+    void testManyRestingOrders()
+    {
+        OrderBook book;
+        SimulatedExecutionGateway gateway;
+        BookFeed feed { book, gateway };
+
+        constexpr std::size_t Levels { 64 };
+        constexpr std::size_t OrdersPerLevel { 64 };
+
+        feed.update(Side::Sell, Price { 10'100'000'000 }, Quantity { 500'000'000 });
+        for (std::size_t level = 0; level < Levels; ++level)
+            feed.update(Side::Buy, Price { static_cast<Price::Value>(9'000'000'000 + level * 1'000'000) }, Quantity { 100'000'000 });
+
+        OrderId orderId { 1 };
+        for (std::size_t index = 0; index < OrdersPerLevel; ++index)
+            for (std::size_t level = 0; level < Levels; ++level)
+                gateway.send(order(orderId++, Side::Buy, Price { static_cast<Price::Value>(9'000'000'000 + level * 1'000'000) }, Quantity { 1'000'000 }));
+
+        Assert(deliver(gateway).size() == Levels * OrdersPerLevel, "all orders must be acknowledged");
+        Assert(gateway.restingOrderCount() == Levels * OrdersPerLevel, "all orders must rest");
+
+        const Price level { 9'010'000'000 };
+        feed.update(Side::Buy, level, Quantity {});
+        Assert(deliver(gateway).empty(), "queue ahead must absorb the decrease");
+
+        feed.update(Side::Buy, level, Quantity { 100'000'000 });
+        feed.update(Side::Buy, level, Quantity {});
+        const std::vector<ExecutionReport> fills = deliver(gateway);
+        Assert(fills.size() == OrdersPerLevel, "every order of the level must fill");
+        for (const ExecutionReport& report : fills)
+            Assert(report.price == level && report.status == OrderStatus::Filled, "only the decreased level must fill");
+        Assert(gateway.restingOrderCount() == (Levels - 1) * OrdersPerLevel, "other levels must keep resting");
+    }
+}
+
+void simulated_execution_gateway_test()
+{
+    testCrossingOrderTakesTheOppositeBest();
+    testRestingOrderFillsAtItsOwnPrice();
+    testCancelRemovesRestingOrder();
+    testOrdersSentFromHandlerAreDelivered();
+    testQueuePositionFromOrderBook();
+    testOrdersOfOneLevelFillInArrivalOrder();
+    testTradeThroughFillsCrossedLevels();
+    testVirtualLatency();
+    testWallClockLatency();
+    testManyRestingOrders();
+
+    std::cout << "All SimulatedExecutionGateway tests: OK\n";
+}
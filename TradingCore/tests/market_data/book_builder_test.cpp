@@ -325,6 +325,119 @@ namespace
         Assert(orderBook.sequence() == 100, "order book sequence must not change");
     }
 
+    void testBatchPublishesSingleMarketEvent()
+    {
+        OrderBook orderBook;
+        TestMarketEventHandler eventHandler;
+        constexpr InstrumentId instrument { 42 };
+        BookBuilder builder { instrument, orderBook, eventHandler };
+
+        const bool _ = builder.applySnapshot(
+            SequenceNumber { 100 },
+            {{ Price { 6'500'000'000'000 }, Quantity { 120'000'000 } }},
+            {{ Price { 6'500'001'000'000 }, Quantity { 90'000'000 } }},
+            Timestamp { 1'000 });
+        eventHandler.clear();
+
+        const std::vector<BookUpdate> updates {
+            BookUpdate {
+                .instrument = instrument,
+                .sequence = SequenceNumber { 101 },
+                .exchangeTimestamp = Timestamp { 2'000'000 },
+                .side = Side::Buy,
+                .price = Price { 6'500'000'000'000 },
+                .quantity = Quantity {}
+            },
+            BookUpdate {
+                .instrument = instrument,
+                .sequence = SequenceNumber { 102 },
+                .exchangeTimestamp = Timestamp { 2'000'000 },
+                .side = Side::Buy,
+                .price = Price { 6'499'999'000'000 },
+                .quantity = Quantity { 300'000'000 }
+            },
+            BookUpdate {
+                .instrument = instrument,
+                .sequence = SequenceNumber { 103 },
+                .exchangeTimestamp = Timestamp { 2'000'000 },
+                .side = Side::Sell,
+                .price = Price { 6'500'002'000'000 },
+                .quantity = Quantity { 50'000'000 }
+            }
+        };
+
+        builder.onBookUpdates(updates);
+
+        Assert(eventHandler.eventCount() == 1, "batch must publish exactly one market event");
+
+        const MarketEvent& event = eventHandler.lastEvent();
+
+        Assert(event.sequence == SequenceNumber { 103 }, "event must carry the last sequence of the batch");
+        Assert(event.exchangeTimestamp == Timestamp { 2'000'000 }, "invalid exchange timestamp");
+        Assert(event.bestBid == Price { 6'499'999'000'000 }, "event must reflect the whole batch");
+        Assert(event.bestBidQuantity == Quantity { 300'000'000 }, "invalid best bid quantity");
+        Assert(event.bestAsk == Price { 6'500'001'000'000 }, "invalid best ask");
+        Assert(orderBook.sequence() == 103, "all updates must be applied");
+    }
+
+    void testBatchWithSequenceGapPublishesNothing()
+    {
+        OrderBook orderBook;
+        TestMarketEventHandler eventHandler;
+        constexpr InstrumentId instrument { 42 };
+        BookBuilder builder { instrument, orderBook, eventHandler };
+
+        const bool _ = builder.applySnapshot(SequenceNumber { 100 }, {}, {}, Timestamp { 1'000 });
+        eventHandler.clear();
+
+        const std::vector<BookUpdate> updates {
+            BookUpdate {
+                .instrument = instrument,
+                .sequence = SequenceNumber { 101 },
+                .side = Side::Buy,
+                .price = Price { 6'500'000'000'000 },
+                .quantity = Quantity { 100'000'000 }
+            },
+            BookUpdate {
+                .instrument = instrument,
+                .sequence = SequenceNumber { 103 },
+                .side = Side::Buy,
+                .price = Price { 6'499'999'000'000 },
+                .quantity = Quantity { 100'000'000 }
+            }
+        };
+
+        builder.onBookUpdates(updates);
+
+        Assert(eventHandler.isEmpty(), "partially applied batch must not publish a market event");
+        Assert(!orderBook.isValid(), "order book must become invalid after sequence gap");
+    }
+
+    void testBatchForAnotherInstrumentIsIgnored()
+    {
+        OrderBook orderBook;
+        TestMarketEventHandler eventHandler;
+        BookBuilder builder { InstrumentId { 1 }, orderBook, eventHandler };
+
+        const bool _ = builder.applySnapshot(SequenceNumber { 100 }, {}, {}, Timestamp { 1'000 });
+        eventHandler.clear();
+
+        const std::vector<BookUpdate> updates {
+            BookUpdate {
+                .instrument = InstrumentId { 2 },
+                .sequence = SequenceNumber { 101 },
+                .side = Side::Buy,
+                .price = Price { 6'500'000'000'000 },
+                .quantity = Quantity { 100'000'000 }
+            }
+        };
+
+        builder.onBookUpdates(updates);
+
+        Assert(eventHandler.isEmpty(), "batch for another instrument must be ignored");
+        Assert(orderBook.sequence() == 100, "order book sequence must not change");
+    }
+
 }
 
 void book_builder_test()
@@ -337,6 +450,9 @@ void book_builder_test()
     testUpdateAfterSnapshot();
     testEmptySnapshot();
     testBookUpdateWithWrongInstrumentIsIgnored();
+    testBatchPublishesSingleMarketEvent();
+    testBatchWithSequenceGapPublishesNothing();
+    testBatchForAnotherInstrumentIsIgnored();
 
     std::cout << "All BookBuilder tests: OK\n";
 }
\ No newline at end of file
@@ -0,0 +1,237 @@
+/**============================================================================
+Name        : book_registry_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : BookRegistry unit tests.
+============================================================================**/
+
+#include "book_registry.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <iostream>
+#include <span>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::MaxInstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Side;
+    using trading::Timestamp;
+    using trading::market_data::BookRegistry;
+    using trading::market_data::BookUpdate;
+    using trading::market_data::IBookUpdateHandler;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::TickBookRegistry;
+    using testing::Assert;
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+    constexpr Instrument ethUsdt { InstrumentId { 2 }, "ETHUSDT", Price { 1'000'000 }, Quantity { 10'000 } };
+    constexpr Instrument solUsdt { InstrumentId { 7 }, "SOLUSDT", Price { 1'000'000 }, Quantity { 100'000 } };
+
+    constexpr std::array instruments { btcUsdt, ethUsdt, solUsdt };
+
+    struct TestMarketEventHandler final : IMarketEventHandler
+    {
+        void onMarketEvent(const MarketEvent& event) override {
+            events.push_back(event);
+        }
+        std::vector<MarketEvent> events;
+    };
+
+    struct TestBookUpdateHandler final : IBookUpdateHandler
+    {
+        void onBookUpdate(const BookUpdate& update) override {
+            updates.push_back(update);
+        }
+        void onBookUpdates(const std::span<const BookUpdate> batch) override {
+            updates.insert(updates.end(), batch.begin(), batch.end());
+            ++batches;
+        }
+        std::vector<BookUpdate> updates;
+        std::size_t batches { 0 };
+    };
+
+    [[nodiscard]]
+    BookUpdate makeUpdate(const InstrumentId instrument,
+                          const SequenceNumber sequence,
+                          const Side side,
+                          const Price price,
+                          const Quantity quantity)
+    {
+        return BookUpdate {
+            .instrument = instrument,
+            .sequence = sequence,
+            .exchangeTimestamp = Timestamp { sequence * 1'000 },
+            .side = side,
+            .price = price,
+            .quantity = quantity
+        };
+    }
+
+    template<typename Registry>
+    void applySnapshots(Registry& registry)
+    {
+        for (const Instrument& instrument : instruments)
+        {
+            const Price mid = Price::fromInteger(1'000 * instrument.id());
+            const bool _ = registry.builder(instrument.id())->applySnapshot(
+                100,
+                {{ mid, Quantity { 100'000'000 } }},
+                {{ mid + Price { 1'000'000 }, Quantity { 100'000'000 } }},
+                Timestamp {});
+        }
+    }
+
+    void testRegistersInstruments()
+    {
+        TestMarketEventHandler handler;
+        BookRegistry registry { instruments, handler };
+
+        Assert(registry.size() == 3, "every instrument must get a book");
+        Assert(registry.contains(btcUsdt.id()), "BTCUSDT must be registered");
+        Assert(registry.contains(solUsdt.id()), "SOLUSDT must be registered");
+        Assert(!registry.contains(InstrumentId { 3 }), "gap in the id range must not be registered");
+        Assert(!registry.contains(InstrumentId { 1'000 }), "unknown id must not be registered");
+        Assert(registry.book(InstrumentId { 3 }) == nullptr, "unknown instrument must have no book");
+        Assert(registry.book(btcUsdt.id()) != registry.book(ethUsdt.id()), "books must be distinct");
+    }
+
+    void testRoutesUpdatesToInstrumentBooks()
+    {
+        TestMarketEventHandler handler;
+        BookRegistry registry { instruments, handler };
+        applySnapshots(registry);
+        handler.events.clear();
+
+        registry.onBookUpdate(makeUpdate(ethUsdt.id(), 101, Side::Buy, Price::fromInteger(2'000), Quantity { 300'000'000 }));
+
+        Assert(handler.events.size() == 1, "one event must be published");
+        Assert(handler.events.back().instrument == ethUsdt.id(), "event must belong to ETHUSDT");
+        Assert(registry.book(ethUsdt.id())->bidVolume(Price::fromInteger(2'000)) == Quantity { 300'000'000 },
+            "update must be applied to the ETHUSDT book");
+        Assert(registry.book(btcUsdt.id())->sequence() == 100, "BTCUSDT book must not change");
+    }
+
+    void testTopOfBookPerInstrument()
+    {
+        TestMarketEventHandler handler;
+        BookRegistry registry { instruments, handler };
+
+        Assert(registry.topOfBook(btcUsdt.id()).bestBid.isZero(), "top of book must be empty before snapshot");
+        Assert(registry.topOfBook(InstrumentId { 3 }).instrument == 0, "unknown instrument must have empty top of book");
+
+        applySnapshots(registry);
+
+        registry.onBookUpdate(makeUpdate(solUsdt.id(), 101, Side::Sell, Price::fromInteger(7'000) + Price { 500'000 },
+                                         Quantity { 50'000'000 }));
+
+        const MarketEvent& sol = registry.topOfBook(solUsdt.id());
+        const MarketEvent& btc = registry.topOfBook(btcUsdt.id());
+
+        Assert(sol.instrument == solUsdt.id(), "invalid SOLUSDT instrument");
+        Assert(sol.sequence == 101, "invalid SOLUSDT sequence");
+        Assert(sol.bestAsk == Price::fromInteger(7'000) + Price { 500'000 }, "invalid SOLUSDT best ask");
+        Assert(btc.bestBid == Price::fromInteger(1'000), "invalid BTCUSDT best bid");
+        Assert(btc.sequence == 100, "BTCUSDT top of book must come from the snapshot");
+    }
+
+    void testMixedBatchIsRoutedInRuns()
+    {
+        TestMarketEventHandler handler;
+        BookRegistry registry { instruments, handler };
+        applySnapshots(registry);
+        handler.events.clear();
+
+        const std::array batch {
+            makeUpdate(btcUsdt.id(), 101, Side::Buy, Price::fromInteger(1'000), Quantity { 1 }),
+            makeUpdate(btcUsdt.id(), 102, Side::Buy, Price::fromInteger(999), Quantity { 2 }),
+            makeUpdate(ethUsdt.id(), 101, Side::Buy, Price::fromInteger(2'000), Quantity { 3 }),
+            makeUpdate(InstrumentId { 3 }, 1, Side::Buy, Price::fromInteger(1), Quantity { 4 }),
+            makeUpdate(btcUsdt.id(), 103, Side::Sell, Price::fromInteger(1'002), Quantity { 5 })
+        };
+
+        registry.onBookUpdates(batch);
+
+        Assert(handler.events.size() == 3, "one event per applied run");
+        Assert(handler.events[0].instrument == btcUsdt.id() && handler.events[0].sequence == 102,
+            "first run must end at the last BTCUSDT update");
+        Assert(handler.events[1].instrument == ethUsdt.id(), "second run must be ETHUSDT");
+        Assert(handler.events[2].sequence == 103, "third run must be BTCUSDT again");
+        Assert(registry.droppedUpdates() == 1, "unknown instrument update must be dropped");
+        Assert(registry.book(btcUsdt.id())->bidVolume(Price::fromInteger(999)) == Quantity { 2 },
+            "BTCUSDT updates must be applied");
+    }
+
+    void testUpdateHandlerOverride()
+    {
+        TestMarketEventHandler handler;
+        BookRegistry registry { instruments, handler };
+        TestBookUpdateHandler synchronizer;
+
+        Assert(registry.setUpdateHandler(ethUsdt.id(), synchronizer), "handler must be set");
+        Assert(!registry.setUpdateHandler(InstrumentId { 3 }, synchronizer), "unknown instrument must be rejected");
+
+        const std::array batch {
+            makeUpdate(ethUsdt.id(), 101, Side::Buy, Price::fromInteger(2'000), Quantity { 3 }),
+            makeUpdate(ethUsdt.id(), 101, Side::Sell, Price::fromInteger(2'001), Quantity { 4 })
+        };
+
+        registry.onBookUpdates(batch);
+
+        Assert(synchronizer.batches == 1, "run must be forwarded as one batch");
+        Assert(synchronizer.updates.size() == 2, "both updates must be forwarded");
+        Assert(handler.events.empty(), "builder must not be called directly");
+    }
+
+    void testDuplicateAndOversizedIds()
+    {
+        constexpr std::array configured {
+            btcUsdt,
+            Instrument { btcUsdt.id(), "BTCUSDC", Price { 1'000'000 }, Quantity { 1'000 } },
+            Instrument { MaxInstrumentId + 1, "HUGE", Price { 1 }, Quantity { 1 } }
+        };
+
+        TestMarketEventHandler handler;
+        BookRegistry registry { configured, handler };
+
+        Assert(registry.size() == 1, "duplicate and oversized ids must not be registered");
+        Assert(!registry.contains(MaxInstrumentId + 1), "oversized id must not be registered");
+    }
+
+    void testTickBookRegistry()
+    {
+        TestMarketEventHandler handler;
+        TickBookRegistry registry { instruments, handler };
+        applySnapshots(registry);
+
+        registry.onBookUpdate(makeUpdate(btcUsdt.id(), 101, Side::Buy, Price::fromInteger(1'000) - Price { 1'000'000 },
+                                         Quantity { 7 }));
+
+        Assert(registry.book(btcUsdt.id())->isValid(), "tick book must be valid");
+        Assert(registry.book(btcUsdt.id())->bidVolume(Price::fromInteger(1'000) - Price { 1'000'000 }) == Quantity { 7 },
+            "update must be applied to the tick book");
+        Assert(registry.topOfBook(btcUsdt.id()).sequence == 101, "top of book must follow the tick book");
+    }
+}
+
+void book_registry_test()
+{
+    testRegistersInstruments();
+    testRoutesUpdatesToInstrumentBooks();
+    testTopOfBookPerInstrument();
+    testMixedBatchIsRoutedInRuns();
+    testUpdateHandlerOverride();
+    testDuplicateAndOversizedIds();
+    testTickBookRegistry();
+
+    std::cout << "All BookRegistry tests: OK\n";
+}
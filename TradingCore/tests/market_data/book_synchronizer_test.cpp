@@ -0,0 +1,227 @@
+/**============================================================================
+Name        : book_synchronizer_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : BookSynchronizer unit tests.
+============================================================================**/
+
+#include "book_synchronizer.hpp"
+#include "test_support/testing.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Side;
+    using trading::Timestamp;
+    using trading::market_data::BookBuilder;
+    using trading::market_data::BookSnapshot;
+    using trading::market_data::BookSynchronizer;
+    using trading::market_data::BookSyncState;
+    using trading::market_data::BookUpdate;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::OrderBook;
+    using testing::Assert;
+
+    constexpr InstrumentId instrument { 1 };
+
+    class TestMarketEventHandler final : public IMarketEventHandler
+    {
+    public:
+        void onMarketEvent(const MarketEvent& event) override {
+            events.push_back(event);
+        }
+
+        std::vector<MarketEvent> events;
+    };
+
+    /*
+        Builds a Binance-style message [first, last] with one bid level.
+    */
+    [[nodiscard]]
+    std::vector<BookUpdate> makeMessage(const SequenceNumber first,
+                                        const SequenceNumber last,
+                                        const Price bidPrice,
+                                        const Quantity bidQuantity)
+    {
+        return {
+            BookUpdate {
+                .instrument = instrument,
+                .firstSequence = first,
+                .sequence = last,
+                .side = Side::Buy,
+                .price = bidPrice,
+                .quantity = bidQuantity
+            },
+            BookUpdate {
+                .instrument = instrument,
+                .firstSequence = first,
+                .sequence = last,
+                .side = Side::Sell,
+                .price = Price { 6'500'100'000'000 },
+                .quantity = Quantity { 10'000'000 }
+            }
+        };
+    }
+
+    [[nodiscard]]
+    BookSnapshot makeSnapshot(const SequenceNumber sequence)
+    {
+        return BookSnapshot {
+            .sequence = sequence,
+            .exchangeTimestamp = Timestamp { 1'000 },
+            .bids = {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }},
+            .asks = {{ Price { 6'500'001'000'000 }, Quantity { 100'000'000 } }}
+        };
+    }
+
+    struct Fixture
+    {
+        OrderBook orderBook;
+        TestMarketEventHandler eventHandler;
+        BookBuilder builder { instrument, orderBook, eventHandler };
+        int snapshotRequests { 0 };
+        BookSynchronizer synchronizer { builder, orderBook, [this] { ++snapshotRequests; }, 64 };
+    };
+
+    void testBuffersUntilSnapshotThenReplays()
+    {
+        Fixture fixture;
+        BookSynchronizer& synchronizer = fixture.synchronizer;
+
+        synchronizer.onBookUpdates(makeMessage(95, 100, Price { 6'499'000'000'000 }, Quantity { 1 }));
+        synchronizer.onBookUpdates(makeMessage(101, 105, Price { 6'499'500'000'000 }, Quantity { 2 }));
+        synchronizer.onBookUpdates(makeMessage(106, 110, Price { 6'499'600'000'000 }, Quantity { 3 }));
+
+        Assert(synchronizer.state() == BookSyncState::AwaitingSnapshot, "synchronizer must wait for snapshot");
+        Assert(fixture.snapshotRequests == 1, "snapshot must be requested exactly once");
+        Assert(fixture.eventHandler.events.empty(), "nothing must be published before the snapshot");
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(102)), "snapshot must be accepted");
+        synchronizer.poll();
+
+        Assert(synchronizer.state() == BookSyncState::Live, "synchronizer must become live");
+        Assert(fixture.orderBook.isValid(), "order book must be valid");
+        Assert(fixture.orderBook.sequence() == 110, "buffered messages must be replayed");
+        Assert(synchronizer.statistics().staleMessages == 1, "message older than snapshot must be discarded");
+        Assert(fixture.eventHandler.events.size() == 3, "snapshot and two replayed messages must publish three events");
+        Assert(fixture.orderBook.bidVolume(Price { 6'499'000'000'000 }).isZero(), "stale level must not be applied");
+        Assert(fixture.orderBook.bidVolume(Price { 6'499'600'000'000 }) == Quantity { 3 }, "last message must be applied");
+    }
+
+    void testLiveMessagesAreForwarded()
+    {
+        Fixture fixture;
+        BookSynchronizer& synchronizer = fixture.synchronizer;
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(100)), "snapshot must be accepted");
+        synchronizer.poll();
+
+        synchronizer.onBookUpdates(makeMessage(99, 104, Price { 6'499'500'000'000 }, Quantity { 2 }));
+        synchronizer.onBookUpdates(makeMessage(105, 107, Price { 6'499'600'000'000 }, Quantity { 3 }));
+        synchronizer.onBookUpdates(makeMessage(100, 104, Price { 6'499'700'000'000 }, Quantity { 4 }));
+
+        Assert(synchronizer.state() == BookSyncState::Live, "synchronizer must stay live");
+        Assert(fixture.orderBook.sequence() == 107, "invalid book sequence");
+        Assert(synchronizer.statistics().staleMessages == 1, "duplicate message must be discarded");
+        Assert(fixture.eventHandler.events.size() == 3, "each message must publish one event");
+    }
+
+    void testGapTriggersRecovery()
+    {
+        Fixture fixture;
+        BookSynchronizer& synchronizer = fixture.synchronizer;
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(100)), "snapshot must be accepted");
+        synchronizer.poll();
+        synchronizer.onBookUpdates(makeMessage(101, 105, Price { 6'499'500'000'000 }, Quantity { 2 }));
+
+        // 106..109 is lost
+        synchronizer.onBookUpdates(makeMessage(110, 112, Price { 6'499'600'000'000 }, Quantity { 3 }));
+        synchronizer.onBookUpdates(makeMessage(113, 115, Price { 6'499'700'000'000 }, Quantity { 4 }));
+
+        Assert(synchronizer.state() == BookSyncState::AwaitingSnapshot, "gap must start recovery");
+        Assert(synchronizer.statistics().gaps == 1, "gap must be counted");
+        Assert(fixture.snapshotRequests == 1, "gap must request one new snapshot");
+        Assert(fixture.orderBook.sequence() == 105, "messages after the gap must not be applied");
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(111)), "snapshot must be accepted");
+        synchronizer.onBookUpdates(makeMessage(116, 118, Price { 6'499'800'000'000 }, Quantity { 5 }));
+
+        Assert(synchronizer.state() == BookSyncState::Live, "synchronizer must recover");
+        Assert(fixture.orderBook.sequence() == 118, "buffered and new messages must be applied");
+        Assert(fixture.orderBook.bidVolume(Price { 6'499'700'000'000 }) == Quantity { 4 }, "buffered message must be applied");
+    }
+
+    void testSnapshotOlderThanBufferRequestsAnother()
+    {
+        Fixture fixture;
+        BookSynchronizer& synchronizer = fixture.synchronizer;
+
+        synchronizer.onBookUpdates(makeMessage(200, 205, Price { 6'499'500'000'000 }, Quantity { 2 }));
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(150)), "snapshot must be accepted");
+        synchronizer.poll();
+
+        Assert(synchronizer.state() == BookSyncState::AwaitingSnapshot, "old snapshot must not make the book live");
+        Assert(fixture.snapshotRequests == 2, "a newer snapshot must be requested");
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(201)), "snapshot must be accepted");
+        synchronizer.poll();
+
+        Assert(synchronizer.state() == BookSyncState::Live, "synchronizer must become live");
+        Assert(fixture.orderBook.sequence() == 205, "retained message must be replayed");
+    }
+
+    void testSecondSnapshotRejectedUntilConsumed()
+    {
+        Fixture fixture;
+
+        Assert(fixture.synchronizer.offerSnapshot(makeSnapshot(100)), "first snapshot must be accepted");
+        Assert(!fixture.synchronizer.offerSnapshot(makeSnapshot(101)), "second snapshot must be rejected");
+
+        fixture.synchronizer.poll();
+
+        Assert(fixture.synchronizer.offerSnapshot(makeSnapshot(102)), "slot must be free after poll");
+    }
+
+    void testBufferOverflowDiscardsOldestMessages()
+    {
+        Fixture fixture;
+        BookSynchronizer& synchronizer = fixture.synchronizer;
+
+        // Capacity is 64 updates, each message has 2 updates.
+        SequenceNumber sequence { 1 };
+        for (int index { 0 }; index < 33; ++index, ++sequence)
+            synchronizer.onBookUpdates(makeMessage(sequence, sequence, Price { 6'499'500'000'000 }, Quantity { 1 }));
+
+        Assert(synchronizer.statistics().discardedMessages == 32, "full buffer must be discarded");
+        Assert(synchronizer.statistics().bufferedMessages == 33, "every message must be counted");
+
+        Assert(synchronizer.offerSnapshot(makeSnapshot(32)), "snapshot must be accepted");
+        synchronizer.poll();
+
+        Assert(synchronizer.state() == BookSyncState::Live, "synchronizer must become live");
+        Assert(fixture.orderBook.sequence() == 33, "retained message must be replayed");
+    }
+}
+
+void book_synchronizer_test()
+{
+    testBuffersUntilSnapshotThenReplays();
+    testLiveMessagesAreForwarded();
+    testGapTriggersRecovery();
+    testSnapshotOlderThanBufferRequestsAnother();
+    testSecondSnapshotRejectedUntilConsumed();
+    testBufferOverflowDiscardsOldestMessages();
+
+    std::cout << "All BookSynchronizer tests: OK\n";
+}
@@ -0,0 +1,175 @@
+/**============================================================================
+Name        : file_replay_market_data_source_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : FileReplayMarketDataSource unit tests.
+============================================================================**/
+
+#include "file_replay_market_data_source.hpp"
+#include "test_support/testing.hpp"
+
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using trading::Timestamp;
+    using trading::market_data::FileReplayMarketDataSource;
+    using trading::market_data::IMarketDataMessageHandler;
+    using trading::market_data::ReplayMode;
+    using trading::market_data::ReplayOptions;
+    using testing::Assert;
+
+    struct TestMessageHandler final : IMarketDataMessageHandler
+    {
+        void onMessage(const std::string_view message) override
+        {
+            views.push_back(message);
+            messages.emplace_back(message);
+            if (source != nullptr && messages.size() == stopAfter)
+                source->stop();
+        }
+
+        std::vector<std::string_view> views;
+        std::vector<std::string> messages;
+        FileReplayMarketDataSource* source { nullptr };
+        std::size_t stopAfter { 0 };
+    };
+
+    // Frames of the test recordings start with their exchange time in milliseconds.
+    std::optional<Timestamp> leadingMilliseconds(const std::string_view message) noexcept
+    {
+        uint64_t milliseconds { 0 };
+        const auto [_, error] = std::from_chars(message.data(), message.data() + message.size(), milliseconds);
+        if (error != std::errc {})
+            return std::nullopt;
+        return Timestamp { milliseconds * 1'000'000 };
+    }
+
+    [[nodiscard]]
+    std::string writeRecording(const std::string_view name, const std::string_view content)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file { path, std::ios::binary | std::ios::trunc };
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return path.string();
+    }
+
+    void testReplaysFramesInPlace()
+    {
+        const std::string path = writeRecording("replay_frames.jsonl", "{\"a\":1}\n{\"b\":2}\r\n\n{\"c\":3}");
+        FileReplayMarketDataSource source { path };
+        TestMessageHandler handler;
+        source.setMessageHandler(handler);
+
+        Assert(source.isOpen(), "recording must be mapped");
+        source.start();
+
+        Assert(handler.messages == std::vector<std::string> { "{\"a\":1}", "{\"b\":2}", "{\"c\":3}" },
+            "frames must be split on newlines without '\\r' and empty lines");
+        Assert(handler.views[1].data() == handler.views[0].data() + handler.views[0].size() + 1,
+            "frames must be views into the mapping");
+        Assert(source.statistics().messages == 3, "invalid number of replayed messages");
+        Assert(source.statistics().bytes == 21, "invalid number of replayed bytes");
+
+        std::filesystem::remove(path);
+    }
+
+    void testMultiplePasses()
+    {
+        const std::string path = writeRecording("replay_passes.jsonl", "1\n2\n");
+        FileReplayMarketDataSource source { path, ReplayOptions { .passes = 3 } };
+        TestMessageHandler handler;
+        source.setMessageHandler(handler);
+
+        source.start();
+
+        Assert(handler.messages.size() == 6, "every pass must replay the whole recording");
+        Assert(source.statistics().messages == 6, "statistics must cover all passes");
+        Assert(source.statistics().nanosecondsPerMessage() > 0.0, "ns/msg must be reported");
+        Assert(source.statistics().messagesPerSecond() > 0.0, "msgs/s must be reported");
+
+        std::filesystem::remove(path);
+    }
+
+    void testStopFromHandler()
+    {
+        const std::string path = writeRecording("replay_stop.jsonl", "1\n2\n3\n4\n");
+        FileReplayMarketDataSource source { path, ReplayOptions { .passes = 10 } };
+        TestMessageHandler handler;
+        handler.source = &source;
+        handler.stopAfter = 2;
+        source.setMessageHandler(handler);
+
+        source.start();
+
+        Assert(handler.messages.size() == 2, "replay must end when stopped");
+        Assert(source.statistics().messages == 2, "statistics must end at the stop");
+
+        std::filesystem::remove(path);
+    }
+
+    void testExchangeTimePaced()
+    {
+        // 20 ms of recorded time replayed at 2x speed take at least 10 ms.
+        const std::string path = writeRecording("replay_paced.jsonl", "1000 a\n1010 b\nno time\n1005 c\n1020 d\n");
+        const ReplayOptions options {
+            .mode = ReplayMode::ExchangeTimePaced,
+            .speed = 2.0,
+            .exchangeTimeReader = leadingMilliseconds
+        };
+        FileReplayMarketDataSource source { path, options };
+        TestMessageHandler handler;
+        source.setMessageHandler(handler);
+
+        const Timestamp started = Timestamp::now();
+        source.start();
+        const uint64_t elapsed = Timestamp::now() - started;
+
+        Assert(handler.messages.size() == 5, "paced replay must deliver every frame");
+        Assert(elapsed >= 10'000'000, "replay must be paced by the exchange time");
+        Assert(elapsed < 1'000'000'000, "replay must not wait for frames without a valid time");
+
+        std::filesystem::remove(path);
+    }
+
+    void testMissingAndEmptyFiles()
+    {
+        TestMessageHandler handler;
+
+        FileReplayMarketDataSource missing { "/nonexistent/recording.jsonl" };
+        missing.setMessageHandler(handler);
+        missing.start();
+
+        Assert(!missing.isOpen(), "missing file must not be open");
+        Assert(handler.messages.empty(), "missing file must replay nothing");
+
+        const std::string path = writeRecording("replay_empty.jsonl", "");
+        FileReplayMarketDataSource empty { path };
+        empty.setMessageHandler(handler);
+        empty.start();
+
+        Assert(empty.isOpen(), "empty file must be open");
+        Assert(empty.fileSize() == 0, "empty file must have no size");
+        Assert(handler.messages.empty(), "empty file must replay nothing");
+
+        std::filesystem::remove(path);
+    }
+}
+
+void file_replay_market_data_source_test()
+{
+    testReplaysFramesInPlace();
+    testMultiplePasses();
+    testStopFromHandler();
+    testExchangeTimePaced();
+    testMissingAndEmptyFiles();
+
+    std::cout << "All FileReplayMarketDataSource tests: OK\n";
+}
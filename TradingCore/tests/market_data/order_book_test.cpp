@@ -259,6 +259,61 @@ namespace
         Assert(book.sequence() == 101, "sequence must not advance after gap");
     }
 
+    void testRangedSequenceMessages()
+    {
+        OrderBook book;
+        book.replace(100, {}, {});
+
+        // First message after the snapshot overlaps it: U <= 101 <= u
+        Assert(
+            book.applyUpdate(BookUpdate {
+                .instrument = 1,
+                .firstSequence = 95,
+                .sequence = 104,
+                .side = Side::Buy,
+                .price = Price { 6'500'000'000'000 },
+                .quantity = Quantity { 100'000'000 }
+            }),
+            "overlapping range must be accepted");
+
+        // Remaining levels of the same message
+        Assert(
+            book.applyUpdate(BookUpdate {
+                .instrument = 1,
+                .firstSequence = 95,
+                .sequence = 104,
+                .side = Side::Sell,
+                .price = Price { 6'500'001'000'000 },
+                .quantity = Quantity { 100'000'000 }
+            }),
+            "level of the same message must be accepted");
+
+        Assert(
+            book.applyUpdate(BookUpdate {
+                .instrument = 1,
+                .firstSequence = 105,
+                .sequence = 110,
+                .side = Side::Buy,
+                .price = Price { 6'500'000'000'000 },
+                .quantity = Quantity { 200'000'000 }
+            }),
+            "next range must be accepted");
+
+        Assert(book.sequence() == 110, "sequence must be the end of the last range");
+
+        const bool applied = book.applyUpdate(BookUpdate {
+            .instrument = 1,
+            .firstSequence = 112,
+            .sequence = 115,
+            .side = Side::Buy,
+            .price = Price { 6'500'000'000'000 },
+            .quantity = Quantity { 300'000'000 }
+        });
+
+        Assert(!applied, "range after a gap must be rejected");
+        Assert(!book.isValid(), "book must become invalid after range gap");
+    }
+
     void testUpdatesRejectedWhenBookInvalid()
     {
         OrderBook book;
@@ -351,6 +406,7 @@ void order_book_test()
     testBestAsk();
     testSequentialUpdates();
     testSequenceGap();
+    testRangedSequenceMessages();
     testUpdatesRejectedWhenBookInvalid();
     testReplaceClearsPreviousLevels();
     testClear();
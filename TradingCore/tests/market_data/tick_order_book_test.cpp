@@ -0,0 +1,288 @@
+/**============================================================================
+Name        : tick_order_book_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : TickOrderBook unit tests.
+============================================================================**/
+
+#include "tick_order_book.hpp"
+#include "book_builder.hpp"
+#include "test_support/testing.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::Side;
+    using trading::Timestamp;
+    using trading::market_data::BookUpdate;
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::market_data::TickBookBuilder;
+    using trading::market_data::TickOrderBook;
+    using testing::Assert;
+
+    // BTCUSDT: tick size 0.01
+    constexpr Instrument instrument { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+
+    [[nodiscard]]
+    BookUpdate makeUpdate(const uint64_t sequence,
+                          const Side side,
+                          const Price price,
+                          const Quantity quantity)
+    {
+        return BookUpdate {
+            .instrument = instrument.id(),
+            .sequence = sequence,
+            .side = side,
+            .price = price,
+            .quantity = quantity
+        };
+    }
+
+    void testEmptyBook()
+    {
+        const TickOrderBook book { instrument, 1024 };
+
+        Assert(!book.isValid(), "new book must be invalid");
+        Assert(book.sequence() == 0, "new book sequence must be zero");
+        Assert(!book.bestBid().has_value(), "empty book must have no best bid");
+        Assert(!book.bestAsk().has_value(), "empty book must have no best ask");
+        Assert(book.levelCount() == 1024, "invalid level count");
+    }
+
+    void testReplaceCentresWindow()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(
+            100,
+            {
+                { Price { 6'500'000'000'000 }, Quantity { 120'000'000 } },
+                { Price { 6'499'999'000'000 }, Quantity { 250'000'000 } }
+            },
+            {
+                { Price { 6'500'001'000'000 }, Quantity { 90'000'000 } },
+                { Price { 6'500'002'000'000 }, Quantity { 310'000'000 } }
+            });
+
+        Assert(book.isValid(), "book must be valid after replace");
+        Assert(book.sequence() == 100, "replace sequence must be stored");
+        Assert(book.basePrice() == Price { 6'500'000'000'000 - 512 * 1'000'000 }, "window must be centred on the spread");
+
+        const auto bestBid = book.bestBid();
+        const auto bestAsk = book.bestAsk();
+
+        Assert(bestBid.has_value(), "best bid must exist");
+        Assert(bestBid->price == Price { 6'500'000'000'000 }, "invalid best bid price");
+        Assert(bestBid->quantity == Quantity { 120'000'000 }, "invalid best bid quantity");
+        Assert(bestAsk.has_value(), "best ask must exist");
+        Assert(bestAsk->price == Price { 6'500'001'000'000 }, "invalid best ask price");
+        Assert(bestAsk->quantity == Quantity { 90'000'000 }, "invalid best ask quantity");
+        Assert(book.askVolume(Price { 6'500'002'000'000 }) == Quantity { 310'000'000 }, "invalid ask volume");
+    }
+
+    void testRemoveBestMovesToNextLevel()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        // Levels are more than 64 ticks apart so that the scan crosses bitmap words.
+        book.replace(
+            100,
+            {
+                { Price { 6'500'000'000'000 }, Quantity { 100'000'000 } },
+                { Price { 6'499'800'000'000 }, Quantity { 200'000'000 } }
+            },
+            {
+                { Price { 6'500'001'000'000 }, Quantity { 300'000'000 } },
+                { Price { 6'500'201'000'000 }, Quantity { 400'000'000 } }
+            });
+
+        Assert(book.applyUpdate(makeUpdate(101, Side::Buy, Price { 6'500'000'000'000 }, Quantity {})),
+            "bid removal must be applied");
+        Assert(book.bestBid()->price == Price { 6'499'800'000'000 }, "best bid must move to next level");
+
+        Assert(book.applyUpdate(makeUpdate(102, Side::Sell, Price { 6'500'001'000'000 }, Quantity {})),
+            "ask removal must be applied");
+        Assert(book.bestAsk()->price == Price { 6'500'201'000'000 }, "best ask must move to next level");
+
+        Assert(book.applyUpdate(makeUpdate(103, Side::Buy, Price { 6'499'800'000'000 }, Quantity {})),
+            "last bid removal must be applied");
+        Assert(!book.bestBid().has_value(), "book must have no best bid");
+    }
+
+    void testBetterLevelBecomesBest()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(
+            100,
+            {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }},
+            {{ Price { 6'500'005'000'000 }, Quantity { 100'000'000 } }});
+
+        Assert(book.applyUpdate(makeUpdate(101, Side::Buy, Price { 6'500'001'000'000 }, Quantity { 50'000'000 })),
+            "bid update must be applied");
+        Assert(book.applyUpdate(makeUpdate(102, Side::Sell, Price { 6'500'004'000'000 }, Quantity { 70'000'000 })),
+            "ask update must be applied");
+
+        Assert(book.bestBid()->price == Price { 6'500'001'000'000 }, "invalid best bid");
+        Assert(book.bestBid()->quantity == Quantity { 50'000'000 }, "invalid best bid quantity");
+        Assert(book.bestAsk()->price == Price { 6'500'004'000'000 }, "invalid best ask");
+        Assert(book.bidVolume(Price { 6'500'000'000'000 }) == Quantity { 100'000'000 }, "old bid must remain");
+    }
+
+    void testDeepLevelsOutsideWindowAreDropped()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(
+            100,
+            {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }},
+            {{ Price { 6'500'001'000'000 }, Quantity { 100'000'000 } }});
+
+        Assert(book.applyUpdate(makeUpdate(101, Side::Buy, Price { 5'000'000'000'000 }, Quantity { 1'000'000 })),
+            "deep bid must be accepted");
+        Assert(book.applyUpdate(makeUpdate(102, Side::Sell, Price { 8'000'000'000'000 }, Quantity { 1'000'000 })),
+            "deep ask must be accepted");
+
+        Assert(book.isValid(), "book must remain valid");
+        Assert(book.sequence() == 102, "sequence must advance");
+        Assert(book.droppedUpdates() == 2, "deep levels must be counted as dropped");
+        Assert(book.bidVolume(Price { 5'000'000'000'000 }).isZero(), "deep bid must not be stored");
+        Assert(book.bestBid()->price == Price { 6'500'000'000'000 }, "best bid must not change");
+    }
+
+    void testTopOfBookOutsideWindowInvalidatesBook()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(
+            100,
+            {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }},
+            {{ Price { 6'500'001'000'000 }, Quantity { 100'000'000 } }});
+
+        const bool applied = book.applyUpdate(
+            makeUpdate(101, Side::Buy, Price { 8'000'000'000'000 }, Quantity { 1'000'000 }));
+
+        Assert(!applied, "bid above the window must be rejected");
+        Assert(!book.isValid(), "book must become invalid");
+        Assert(book.sequence() == 100, "sequence must not advance");
+    }
+
+    void testMisalignedPriceInvalidatesBook()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(100, {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }}, {});
+
+        const bool applied = book.applyUpdate(
+            makeUpdate(101, Side::Buy, Price { 6'500'000'500'000 }, Quantity { 1'000'000 }));
+
+        Assert(!applied, "price off the tick grid must be rejected");
+        Assert(!book.isValid(), "book must become invalid");
+    }
+
+    void testSequenceGap()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(100, {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }}, {});
+
+        const bool applied = book.applyUpdate(
+            makeUpdate(102, Side::Buy, Price { 6'500'000'000'000 }, Quantity { 200'000'000 }));
+
+        Assert(!applied, "sequence gap must be rejected");
+        Assert(!book.isValid(), "book must become invalid after sequence gap");
+        Assert(book.sequence() == 100, "sequence must not advance after gap");
+    }
+
+    void testReplaceClearsPreviousLevels()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(
+            100,
+            {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }},
+            {{ Price { 6'500'001'000'000 }, Quantity { 200'000'000 } }});
+
+        book.replace(
+            200,
+            {{ Price { 6'600'000'000'000 }, Quantity { 300'000'000 } }},
+            {{ Price { 6'600'001'000'000 }, Quantity { 400'000'000 } }});
+
+        Assert(book.isValid(), "book must be valid");
+        Assert(book.sequence() == 200, "replace sequence must replace old sequence");
+        Assert(book.bidVolume(Price { 6'500'000'000'000 }).isZero(), "old bid must be removed");
+        Assert(book.askVolume(Price { 6'500'001'000'000 }).isZero(), "old ask must be removed");
+        Assert(book.bestBid()->price == Price { 6'600'000'000'000 }, "invalid best bid");
+        Assert(book.bestAsk()->price == Price { 6'600'001'000'000 }, "invalid best ask");
+    }
+
+    void testClear()
+    {
+        TickOrderBook book { instrument, 1024 };
+
+        book.replace(
+            100,
+            {{ Price { 6'500'000'000'000 }, Quantity { 100'000'000 } }},
+            {{ Price { 6'500'001'000'000 }, Quantity { 200'000'000 } }});
+
+        book.clear();
+
+        Assert(!book.isValid(), "cleared book must be invalid");
+        Assert(book.sequence() == 0, "cleared book sequence must be zero");
+        Assert(!book.bestBid().has_value(), "cleared book must have no bid");
+        Assert(!book.bestAsk().has_value(), "cleared book must have no ask");
+    }
+
+    void testTickBookBuilderPublishesMarketEvent()
+    {
+        struct Handler final : IMarketEventHandler
+        {
+            void onMarketEvent(const MarketEvent& event) override {
+                events.push_back(event);
+            }
+            std::vector<MarketEvent> events;
+        };
+
+        TickOrderBook book { instrument, 1024 };
+        Handler handler;
+        TickBookBuilder builder { instrument.id(), book, handler };
+
+        const bool _ = builder.applySnapshot(
+            100,
+            {{ Price { 6'500'000'000'000 }, Quantity { 120'000'000 } }},
+            {{ Price { 6'500'001'000'000 }, Quantity { 90'000'000 } }},
+            Timestamp { 1'000 });
+
+        builder.onBookUpdate(makeUpdate(101, Side::Buy, Price { 6'500'000'000'000 }, Quantity { 200'000'000 }));
+
+        Assert(handler.events.size() == 2, "snapshot and update must publish two events");
+        Assert(handler.events.back().bestBidQuantity == Quantity { 200'000'000 }, "invalid best bid quantity");
+        Assert(handler.events.back().bestAsk == Price { 6'500'001'000'000 }, "invalid best ask");
+    }
+}
+
+void tick_order_book_test()
+{
+    testEmptyBook();
+    testReplaceCentresWindow();
+    testRemoveBestMovesToNextLevel();
+    testBetterLevelBecomesBest();
+    testDeepLevelsOutsideWindowAreDropped();
+    testTopOfBookOutsideWindowInvalidatesBook();
+    testMisalignedPriceInvalidatesBook();
+    testSequenceGap();
+    testReplaceClearsPreviousLevels();
+    testClear();
+    testTickBookBuilderPublishesMarketEvent();
+
+    std::cout << "All TickOrderBook tests: OK\n";
+}
@@ -34,14 +34,18 @@ Description : pnl_calculator_test.cpp
         - unrealized PnL for short positions;
         - flat positions;
         - total PnL;
-        - ignored non-Trade execution reports.
+        - ignored non-Trade execution reports;
+        - portfolio mark-to-market equal to calculateUnrealized() for every
+          position, including values whose product does not fit 64 bits.
 */
 
 #include "pnl_calculator.hpp"
 #include "test_support/testing.hpp"
 
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 using trading::ExchangeOrderId;
 using trading::InstrumentId;
@@ -56,6 +60,7 @@ using trading::execution::ExecutionReport;
 using trading::market_data::MarketEvent;
 using trading::pnl::PnLCalculator;
 using trading::position::Position;
+using trading::position::PositionManager;
 
 namespace
 {
@@ -313,6 +318,86 @@ namespace
         const Price pnl = calculator.calculateUnrealized(position, marketEvent);
         Assert(pnl == price(50), "short position must use ask price");
     }
+
+    /*
+        Input:
+            37 positions (several full SIMD vectors and a tail), long and
+            short, with fractional prices and quantities up to 1'000'000
+            units at prices up to 1'000'000.
+
+        Expected:
+            markToMarket() returns calculateUnrealized() for every position
+            and their sum as the total.
+    */
+    void testMarkToMarketMatchesCalculateUnrealized()
+    {
+        constexpr std::size_t Count { 37 };
+
+        uint64_t seed { 0x9E3779B97F4A7C15ULL };
+        const auto next = [&seed](const int64_t limit) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            return static_cast<int64_t>((seed >> 11) % static_cast<uint64_t>(limit)) + 1;
+        };
+
+        PositionManager positions {};
+        std::vector<Price> bids(Count);
+        std::vector<Price> asks(Count);
+
+        for (std::size_t index = 0; index < Count; ++index)
+        {
+            const auto instrument = static_cast<InstrumentId>(100 + index * 7);
+            const int64_t magnitude = index % 3 == 0 ? 1'000'000 : 1'000;
+            const Price entry { next(magnitude * Price::Scale) };
+            const Quantity size { next(magnitude * Quantity::Scale) };
+            const Side side = index % 2 == 0 ? Side::Buy : Side::Sell;
+
+            const bool _ = positions.applyExecution(trade(instrument, side, entry, size));
+
+            const PositionManager::Slot slot = positions.slotOf(instrument);
+            bids[slot] = Price { next(2 * magnitude * Price::Scale) };
+            asks[slot] = bids[slot] + Price { next(Price::Scale) };
+        }
+
+        std::vector<Price> unrealized(Count);
+        const Price total = PnLCalculator::markToMarket(positions, bids, asks, unrealized);
+
+        Price expectedTotal {};
+        for (std::size_t slot = 0; slot < Count; ++slot)
+        {
+            const std::optional<Position> position = positions.find(positions.instruments()[slot]);
+            const Price expected = PnLCalculator::calculateUnrealized(
+                *position, market(position->instrumentId(), bids[slot], quantity(1), asks[slot], quantity(1)));
+
+            Assert(unrealized[slot] == expected, "mark-to-market must match calculateUnrealized");
+            expectedTotal += expected;
+        }
+
+        Assert(total == expectedTotal, "total must be the sum of unrealized PnL");
+    }
+
+    /*
+        Input:
+            A long position without a bid and a short position without an ask.
+
+        Expected:
+            Both positions have zero unrealized PnL, as for an empty book side.
+    */
+    void testMarkToMarketWithoutMarkPrice()
+    {
+        PositionManager positions {};
+        const bool longApplied = positions.applyExecution(trade(1, Side::Buy, price(100), quantity(10)));
+        const bool shortApplied = positions.applyExecution(trade(2, Side::Sell, price(100), quantity(10)));
+        Assert(longApplied && shortApplied, "trades must be applied");
+
+        const std::vector<Price> bids { Price {}, price(90) };
+        const std::vector<Price> asks { price(110), Price {} };
+        std::vector<Price> unrealized(2, price(1));
+
+        const Price total = PnLCalculator::markToMarket(positions, bids, asks, unrealized);
+
+        Assert(unrealized[0].isZero() && unrealized[1].isZero(), "position without mark price must have zero PnL");
+        Assert(total.isZero(), "total must be zero");
+    }
 }
 
 void pnl_calculator_test()
@@ -334,5 +419,8 @@ void pnl_calculator_test()
     testLongUsesBidForMarking();
     testShortUsesAskForMarking();
 
+    testMarkToMarketMatchesCalculateUnrealized();
+    testMarkToMarketWithoutMarkPrice();
+
     std::cout << "All PnLCalculator tests: OK\n";
 }
\ No newline at end of file
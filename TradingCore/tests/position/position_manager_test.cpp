@@ -11,10 +11,12 @@ Description : position_manager_test.cpp
 #include "test_support/testing.hpp"
 
 #include <iostream>
+#include <optional>
 
 using trading::ExchangeOrderId;
 using trading::ExecType;
 using trading::InstrumentId;
+using trading::MaxInstrumentId;
 using trading::OrderId;
 using trading::OrderStatus;
 using trading::Price;
@@ -57,9 +59,9 @@ namespace
     void testInitialState()
     {
         const PositionManager manager {};
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position == nullptr, "position must not exist initially");
+        Assert(!position.has_value(), "position must not exist initially");
     }
 
     /*
@@ -83,9 +85,9 @@ namespace
 
         Assert(applied, "Buy trade must be applied");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position != nullptr, "position must be created");
+        Assert(position.has_value(), "position must be created");
         Assert(position->quantity() == Quantity { 100'000'000 }.raw(), "invalid position quantity");
         Assert(position->averagePrice() == Price { 6'500'000'000'000 }, "invalid average entry price");
     }
@@ -111,9 +113,9 @@ namespace
 
         Assert(applied, "Sell trade must be applied");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position != nullptr, "position must be created");
+        Assert(position.has_value(), "position must be created");
         Assert(position->quantity() == Quantity { -100'000'000 }.raw(), "invalid short position quantity");
         Assert(position->averagePrice() == Price { 6'500'000'000'000 }, "invalid short position entry price");
     }
@@ -147,9 +149,9 @@ namespace
         Assert(firstApplied, "first trade must be applied");
         Assert(secondApplied, "second trade must be applied");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position != nullptr, "position must exist");
+        Assert(position.has_value(), "position must exist");
         Assert(position->quantity() == Quantity { 200'000'000 }.raw(), "invalid accumulated position quantity");
         Assert(position->averagePrice() == Price { 6'500'000'000'000 }, "invalid weighted average entry price");
     }
@@ -182,11 +184,11 @@ namespace
         Assert(firstApplied, "first trade must be applied");
         Assert(secondApplied, "second trade must be applied");
 
-        const Position* firstPosition = manager.find(InstrumentId { 1 });
-        const Position* secondPosition = manager.find(InstrumentId { 2 });
+        const std::optional<Position> firstPosition = manager.find(InstrumentId { 1 });
+        const std::optional<Position> secondPosition = manager.find(InstrumentId { 2 });
 
-        Assert(firstPosition != nullptr, "first position must exist");
-        Assert(secondPosition != nullptr, "second position must exist");
+        Assert(firstPosition.has_value(), "first position must exist");
+        Assert(secondPosition.has_value(), "second position must exist");
         Assert(firstPosition->quantity() == Quantity { 100'000'000 }.raw(), "invalid first position quantity");
         Assert(secondPosition->quantity() == Quantity { 200'000'000 }.raw(), "invalid second position quantity");
     }
@@ -218,9 +220,9 @@ namespace
 
         Assert(!applied, "non-trade execution must be rejected");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position == nullptr, "non-trade execution must not create a position");
+        Assert(!position.has_value(), "non-trade execution must not create a position");
     }
 
     /*
@@ -244,9 +246,9 @@ namespace
 
         Assert(!applied, "zero quantity trade must be rejected");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position == nullptr, "zero quantity trade must not create a position");
+        Assert(!position.has_value(), "zero quantity trade must not create a position");
     }
 
     /*
@@ -276,9 +278,9 @@ namespace
 
         Assert(applied, "reducing trade must be applied");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position != nullptr, "position must exist");
+        Assert(position.has_value(), "position must exist");
         Assert(position->quantity() == Quantity { 60'000'000 }.raw(), "invalid reduced position quantity");
         Assert(position->averagePrice() == Price { 6'500'000'000'000 }, "average entry price must be preserved");
     }
@@ -310,9 +312,9 @@ namespace
 
         Assert(applied, "closing trade must be applied");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position != nullptr, "position must exist");
+        Assert(position.has_value(), "position must exist");
         Assert(position->quantity() == 0, "position must become flat");
         Assert(position->averagePrice().isZero(), "average entry price must be reset");
     }
@@ -344,9 +346,9 @@ namespace
 
         Assert(applied, "reversal trade must be applied");
 
-        const Position* position = manager.find(InstrumentId { 1 });
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
 
-        Assert(position != nullptr, "position must exist");
+        Assert(position.has_value(), "position must exist");
         Assert(position->quantity() == Quantity { -50'000'000 }.raw(), "invalid reversed position quantity");
         Assert(position->averagePrice() == Price { 7'000'000'000'000 }, "reversed position must use execution price");
     }
@@ -369,9 +371,98 @@ namespace
                 Price { 6'500'000'000'000 },
                 Quantity { 100'000'000 }));
 
-        const Position* position = manager.find(InstrumentId { 2 });
+        const std::optional<Position> position = manager.find(InstrumentId { 2 });
 
-        Assert(position == nullptr, "unknown instrument must not be found");
+        Assert(!position.has_value(), "unknown instrument must not be found");
+    }
+
+    /*
+        Input:
+            Trades for instruments 7, 3 and 7 again.
+
+        Expected:
+            Instruments get dense slots in first-trade order and the columns
+            hold the state of each slot.
+    */
+    void testSlotsFollowFirstTrade()
+    {
+        PositionManager manager {};
+
+        const bool first = manager.applyExecution(
+            createTradeReport(InstrumentId { 7 }, Side::Buy, Price { 6'000'000'000'000 }, Quantity { 100'000'000 }));
+        const bool second = manager.applyExecution(
+            createTradeReport(InstrumentId { 3 }, Side::Sell, Price { 7'000'000'000'000 }, Quantity { 50'000'000 }));
+        const bool third = manager.applyExecution(
+            createTradeReport(InstrumentId { 7 }, Side::Buy, Price { 7'000'000'000'000 }, Quantity { 100'000'000 }));
+
+        Assert(first && second && third, "trades must be applied");
+        Assert(manager.size() == 2, "one slot per instrument");
+        Assert(manager.slotOf(InstrumentId { 7 }) == 0, "first traded instrument must get slot 0");
+        Assert(manager.slotOf(InstrumentId { 3 }) == 1, "second traded instrument must get slot 1");
+        Assert(manager.slotOf(InstrumentId { 5 }) == PositionManager::NoSlot, "untraded instrument must have no slot");
+
+        Assert(manager.instruments()[1] == InstrumentId { 3 }, "invalid instrument column");
+        Assert(manager.quantities()[0] == Quantity { 200'000'000 }.raw(), "invalid quantity column");
+        Assert(manager.quantities()[1] == Quantity { -50'000'000 }.raw(), "invalid short quantity column");
+        Assert(manager.averagePrices()[0] == Price { 6'500'000'000'000 }, "invalid average price column");
+    }
+
+    /*
+        Input:
+            Buy 1 unit at 65000, Sell 0.5 at 70000, then Sell 1 at 74000.
+
+        Expected:
+            The partial close realizes 2500 and the reversal realizes 4500 on
+            the closed half, so the realized column and find() report 7000.
+            An opening trade leaves the realized PnL at zero.
+    */
+    void testRealizedPnlColumnAccumulatesClosingFills()
+    {
+        PositionManager manager {};
+
+        const bool opened = manager.applyExecution(
+            createTradeReport(InstrumentId { 1 }, Side::Buy, Price { 6'500'000'000'000 }, Quantity { 100'000'000 }));
+
+        Assert(opened, "opening trade must be applied");
+        Assert(manager.realizedPnls()[0].isZero(), "opening trade must not realize PnL");
+
+        const bool reduced = manager.applyExecution(
+            createTradeReport(InstrumentId { 1 }, Side::Sell, Price { 7'000'000'000'000 }, Quantity { 50'000'000 }));
+
+        Assert(reduced, "reducing trade must be applied");
+        Assert(manager.realizedPnls()[0] == Price { 250'000'000'000 }, "partial close must realize 2500");
+
+        const bool reversed = manager.applyExecution(
+            createTradeReport(InstrumentId { 1 }, Side::Sell, Price { 7'400'000'000'000 }, Quantity { 100'000'000 }));
+
+        Assert(reversed, "reversing trade must be applied");
+        Assert(manager.realizedPnls().size() == 1, "realized column must have one entry per position");
+        Assert(manager.realizedPnls()[0] == Price { 700'000'000'000 }, "reversal must realize only the closed quantity");
+
+        const std::optional<Position> position = manager.find(InstrumentId { 1 });
+
+        Assert(position.has_value(), "position must exist");
+        Assert(position->quantity() == Quantity { -50'000'000 }.raw(), "position must reverse to short");
+        Assert(position->realizedPnl() == Price { 700'000'000'000 }, "find() must return the realized PnL");
+    }
+
+    /*
+        Input:
+            Trade for an instrument above MaxInstrumentId.
+
+        Expected:
+            Execution is rejected and no position is created.
+    */
+    void testInstrumentAboveMaxIsRejected()
+    {
+        PositionManager manager {};
+        constexpr InstrumentId instrument { MaxInstrumentId + 1 };
+
+        const bool applied = manager.applyExecution(
+            createTradeReport(instrument, Side::Buy, Price { 6'500'000'000'000 }, Quantity { 100'000'000 }));
+
+        Assert(!applied, "instrument above MaxInstrumentId must be rejected");
+        Assert(!manager.find(instrument).has_value(), "no position must be created");
     }
 }
 
@@ -391,8 +482,12 @@ void position_manager_test()
     testPartialReductionPreservesAverageEntryPrice();
     testClosingPositionResetsAverageEntryPrice();
     testPositionReversalUsesExecutionPrice();
+    testRealizedPnlColumnAccumulatesClosingFills();
 
     testFindUnknownInstrument();
 
+    testSlotsFollowFirstTrade();
+    testInstrumentAboveMaxIsRejected();
+
     std::cout << "All PositionManager tests: OK\n";
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+/**============================================================================
+Name        : journal_reader_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tests for JournalReader.
+============================================================================**/
+
+#include "journal_reader.hpp"
+#include "journal_recorder.hpp"
+#include "test_support/testing.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+using trading::InstrumentId;
+using trading::Price;
+using trading::Quantity;
+using trading::SequenceNumber;
+
+using trading::market_data::MarketEvent;
+using trading::recording::JournalConfig;
+using trading::recording::JournalFileHeader;
+using trading::recording::JournalReader;
+using trading::recording::JournalReadStatus;
+using trading::recording::JournalRecord;
+using trading::recording::JournalRecorder;
+
+namespace
+{
+    using testing::Assert;
+
+    [[nodiscard]]
+    std::filesystem::path testDirectory(const char* name)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        return directory;
+    }
+
+    [[nodiscard]]
+    MarketEvent marketEvent(const SequenceNumber sequence)
+    {
+        return MarketEvent {
+            .instrument = InstrumentId { 1 },
+            .sequence = sequence,
+            .bestBid = Price { 6'500'000'000'000 },
+            .bestBidQuantity = Quantity { 100'000'000 },
+            .bestAsk = Price { 6'500'001'000'000 },
+            .bestAskQuantity = Quantity { 200'000'000 }
+        };
+    }
+
+    /*
+        Input:
+            A journal of three market events written by JournalRecorder.
+
+        Expected:
+            The reader opens it and exposes the header and the three records
+            in place.
+    */
+    void testReadsRecordedJournal()
+    {
+        const std::filesystem::path directory = testDirectory("journal_reader_recorded");
+        JournalRecorder recorder { JournalConfig { .directory = directory, .prefix = "read" } };
+
+        Assert(recorder.start().has_value(), "journal must start");
+        for (SequenceNumber sequence = 1; sequence <= 3; ++sequence)
+            recorder.record(marketEvent(sequence));
+        recorder.stop();
+
+        {
+            const JournalReader reader { recorder.filePath(1) };
+            Assert(reader.isOpen() && reader.status() == JournalReadStatus::Open, "recorded journal must open");
+            Assert(reader.header().fileIndex == 1, "invalid file index");
+            Assert(reader.records().size() == 3, "three records must be read");
+            Assert(reader.records()[2].sequence == 3, "records must keep their order");
+            Assert(trading::recording::marketEventOf(reader.records()[1]).sequence == 2, "invalid payload");
+        }
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            A pre-allocated file holding five records whose header counts
+            two (a writer that stopped without closing the file).
+
+        Expected:
+            Only the two counted records are exposed.
+    */
+    void testRecordCountLimitsRecords()
+    {
+        const std::filesystem::path directory = testDirectory("journal_reader_count");
+        const std::filesystem::path path = directory / "crashed.journal";
+        {
+            const JournalFileHeader header { .recordSize = sizeof(JournalRecord), .fileIndex = 1, .firstSequence = 1, .recordCount = 2 };
+            std::ofstream file { path, std::ios::binary };
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (uint64_t sequence = 1; sequence <= 5; ++sequence)
+            {
+                const JournalRecord record { .sequence = sequence };
+                file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+            }
+        }
+
+        {
+            const JournalReader reader { path };
+            Assert(reader.isOpen(), "journal must open");
+            Assert(reader.records().size() == 2, "only counted records must be read");
+        }
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            A missing file, a file with a foreign magic, a file shorter than
+            a header.
+
+        Expected:
+            CannotOpenFile, InvalidHeader, InvalidHeader; no records.
+    */
+    void testInvalidFiles()
+    {
+        const std::filesystem::path directory = testDirectory("journal_reader_invalid");
+
+        const JournalReader missing { directory / "missing.journal" };
+        Assert(missing.status() == JournalReadStatus::CannotOpenFile, "missing file must not open");
+        Assert(missing.records().empty(), "missing file must have no records");
+
+        const std::filesystem::path foreignPath = directory / "foreign.journal";
+        {
+            const JournalFileHeader header { .magic = 42, .recordSize = sizeof(JournalRecord) };
+            std::ofstream file { foreignPath, std::ios::binary };
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+        const JournalReader foreign { foreignPath };
+        Assert(foreign.status() == JournalReadStatus::InvalidHeader, "foreign magic must be rejected");
+        Assert(foreign.records().empty(), "rejected file must have no records");
+
+        const std::filesystem::path shortPath = directory / "short.journal";
+        {
+            std::ofstream file { shortPath, std::ios::binary };
+            file << "TRJRNL";
+        }
+        const JournalReader truncated { shortPath };
+        Assert(truncated.status() == JournalReadStatus::InvalidHeader, "short file must be rejected");
+
+        std::filesystem::remove_all(directory);
+    }
+}
+
+void journal_reader_test()
+{
+    testReadsRecordedJournal();
+    testRecordCountLimitsRecords();
+    testInvalidFiles();
+
+    std::cout << "All JournalReader tests: OK\n";
+}
@@ -0,0 +1,396 @@
+/**============================================================================
+Name        : journal_recorder_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tests for JournalRecorder.
+============================================================================**/
+
+#include "journal_recorder.hpp"
+#include "test_support/testing.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using trading::ExchangeOrderId;
+using trading::ExecType;
+using trading::InstrumentId;
+using trading::OrderId;
+using trading::OrderStatus;
+using trading::Price;
+using trading::Quantity;
+using trading::SequenceNumber;
+using trading::Side;
+using trading::Timestamp;
+
+using trading::execution::ExecutionReport;
+using trading::market_data::MarketEvent;
+using trading::recording::EventType;
+using trading::recording::JournalConfig;
+using trading::recording::JournalError;
+using trading::recording::JournalFileHeader;
+using trading::recording::JournalMagic;
+using trading::recording::JournalRecord;
+using trading::recording::JournalRecorder;
+using trading::recording::JournalStatistics;
+using trading::recording::JournalVersion;
+
+namespace
+{
+    using testing::Assert;
+
+    struct JournalFile
+    {
+        std::size_t size { 0 };
+        JournalFileHeader header {};
+        std::vector<JournalRecord> records;
+    };
+
+    [[nodiscard]]
+    std::filesystem::path testDirectory(const char* name)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        return directory;
+    }
+
+    [[nodiscard]]
+    JournalFile readJournal(const std::filesystem::path& path)
+    {
+        std::ifstream file { path, std::ios::binary };
+        const std::vector<char> bytes { std::istreambuf_iterator<char> { file }, std::istreambuf_iterator<char> {} };
+
+        JournalFile journal { .size = bytes.size(), .header = {}, .records = {} };
+        if (bytes.size() < sizeof(JournalFileHeader))
+            return journal;
+
+        std::memcpy(&journal.header, bytes.data(), sizeof(JournalFileHeader));
+        for (std::size_t offset = sizeof(JournalFileHeader); offset + sizeof(JournalRecord) <= bytes.size(); offset += sizeof(JournalRecord))
+        {
+            JournalRecord record;
+            std::memcpy(&record, bytes.data() + offset, sizeof(JournalRecord));
+            journal.records.push_back(record);
+        }
+        return journal;
+    }
+
+    [[nodiscard]]
+    MarketEvent marketEvent(const SequenceNumber sequence)
+    {
+        return MarketEvent {
+            .instrument = InstrumentId { 1 },
+            .sequence = sequence,
+            .exchangeTimestamp = Timestamp { 1'000 + sequence },
+            .receiveTimestamp = Timestamp { 2'000 + sequence },
+            .bestBid = Price { 6'500'000'000'000 },
+            .bestBidQuantity = Quantity { 100'000'000 },
+            .bestAsk = Price { 6'500'001'000'000 },
+            .bestAskQuantity = Quantity { 200'000'000 }
+        };
+    }
+
+    [[nodiscard]]
+    ExecutionReport executionReport(const OrderId orderId)
+    {
+        return ExecutionReport {
+            .clientOrderId = orderId,
+            .exchangeOrderId = ExchangeOrderId { 1000 + orderId },
+            .instrument = InstrumentId { 1 },
+            .side = Side::Sell,
+            .execType = ExecType::Trade,
+            .status = OrderStatus::PartiallyFilled,
+            .price = Price { 6'500'000'000'000 },
+            .quantity = Quantity { 10'000'000 },
+            .filledQuantity = Quantity { 10'000'000 }
+        };
+    }
+
+    /*
+        Input:
+            Three market events and two execution reports, interleaved.
+
+        Expected:
+            One file with a valid header, five records in recording order
+            with sequence numbers 1..5, type tags and the original payloads,
+            truncated to the written records.
+    */
+    void testRecordsAreWrittenInOrder()
+    {
+        const std::filesystem::path directory = testDirectory("journal_recorder_order");
+        JournalRecorder recorder { JournalConfig { .directory = directory, .prefix = "test" } };
+
+        Assert(recorder.start().has_value(), "journal must start");
+        recorder.record(marketEvent(10));
+        recorder.record(executionReport(1));
+        recorder.record(marketEvent(11));
+        recorder.record(executionReport(2));
+        recorder.record(marketEvent(12));
+        recorder.stop();
+
+        const JournalFile journal = readJournal(recorder.filePath(1));
+
+        Assert(journal.header.magic == JournalMagic, "invalid magic");
+        Assert(journal.header.version == JournalVersion, "invalid version");
+        Assert(journal.header.recordSize == sizeof(JournalRecord), "invalid record size");
+        Assert(journal.header.fileIndex == 1, "invalid file index");
+        Assert(journal.header.firstSequence == 1, "invalid first sequence");
+        Assert(journal.header.recordCount == 5, "invalid record count");
+        Assert(journal.size == sizeof(JournalFileHeader) + 5 * sizeof(JournalRecord), "file must be truncated to its records");
+        Assert(journal.records.size() == 5, "five records must be written");
+
+        for (std::size_t index = 0; index < journal.records.size(); ++index)
+            Assert(journal.records[index].sequence == index + 1, "sequence numbers must follow recording order");
+
+        Assert(journal.records[0].type == EventType::MarketEvent, "invalid market event tag");
+        Assert(journal.records[1].type == EventType::ExecutionReport, "invalid execution report tag");
+
+        const MarketEvent event = trading::recording::marketEventOf(journal.records[2]);
+        Assert(event.sequence == 11, "invalid market event payload");
+        Assert(event.receiveTimestamp == Timestamp { 2'011 }, "invalid market event timestamp");
+        Assert(event.bestAsk == Price { 6'500'001'000'000 }, "invalid market event price");
+
+        const ExecutionReport report = trading::recording::executionReportOf(journal.records[3]);
+        Assert(report.clientOrderId == 2, "invalid execution report payload");
+        Assert(report.side == Side::Sell, "invalid execution report side");
+        Assert(report.filledQuantity == Quantity { 10'000'000 }, "invalid execution report quantity");
+
+        const JournalStatistics statistics = recorder.statistics();
+        Assert(statistics.recorded == 5 && statistics.written == 5, "all records must be written");
+        Assert(statistics.dropped == 0 && statistics.lost == 0, "no record must be dropped");
+        Assert(statistics.files == 1, "one file must be created");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            Files that hold four records, ten records.
+
+        Expected:
+            Three files with 4, 4 and 2 records; every header names the first
+            sequence number of its file.
+    */
+    void testFilesRollBySize()
+    {
+        const std::filesystem::path directory = testDirectory("journal_recorder_roll");
+        JournalRecorder recorder { JournalConfig {
+            .directory = directory,
+            .prefix = "roll",
+            .fileSize = sizeof(JournalFileHeader) + 4 * sizeof(JournalRecord) + 10
+        } };
+
+        Assert(recorder.start().has_value(), "journal must start");
+        for (SequenceNumber sequence = 1; sequence <= 10; ++sequence)
+            recorder.record(marketEvent(sequence));
+        recorder.stop();
+
+        const JournalFile first = readJournal(recorder.filePath(1));
+        const JournalFile second = readJournal(recorder.filePath(2));
+        const JournalFile third = readJournal(recorder.filePath(3));
+
+        Assert(first.header.recordCount == 4 && first.records.size() == 4, "first file must hold four records");
+        Assert(second.header.recordCount == 4 && second.records.size() == 4, "second file must hold four records");
+        Assert(third.header.recordCount == 2 && third.records.size() == 2, "third file must hold the rest");
+
+        Assert(first.header.firstSequence == 1, "invalid first sequence of the first file");
+        Assert(second.header.firstSequence == 5, "invalid first sequence of the second file");
+        Assert(third.header.firstSequence == 9, "invalid first sequence of the third file");
+        Assert(third.header.fileIndex == 3, "invalid file index");
+        Assert(trading::recording::marketEventOf(third.records[1]).sequence == 10, "invalid last payload");
+
+        Assert(!std::filesystem::exists(recorder.filePath(4)), "no fourth file must be created");
+        Assert(recorder.statistics().files == 3, "three files must be counted");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            RingCapacity + 3 records before the writer is started, then one
+            more record once the writer has drained the ring.
+
+        Expected:
+            Three records are dropped and counted. The journal holds the
+            first RingCapacity records followed by the last one, whose
+            sequence number shows the gap.
+    */
+    void testFullRingDropsRecords()
+    {
+        const std::filesystem::path directory = testDirectory("journal_recorder_drop");
+        JournalRecorder recorder { JournalConfig { .directory = directory, .prefix = "drop" } };
+
+        for (std::size_t index = 0; index < JournalRecorder::RingCapacity + 3; ++index)
+            recorder.record(marketEvent(index));
+
+        Assert(recorder.statistics().dropped == 3, "records beyond the ring capacity must be dropped");
+
+        Assert(recorder.start().has_value(), "journal must start");
+        while (recorder.statistics().written != JournalRecorder::RingCapacity)
+            std::this_thread::yield();
+        recorder.record(executionReport(7));
+        recorder.stop();
+
+        const JournalFile journal = readJournal(recorder.filePath(1));
+        Assert(journal.records.size() == JournalRecorder::RingCapacity + 1, "kept records must be written");
+        Assert(journal.records[JournalRecorder::RingCapacity - 1].sequence == JournalRecorder::RingCapacity,
+               "kept records must keep their sequence numbers");
+        Assert(journal.records.back().sequence == JournalRecorder::RingCapacity + 4, "sequence must show the dropped records");
+
+        const JournalStatistics statistics = recorder.statistics();
+        Assert(statistics.recorded == JournalRecorder::RingCapacity + 1, "invalid recorded count");
+        Assert(statistics.written == JournalRecorder::RingCapacity + 1, "invalid written count");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            Files that hold two records. Two records fill the first file, the
+            directory is removed so the second file cannot be created, then
+            the directory is restored and records keep coming.
+
+        Expected:
+            Records drained while the file is missing are lost. A later batch
+            creates the second file, which starts with the first record
+            written after the recovery.
+    */
+    void testFailedRotationIsRetried()
+    {
+        using namespace std::chrono_literals;
+
+        const std::filesystem::path directory = testDirectory("journal_recorder_retry");
+        JournalRecorder recorder { JournalConfig {
+            .directory = directory,
+            .prefix = "retry",
+            .fileSize = sizeof(JournalFileHeader) + 2 * sizeof(JournalRecord),
+            .reopenDelay = 1ms
+        } };
+
+        Assert(recorder.start().has_value(), "journal must start");
+        recorder.record(marketEvent(1));
+        recorder.record(marketEvent(2));
+        while (recorder.statistics().written != 2)
+            std::this_thread::yield();
+
+        std::filesystem::remove_all(directory);
+        recorder.record(marketEvent(3));
+        while (recorder.statistics().lost != 1)
+            std::this_thread::yield();
+
+        std::filesystem::create_directories(directory);
+        SequenceNumber sequence { 3 };
+        while (recorder.statistics().written == 2)
+        {
+            // One record at a time: each one is either written or lost before the next.
+            recorder.record(marketEvent(++sequence));
+            while (recorder.statistics().written + recorder.statistics().lost != sequence)
+                std::this_thread::yield();
+            std::this_thread::sleep_for(1ms);
+        }
+        recorder.stop();
+
+        const JournalStatistics statistics = recorder.statistics();
+        Assert(statistics.files == 2, "the second file must be created once the directory is back");
+        Assert(statistics.written == 3, "one record must be written after the recovery");
+        Assert(statistics.lost == sequence - 3, "records drained without a file must be lost");
+
+        const JournalFile second = readJournal(recorder.filePath(2));
+        Assert(second.header.fileIndex == 2, "invalid file index");
+        Assert(second.records.size() == 1, "second file must hold the record written after the recovery");
+        Assert(second.header.firstSequence == sequence, "second file must start with the recovered record");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            Two recorders started in turn on the same directory and prefix,
+            the first writes three records, the second two.
+
+        Expected:
+            The first run's file keeps its three records. The second run
+            continues with file 2 (sequence numbers restart at 1) instead of
+            overwriting file 1.
+    */
+    void testRestartKeepsEarlierFiles()
+    {
+        const std::filesystem::path directory = testDirectory("journal_recorder_restart");
+        const JournalConfig config { .directory = directory, .prefix = "restart" };
+
+        {
+            JournalRecorder first { config };
+            Assert(first.start().has_value(), "first journal must start");
+            for (SequenceNumber sequence = 1; sequence <= 3; ++sequence)
+                first.record(marketEvent(sequence));
+            first.stop();
+        }
+
+        JournalRecorder second { config };
+        Assert(second.start().has_value(), "second journal must start");
+        second.record(executionReport(1));
+        second.record(executionReport(2));
+        second.stop();
+
+        const JournalFile earlier = readJournal(second.filePath(1));
+        Assert(earlier.header.fileIndex == 1, "invalid file index of the first run");
+        Assert(earlier.header.recordCount == 3 && earlier.records.size() == 3, "first run's records must survive");
+        Assert(earlier.records[0].type == EventType::MarketEvent, "first run's file must not be overwritten");
+        Assert(trading::recording::marketEventOf(earlier.records[2]).sequence == 3, "invalid first run payload");
+
+        const JournalFile later = readJournal(second.filePath(2));
+        Assert(later.header.fileIndex == 2, "second run must continue with the next file index");
+        Assert(later.records.size() == 2, "second run's records must be written");
+        Assert(later.header.firstSequence == 1, "sequence numbers restart with the recorder");
+        Assert(later.records[0].type == EventType::ExecutionReport, "invalid second run tag");
+
+        Assert(!std::filesystem::exists(second.filePath(3)), "no third file must be created");
+        Assert(second.statistics().files == 1, "second run must create one file");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    /*
+        Input:
+            A file size smaller than one record; start() on a running journal.
+
+        Expected:
+            InvalidConfiguration and AlreadyStarted.
+    */
+    void testStartErrors()
+    {
+        const std::filesystem::path directory = testDirectory("journal_recorder_errors");
+
+        JournalRecorder tooSmall { JournalConfig { .directory = directory, .fileSize = sizeof(JournalFileHeader) } };
+        const std::expected<void, JournalError> invalid = tooSmall.start();
+        Assert(!invalid && invalid.error() == JournalError::InvalidConfiguration, "too small files must be rejected");
+        Assert(!tooSmall.isRunning(), "rejected journal must not run");
+
+        JournalRecorder recorder { JournalConfig { .directory = directory } };
+        Assert(recorder.start().has_value(), "journal must start");
+        const std::expected<void, JournalError> again = recorder.start();
+        Assert(!again && again.error() == JournalError::AlreadyStarted, "second start must be rejected");
+        recorder.stop();
+        Assert(!recorder.isRunning(), "stopped journal must not run");
+
+        std::filesystem::remove_all(directory);
+    }
+}
+
+void journal_recorder_test()
+{
+    testRecordsAreWrittenInOrder();
+    testFilesRollBySize();
+    testFullRingDropsRecords();
+    testFailedRotationIsRetried();
+    testRestartKeepsEarlierFiles();
+    testStartErrors();
+
+    std::cout << "All JournalRecorder tests: OK\n";
+}
@@ -0,0 +1,114 @@
+/**============================================================================
+Name        : reference_prices_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : ReferencePrices unit tests.
+============================================================================**/
+
+#include "reference_prices.hpp"
+#include "test_support/testing.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+namespace
+{
+    using testing::Assert;
+
+    using trading::Instrument;
+    using trading::InstrumentId;
+    using trading::Price;
+    using trading::Quantity;
+    using trading::SequenceNumber;
+    using trading::Timestamp;
+
+    using trading::market_data::IMarketEventHandler;
+    using trading::market_data::MarketEvent;
+    using trading::risk::ReferencePrice;
+    using trading::risk::ReferencePrices;
+
+    constexpr Instrument btcUsdt { InstrumentId { 1 }, "BTCUSDT", Price { 1'000'000 }, Quantity { 1'000 } };
+    constexpr Instrument ethUsdt { InstrumentId { 2 }, "ETHUSDT", Price { 1'000'000 }, Quantity { 10'000 } };
+
+    constexpr std::array instruments { btcUsdt, ethUsdt };
+
+    class CountingHandler final : public IMarketEventHandler
+    {
+    public:
+        void onMarketEvent(const MarketEvent& event) override
+        {
+            lastInstrument = event.instrument;
+            ++events;
+        }
+
+        InstrumentId lastInstrument { 0 };
+        uint64_t events { 0 };
+    };
+
+    [[nodiscard]]
+    MarketEvent topOfBook(const InstrumentId instrument, const Price bid, const Price ask)
+    {
+        return MarketEvent {
+            .instrument = instrument,
+            .sequence = SequenceNumber { 1 },
+            .exchangeTimestamp = Timestamp {},
+            .receiveTimestamp = Timestamp {},
+            .bestBid = bid,
+            .bestBidQuantity = Quantity { 100'000'000 },
+            .bestAsk = ask,
+            .bestAskQuantity = Quantity { 100'000'000 }
+        };
+    }
+
+    void testNoReferenceBeforeFirstEvent()
+    {
+        CountingHandler next;
+        const ReferencePrices prices { instruments, next };
+
+        const ReferencePrice reference = prices.reference(btcUsdt.id());
+        Assert(!reference.isValid(), "reference must be invalid before the first event");
+        Assert(reference.tickSize == btcUsdt.tickSize(), "tick size must be known before the first event");
+        Assert(prices.contains(btcUsdt.id()), "configured instrument must be contained");
+        Assert(!prices.contains(InstrumentId { 3 }), "unknown instrument must not be contained");
+    }
+
+    void testEventUpdatesReferenceAndIsForwarded()
+    {
+        CountingHandler next;
+        ReferencePrices prices { instruments, next };
+
+        prices.onMarketEvent(topOfBook(ethUsdt.id(), Price { 300'000'000'000 }, Price { 300'001'000'000 }));
+
+        const ReferencePrice reference = prices.reference(ethUsdt.id());
+        Assert(reference.isValid(), "reference must be valid after a two-sided event");
+        Assert(reference.bid == Price { 300'000'000'000 }, "invalid reference bid");
+        Assert(reference.ask == Price { 300'001'000'000 }, "invalid reference ask");
+        Assert(!prices.reference(btcUsdt.id()).isValid(), "other instruments must not change");
+
+        Assert(next.events == 1, "event must be forwarded");
+        Assert(next.lastInstrument == ethUsdt.id(), "forwarded event must be unchanged");
+    }
+
+    void testUnknownInstrumentIsForwarded()
+    {
+        CountingHandler next;
+        ReferencePrices prices { instruments, next };
+
+        prices.onMarketEvent(topOfBook(InstrumentId { 9 }, Price { 100'000'000 }, Price { 200'000'000 }));
+
+        Assert(next.events == 1, "event of an unknown instrument must be forwarded");
+        Assert(!prices.reference(InstrumentId { 9 }).isValid(), "unknown instrument has no reference");
+    }
+}
+
+void reference_prices_test()
+{
+    testNoReferenceBeforeFirstEvent();
+    testEventUpdatesReferenceAndIsForwarded();
+    testUnknownInstrumentIsForwarded();
+
+    std::cout << "All ReferencePrices tests: OK\n";
+}
@@ -32,23 +32,35 @@ Description : risk_manager_test.cpp
         - maximum notional;
         - long positions;
         - short positions;
-        - disabled limits.
+        - disabled limits;
+        - reservation of open orders;
+        - maximum open notional;
+        - pending table sized for the configured instruments;
+        - price band in ticks and basis points.
 */
 
 #include "risk_manager.hpp"
+#include "reference_prices.hpp"
 #include "test_support/testing.hpp"
 
+#include <array>
 #include <cstdlib>
 #include <iostream>
 
+using trading::Instrument;
 using trading::InstrumentId;
+using trading::OrderId;
 using trading::OrderType;
 using trading::Price;
 using trading::Quantity;
 using trading::Side;
 
+using trading::execution::Order;
 using trading::execution::OrderRequest;
 using trading::position::Position;
+using trading::risk::PendingExposure;
+using trading::risk::PriceBandUnit;
+using trading::risk::ReferencePrices;
 using trading::risk::RiskLimits;
 using trading::risk::RiskManager;
 using trading::risk::RiskReason;
@@ -272,6 +284,223 @@ namespace
         Assert(manager.lastReason() == RiskReason::None,
             "reason must be reset after accepted order");
     }
+
+    [[nodiscard]]
+    constexpr Order openOrder(const OrderId orderId, const Side side, const Price orderPrice, const Quantity orderQuantity)
+    {
+        return Order {
+            .clientOrderId = orderId,
+            .instrument = InstrumentId { 1 },
+            .side = side,
+            .type = OrderType::Limit,
+            .price = orderPrice,
+            .quantity = orderQuantity
+        };
+    }
+
+    void testPendingOrdersCountTowardsPosition()
+    {
+        RiskManager manager {
+            RiskLimits {
+                .maxOrderQuantity = quantity(1'000),
+                .maxPositionQuantity = quantity(100)
+            }
+        };
+
+        constexpr Position position { InstrumentId { 1 } };
+        constexpr auto request = limitOrder(Side::Buy, price(100), quantity(40));
+
+        Assert(manager.checkOrder(request, position) == RiskResult::Accepted, "first order must be accepted");
+        manager.reserve(openOrder(1, Side::Buy, price(100), quantity(40)));
+
+        Assert(manager.checkOrder(request, position) == RiskResult::Accepted, "second order must be accepted");
+        manager.reserve(openOrder(2, Side::Buy, price(100), quantity(40)));
+
+        Assert(manager.checkOrder(request, position) == RiskResult::Rejected,
+               "pending buys must count towards the position limit");
+        Assert(manager.lastReason() == RiskReason::MaxPositionQuantity, "invalid rejection reason");
+
+        constexpr auto sell = limitOrder(Side::Sell, price(100), quantity(40));
+        Assert(manager.checkOrder(sell, position) == RiskResult::Accepted,
+               "pending buys must not block the opposite side");
+    }
+
+    void testReleaseRestoresCapacity()
+    {
+        RiskManager manager {
+            RiskLimits {
+                .maxOrderQuantity = quantity(1'000),
+                .maxPositionQuantity = quantity(100)
+            }
+        };
+
+        Position position { InstrumentId { 1 } };
+        const Order order = openOrder(1, Side::Sell, price(100), quantity(80));
+        manager.reserve(order);
+
+        constexpr auto request = limitOrder(Side::Sell, price(100), quantity(30));
+        Assert(manager.checkOrder(request, position) == RiskResult::Rejected, "pending sells must be counted");
+
+        // Partial fill: 50 moves from pending into the position.
+        manager.release(order, quantity(50));
+        position.applyTrade(Side::Sell, price(100), quantity(50));
+        Assert(manager.checkOrder(request, position) == RiskResult::Rejected, "filled part must stay counted");
+
+        // Cancel of the rest.
+        manager.release(order, quantity(30));
+        Assert(manager.checkOrder(request, position) == RiskResult::Accepted, "cancelled part must be released");
+    }
+
+    void testPendingExposure()
+    {
+        RiskManager manager { RiskLimits {} };
+
+        const Order buy = openOrder(1, Side::Buy, price(100), quantity(3));
+        const Order sell = openOrder(2, Side::Sell, price(110), quantity(2));
+        manager.reserve(buy);
+        manager.reserve(sell);
+
+        const PendingExposure exposure = manager.pendingExposure(InstrumentId { 1 });
+        Assert(exposure.buyQuantity == quantity(3), "invalid pending buy quantity");
+        Assert(exposure.sellQuantity == quantity(2), "invalid pending sell quantity");
+        Assert(exposure.buyNotional == price(300), "invalid pending buy notional");
+        Assert(exposure.sellNotional == price(220), "invalid pending sell notional");
+
+        manager.release(buy, quantity(3));
+        manager.release(sell, quantity(2));
+
+        const PendingExposure released = manager.pendingExposure(InstrumentId { 1 });
+        Assert(released.buyQuantity.isZero() && released.sellQuantity.isZero(), "quantities must be released");
+        Assert(released.buyNotional.isZero() && released.sellNotional.isZero(), "notional must be released");
+
+        const PendingExposure unknown = manager.pendingExposure(InstrumentId { 7 });
+        Assert(unknown.buyQuantity.isZero(), "unknown instrument has no pending orders");
+    }
+
+    void testRejectMaxOpenNotional()
+    {
+        RiskManager manager {
+            RiskLimits {
+                .maxOpenNotional = price(10'000)
+            }
+        };
+
+        constexpr Position position { InstrumentId { 1 } };
+        manager.reserve(openOrder(1, Side::Buy, price(100), quantity(60)));
+
+        Assert(manager.checkOrder(limitOrder(Side::Sell, price(100), quantity(40)), position) == RiskResult::Accepted,
+               "order at the open notional limit must be accepted");
+
+        Assert(manager.checkOrder(limitOrder(Side::Sell, price(100), quantity(41)), position) == RiskResult::Rejected,
+               "open notional above the limit must be rejected");
+        Assert(manager.lastReason() == RiskReason::MaxOpenNotional, "invalid open notional rejection reason");
+    }
+
+    class NullEventHandler final : public trading::market_data::IMarketEventHandler
+    {
+    public:
+        void onMarketEvent(const trading::market_data::MarketEvent&) override {}
+    };
+
+    constexpr std::array bandInstruments {
+        Instrument { InstrumentId { 1 }, "BTCUSDT", Price { Price::Scale / 100 }, Quantity { 1'000 } }
+    };
+
+    void publishTopOfBook(ReferencePrices& prices, const Price bid, const Price ask)
+    {
+        prices.onMarketEvent(trading::market_data::MarketEvent {
+            .instrument = InstrumentId { 1 },
+            .bestBid = bid,
+            .bestBidQuantity = quantity(1),
+            .bestAsk = ask,
+            .bestAskQuantity = quantity(1)
+        });
+    }
+
+    void testPendingTableCoversConfiguredInstruments()
+    {
+        RiskManager manager { RiskLimits {}, bandInstruments };
+
+        manager.reserve(openOrder(1, Side::Buy, price(100), quantity(3)));
+
+        Order unknown = openOrder(2, Side::Buy, price(100), quantity(5));
+        unknown.instrument = InstrumentId { 2 };
+        manager.reserve(unknown);
+        manager.release(unknown, quantity(5));
+
+        Assert(manager.pendingExposure(InstrumentId { 1 }).buyQuantity == quantity(3),
+               "configured instrument must be reserved");
+        Assert(manager.pendingExposure(InstrumentId { 2 }).buyQuantity.isZero(),
+               "instrument outside the table must not be reserved");
+    }
+
+    void testPriceBandInBasisPoints()
+    {
+        NullEventHandler next;
+        ReferencePrices prices { bandInstruments, next };
+        publishTopOfBook(prices, price(10'000), price(10'001));
+
+        RiskManager manager { RiskLimits { .priceBand = 10, .priceBandUnit = PriceBandUnit::BasisPoints } };
+        manager.setReferencePrices(prices);
+
+        constexpr Position position { InstrumentId { 1 } };
+
+        // 10 bps of the ask 10'001 is 10.001: the highest buy is 10'011.001.
+        Assert(manager.checkOrder(limitOrder(Side::Buy, Price { 1'001'100'100'000 }, quantity(1)), position)
+                   == RiskResult::Accepted, "buy at the band edge must be accepted");
+        Assert(manager.checkOrder(limitOrder(Side::Buy, Price { 1'001'100'100'001 }, quantity(1)), position)
+                   == RiskResult::Rejected, "buy above the band must be rejected");
+        Assert(manager.lastReason() == RiskReason::PriceBand, "invalid band rejection reason");
+
+        // 10 bps of the bid 10'000 is 10: the lowest sell is 9'990.
+        Assert(manager.checkOrder(limitOrder(Side::Sell, price(9'990), quantity(1)), position)
+                   == RiskResult::Accepted, "sell at the band edge must be accepted");
+        Assert(manager.checkOrder(limitOrder(Side::Sell, price(9'989), quantity(1)), position)
+                   == RiskResult::Rejected, "sell below the band must be rejected");
+        Assert(manager.checkOrder(limitOrder(Side::Buy, price(5'000), quantity(1)), position)
+                   == RiskResult::Accepted, "passive buy far below the market must be accepted");
+    }
+
+    void testPriceBandInTicks()
+    {
+        NullEventHandler next;
+        ReferencePrices prices { bandInstruments, next };
+        publishTopOfBook(prices, price(100), price(101));
+
+        RiskManager manager { RiskLimits { .priceBand = 5, .priceBandUnit = PriceBandUnit::Ticks } };
+        manager.setReferencePrices(prices);
+
+        constexpr Position position { InstrumentId { 1 } };
+
+        // Tick size 0.01: five ticks above the ask 101 is 101.05.
+        Assert(manager.checkOrder(limitOrder(Side::Buy, Price { 10'105'000'000 }, quantity(1)), position)
+                   == RiskResult::Accepted, "buy five ticks through the ask must be accepted");
+        Assert(manager.checkOrder(limitOrder(Side::Buy, Price { 10'106'000'000 }, quantity(1)), position)
+                   == RiskResult::Rejected, "buy six ticks through the ask must be rejected");
+
+        publishTopOfBook(prices, price(110), price(111));
+        Assert(manager.checkOrder(limitOrder(Side::Buy, Price { 10'106'000'000 }, quantity(1)), position)
+                   == RiskResult::Accepted, "band must follow the live top of book");
+    }
+
+    void testPriceBandWithoutReference()
+    {
+        NullEventHandler next;
+        const ReferencePrices prices { bandInstruments, next };
+        constexpr Position position { InstrumentId { 1 } };
+        constexpr RiskLimits limits { .priceBand = 10 };
+
+        RiskManager detached { limits };
+        Assert(detached.checkOrder(limitOrder(Side::Buy, price(100), quantity(1)), position) == RiskResult::Rejected,
+               "band without reference prices must reject");
+        Assert(detached.lastReason() == RiskReason::NoReferencePrice, "invalid missing reference reason");
+
+        RiskManager manager { limits };
+        manager.setReferencePrices(prices);
+        Assert(manager.checkOrder(limitOrder(Side::Buy, price(100), quantity(1)), position) == RiskResult::Rejected,
+               "band before the first market event must reject");
+        Assert(manager.lastReason() == RiskReason::NoReferencePrice, "invalid missing reference reason");
+    }
 }
 
 void risk_manager_test()
@@ -291,5 +520,15 @@ void risk_manager_test()
     testDisabledLimits();
     testReasonIsResetAfterAcceptedOrder();
 
+    testPendingOrdersCountTowardsPosition();
+    testReleaseRestoresCapacity();
+    testPendingExposure();
+    testRejectMaxOpenNotional();
+    testPendingTableCoversConfiguredInstruments();
+
+    testPriceBandInBasisPoints();
+    testPriceBandInTicks();
+    testPriceBandWithoutReference();
+
     std::cout << "All RiskManager tests: OK\n";
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**============================================================================
+Name        : latency_histogram_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tests for LatencyHistogram.
+============================================================================**/
+
+#include "latency_histogram.hpp"
+#include "test_support/testing.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
+using trading::trace::LatencyHistogram;
+using trading::trace::LatencySummary;
+
+namespace
+{
+    using testing::Assert;
+
+    /*
+        Input:
+            Values below SubBuckets, powers of two, their neighbours and the
+            largest uint64_t.
+
+        Expected:
+            Small values have a bucket of their own; every value lies within
+            its bucket, the bucket is at most 1/SubBuckets of the value wide
+            and consecutive values never map to a lower bucket.
+    */
+    void testBucketBounds()
+    {
+        for (uint64_t value = 0; value < LatencyHistogram::SubBuckets; ++value)
+        {
+            Assert(LatencyHistogram::bucketOf(value) == value, "small values must be exact");
+            Assert(LatencyHistogram::upperBoundOf(value) == value, "small buckets must hold one value");
+        }
+
+        std::size_t previous { 0 };
+        for (unsigned bit = 5; bit < 64; ++bit)
+        {
+            for (const uint64_t value : { (uint64_t { 1 } << bit) - 1, uint64_t { 1 } << bit, (uint64_t { 1 } << bit) + 1 })
+            {
+                const std::size_t bucket = LatencyHistogram::bucketOf(value);
+                const uint64_t upper = LatencyHistogram::upperBoundOf(bucket);
+
+                Assert(bucket < LatencyHistogram::BucketCount, "bucket out of range");
+                Assert(bucket >= previous, "buckets must grow with the value");
+                Assert(upper >= value, "value must not exceed its bucket");
+                Assert(upper - value <= value / LatencyHistogram::SubBuckets, "bucket too wide");
+                previous = bucket;
+            }
+        }
+
+        const uint64_t largest = std::numeric_limits<uint64_t>::max();
+        Assert(LatencyHistogram::bucketOf(largest) == LatencyHistogram::BucketCount - 1, "largest value must use the last bucket");
+        Assert(LatencyHistogram::upperBoundOf(LatencyHistogram::BucketCount - 1) == largest, "invalid last bucket bound");
+    }
+
+    /*
+        Input:
+            The latencies 1..1000 ns.
+
+        Expected:
+            p50 ~ 500, p99 ~ 990, p99.9 ~ 999 (within one bucket, never
+            below the exact value), max exactly 1000.
+    */
+    void testPercentiles()
+    {
+        LatencyHistogram histogram;
+        for (uint64_t value = 1; value <= 1'000; ++value)
+            histogram.record(value);
+
+        const LatencySummary summary = histogram.summary();
+
+        Assert(summary.count == 1'000, "invalid count");
+        Assert(summary.p50 >= 500 && summary.p50 <= 500 + 500 / 32, "invalid p50");
+        Assert(summary.p99 >= 990 && summary.p99 <= 990 + 990 / 32, "invalid p99");
+        Assert(summary.p999 >= 999 && summary.p999 <= 1'000, "invalid p99.9");
+        Assert(summary.max == 1'000, "max must be exact");
+    }
+
+    /*
+        Input:
+            999 latencies of 100 ns and one of 1 ms.
+
+        Expected:
+            p99 stays at 100 ns, p99.9 and max show the outlier.
+    */
+    void testTailOutlier()
+    {
+        LatencyHistogram histogram;
+        for (int index = 0; index < 999; ++index)
+            histogram.record(100);
+        histogram.record(1'000'000);
+
+        Assert(histogram.valueAt(0.99) >= 100 && histogram.valueAt(0.99) < 104, "p99 must ignore the outlier");
+        Assert(histogram.valueAt(0.999) >= 100 && histogram.valueAt(0.999) < 104, "p99.9 is the 999th value");
+        Assert(histogram.valueAt(1.0) == 1'000'000, "p100 must be the outlier");
+        Assert(histogram.max() == 1'000'000, "invalid max");
+    }
+
+    /*
+        Input:
+            An empty histogram; two histograms merged; a reset.
+
+        Expected:
+            Zero percentiles when empty; the merge holds the counts and max
+            of both; reset empties it.
+    */
+    void testMergeAndReset()
+    {
+        LatencyHistogram first;
+        Assert(first.summary().count == 0 && first.valueAt(0.5) == 0, "empty histogram must report zero");
+
+        LatencyHistogram second;
+        first.record(10);
+        second.record(20);
+        second.record(5'000);
+
+        first.merge(second);
+        Assert(first.count() == 3, "merge must add the counts");
+        Assert(first.max() == 5'000, "merge must keep the max");
+        Assert(first.valueAt(0.5) == 20, "invalid merged median");
+
+        first.reset();
+        Assert(first.count() == 0 && first.max() == 0 && first.valueAt(1.0) == 0, "reset must empty the histogram");
+    }
+}
+
+void latency_histogram_test()
+{
+    testBucketBounds();
+    testPercentiles();
+    testTailOutlier();
+    testMergeAndReset();
+
+    std::cout << "All LatencyHistogram tests: OK\n";
+}
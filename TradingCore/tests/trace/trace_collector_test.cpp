@@ -0,0 +1,392 @@
+/**============================================================================
+Name        : trace_collector_test.cpp
+Created on  : 17.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tests for TraceCollector and the propagation of TraceContext.
+============================================================================**/
+
+#include "book_builder.hpp"
+#include "order_manager.hpp"
+#include "strategy_executor.hpp"
+#include "trace_collector.hpp"
+#include "test_support/testing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using trading::InstrumentId;
+using trading::OrderId;
+using trading::Price;
+using trading::Quantity;
+using trading::SequenceNumber;
+using trading::Side;
+using trading::Timestamp;
+
+using trading::execution::IExecutionGateway;
+using trading::execution::Order;
+using trading::execution::OrderManager;
+using trading::execution::OrderRequest;
+using trading::market_data::BookBuilder;
+using trading::market_data::BookUpdate;
+using trading::market_data::IMarketEventHandler;
+using trading::market_data::MarketEvent;
+using trading::market_data::OrderBook;
+using trading::position::Position;
+using trading::risk::IRiskManager;
+using trading::risk::RiskReason;
+using trading::risk::RiskResult;
+using trading::trace::Stage;
+using trading::trace::TraceBuffer;
+using trading::trace::TraceCollector;
+using trading::trace::TraceContext;
+using trading::trace::TraceStamps;
+using trading::trace::TraceStatistics;
+
+namespace
+{
+    using testing::Assert;
+    using trading::trace::indexOf;
+
+    class AcceptingRiskManager final : public IRiskManager
+    {
+    public:
+        RiskResult checkOrder(const OrderRequest&, const Position&) override
+        {
+            return RiskResult::Accepted;
+        }
+
+        [[nodiscard]]
+        RiskReason lastReason() const noexcept override
+        {
+            return RiskReason::None;
+        }
+    };
+
+    class CapturingGateway final : public IExecutionGateway
+    {
+    public:
+        void send(const Order& order) override
+        {
+            orders.push_back(order);
+        }
+
+        void cancel(OrderId) override
+        {
+        }
+
+        std::vector<Order> orders;
+    };
+
+    class CapturingEventHandler final : public IMarketEventHandler
+    {
+    public:
+        void onMarketEvent(const MarketEvent& event) override
+        {
+            events.push_back(event);
+        }
+
+        std::vector<MarketEvent> events;
+    };
+
+    [[nodiscard]]
+    TraceStamps stampsFrom(const uint64_t start, const std::array<uint64_t, trading::trace::StageCount - 1>& deltas)
+    {
+        TraceStamps stamps {};
+        stamps[0] = Timestamp { start };
+        for (std::size_t index = 1; index < stamps.size(); ++index)
+            stamps[index] = stamps[index - 1] + deltas[index - 1];
+        return stamps;
+    }
+
+    /*
+        Input:
+            Two complete traces with stage latencies 100/200/300/400/500 ns
+            and 300/400/500/600/700 ns.
+
+        Expected:
+            Every stage histogram counts two latencies with the matching max,
+            SocketRead stays empty, tick-to-trade holds 1500 and 2500 ns.
+    */
+    void testStagesAreAggregated()
+    {
+        TraceCollector collector;
+        collector.record(stampsFrom(1'000, { 100, 200, 300, 400, 500 }));
+        collector.record(stampsFrom(9'000, { 300, 400, 500, 600, 700 }));
+
+        Assert(collector.stage(Stage::SocketRead).count() == 0, "SocketRead has no previous stage");
+        Assert(collector.stage(Stage::Parsed).count() == 2, "invalid Parsed count");
+        Assert(collector.stage(Stage::Parsed).max() == 300, "invalid Parsed max");
+        Assert(collector.stage(Stage::BookApplied).max() == 400, "invalid BookApplied max");
+        Assert(collector.stage(Stage::StrategyDecided).max() == 500, "invalid StrategyDecided max");
+        Assert(collector.stage(Stage::RiskPassed).max() == 600, "invalid RiskPassed max");
+        Assert(collector.stage(Stage::GatewaySend).max() == 700, "invalid GatewaySend max");
+        Assert(collector.stage(Stage::GatewaySend).valueAt(0.5) >= 500 &&
+               collector.stage(Stage::GatewaySend).valueAt(0.5) < 700, "invalid GatewaySend median");
+
+        Assert(collector.tickToTrade().count() == 2, "both traces are complete");
+        Assert(collector.tickToTrade().max() == 2'500, "invalid tick-to-trade max");
+        Assert(collector.statistics().traces == 2, "invalid trace count");
+
+        collector.reset();
+        Assert(collector.tickToTrade().count() == 0 && collector.statistics().traces == 0, "reset must clear the histograms");
+    }
+
+    /*
+        Input:
+            A monitoring thread collects 1000 traces one at a time while a
+            reader thread keeps taking tickToTrade() and stage() copies.
+
+        Expected:
+            Every copy is a consistent snapshot: counts never go backwards and
+            a copy taken earlier does not change when more traces arrive.
+    */
+    void testHistogramsAreReadAsSnapshots()
+    {
+        TraceCollector collector;
+        TraceBuffer& buffer = *collector.claimBuffer();
+        const TraceStamps stamps = stampsFrom(1'000, { 10, 10, 10, 10, 10 });
+
+        std::atomic<bool> collecting { true };
+        bool monotonic { true };
+        std::thread reader { [&] {
+            uint64_t previous { 0 };
+            while (collecting.load(std::memory_order_acquire))
+            {
+                const uint64_t count = collector.tickToTrade().count();
+                monotonic = monotonic && count >= previous && collector.stage(Stage::GatewaySend).count() >= count;
+                previous = count;
+            }
+        } };
+
+        for (int index = 0; index < 1'000; ++index)
+        {
+            buffer.push(stamps);
+            collector.collect();
+        }
+        collecting.store(false, std::memory_order_release);
+        reader.join();
+
+        Assert(monotonic, "histogram copies must not go backwards");
+
+        const trading::trace::LatencyHistogram snapshot = collector.tickToTrade();
+        collector.record(stamps);
+        Assert(snapshot.count() == 1'000, "invalid snapshot count");
+        Assert(collector.tickToTrade().count() == 1'001, "record() must update the collector");
+    }
+
+    /*
+        Input:
+            A trace that starts at BookApplied, as for a replayed event.
+
+        Expected:
+            Only the stages after BookApplied are counted; no tick-to-trade.
+    */
+    void testPartialTrace()
+    {
+        TraceStamps stamps {};
+        stamps[indexOf(Stage::BookApplied)] = Timestamp { 5'000 };
+        stamps[indexOf(Stage::StrategyDecided)] = Timestamp { 5'050 };
+        stamps[indexOf(Stage::RiskPassed)] = Timestamp { 5'070 };
+        stamps[indexOf(Stage::GatewaySend)] = Timestamp { 5'100 };
+
+        TraceCollector collector;
+        collector.record(stamps);
+
+        Assert(collector.stage(Stage::Parsed).count() == 0, "unstamped stages must not be counted");
+        Assert(collector.stage(Stage::BookApplied).count() == 0, "a stage needs its predecessor");
+        Assert(collector.stage(Stage::StrategyDecided).max() == 50, "invalid StrategyDecided latency");
+        Assert(collector.stage(Stage::GatewaySend).max() == 30, "invalid GatewaySend latency");
+        Assert(collector.tickToTrade().count() == 0, "tick-to-trade needs SocketRead");
+    }
+
+    /*
+        Input:
+            Two producer threads push 1000 traces each into their own
+            buffers; a third buffer receives Capacity + 5 traces without
+            being collected.
+
+        Expected:
+            collect() gathers every queued trace; the overfull buffer drops
+            five and the statistics count them.
+    */
+    void testBuffersAreCollected()
+    {
+        TraceCollector collector;
+        TraceBuffer& first = *collector.claimBuffer();
+        TraceBuffer& second = *collector.claimBuffer();
+
+        const TraceStamps stamps = stampsFrom(1'000, { 10, 10, 10, 10, 10 });
+        std::thread producerA { [&] { for (int index = 0; index < 1'000; ++index) first.push(stamps); } };
+        std::thread producerB { [&] { for (int index = 0; index < 1'000; ++index) second.push(stamps); } };
+        producerA.join();
+        producerB.join();
+
+        Assert(collector.collect() == 2'000, "all queued traces must be collected");
+        Assert(collector.tickToTrade().count() == 2'000, "collected traces must be aggregated");
+        Assert(collector.collect() == 0, "buffers must be empty after collect()");
+
+        TraceBuffer& third = *collector.claimBuffer();
+        for (std::size_t index = 0; index < TraceBuffer::Capacity + 5; ++index)
+            third.push(stamps);
+
+        const TraceStatistics statistics = collector.statistics();
+        Assert(statistics.buffers == 3, "invalid buffer count");
+        Assert(statistics.dropped == 5, "traces beyond the capacity must be dropped");
+        Assert(collector.collect() == TraceBuffer::Capacity, "kept traces must be collected");
+    }
+
+    /*
+        Input:
+            MaxBuffers claims, one more claim and a trace of a thread
+            without a buffer.
+
+        Expected:
+            The claims return distinct buffers, the extra claim nullptr; the
+            unbuffered trace is counted as dropped.
+    */
+    void testBufferClaimsAreBounded()
+    {
+        TraceCollector collector;
+        std::vector<const TraceBuffer*> claimed;
+        for (std::size_t index = 0; index < TraceCollector::MaxBuffers; ++index)
+        {
+            const TraceBuffer* const buffer = collector.claimBuffer();
+            Assert(buffer != nullptr, "preallocated buffers must be claimable");
+            Assert(std::ranges::find(claimed, buffer) == claimed.end(), "claimed buffers must be distinct");
+            claimed.push_back(buffer);
+        }
+
+        Assert(collector.claimBuffer() == nullptr, "no buffer must be left after MaxBuffers claims");
+
+        collector.dropUnbuffered();
+        const TraceStatistics statistics = collector.statistics();
+        Assert(statistics.buffers == TraceCollector::MaxBuffers, "invalid buffer count");
+        Assert(statistics.dropped == 1, "a trace without a buffer must be dropped");
+    }
+
+    /*
+        Input:
+            2 * MaxBuffers threads, one after the other, each commits one
+            trace and exits; collect() runs after every thread.
+
+        Expected:
+            Every trace is collected and none is dropped: an exited thread
+            hands its buffer back, so later threads still find one. No
+            buffer stays claimed once the threads are gone.
+    */
+    void testExitedThreadsReleaseBuffers()
+    {
+        TraceCollector& collector = trading::trace::collector();
+        collector.collect();
+        collector.reset();
+        const TraceStatistics before = collector.statistics();
+
+        const TraceStamps stamps = stampsFrom(1'000, { 100, 200, 300, 400, 500 });
+        constexpr std::size_t Threads { 2 * TraceCollector::MaxBuffers };
+        for (std::size_t index = 0; index < Threads; ++index)
+        {
+            std::thread producer { [&] { trading::trace::commit(stamps); } };
+            producer.join();
+            Assert(collector.collect() == 1, "the trace of an exited thread must be collected");
+        }
+
+        const TraceStatistics statistics = collector.statistics();
+        Assert(statistics.traces == Threads, "every thread's trace must be counted");
+        Assert(statistics.dropped == before.dropped, "no trace must be dropped");
+        Assert(statistics.buffers == before.buffers, "exited threads must not keep their buffers");
+        Assert(collector.tickToTrade().count() == Threads, "every trace must reach the histograms");
+    }
+
+    /*
+        Input:
+            A BookUpdate through BookBuilder, makeOrderRequest() and
+            OrderManager::createOrder().
+
+        Expected:
+            With TRADING_CORE_TRACING: the order handed to the gateway
+            carries the stamps of the update, in stage order up to
+            RiskPassed, and one complete trace reaches collector().
+            Without it: TraceContext is empty, the messages keep their size
+            and no trace is committed.
+    */
+    void testContextPropagation()
+    {
+        OrderBook book;
+        CapturingEventHandler handler;
+        BookBuilder builder { InstrumentId { 1 }, book, handler };
+        const bool _ = builder.applySnapshot(SequenceNumber { 10 },
+                                             { { Price { 100'000'000 }, Quantity { 100'000'000 } } },
+                                             { { Price { 101'000'000 }, Quantity { 100'000'000 } } },
+                                             Timestamp { 1 });
+
+        BookUpdate update {
+            .instrument = InstrumentId { 1 },
+            .sequence = SequenceNumber { 11 },
+            .side = Side::Buy,
+            .price = Price { 100'000'000 },
+            .quantity = Quantity { 300'000'000 }
+        };
+        update.trace.stamp(Stage::SocketRead);
+        update.trace.stamp(Stage::Parsed);
+        builder.onBookUpdate(update);
+        Assert(handler.events.size() == 2, "update must produce a MarketEvent");
+
+        const std::optional<OrderRequest> request =
+            trading::strategy::makeOrderRequest(trading::strategy::Signal::Buy, handler.events.back(), Quantity { 100'000'000 });
+
+        AcceptingRiskManager riskManager;
+        CapturingGateway gateway;
+        Position position { InstrumentId { 1 } };
+        OrderManager orderManager { gateway, riskManager, position };
+
+        TraceCollector& collector = trading::trace::collector();
+        collector.collect();
+        collector.reset();
+
+        Assert(orderManager.createOrder(*request).has_value(), "order must be created");
+        Assert(gateway.orders.size() == 1, "order must be sent");
+        collector.collect();
+
+        const TraceStamps stamps = gateway.orders.front().trace.stamps();
+        if constexpr (trading::trace::TracingEnabled)
+        {
+            for (std::size_t index = 0; index <= indexOf(Stage::RiskPassed); ++index)
+                Assert(stamps[index] != Timestamp {}, "every stage up to RiskPassed must be stamped");
+            for (std::size_t index = 1; index <= indexOf(Stage::RiskPassed); ++index)
+                Assert(stamps[index] >= stamps[index - 1], "stamps must follow the stages");
+
+            Assert(collector.statistics().traces == 1, "the sent order must commit its trace");
+            Assert(collector.tickToTrade().count() == 1, "the committed trace must be complete");
+        }
+        else
+        {
+            Assert(std::is_empty_v<TraceContext>, "TraceContext must be empty without tracing");
+            Assert(sizeof(MarketEvent) == 64, "MarketEvent must keep its size");
+            Assert(sizeof(BookUpdate) == 56, "BookUpdate must keep its size");
+            Assert(stamps == TraceStamps {}, "no stamps without tracing");
+            Assert(collector.statistics().traces == 0, "nothing must be committed without tracing");
+        }
+    }
+}
+
+void trace_collector_test()
+{
+    testStagesAreAggregated();
+    testHistogramsAreReadAsSnapshots();
+    testPartialTrace();
+    testBuffersAreCollected();
+    testBufferClaimsAreBounded();
+    testExitedThreadsReleaseBuffers();
+    testContextPropagation();
+
+    std::cout << "All TraceCollector tests: OK\n";
+}
@@ -14,6 +14,12 @@ namespace
     constexpr double asDouble(const nlohmann::json& data){
         return std::stod(data.get_ref<const std::string&>());
     };
+
+    market_data::binance::InstrumentId asInstrument(const nlohmann::json& data,
+                                                    const market_data::binance::InstrumentResolver& resolver)
+    {
+        return resolver.resolve(data.get_ref<const std::string&>()).value_or(market_data::binance::UnknownInstrument);
+    }
 }
 
 
@@ -21,10 +27,10 @@ namespace BinanceParserJson
 {
     using market_data::binance::JsonParams;
 
-    market_data::binance::Trade parseTrade(const nlohmann::json& data)
+    market_data::binance::Trade parseTrade(const nlohmann::json& data, const InstrumentResolver& resolver)
     {
         market_data::binance::Trade trade;
-        data.at(JsonParams::symbol).get_to(trade.symbol);
+        trade.instrument = asInstrument(data.at(JsonParams::symbol), resolver);
         data.at(JsonParams::eventTime).get_to(trade.eventTime);
         data.at(JsonParams::Trade::tradeId).get_to(trade.tradeId);
         // data.at(JsonParams::Trade::buyerOrderID).get_to(trade.buyerOrderId);
@@ -36,10 +42,10 @@ namespace BinanceParserJson
         return trade;
     }
 
-    market_data::binance::AggTrade parseAggTrade(const nlohmann::json& data)
+    market_data::binance::AggTrade parseAggTrade(const nlohmann::json& data, const InstrumentResolver& resolver)
     {
         market_data::binance::AggTrade aggTrade;
-        data.at(JsonParams::symbol).get_to(aggTrade.symbol);
+        aggTrade.instrument = asInstrument(data.at(JsonParams::symbol), resolver);
         data.at(JsonParams::eventTime).get_to(aggTrade.eventTime);
         data.at(JsonParams::AggTrade::aggregateTradeId).get_to(aggTrade.aggregateTradeId);
         data.at(JsonParams::AggTrade::firstTradeId).get_to(aggTrade.firstTradeId);
@@ -51,11 +57,11 @@ namespace BinanceParserJson
         return aggTrade;
     }
 
-    market_data::binance::MiniTicker parseMiniTicker(const nlohmann::json& data)
+    market_data::binance::MiniTicker parseMiniTicker(const nlohmann::json& data, const InstrumentResolver& resolver)
     {
         market_data::binance::MiniTicker ticker;
         data.at(JsonParams::eventTime).get_to(ticker.timestamp);
-        data.at(JsonParams::symbol).get_to(ticker.symbol);
+        ticker.instrument = asInstrument(data.at(JsonParams::symbol), resolver);
         ticker.close    = asDouble(data.at("c"));
         ticker.open     = asDouble(data.at("o"));
         ticker.high     = asDouble(data.at("h"));
@@ -65,10 +71,10 @@ namespace BinanceParserJson
         return ticker;
     }
 
-    market_data::binance::BookTicker parseBookTicker(const nlohmann::json& data)
+    market_data::binance::BookTicker parseBookTicker(const nlohmann::json& data, const InstrumentResolver& resolver)
     {
         market_data::binance::BookTicker ticker;
-        data.at(JsonParams::symbol).get_to(ticker.symbol);
+        ticker.instrument = asInstrument(data.at(JsonParams::symbol), resolver);
         ticker.bidPrice    = asDouble(data.at(JsonParams::BookTicker::bestBuyPrice));
         ticker.bidQuantity = asDouble(data.at(JsonParams::BookTicker::bestBuyQuantity));
         ticker.askPrice    = asDouble(data.at(JsonParams::BookTicker::bestAskPrice));
@@ -77,10 +83,10 @@ namespace BinanceParserJson
         return ticker;
     }
 
-    market_data::binance::DepthUpdate parseDepthUpdate(const nlohmann::json& data)
+    market_data::binance::DepthUpdate parseDepthUpdate(const nlohmann::json& data, const InstrumentResolver& resolver)
     {
         market_data::binance::DepthUpdate update;
-        data.at(JsonParams::symbol).get_to(update.symbol);
+        update.instrument = asInstrument(data.at(JsonParams::symbol), resolver);
         data.at(JsonParams::eventTime).get_to(update.eventTime);
         data.at(JsonParams::DepthUpdate::firstUpdateId).get_to(update.firstUpdateId);
         data.at(JsonParams::DepthUpdate::finalUpdateId).get_to(update.finalUpdateId);
@@ -120,11 +126,11 @@ namespace BinanceParserJson
         return bookSnapshot;
     }
 
-    market_data::binance::Ticker parseTicker(const nlohmann::json& data)
+    market_data::binance::Ticker parseTicker(const nlohmann::json& data, const InstrumentResolver& resolver)
     {
         market_data::binance::Ticker ticker;
 
-        data.at(JsonParams::symbol).get_to(ticker.symbol);
+        ticker.instrument = asInstrument(data.at(JsonParams::symbol), resolver);
         data.at(JsonParams::eventTime).get_to(ticker.eventTime);
         data.at(JsonParams::eventType).get_to(ticker.eventType);
         ticker.priceChange = asDouble(data.at(JsonParams::Ticker::priceChange));
@@ -15,13 +15,15 @@ Description : BinanceDataParser.hpp
 
 namespace BinanceParserJson
 {
-    market_data::binance::Trade        parseTrade(const nlohmann::json& data);
-    market_data::binance::AggTrade     parseAggTrade(const nlohmann::json& data);
-    market_data::binance::MiniTicker   parseMiniTicker(const nlohmann::json& data);
-    market_data::binance::BookTicker   parseBookTicker(const nlohmann::json& data);
-    market_data::binance::DepthUpdate  parseDepthUpdate(const nlohmann::json& data);
+    using market_data::binance::InstrumentResolver;
+
+    market_data::binance::Trade        parseTrade(const nlohmann::json& data, const InstrumentResolver& resolver);
+    market_data::binance::AggTrade     parseAggTrade(const nlohmann::json& data, const InstrumentResolver& resolver);
+    market_data::binance::MiniTicker   parseMiniTicker(const nlohmann::json& data, const InstrumentResolver& resolver);
+    market_data::binance::BookTicker   parseBookTicker(const nlohmann::json& data, const InstrumentResolver& resolver);
+    market_data::binance::DepthUpdate  parseDepthUpdate(const nlohmann::json& data, const InstrumentResolver& resolver);
     market_data::binance::BookSnapshot parseBookSnapshot(const nlohmann::json& data);
-    market_data::binance::Ticker       parseTicker(const nlohmann::json& data);
+    market_data::binance::Ticker       parseTicker(const nlohmann::json& data, const InstrumentResolver& resolver);
 }
 
 #endif //FINANCETECHNOLOGYPROJECTS_BINANCE_DATA_PARSER_HPP
\ No newline at end of file
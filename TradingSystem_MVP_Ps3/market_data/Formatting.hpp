@@ -23,10 +23,10 @@ struct std::formatter<market_data::binance::Trade>
 
     static auto format(const market_data::binance::Trade& trade, std::format_context& ctx) -> decltype(auto)
     {
-        return std::format_to(ctx.out(), "Trade(\n\tsymbol: {},\n\teventTime: {}, \n\ttradeId: {},"
+        return std::format_to(ctx.out(), "Trade(\n\tinstrument: {},\n\teventTime: {}, \n\ttradeId: {},"
         "\n\tprice: {},\n\tquantity: {},\n\tbuyerOrderId: {},\n\tsellerOrderId: {},"
         "\n\ttradeTime: {},\n\tisBuyerMaker: {}\n)",
-            trade.symbol,
+            trade.instrument,
             trade.eventTime,
             trade.tradeId,
             trade.price,
@@ -46,10 +46,10 @@ struct std::formatter<market_data::binance::AggTrade>
 
     static auto format(const market_data::binance::AggTrade& aggTrade, std::format_context& ctx) -> decltype(auto)
     {
-        return std::format_to(ctx.out(), "Trade(\n\tsymbol: {},\n\teventTime: {}, \n\taggregateTradeId: {},"
+        return std::format_to(ctx.out(), "Trade(\n\tinstrument: {},\n\teventTime: {}, \n\taggregateTradeId: {},"
         "\n\tprice: {},\n\tquantity: {},\n\tfirstTradeId: {},\n\tlastTradeId: {},"
         "\n\ttradeTime: {},\n\tisBuyerMaker: {}\n)",
-            aggTrade.symbol,
+            aggTrade.instrument,
             aggTrade.eventTime,
             aggTrade.aggregateTradeId,
             aggTrade.price,
@@ -71,9 +71,9 @@ struct std::formatter<market_data::binance::MiniTicker>
 
     static auto format(const market_data::binance::MiniTicker& miniTicker, std::format_context& ctx) -> decltype(auto)
     {
-        return std::format_to(ctx.out(), "MiniTicker(\n\tsymbol: {},\n\ttimestamp: {}, \n\tclose: {},"
+        return std::format_to(ctx.out(), "MiniTicker(\n\tinstrument: {},\n\ttimestamp: {}, \n\tclose: {},"
             "\n\topen: {},\n\thigh: {},\n\tlow: {},\n\tvolume: {},\n\tquantity: {}\n)",
-            miniTicker.symbol,
+            miniTicker.instrument,
             miniTicker.timestamp,
             miniTicker.close,
             miniTicker.open,
@@ -93,9 +93,9 @@ struct std::formatter<market_data::binance::BookTicker>
 
     static auto format(const market_data::binance::BookTicker& bookTicker, std::format_context& ctx) -> decltype(auto)
     {
-        return std::format_to(ctx.out(),"BookTicker(\n\tsymbol: {},\n\tbidPrice: {}, \n\tbidQuantity: {},"
+        return std::format_to(ctx.out(),"BookTicker(\n\tinstrument: {},\n\tbidPrice: {}, \n\tbidQuantity: {},"
             "\n\taskPrice: {},\n\taskQuantity: {},\n\tupdateId: {}\n)",
-            bookTicker.symbol,
+            bookTicker.instrument,
             bookTicker.bidPrice,
             bookTicker.bidQuantity,
             bookTicker.askPrice,
@@ -134,9 +134,9 @@ struct std::formatter<market_data::binance::DepthUpdate>
             strBids += std::format("({}, {})", price,quantity) + " ";
         }
 
-        return std::format_to(ctx.out(),"DepthUpdate(\n\tsymbol: {},\n\tfirstUpdateId: {}, "
+        return std::format_to(ctx.out(),"DepthUpdate(\n\tinstrument: {},\n\tfirstUpdateId: {}, "
             "\n\tfinalUpdateId: {},\n\teventTime: {},\n\tbids: [ {}],\n\tasks: [ {}]\n)",
-            update.symbol,
+            update.instrument,
             update.firstUpdateId,
             update.finalUpdateId,
             update.eventTime,
@@ -181,13 +181,13 @@ struct std::formatter<market_data::binance::Ticker>
     static auto format(const market_data::binance::Ticker& ticker, std::format_context& ctx) -> decltype(auto)
     {
         return std::format_to(ctx.out(), "Ticker("
-             "\n\tsymbol: {},\n\teventType: {},\n\teventTime: {},\n\tpriceChange: {},"
+             "\n\tinstrument: {},\n\teventType: {},\n\teventTime: {},\n\tpriceChange: {},"
             "\n\tpriceChangePercent: {},\n\tweightedAvgPrice: {},\n\tprevClosePrice: {},"
             "\n\tlastPrice: {},\n\tlastQuantity: {},\n\tbestBid: {},\n\tbestBidQuantity: {},"
             "\n\tbestAskQuantity: {},\n\topenPrice: {},\n\thighPrice: {},\n\tlowPrice: {},"
             "\n\tvolume: {},\n\tquoteVolume: {},\n\topenTime: {},\n\tcloseTime: {},\n\tfirstTradeId: {},"
             "\n\tlastTradeId: {},\n\tnumTrades: {}\n)",
-            ticker.symbol,
+            ticker.instrument,
             ticker.eventType,
             ticker.eventTime,
             ticker.priceChange,
@@ -10,6 +10,7 @@ Description :
 #ifndef FINANCETECHNOLOGYPROJECTS_MARKETDATA_HPP
 #define FINANCETECHNOLOGYPROJECTS_MARKETDATA_HPP
 
+#include <array>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -17,6 +18,7 @@ Description :
 
 
 #include "Common.hpp"
+#include "instrument_resolver.hpp"
 
 namespace market_data::binance
 {
@@ -27,8 +29,11 @@ namespace market_data::binance
     using Timestamp  = common::Timestamp;
     using PriceLevel = common::PriceLevel;
 
-    // TODO: ---> implement StaticString (stack only)
-    using Symbol = std::string;
+    using InstrumentId = trading::InstrumentId;
+    using InstrumentResolver = trading::InstrumentResolver;
+
+    // Symbols that are not configured below are reported with this id
+    constexpr InstrumentId UnknownInstrument { 0 };
 
     struct JsonParams
     {
@@ -132,13 +137,26 @@ namespace market_data::binance
         static constexpr std::string_view kline_1m { "kline_1m" };
         static constexpr std::string_view miniTicker { "miniTicker" };
     };
+
+    /** Traded instruments: the "s" symbol of every event is resolved to the InstrumentId
+     *  through a perfect-hash table generated from this list at compile time. **/
+    inline constexpr std::array instruments {
+        trading::Instrument { 1, "BTCUSDT", trading::Price { 1'000'000 }, trading::Quantity { 1'000 } },
+        trading::Instrument { 2, "ETHUSDT", trading::Price { 1'000'000 }, trading::Quantity { 10'000 } },
+        trading::Instrument { 3, "BNBUSDT", trading::Price { 1'000'000 }, trading::Quantity { 100'000 } },
+        trading::Instrument { 4, "SOLUSDT", trading::Price { 1'000'000 }, trading::Quantity { 100'000 } },
+        trading::Instrument { 5, "XRPUSDT", trading::Price { 10'000 }, trading::Quantity { 10'000'000 } },
+    };
+
+    inline constexpr InstrumentResolver instrumentResolver { instruments };
+    static_assert(instrumentResolver.isValid(), "Invalid instrument list");
 }
 
 namespace market_data::binance
 {
     struct MiniTicker
     {
-        Symbol    symbol {}; //               <---------- REMOVE
+        InstrumentId instrument { UnknownInstrument };
         Timestamp timestamp { 0 };
         Price     close { 0.0 };
         Price     open { 0.0 };
@@ -150,7 +168,7 @@ namespace market_data::binance
 
     struct BookTicker
     {
-        Symbol   symbol {}; //               <---------- REMOVE
+        InstrumentId instrument { UnknownInstrument };
         Price    bidPrice { 0.0 };
         Quantity bidQuantity { 0.0 };
         Price    askPrice { 0.0 };
@@ -160,7 +178,7 @@ namespace market_data::binance
 
     struct DepthUpdate
     {
-        Symbol symbol {}; //               <---------- REMOVE
+        InstrumentId instrument { UnknownInstrument };
         Timestamp firstUpdateId { 0 };
         Timestamp finalUpdateId { 0 };
         Timestamp eventTime { 0 };
@@ -177,7 +195,7 @@ namespace market_data::binance
 
     struct Ticker
     {
-        Symbol symbol;
+        InstrumentId instrument { UnknownInstrument };
         std::string eventType;
         Timestamp eventTime { 0 };
         Price priceChange   { 0.0 };
@@ -204,7 +222,7 @@ namespace market_data::binance
 
     struct Trade
     {
-        Symbol symbol;
+        InstrumentId instrument { UnknownInstrument };
         Timestamp eventTime { 0 };
         Number tradeId { 0 };
         Price price { 0.0 };
@@ -217,7 +235,7 @@ namespace market_data::binance
 
     struct AggTrade
     {
-        Symbol symbol;
+        InstrumentId instrument { UnknownInstrument };
         Timestamp eventTime { 0 };
         Number aggregateTradeId { 0 };
         Price price { 0.0 };
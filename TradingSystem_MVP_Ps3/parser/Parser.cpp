@@ -20,7 +20,7 @@ namespace
 
 namespace parser
 {
-    BinanceMarketEvent parseEventData(const nlohmann::json& jsonData)
+    BinanceMarketEvent parseEventData(const nlohmann::json& jsonData, const InstrumentResolver& resolver)
     {
         std::string_view stream = jsonData[JsonParams::stream].get<std::string_view>();
         const size_t pos = stream.find('@');
@@ -28,26 +28,29 @@ namespace parser
 
         const nlohmann::json& data = jsonData[JsonParams::data];
         if (stream.starts_with(StreamNames::miniTicker))
-            return BinanceParserJson::parseMiniTicker(data);
+            return BinanceParserJson::parseMiniTicker(data, resolver);
         if (stream.starts_with(StreamNames::bookTicker))
-            return BinanceParserJson::parseBookTicker(data);
+            return BinanceParserJson::parseBookTicker(data, resolver);
         if (stream.starts_with(StreamNames::trade))
-            return BinanceParserJson::parseTrade(data);
+            return BinanceParserJson::parseTrade(data, resolver);
         if (stream.starts_with(StreamNames::aggTrade))
-            return BinanceParserJson::parseAggTrade(data);
+            return BinanceParserJson::parseAggTrade(data, resolver);
         if (stream.starts_with(StreamNames::depth))
-            return BinanceParserJson::parseDepthUpdate(data);
+            return BinanceParserJson::parseDepthUpdate(data, resolver);
 
         return NoYetImplemented { std::string(stream) };
     }
 
+    BinanceParser::BinanceParser(const InstrumentResolver& resolver): resolver { &resolver } {
+    }
+
     BinanceMarketEvent BinanceParser::parse(const buffer::Buffer& buffer) const
     {
         std::cout << "BinanceParser [CPU: " << utilities::getCpu() << "] : " << buffer.length() << std::endl;
 
         // TODO: Need to be optimised --> SIMD-Json
         const nlohmann::json jsonData = nlohmann::json::parse(buffer.head(), buffer.tail());
-        return parseEventData(jsonData);
+        return parseEventData(jsonData, *resolver);
     }
 }
 
@@ -16,12 +16,20 @@ Description : Parser.hpp
 namespace parser
 {
     using market_data::binance::BinanceMarketEvent;
+    using market_data::binance::InstrumentResolver;
 
     // TODO: Create ::parse(buffer) concepts for Parser
 
     struct BinanceParser
     {
+        BinanceParser() = default;
+        explicit BinanceParser(const InstrumentResolver& resolver);
+
         BinanceMarketEvent parse(const buffer::Buffer& buffer) const;
+
+    private:
+        // The parser is copied into the ExchangeDataProcessor: the table is referenced, not copied
+        const InstrumentResolver* resolver { &market_data::binance::instrumentResolver };
     };
 
     struct ByBitParser
@@ -173,7 +173,8 @@ namespace pricer_test
         for (const auto& entry: data)
         {
             const nlohmann::json jsonData = nlohmann::json::parse(entry);
-            BinanceMarketEvent event = BinanceParserJson::parseDepthUpdate(jsonData[JsonParams::data]);
+            BinanceMarketEvent event = BinanceParserJson::parseDepthUpdate(
+                jsonData[JsonParams::data], market_data::binance::instrumentResolver);
             std::visit(eventPrinter, event);
 
             std::cout << n++ << std::endl;
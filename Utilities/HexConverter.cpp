@@ -9,6 +9,7 @@ Description : HexConverter
 
 #include "HexConverter.hpp"
 
+#include <algorithm>
 #include <string_view>
 #include <vector>
 #include <array>
@@ -16,9 +17,14 @@ Description : HexConverter
 #include <iostream>
 #include <cstring>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace
 {
     constexpr std::array<char, 16> table { '0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F'};
+    constexpr std::array<char, 16> lowerTable { '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f'};
 }
 
 namespace HexConverter
@@ -58,6 +64,37 @@ namespace HexConverter
     }
 
 
+    void bytesToLowerHex(const uint8_t *src,
+                         size_t len,
+                         char *dest) noexcept
+    {
+#if defined(__SSE2__)
+        /** Nibble n becomes '0' + n, plus ('a' - '0' - 10) when n > 9 **/
+        const __m128i lowNibbles = _mm_set1_epi8(0x0f);
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i letterOffset = _mm_set1_epi8('a' - '0' - 10);
+
+        const auto toHex = [&](const __m128i nibbles) {
+            const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letterOffset);
+            return _mm_add_epi8(_mm_add_epi8(nibbles, zero), letters);
+        };
+
+        for (; len >= 16; len -= 16, src += 16, dest += 32) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i high = toHex(_mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibbles));
+            const __m128i low = toHex(_mm_and_si128(bytes, lowNibbles));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_unpackhi_epi8(high, low));
+        }
+#endif
+        for (; len > 0; --len) {
+            const uint8_t ch = *src++;
+            *dest++ = lowerTable[ch >> 4];
+            *dest++ = lowerTable[ch & 0x0f];
+        }
+    }
+
     static constexpr uint8_t hexCode(unsigned char symbol) noexcept
     {
         if (symbol >= '0' && symbol <= '9')
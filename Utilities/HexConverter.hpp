@@ -11,6 +11,7 @@ Description : HexConverter
 #define HEXCONVERTER_H
 
 #include <string>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -21,6 +22,15 @@ namespace HexConverter
 
     std::string bytesToHex(const std::string& bytesStr);
 
+    /**
+     * Writes 2 * len lowercase hex digits of [src, src + len) into dest,
+     * without a terminating null character. Allocates nothing; 16 bytes per
+     * step with SSE2 (always available on x86-64).
+     */
+    void bytesToLowerHex(const uint8_t *src,
+                         size_t len,
+                         char *dest) noexcept;
+
     [[nodiscard]]
     std::string intToHex(int value);
 